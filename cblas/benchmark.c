@@ -0,0 +1,137 @@
+/* blas/benchmark.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* GFLOP/s of cblas_dgemm and cblas_zgemm against the unblocked triple
+ * loops they replace for large matrices.
+ *
+ * usage: benchmark [nmax]
+ *
+ * Square row-major products C := A*B are timed for n = 32, 64, ...,
+ * nmax (default 1024). Build with "make benchmark". */
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <gsl/gsl_cblas.h>
+
+static void
+ref_dgemm (int n, const double *A, const double *B, double *C)
+{
+  int i, j, k;
+
+  for (i = 0; i < n * n; i++)
+    C[i] = 0.0;
+
+  for (k = 0; k < n; k++)
+    {
+      for (i = 0; i < n; i++)
+        {
+          const double temp = A[n * i + k];
+          if (temp != 0.0)
+            {
+              for (j = 0; j < n; j++)
+                C[n * i + j] += temp * B[n * k + j];
+            }
+        }
+    }
+}
+
+static void
+ref_zgemm (int n, const double *A, const double *B, double *C)
+{
+  int i, j, k;
+
+  for (i = 0; i < 2 * n * n; i++)
+    C[i] = 0.0;
+
+  for (k = 0; k < n; k++)
+    {
+      for (i = 0; i < n; i++)
+        {
+          const double t_real = A[2 * (n * i + k)];
+          const double t_imag = A[2 * (n * i + k) + 1];
+          for (j = 0; j < n; j++)
+            {
+              const double b_real = B[2 * (n * k + j)];
+              const double b_imag = B[2 * (n * k + j) + 1];
+              C[2 * (n * i + j)] += t_real * b_real - t_imag * b_imag;
+              C[2 * (n * i + j) + 1] += t_real * b_imag + t_imag * b_real;
+            }
+        }
+    }
+}
+
+/* repeat until at least 0.5 seconds have elapsed and return GFLOP/s */
+#define TIME_GFLOPS(call, flops, result)                             \
+  do {                                                               \
+    clock_t start = clock (), end;                                   \
+    size_t count = 0;                                                \
+    do { call; count++; end = clock (); }                            \
+    while (end - start < CLOCKS_PER_SEC / 2);                        \
+    result = (flops) * count / ((double) (end - start) / CLOCKS_PER_SEC) * 1.0e-9; \
+  } while (0)
+
+int
+main (int argc, char *argv[])
+{
+  const double alpha[2] = { 1.0, 0.0 };
+  const double beta[2] = { 0.0, 0.0 };
+  int nmax = 1024;
+  int n, i;
+
+  if (argc == 2)
+    nmax = strtol (argv[1], NULL, 0);
+
+  printf ("%6s %12s %12s %12s %12s\n", "n", "dgemm", "dgemm(ref)",
+          "zgemm", "zgemm(ref)");
+
+  for (n = 32; n <= nmax; n *= 2)
+    {
+      double *A = malloc (2 * (size_t) n * n * sizeof (double));
+      double *B = malloc (2 * (size_t) n * n * sizeof (double));
+      double *C = malloc (2 * (size_t) n * n * sizeof (double));
+      const double flops = 2.0 * n * n * (double) n;
+      double d_new, d_ref, z_new, z_ref;
+
+      for (i = 0; i < 2 * n * n; i++)
+        {
+          A[i] = (double) rand () / RAND_MAX - 0.5;
+          B[i] = (double) rand () / RAND_MAX - 0.5;
+        }
+
+      TIME_GFLOPS (cblas_dgemm (CblasRowMajor, CblasNoTrans, CblasNoTrans,
+                                n, n, n, 1.0, A, n, B, n, 0.0, C, n),
+                   flops, d_new);
+      TIME_GFLOPS (ref_dgemm (n, A, B, C), flops, d_ref);
+      TIME_GFLOPS (cblas_zgemm (CblasRowMajor, CblasNoTrans, CblasNoTrans,
+                                n, n, n, alpha, A, n, B, n, beta, C, n),
+                   4.0 * flops, z_new);
+      TIME_GFLOPS (ref_zgemm (n, A, B, C), 4.0 * flops, z_ref);
+
+      printf ("%6d %12.3f %12.3f %12.3f %12.3f\n", n, d_new, d_ref, z_new, z_ref);
+      fflush (stdout);
+
+      free (A);
+      free (B);
+      free (C);
+    }
+
+  return 0;
+}
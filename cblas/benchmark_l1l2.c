@@ -0,0 +1,103 @@
+/* blas/benchmark.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* GFLOP/s of the unit stride level 1 and level 2 routines which use the
+ * SIMD kernels of simd.c.
+ *
+ * usage: benchmark_l1l2 [nmax]
+ *
+ * Vectors of length n = 64, 256, ..., nmax (default 4194304) and square
+ * row-major matrices of the same number of elements are used, so the
+ * table shows the transition from cache to memory bandwidth.  The
+ * kernels in use are printed first; set GSL_SIMD=generic to
+ * obtain the portable loops for comparison.  Build with
+ * "make benchmark_l1l2". */
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include <gsl/gsl_cblas.h>
+
+#include "simd.h"
+
+/* repeat until at least 0.2 seconds have elapsed and return GFLOP/s */
+#define TIME_GFLOPS(call, flops, result)                             \
+  do {                                                               \
+    clock_t start = clock (), end;                                   \
+    size_t count = 0;                                                \
+    do { call; count++; end = clock (); }                            \
+    while (end - start < CLOCKS_PER_SEC / 5);                        \
+    result = (flops) * count / ((double) (end - start) / CLOCKS_PER_SEC) * 1.0e-9; \
+  } while (0)
+
+int
+main (int argc, char *argv[])
+{
+  int nmax = 4194304;
+  int n, i;
+  volatile double sink = 0.0;
+
+  if (argc == 2)
+    nmax = strtol (argv[1], NULL, 0);
+
+  printf ("kernels: %s\n", cblas_simd_get ()->name);
+  printf ("%9s %9s %9s %9s %9s %9s %9s\n", "n", "ddot", "daxpy", "dnrm2",
+          "dgemv(N)", "dgemv(T)", "dger");
+
+  for (n = 64; n <= nmax; n *= 4)
+    {
+      const int m = (int) sqrt ((double) n);
+      double *X = malloc ((size_t) n * sizeof (double));
+      double *Y = malloc ((size_t) n * sizeof (double));
+      double *A = malloc ((size_t) m * m * sizeof (double));
+      double dot, axpy, nrm2, gemv_n, gemv_t, ger;
+
+      for (i = 0; i < n; i++)
+        {
+          X[i] = (double) rand () / RAND_MAX - 0.5;
+          Y[i] = (double) rand () / RAND_MAX - 0.5;
+        }
+
+      for (i = 0; i < m * m; i++)
+        A[i] = (double) rand () / RAND_MAX - 0.5;
+
+      TIME_GFLOPS (sink += cblas_ddot (n, X, 1, Y, 1), 2.0 * n, dot);
+      TIME_GFLOPS (cblas_daxpy (n, 1.0e-9, X, 1, Y, 1), 2.0 * n, axpy);
+      TIME_GFLOPS (sink += cblas_dnrm2 (n, X, 1), 2.0 * n, nrm2);
+      TIME_GFLOPS (cblas_dgemv (CblasRowMajor, CblasNoTrans, m, m, 1.0, A, m,
+                                X, 1, 0.5, Y, 1), 2.0 * m * m, gemv_n);
+      TIME_GFLOPS (cblas_dgemv (CblasRowMajor, CblasTrans, m, m, 1.0, A, m,
+                                X, 1, 0.5, Y, 1), 2.0 * m * m, gemv_t);
+      TIME_GFLOPS (cblas_dger (CblasRowMajor, m, m, 1.0e-9, X, 1, Y, 1, A, m),
+                   2.0 * m * m, ger);
+
+      printf ("%9d %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f\n", n, dot, axpy, nrm2,
+              gemv_n, gemv_t, ger);
+      fflush (stdout);
+
+      free (X);
+      free (Y);
+      free (A);
+    }
+
+  (void) sink;
+  return 0;
+}
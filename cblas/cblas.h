@@ -29,6 +29,71 @@
 /* #define TBUP(N,i,j) */
 /* #define TBLO(N,i,j) */
 
+/* Blocking parameters for the packed GEMM (source_gemm_blocked_*.h).
+   MR x NR is the register tile of the micro-kernel, MC x KC the packed
+   block of A which should fit in L2 and KC x NC the packed panel of B
+   which should fit in L3.  Products with fewer than GEMM_BLOCK_MIN
+   multiply-adds use the unblocked loops, since packing does not pay
+   off for them. */
+
+#define GEMM_MR 4
+#define GEMM_NR 4
+#define GEMM_MR_C 2
+#define GEMM_NR_C 2
+#define GEMM_MC 96
+#define GEMM_KC 256
+#define GEMM_NC 4096
+#define GEMM_BLOCK_MIN 32768.0
+
+#define GEMM_MIN(a,b) ((a) < (b) ? (a) : (b))
+#define GEMM_ROUNDUP(n,r) ((((n) + (r) - 1) / (r)) * (r))
+#define GEMM_USE_BLOCKED(n1,n2,K) ((double) (n1) * (n2) * (K) >= GEMM_BLOCK_MIN)
+
+/* Minimum number of floating point operations given to each thread by
+   the multithreaded level 3 routines (source_*_thread.h) */
+
+#define CBLAS_THREAD_MIN_FLOPS 2.0e6
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* number of threads to use for an operation of about 'flops' floating
+   point operations; calls made from within a parallel region, either
+   our own or the caller's, always run on a single thread */
+static inline int
+cblas_thread_count (const double flops)
+{
+#ifdef _OPENMP
+  int nthreads = cblas_get_num_threads ();
+
+  if (nthreads <= 1 || omp_in_parallel ())
+    return 1;
+
+  if (flops < (double) nthreads * CBLAS_THREAD_MIN_FLOPS)
+    nthreads = (int) (flops / CBLAS_THREAD_MIN_FLOPS);
+
+  return (nthreads > 1) ? nthreads : 1;
+#else
+  (void) flops;
+  return 1;
+#endif
+}
+
+/* start of slice t (0 <= t <= nthreads) when n is split into nthreads
+   contiguous slices, rounded to the GEMM register tile */
+static inline int
+cblas_thread_split (const int n, const int nthreads, const int t)
+{
+  if (t >= nthreads)
+    return n;
+  else
+    {
+      const int s = (int) (((double) n * t) / nthreads);
+      return (s / GEMM_MR) * GEMM_MR;
+    }
+}
+
 #define TPUP(N,i,j) (TRCOUNT(N,(i)-1)+(j)-(i))
 #define TPLO(N,i,j) (((i)*((i)+1))/2 + (j))
 
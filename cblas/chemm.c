@@ -9,7 +9,9 @@ cblas_chemm (const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side,
              const void *alpha, const void *A, const int lda, const void *B,
              const int ldb, const void *beta, void *C, const int ldc)
 {
+#define CBLAS_FN cblas_chemm
 #define BASE float
 #include "source_hemm.h"
 #undef BASE
+#undef CBLAS_FN
 }
@@ -9,7 +9,11 @@ cblas_cherk (const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo,
              const float alpha, const void *A, const int lda,
              const float beta, void *C, const int ldc)
 {
+#define CBLAS_FN cblas_cherk
+#define CBLAS_GEMM_FN cblas_cgemm
 #define BASE float
 #include "source_herk.h"
 #undef BASE
+#undef CBLAS_FN
+#undef CBLAS_GEMM_FN
 }
@@ -12,7 +12,9 @@ cblas_ctrsm (const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side,
              const void *alpha, const void *A, const int lda, void *B,
              const int ldb)
 {
+#define CBLAS_FN cblas_ctrsm
 #define BASE float
 #include "source_trsm_c.h"
 #undef BASE
+#undef CBLAS_FN
 }
@@ -1,12 +1,15 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "simd.h"
 
 void
 cblas_daxpy (const int N, const double alpha, const double *X, const int incX,
              double *Y, const int incY)
 {
+#define AXPY_UNIT(N,alpha,X,Y) (cblas_simd_get ()->daxpy (N, alpha, X, Y))
 #define BASE double
 #include "source_axpy_r.h"
 #undef BASE
+#undef AXPY_UNIT
 }
@@ -1,6 +1,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "simd.h"
 
 double
 cblas_ddot (const int N, const double *X, const int incX, const double *Y,
@@ -8,9 +9,11 @@ cblas_ddot (const int N, const double *X, const int incX, const double *Y,
 {
 #define INIT_VAL  0.0
 #define ACC_TYPE  double
+#define DOT_UNIT(N,X,Y) (cblas_simd_get ()->ddot (N, X, Y))
 #define BASE double
 #include "source_dot_r.h"
 #undef ACC_TYPE
 #undef BASE
+#undef DOT_UNIT
 #undef INIT_VAL
 }
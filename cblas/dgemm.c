@@ -1,3 +1,4 @@
+#include <stdlib.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
@@ -10,7 +11,9 @@ cblas_dgemm (const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA,
              const double *B, const int ldb, const double beta, double *C,
              const int ldc)
 {
+#define CBLAS_FN cblas_dgemm
 #define BASE double
 #include "source_gemm_r.h"
 #undef BASE
+#undef CBLAS_FN
 }
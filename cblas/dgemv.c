@@ -1,6 +1,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "simd.h"
 #include "error_cblas_l2.h"
 
 void
@@ -9,7 +10,11 @@ cblas_dgemv (const enum CBLAS_ORDER order, const enum CBLAS_TRANSPOSE TransA,
              const int lda, const double *X, const int incX,
              const double beta, double *Y, const int incY)
 {
+#define DOT_UNIT(N,X,Y) (cblas_simd_get ()->ddot (N, X, Y))
+#define AXPY_UNIT(N,alpha,X,Y) (cblas_simd_get ()->daxpy (N, alpha, X, Y))
 #define BASE double
 #include "source_gemv_r.h"
 #undef BASE
+#undef DOT_UNIT
+#undef AXPY_UNIT
 }
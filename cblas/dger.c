@@ -1,6 +1,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "simd.h"
 #include "error_cblas_l2.h"
 
 void
@@ -8,7 +9,9 @@ cblas_dger (const enum CBLAS_ORDER order, const int M, const int N,
             const double alpha, const double *X, const int incX,
             const double *Y, const int incY, double *A, const int lda)
 {
+#define AXPY_UNIT(N,alpha,X,Y) (cblas_simd_get ()->daxpy (N, alpha, X, Y))
 #define BASE double
 #include "source_ger.h"
 #undef BASE
+#undef AXPY_UNIT
 }
@@ -1,11 +1,19 @@
+#include <float.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "simd.h"
 
 double
 cblas_dnrm2 (const int N, const double *X, const int incX)
 {
+#define SSQ_UNIT(N,X) (cblas_simd_get ()->dssq (N, X))
+#define SSQ_MIN (DBL_MIN / DBL_EPSILON)
+#define SSQ_MAX DBL_MAX
 #define BASE double
 #include "source_nrm2_r.h"
 #undef BASE
+#undef SSQ_UNIT
+#undef SSQ_MIN
+#undef SSQ_MAX
 }
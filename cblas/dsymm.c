@@ -10,7 +10,9 @@ cblas_dsymm (const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side,
              const double *B, const int ldb, const double beta, double *C,
              const int ldc)
 {
+#define CBLAS_FN cblas_dsymm
 #define BASE double
 #include "source_symm_r.h"
 #undef BASE
+#undef CBLAS_FN
 }
@@ -9,7 +9,11 @@ cblas_dsyrk (const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo,
              const double alpha, const double *A, const int lda,
              const double beta, double *C, const int ldc)
 {
+#define CBLAS_FN cblas_dsyrk
+#define CBLAS_GEMM_FN cblas_dgemm
 #define BASE double
 #include "source_syrk_r.h"
 #undef BASE
+#undef CBLAS_FN
+#undef CBLAS_GEMM_FN
 }
@@ -10,7 +10,9 @@ cblas_dtrmm (const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side,
              const double alpha, const double *A, const int lda, double *B,
              const int ldb)
 {
+#define CBLAS_FN cblas_dtrmm
 #define BASE double
 #include "source_trmm_r.h"
 #undef BASE
+#undef CBLAS_FN
 }
@@ -599,6 +599,15 @@ void cblas_zher2k(const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo,
                   const void *B, const int ldb, const double beta,
                   void *C, const int ldc);
 
+/*
+ * ===========================================================================
+ * Thread control for the level 3 routines (GSL extension)
+ * ===========================================================================
+ */
+
+void cblas_set_num_threads(const int n);
+int cblas_get_num_threads(void);
+
 void cblas_xerbla(int p, const char *rout, const char *form, ...);
 
 __END_DECLS
@@ -1,12 +1,15 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "simd.h"
 
 void
 cblas_saxpy (const int N, const float alpha, const float *X, const int incX,
              float *Y, const int incY)
 {
+#define AXPY_UNIT(N,alpha,X,Y) (cblas_simd_get ()->saxpy (N, alpha, X, Y))
 #define BASE float
 #include "source_axpy_r.h"
 #undef BASE
+#undef AXPY_UNIT
 }
@@ -1,6 +1,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "simd.h"
 
 float
 cblas_sdot (const int N, const float *X, const int incX, const float *Y,
@@ -8,9 +9,11 @@ cblas_sdot (const int N, const float *X, const int incX, const float *Y,
 {
 #define INIT_VAL  0.0
 #define ACC_TYPE  float
+#define DOT_UNIT(N,X,Y) (cblas_simd_get ()->sdot (N, X, Y))
 #define BASE float
 #include "source_dot_r.h"
 #undef ACC_TYPE
 #undef BASE
+#undef DOT_UNIT
 #undef INIT_VAL
 }
@@ -1,3 +1,4 @@
+#include <stdlib.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
@@ -10,7 +11,9 @@ cblas_sgemm (const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA,
              const float *B, const int ldb, const float beta, float *C,
              const int ldc)
 {
+#define CBLAS_FN cblas_sgemm
 #define BASE float
 #include "source_gemm_r.h"
 #undef BASE
+#undef CBLAS_FN
 }
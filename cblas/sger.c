@@ -1,6 +1,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "simd.h"
 #include "error_cblas_l2.h"
 
 void
@@ -8,7 +9,9 @@ cblas_sger (const enum CBLAS_ORDER order, const int M, const int N,
             const float alpha, const float *X, const int incX, const float *Y,
             const int incY, float *A, const int lda)
 {
+#define AXPY_UNIT(N,alpha,X,Y) (cblas_simd_get ()->saxpy (N, alpha, X, Y))
 #define BASE float
 #include "source_ger.h"
 #undef BASE
+#undef AXPY_UNIT
 }
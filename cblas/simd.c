@@ -0,0 +1,317 @@
+/* blas/simd.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Runtime selection of the unit stride level 1 kernels.  On x86 the
+ * widest of AVX-512F, AVX2+FMA and SSE2 supported by the CPU (as
+ * reported by cpuid) is used; elsewhere, or when the compiler cannot
+ * build the kernels, the portable loops below are used.  The choice can
+ * be capped with the environment variable GSL_SIMD (see simd_level.h). */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <gsl/gsl_cblas.h>
+#include "simd_level.h"
+#include "cblas.h"
+#include "simd.h"
+
+#define KERNEL_X(prefix,name,suffix) prefix ## name ## _ ## suffix
+#define KERNEL_Y(prefix,name,suffix) KERNEL_X(prefix,name,suffix)
+
+/* portable kernels, in the same order of operations as the reference
+   loops */
+
+static double
+ddot_generic (const int N, const double *X, const double *Y)
+{
+  double r = 0.0;
+  int i;
+
+  for (i = 0; i < N; i++)
+    r += X[i] * Y[i];
+
+  return r;
+}
+
+static float
+sdot_generic (const int N, const float *X, const float *Y)
+{
+  float r = 0.0;
+  int i;
+
+  for (i = 0; i < N; i++)
+    r += X[i] * Y[i];
+
+  return r;
+}
+
+static double
+dssq_generic (const int N, const double *X)
+{
+  double r = 0.0;
+  int i;
+
+  for (i = 0; i < N; i++)
+    r += X[i] * X[i];
+
+  return r;
+}
+
+static float
+sssq_generic (const int N, const float *X)
+{
+  float r = 0.0;
+  int i;
+
+  for (i = 0; i < N; i++)
+    r += X[i] * X[i];
+
+  return r;
+}
+
+static void
+daxpy_generic (const int N, const double alpha, const double *X, double *Y)
+{
+  int i;
+
+  for (i = 0; i < N; i++)
+    Y[i] += alpha * X[i];
+}
+
+static void
+saxpy_generic (const int N, const float alpha, const float *X, float *Y)
+{
+  int i;
+
+  for (i = 0; i < N; i++)
+    Y[i] += alpha * X[i];
+}
+
+static const cblas_simd_kernels kernels_generic =
+  { "generic", ddot_generic, sdot_generic, daxpy_generic, saxpy_generic,
+    dssq_generic, sssq_generic };
+
+#ifdef HAVE_X86_SIMD_DISPATCH
+
+#include <immintrin.h>
+
+/* SSE2 */
+
+#define TARGET __attribute__ ((target ("sse2")))
+#define TARGET_AXPY TARGET
+#define VZERO() _mm_setzero_pd ()
+#define VLOAD(p) _mm_loadu_pd (p)
+#define VSTORE(p,v) _mm_storeu_pd (p, v)
+#define VSET1(x) _mm_set1_pd (x)
+#define VADD(a,b) _mm_add_pd (a, b)
+#define VMUL(a,b) _mm_mul_pd (a, b)
+#define VMADD(a,b,c) _mm_add_pd (_mm_mul_pd (a, b), c)
+#define BASE double
+#define VEC __m128d
+#define VLEN 2
+#define KERNEL(name) KERNEL_Y(d,name,sse2)
+#include "simd_source.h"
+#undef KERNEL
+#undef VLEN
+#undef VEC
+#undef BASE
+#undef VZERO
+#undef VLOAD
+#undef VSTORE
+#undef VSET1
+#undef VADD
+#undef VMUL
+#undef VMADD
+
+#define VZERO() _mm_setzero_ps ()
+#define VLOAD(p) _mm_loadu_ps (p)
+#define VSTORE(p,v) _mm_storeu_ps (p, v)
+#define VSET1(x) _mm_set1_ps (x)
+#define VADD(a,b) _mm_add_ps (a, b)
+#define VMUL(a,b) _mm_mul_ps (a, b)
+#define VMADD(a,b,c) _mm_add_ps (_mm_mul_ps (a, b), c)
+#define BASE float
+#define VEC __m128
+#define VLEN 4
+#define KERNEL(name) KERNEL_Y(s,name,sse2)
+#include "simd_source.h"
+#undef KERNEL
+#undef VLEN
+#undef VEC
+#undef BASE
+#undef VZERO
+#undef VLOAD
+#undef VSTORE
+#undef VSET1
+#undef VADD
+#undef VMUL
+#undef VMADD
+#undef TARGET_AXPY
+#undef TARGET
+
+/* AVX2 and FMA; axpy is built without FMA */
+
+#define TARGET __attribute__ ((target ("avx2,fma")))
+#define TARGET_AXPY __attribute__ ((target ("avx2")))
+#define VZERO() _mm256_setzero_pd ()
+#define VLOAD(p) _mm256_loadu_pd (p)
+#define VSTORE(p,v) _mm256_storeu_pd (p, v)
+#define VSET1(x) _mm256_set1_pd (x)
+#define VADD(a,b) _mm256_add_pd (a, b)
+#define VMUL(a,b) _mm256_mul_pd (a, b)
+#define VMADD(a,b,c) _mm256_fmadd_pd (a, b, c)
+#define BASE double
+#define VEC __m256d
+#define VLEN 4
+#define KERNEL(name) KERNEL_Y(d,name,avx2)
+#include "simd_source.h"
+#undef KERNEL
+#undef VLEN
+#undef VEC
+#undef BASE
+#undef VZERO
+#undef VLOAD
+#undef VSTORE
+#undef VSET1
+#undef VADD
+#undef VMUL
+#undef VMADD
+
+#define VZERO() _mm256_setzero_ps ()
+#define VLOAD(p) _mm256_loadu_ps (p)
+#define VSTORE(p,v) _mm256_storeu_ps (p, v)
+#define VSET1(x) _mm256_set1_ps (x)
+#define VADD(a,b) _mm256_add_ps (a, b)
+#define VMUL(a,b) _mm256_mul_ps (a, b)
+#define VMADD(a,b,c) _mm256_fmadd_ps (a, b, c)
+#define BASE float
+#define VEC __m256
+#define VLEN 8
+#define KERNEL(name) KERNEL_Y(s,name,avx2)
+#include "simd_source.h"
+#undef KERNEL
+#undef VLEN
+#undef VEC
+#undef BASE
+#undef VZERO
+#undef VLOAD
+#undef VSTORE
+#undef VSET1
+#undef VADD
+#undef VMUL
+#undef VMADD
+#undef TARGET_AXPY
+#undef TARGET
+
+/* AVX-512F; axpy is memory bound and uses the AVX2 kernel, which also
+   avoids fused operations */
+
+#define NO_AXPY
+#define TARGET __attribute__ ((target ("avx512f")))
+#define VZERO() _mm512_setzero_pd ()
+#define VLOAD(p) _mm512_loadu_pd (p)
+#define VSTORE(p,v) _mm512_storeu_pd (p, v)
+#define VADD(a,b) _mm512_add_pd (a, b)
+#define VMADD(a,b,c) _mm512_fmadd_pd (a, b, c)
+#define BASE double
+#define VEC __m512d
+#define VLEN 8
+#define KERNEL(name) KERNEL_Y(d,name,avx512)
+#include "simd_source.h"
+#undef KERNEL
+#undef VLEN
+#undef VEC
+#undef BASE
+#undef VZERO
+#undef VLOAD
+#undef VSTORE
+#undef VADD
+#undef VMADD
+
+#define VZERO() _mm512_setzero_ps ()
+#define VLOAD(p) _mm512_loadu_ps (p)
+#define VSTORE(p,v) _mm512_storeu_ps (p, v)
+#define VADD(a,b) _mm512_add_ps (a, b)
+#define VMADD(a,b,c) _mm512_fmadd_ps (a, b, c)
+#define BASE float
+#define VEC __m512
+#define VLEN 16
+#define KERNEL(name) KERNEL_Y(s,name,avx512)
+#include "simd_source.h"
+#undef KERNEL
+#undef VLEN
+#undef VEC
+#undef BASE
+#undef VZERO
+#undef VLOAD
+#undef VSTORE
+#undef VADD
+#undef VMADD
+#undef TARGET
+#undef NO_AXPY
+
+static const cblas_simd_kernels kernels_sse2 =
+  { "sse2", ddot_sse2, sdot_sse2, daxpy_sse2, saxpy_sse2,
+    dssq_sse2, sssq_sse2 };
+
+static const cblas_simd_kernels kernels_avx2 =
+  { "avx2", ddot_avx2, sdot_avx2, daxpy_avx2, saxpy_avx2,
+    dssq_avx2, sssq_avx2 };
+
+static const cblas_simd_kernels kernels_avx512 =
+  { "avx512", ddot_avx512, sdot_avx512, daxpy_avx2, saxpy_avx2,
+    dssq_avx512, sssq_avx512 };
+
+#endif /* HAVE_X86_SIMD_DISPATCH */
+
+static const cblas_simd_kernels *
+simd_select (void)
+{
+  const int level = simd_level ();
+
+#ifdef HAVE_X86_SIMD_DISPATCH
+  switch (level)
+    {
+    case SIMD_AVX512:
+      return &kernels_avx512;
+
+    case SIMD_AVX2:
+      return &kernels_avx2;
+
+    case SIMD_SSE2:
+      return &kernels_sse2;
+    }
+#endif
+
+  (void) level;
+  return &kernels_generic;
+}
+
+static const cblas_simd_kernels *simd_kernels = NULL;
+
+const cblas_simd_kernels *
+cblas_simd_get (void)
+{
+  /* concurrent first calls make the same choice, so the race is benign */
+  if (simd_kernels == NULL)
+    simd_kernels = simd_select ();
+
+  return simd_kernels;
+}
@@ -0,0 +1,53 @@
+/* blas/simd.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __CBLAS_SIMD_H__
+#define __CBLAS_SIMD_H__
+
+/* Unit stride level 1 kernels used by the level 1 and level 2
+ * routines.  The table is selected on first use according to the
+ * instruction sets supported by the CPU (see simd.c).
+ *
+ * The axpy kernels give results identical to the reference loops.
+ * The dot and sum of squares kernels use several partial sums, so their
+ * results may differ from a sequential sum by rounding, within the usual
+ * bound n * eps * sum |x_i y_i|. */
+
+typedef struct
+{
+  const char *name;
+  double (*ddot) (const int N, const double *X, const double *Y);
+  float (*sdot) (const int N, const float *X, const float *Y);
+  void (*daxpy) (const int N, const double alpha, const double *X, double *Y);
+  void (*saxpy) (const int N, const float alpha, const float *X, float *Y);
+  double (*dssq) (const int N, const double *X);
+  float (*sssq) (const int N, const float *X);
+} cblas_simd_kernels;
+
+/* internal to libgslcblas: hidden from the dynamic symbol table, since
+   it is not part of the CBLAS interface */
+#if defined(__GNUC__) && __GNUC__ >= 4 && !defined(_WIN32) && !defined(__CYGWIN__)
+#define CBLAS_INTERNAL __attribute__ ((visibility ("hidden")))
+#else
+#define CBLAS_INTERNAL
+#endif
+
+CBLAS_INTERNAL const cblas_simd_kernels *cblas_simd_get (void);
+
+#endif /* __CBLAS_SIMD_H__ */
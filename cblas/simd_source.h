@@ -0,0 +1,123 @@
+/* blas/simd_source.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Unit stride kernels for one instruction set, included from simd.c
+ * with the vector type and operations defined as macros:
+ *
+ *   BASE, VEC, VLEN                 scalar type, vector type, lanes
+ *   VLOAD, VSTORE, VSET1, VZERO     unaligned load/store, broadcast, zero
+ *   VADD, VMUL, VMADD(a,b,c)        a+b, a*b, a*b+c (possibly fused)
+ *   TARGET, TARGET_AXPY             target attributes of the kernels
+ *   KERNEL(name)                    name of the kernel
+ *
+ * The axpy kernel uses separate multiplies and adds and is compiled for
+ * a target without FMA so that it reproduces the reference rounding. */
+
+/* sum of X[i]*Y[i]; four independent accumulators hide the latency of
+   the vector adds, the remainder is added sequentially */
+static BASE TARGET
+KERNEL (dot) (const int N, const BASE *X, const BASE *Y)
+{
+  VEC s0 = VZERO (), s1 = VZERO (), s2 = VZERO (), s3 = VZERO ();
+  BASE t[VLEN];
+  BASE r = 0.0;
+  int i = 0, k;
+
+  for (; i + 4 * VLEN <= N; i += 4 * VLEN)
+    {
+      s0 = VMADD (VLOAD (X + i), VLOAD (Y + i), s0);
+      s1 = VMADD (VLOAD (X + i + VLEN), VLOAD (Y + i + VLEN), s1);
+      s2 = VMADD (VLOAD (X + i + 2 * VLEN), VLOAD (Y + i + 2 * VLEN), s2);
+      s3 = VMADD (VLOAD (X + i + 3 * VLEN), VLOAD (Y + i + 3 * VLEN), s3);
+    }
+
+  for (; i + VLEN <= N; i += VLEN)
+    s0 = VMADD (VLOAD (X + i), VLOAD (Y + i), s0);
+
+  s0 = VADD (VADD (s0, s1), VADD (s2, s3));
+  VSTORE (t, s0);
+
+  for (k = 0; k < VLEN; k++)
+    r += t[k];
+
+  for (; i < N; i++)
+    r += X[i] * Y[i];
+
+  return r;
+}
+
+/* sum of X[i]^2 */
+static BASE TARGET
+KERNEL (ssq) (const int N, const BASE *X)
+{
+  VEC s0 = VZERO (), s1 = VZERO (), s2 = VZERO (), s3 = VZERO ();
+  BASE t[VLEN];
+  BASE r = 0.0;
+  int i = 0, k;
+
+  for (; i + 4 * VLEN <= N; i += 4 * VLEN)
+    {
+      const VEC x0 = VLOAD (X + i);
+      const VEC x1 = VLOAD (X + i + VLEN);
+      const VEC x2 = VLOAD (X + i + 2 * VLEN);
+      const VEC x3 = VLOAD (X + i + 3 * VLEN);
+      s0 = VMADD (x0, x0, s0);
+      s1 = VMADD (x1, x1, s1);
+      s2 = VMADD (x2, x2, s2);
+      s3 = VMADD (x3, x3, s3);
+    }
+
+  for (; i + VLEN <= N; i += VLEN)
+    {
+      const VEC x0 = VLOAD (X + i);
+      s0 = VMADD (x0, x0, s0);
+    }
+
+  s0 = VADD (VADD (s0, s1), VADD (s2, s3));
+  VSTORE (t, s0);
+
+  for (k = 0; k < VLEN; k++)
+    r += t[k];
+
+  for (; i < N; i++)
+    r += X[i] * X[i];
+
+  return r;
+}
+
+#ifndef NO_AXPY
+/* Y := alpha*X + Y */
+static void TARGET_AXPY
+KERNEL (axpy) (const int N, const BASE alpha, const BASE *X, BASE *Y)
+{
+  const VEC a = VSET1 (alpha);
+  int i = 0;
+
+  for (; i + 2 * VLEN <= N; i += 2 * VLEN)
+    {
+      const VEC y0 = VADD (VLOAD (Y + i), VMUL (a, VLOAD (X + i)));
+      const VEC y1 = VADD (VLOAD (Y + i + VLEN), VMUL (a, VLOAD (X + i + VLEN)));
+      VSTORE (Y + i, y0);
+      VSTORE (Y + i + VLEN, y1);
+    }
+
+  for (; i < N; i++)
+    Y[i] += alpha * X[i];
+}
+#endif
@@ -1,11 +1,19 @@
+#include <float.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
+#include "simd.h"
 
 float
 cblas_snrm2 (const int N, const float *X, const int incX)
 {
+#define SSQ_UNIT(N,X) (cblas_simd_get ()->sssq (N, X))
+#define SSQ_MIN (FLT_MIN / FLT_EPSILON)
+#define SSQ_MAX FLT_MAX
 #define BASE float
 #include "source_nrm2_r.h"
 #undef BASE
+#undef SSQ_UNIT
+#undef SSQ_MIN
+#undef SSQ_MAX
 }
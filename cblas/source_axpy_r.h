@@ -25,6 +25,9 @@
   }
 
   if (incX == 1 && incY == 1) {
+#ifdef AXPY_UNIT
+    AXPY_UNIT (N, alpha, X, Y);
+#else
     const INDEX m = N % 4;
 
     for (i = 0; i < m; i++) {
@@ -37,6 +40,7 @@
       Y[i + 2] += alpha * X[i + 2];
       Y[i + 3] += alpha * X[i + 3];
     }
+#endif
   } else {
     INDEX ix = OFFSET(N, incX);
     INDEX iy = OFFSET(N, incY);
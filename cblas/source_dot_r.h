@@ -23,6 +23,11 @@
   INDEX ix = OFFSET(N, incX);
   INDEX iy = OFFSET(N, incY);
 
+#ifdef DOT_UNIT
+  if (incX == 1 && incY == 1)
+    return DOT_UNIT (N, X, Y);
+#endif
+
   for (i = 0; i < N; i++) {
     r += X[ix] * Y[iy];
     ix += incX;
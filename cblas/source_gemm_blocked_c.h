@@ -0,0 +1,146 @@
+/* blas/source_gemm_blocked_c.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Cache blocked form of C := alpha*op(F)*op(G) + C for complex
+ * matrices, included from source_gemm_c.h once C has been scaled by
+ * beta.  See source_gemm_blocked_r.h for the structure; here the
+ * packed slivers hold interleaved (real,imag) pairs, and alpha and the
+ * conjugations are applied while packing.  The micro-kernel is written
+ * out for GEMM_MR_C = GEMM_NR_C = 2. */
+
+{
+  const INDEX mc_max = GEMM_ROUNDUP (GEMM_MIN (n1, GEMM_MC), GEMM_MR_C);
+  const INDEX nc_max = GEMM_ROUNDUP (GEMM_MIN (n2, GEMM_NC), GEMM_NR_C);
+  const INDEX kc_max = GEMM_MIN (K, GEMM_KC);
+  BASE *Ap = (BASE *) malloc (2 * (size_t) mc_max * kc_max * sizeof (BASE));
+  BASE *Bp = (BASE *) malloc (2 * (size_t) nc_max * kc_max * sizeof (BASE));
+
+  if (Ap != 0 && Bp != 0) {
+    INDEX jc, pc, ic, jr, ir, p;
+
+    for (jc = 0; jc < n2; jc += GEMM_NC) {
+      const INDEX nc = GEMM_MIN (n2 - jc, GEMM_NC);
+
+      for (pc = 0; pc < K; pc += GEMM_KC) {
+        const INDEX kc = GEMM_MIN (K - pc, GEMM_KC);
+
+        /* pack op(G)(pc:pc+kc, jc:jc+nc) into NR-wide slivers */
+
+        for (jr = 0; jr < nc; jr += GEMM_NR_C) {
+          const INDEX nr = GEMM_MIN (nc - jr, GEMM_NR_C);
+          BASE *b = Bp + 2 * jr * kc;
+
+          for (p = 0; p < kc; p++) {
+            for (j = 0; j < nr; j++) {
+              const INDEX idx = (TransG == CblasNoTrans)
+                ? ldg * (pc + p) + (jc + jr + j)
+                : ldg * (jc + jr + j) + (pc + p);
+              b[2 * j] = CONST_REAL (G, idx);
+              b[2 * j + 1] = conjG * CONST_IMAG (G, idx);
+            }
+            for (j = nr; j < GEMM_NR_C; j++) {
+              b[2 * j] = 0.0;
+              b[2 * j + 1] = 0.0;
+            }
+            b += 2 * GEMM_NR_C;
+          }
+        }
+
+        for (ic = 0; ic < n1; ic += GEMM_MC) {
+          const INDEX mc = GEMM_MIN (n1 - ic, GEMM_MC);
+
+          /* pack alpha*op(F)(ic:ic+mc, pc:pc+kc) into MR-high slivers */
+
+          for (ir = 0; ir < mc; ir += GEMM_MR_C) {
+            const INDEX mr = GEMM_MIN (mc - ir, GEMM_MR_C);
+            BASE *a = Ap + 2 * ir * kc;
+
+            for (p = 0; p < kc; p++) {
+              for (i = 0; i < mr; i++) {
+                const INDEX idx = (TransF == CblasNoTrans)
+                  ? ldf * (ic + ir + i) + (pc + p)
+                  : ldf * (pc + p) + (ic + ir + i);
+                const BASE F_real = CONST_REAL (F, idx);
+                const BASE F_imag = conjF * CONST_IMAG (F, idx);
+                a[2 * i] = alpha_real * F_real - alpha_imag * F_imag;
+                a[2 * i + 1] = alpha_real * F_imag + alpha_imag * F_real;
+              }
+              for (i = mr; i < GEMM_MR_C; i++) {
+                a[2 * i] = 0.0;
+                a[2 * i + 1] = 0.0;
+              }
+              a += 2 * GEMM_MR_C;
+            }
+          }
+
+          /* macro-kernel: sweep the packed block with the micro-kernel */
+
+          for (jr = 0; jr < nc; jr += GEMM_NR_C) {
+            const INDEX nr = GEMM_MIN (nc - jr, GEMM_NR_C);
+
+            for (ir = 0; ir < mc; ir += GEMM_MR_C) {
+              const INDEX mr = GEMM_MIN (mc - ir, GEMM_MR_C);
+              const BASE *a = Ap + 2 * ir * kc;
+              const BASE *b = Bp + 2 * jr * kc;
+              BASE ab00_r = 0.0, ab00_i = 0.0, ab01_r = 0.0, ab01_i = 0.0;
+              BASE ab10_r = 0.0, ab10_i = 0.0, ab11_r = 0.0, ab11_i = 0.0;
+
+              /* 2 x 2 complex micro-kernel, accumulated in registers */
+
+              for (p = 0; p < kc; p++) {
+                const BASE a0_r = a[0], a0_i = a[1], a1_r = a[2], a1_i = a[3];
+                const BASE b0_r = b[0], b0_i = b[1], b1_r = b[2], b1_i = b[3];
+                ab00_r += a0_r * b0_r - a0_i * b0_i;
+                ab00_i += a0_r * b0_i + a0_i * b0_r;
+                ab01_r += a0_r * b1_r - a0_i * b1_i;
+                ab01_i += a0_r * b1_i + a0_i * b1_r;
+                ab10_r += a1_r * b0_r - a1_i * b0_i;
+                ab10_i += a1_r * b0_i + a1_i * b0_r;
+                ab11_r += a1_r * b1_r - a1_i * b1_i;
+                ab11_i += a1_r * b1_i + a1_i * b1_r;
+                a += 2 * GEMM_MR_C;
+                b += 2 * GEMM_NR_C;
+              }
+
+              {
+                BASE ab[2 * GEMM_MR_C * GEMM_NR_C];
+
+                ab[0] = ab00_r; ab[1] = ab00_i; ab[2] = ab01_r; ab[3] = ab01_i;
+                ab[4] = ab10_r; ab[5] = ab10_i; ab[6] = ab11_r; ab[7] = ab11_i;
+
+                for (i = 0; i < mr; i++) {
+                  for (j = 0; j < nr; j++) {
+                    const INDEX idx = ldc * (ic + ir + i) + (jc + jr + j);
+                    REAL (C, idx) += ab[2 * (GEMM_NR_C * i + j)];
+                    IMAG (C, idx) += ab[2 * (GEMM_NR_C * i + j) + 1];
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+
+    blocked = 1;
+  }
+
+  free (Ap);
+  free (Bp);
+}
@@ -0,0 +1,156 @@
+/* blas/source_gemm_blocked_r.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Cache blocked form of C := alpha*op(F)*op(G) + C, included from
+ * source_gemm_r.h once C has been scaled by beta.
+ *
+ * A KC x NC panel of op(G) is packed into NR-wide slivers and an
+ * MC x KC block of alpha*op(F) is packed into MR-high slivers, so that
+ * the MR x NR micro-kernel streams through contiguous memory while the
+ * packed blocks stay resident in cache.  Partial slivers are padded
+ * with zeros, so the micro-kernel always works on a full tile and only
+ * the update of C is clipped.  The micro-kernel is written out for
+ * GEMM_MR = GEMM_NR = 4.  Sets "blocked" to 1 on success; if the
+ * packing buffers cannot be allocated C is left untouched and the
+ * caller uses the unblocked loops instead. */
+
+{
+  const INDEX mc_max = GEMM_ROUNDUP (GEMM_MIN (n1, GEMM_MC), GEMM_MR);
+  const INDEX nc_max = GEMM_ROUNDUP (GEMM_MIN (n2, GEMM_NC), GEMM_NR);
+  const INDEX kc_max = GEMM_MIN (K, GEMM_KC);
+  BASE *Ap = (BASE *) malloc ((size_t) mc_max * kc_max * sizeof (BASE));
+  BASE *Bp = (BASE *) malloc ((size_t) nc_max * kc_max * sizeof (BASE));
+
+  if (Ap != 0 && Bp != 0) {
+    INDEX jc, pc, ic, jr, ir, p;
+
+    for (jc = 0; jc < n2; jc += GEMM_NC) {
+      const INDEX nc = GEMM_MIN (n2 - jc, GEMM_NC);
+
+      for (pc = 0; pc < K; pc += GEMM_KC) {
+        const INDEX kc = GEMM_MIN (K - pc, GEMM_KC);
+
+        /* pack op(G)(pc:pc+kc, jc:jc+nc) into NR-wide slivers */
+
+        for (jr = 0; jr < nc; jr += GEMM_NR) {
+          const INDEX nr = GEMM_MIN (nc - jr, GEMM_NR);
+          BASE *b = Bp + jr * kc;
+
+          for (p = 0; p < kc; p++) {
+            if (TransG == CblasNoTrans) {
+              const BASE *g = G + ldg * (pc + p) + (jc + jr);
+              for (j = 0; j < nr; j++)
+                b[j] = g[j];
+            } else {
+              const BASE *g = G + ldg * (jc + jr) + (pc + p);
+              for (j = 0; j < nr; j++)
+                b[j] = g[ldg * j];
+            }
+            for (j = nr; j < GEMM_NR; j++)
+              b[j] = 0.0;
+            b += GEMM_NR;
+          }
+        }
+
+        for (ic = 0; ic < n1; ic += GEMM_MC) {
+          const INDEX mc = GEMM_MIN (n1 - ic, GEMM_MC);
+
+          /* pack alpha*op(F)(ic:ic+mc, pc:pc+kc) into MR-high slivers */
+
+          for (ir = 0; ir < mc; ir += GEMM_MR) {
+            const INDEX mr = GEMM_MIN (mc - ir, GEMM_MR);
+            BASE *a = Ap + ir * kc;
+
+            for (p = 0; p < kc; p++) {
+              if (TransF == CblasNoTrans) {
+                const BASE *f = F + ldf * (ic + ir) + (pc + p);
+                for (i = 0; i < mr; i++)
+                  a[i] = alpha * f[ldf * i];
+              } else {
+                const BASE *f = F + ldf * (pc + p) + (ic + ir);
+                for (i = 0; i < mr; i++)
+                  a[i] = alpha * f[i];
+              }
+              for (i = mr; i < GEMM_MR; i++)
+                a[i] = 0.0;
+              a += GEMM_MR;
+            }
+          }
+
+          /* macro-kernel: sweep the packed block with the micro-kernel */
+
+          for (jr = 0; jr < nc; jr += GEMM_NR) {
+            const INDEX nr = GEMM_MIN (nc - jr, GEMM_NR);
+
+            for (ir = 0; ir < mc; ir += GEMM_MR) {
+              const INDEX mr = GEMM_MIN (mc - ir, GEMM_MR);
+              const BASE *a = Ap + ir * kc;
+              const BASE *b = Bp + jr * kc;
+              BASE *c = C + ldc * (ic + ir) + (jc + jr);
+              BASE ab00 = 0.0, ab01 = 0.0, ab02 = 0.0, ab03 = 0.0;
+              BASE ab10 = 0.0, ab11 = 0.0, ab12 = 0.0, ab13 = 0.0;
+              BASE ab20 = 0.0, ab21 = 0.0, ab22 = 0.0, ab23 = 0.0;
+              BASE ab30 = 0.0, ab31 = 0.0, ab32 = 0.0, ab33 = 0.0;
+
+              /* 4 x 4 micro-kernel, accumulated in registers */
+
+              for (p = 0; p < kc; p++) {
+                const BASE a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3];
+                const BASE b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3];
+                ab00 += a0 * b0; ab01 += a0 * b1; ab02 += a0 * b2; ab03 += a0 * b3;
+                ab10 += a1 * b0; ab11 += a1 * b1; ab12 += a1 * b2; ab13 += a1 * b3;
+                ab20 += a2 * b0; ab21 += a2 * b1; ab22 += a2 * b2; ab23 += a2 * b3;
+                ab30 += a3 * b0; ab31 += a3 * b1; ab32 += a3 * b2; ab33 += a3 * b3;
+                a += GEMM_MR;
+                b += GEMM_NR;
+              }
+
+              if (mr == GEMM_MR && nr == GEMM_NR) {
+                c[0] += ab00; c[1] += ab01; c[2] += ab02; c[3] += ab03;
+                c += ldc;
+                c[0] += ab10; c[1] += ab11; c[2] += ab12; c[3] += ab13;
+                c += ldc;
+                c[0] += ab20; c[1] += ab21; c[2] += ab22; c[3] += ab23;
+                c += ldc;
+                c[0] += ab30; c[1] += ab31; c[2] += ab32; c[3] += ab33;
+              } else {
+                BASE ab[GEMM_MR * GEMM_NR];
+
+                ab[0] = ab00; ab[1] = ab01; ab[2] = ab02; ab[3] = ab03;
+                ab[4] = ab10; ab[5] = ab11; ab[6] = ab12; ab[7] = ab13;
+                ab[8] = ab20; ab[9] = ab21; ab[10] = ab22; ab[11] = ab23;
+                ab[12] = ab30; ab[13] = ab31; ab[14] = ab32; ab[15] = ab33;
+
+                for (i = 0; i < mr; i++) {
+                  for (j = 0; j < nr; j++)
+                    c[ldc * i + j] += ab[GEMM_NR * i + j];
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+
+    blocked = 1;
+  }
+
+  free (Ap);
+  free (Bp);
+}
@@ -26,6 +26,10 @@
 
   CHECK_ARGS14(GEMM,Order,TransA,TransB,M,N,K,alpha,A,lda,B,ldb,beta,C,ldc);
 
+#define NELEM 2
+#include "source_gemm_thread.h"
+#undef NELEM
+
   {
     const BASE alpha_real = CONST_REAL0(alpha);
     const BASE alpha_imag = CONST_IMAG0(alpha);
@@ -83,6 +87,13 @@
     if (alpha_real == 0.0 && alpha_imag == 0.0)
       return;
 
+    if (GEMM_USE_BLOCKED (n1, n2, K)) {
+      int blocked = 0;
+#include "source_gemm_blocked_c.h"
+      if (blocked)
+        return;
+    }
+
     if (TransF == CblasNoTrans && TransG == CblasNoTrans) {
 
       /* form  C := alpha*A*B + C */
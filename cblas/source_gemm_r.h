@@ -26,6 +26,10 @@
 
   CHECK_ARGS14(GEMM,Order,TransA,TransB,M,N,K,alpha,A,lda,B,ldb,beta,C,ldc);
 
+#define NELEM 1
+#include "source_gemm_thread.h"
+#undef NELEM
+
   if (alpha == 0.0 && beta == 1.0)
     return;
 
@@ -67,6 +71,13 @@
   if (alpha == 0.0)
     return;
 
+  if (GEMM_USE_BLOCKED (n1, n2, K)) {
+    int blocked = 0;
+#include "source_gemm_blocked_r.h"
+    if (blocked)
+      return;
+  }
+
   if (TransF == CblasNoTrans && TransG == CblasNoTrans) {
 
     /* form  C := alpha*A*B + C */
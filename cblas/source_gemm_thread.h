@@ -0,0 +1,69 @@
+/* blas/source_gemm_thread.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+
+/* Multithreaded GEMM, included from source_gemm_r.h and source_gemm_c.h
+ * after the arguments have been checked.  The larger of the M and N
+ * dimensions of C is split into one slice per thread, and each slice is
+ * computed by a serial call (CBLAS_FN) on the corresponding submatrices.
+ * The slices of C are disjoint and each element is formed exactly as in
+ * the serial routine, so the result is independent of scheduling.
+ * NELEM is the number of BASE values per matrix element. */
+
+{
+  const int nthreads =
+    cblas_thread_count (NELEM * NELEM * 2.0 * M * (double) N * K);
+
+  if (nthreads > 1) {
+    const size_t size = NELEM * sizeof (BASE);
+    const int split_rows = (M >= N);
+    int t;
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+    for (t = 0; t < nthreads; t++) {
+      if (split_rows) {
+        /* rows i0:i1 of op(A) and C */
+        const int i0 = cblas_thread_split (M, nthreads, t);
+        const int i1 = cblas_thread_split (M, nthreads, t + 1);
+        const size_t offA = ((Order == CblasRowMajor) == (TransA == CblasNoTrans))
+          ? (size_t) i0 * lda : (size_t) i0;
+        const size_t offC = (Order == CblasRowMajor)
+          ? (size_t) i0 * ldc : (size_t) i0;
+        CBLAS_FN (Order, TransA, TransB, i1 - i0, N, K, alpha,
+                  (const void *) ((const char *) A + offA * size), lda, B, ldb,
+                  beta, (void *) ((char *) C + offC * size), ldc);
+      } else {
+        /* columns j0:j1 of op(B) and C */
+        const int j0 = cblas_thread_split (N, nthreads, t);
+        const int j1 = cblas_thread_split (N, nthreads, t + 1);
+        const size_t offB = ((Order == CblasRowMajor) == (TransB == CblasNoTrans))
+          ? (size_t) j0 : (size_t) j0 * ldb;
+        const size_t offC = (Order == CblasRowMajor)
+          ? (size_t) j0 : (size_t) j0 * ldc;
+        CBLAS_FN (Order, TransA, TransB, M, j1 - j0, K, alpha, A, lda,
+                  (const void *) ((const char *) B + offB * size), ldb,
+                  beta, (void *) ((char *) C + offC * size), ldc);
+      }
+    }
+
+    return;
+  }
+}
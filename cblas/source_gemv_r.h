@@ -63,10 +63,17 @@
     INDEX iy = OFFSET(lenY, incY);
     for (i = 0; i < lenY; i++) {
       BASE temp = 0.0;
-      INDEX ix = OFFSET(lenX, incX);
-      for (j = 0; j < lenX; j++) {
-        temp += X[ix] * A[lda * i + j];
-        ix += incX;
+#ifdef DOT_UNIT
+      if (incX == 1) {
+        temp = DOT_UNIT (lenX, X, A + lda * i);
+      } else
+#endif
+      {
+        INDEX ix = OFFSET(lenX, incX);
+        for (j = 0; j < lenX; j++) {
+          temp += X[ix] * A[lda * i + j];
+          ix += incX;
+        }
       }
       Y[iy] += alpha * temp;
       iy += incY;
@@ -78,10 +85,17 @@
     for (j = 0; j < lenX; j++) {
       const BASE temp = alpha * X[ix];
       if (temp != 0.0) {
-        INDEX iy = OFFSET(lenY, incY);
-        for (i = 0; i < lenY; i++) {
-          Y[iy] += temp * A[lda * j + i];
-          iy += incY;
+#ifdef AXPY_UNIT
+        if (incY == 1) {
+          AXPY_UNIT (lenY, temp, A + lda * j, Y);
+        } else
+#endif
+        {
+          INDEX iy = OFFSET(lenY, incY);
+          for (i = 0; i < lenY; i++) {
+            Y[iy] += temp * A[lda * j + i];
+            iy += incY;
+          }
         }
       }
       ix += incX;
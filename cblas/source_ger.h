@@ -26,10 +26,17 @@
     INDEX ix = OFFSET(M, incX);
     for (i = 0; i < M; i++) {
       const BASE tmp = alpha * X[ix];
-      INDEX jy = OFFSET(N, incY);
-      for (j = 0; j < N; j++) {
-        A[lda * i + j] += Y[jy] * tmp;
-        jy += incY;
+#ifdef AXPY_UNIT
+      if (incY == 1) {
+        AXPY_UNIT (N, tmp, Y, A + lda * i);
+      } else
+#endif
+      {
+        INDEX jy = OFFSET(N, incY);
+        for (j = 0; j < N; j++) {
+          A[lda * i + j] += Y[jy] * tmp;
+          jy += incY;
+        }
       }
       ix += incX;
     }
@@ -37,10 +44,17 @@
     INDEX jy = OFFSET(N, incY);
     for (j = 0; j < N; j++) {
       const BASE tmp = alpha * Y[jy];
-      INDEX ix = OFFSET(M, incX);
-      for (i = 0; i < M; i++) {
-        A[i + lda * j] += X[ix] * tmp;
-        ix += incX;
+#ifdef AXPY_UNIT
+      if (incX == 1) {
+        AXPY_UNIT (M, tmp, X, A + lda * j);
+      } else
+#endif
+      {
+        INDEX ix = OFFSET(M, incX);
+        for (i = 0; i < M; i++) {
+          A[i + lda * j] += X[ix] * tmp;
+          ix += incX;
+        }
       }
       jy += incY;
     }
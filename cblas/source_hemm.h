@@ -24,6 +24,10 @@
 
   CHECK_ARGS13(HEMM,Order,Side,Uplo,M,N,alpha,A,lda,B,ldb,beta,C,ldc);
 
+#define NELEM 2
+#include "source_symm_thread.h"
+#undef NELEM
+
   {
     const BASE alpha_real = CONST_REAL0(alpha);
     const BASE alpha_imag = CONST_IMAG0(alpha);
@@ -23,6 +23,25 @@
 
   CHECK_ARGS11(HERK,Order,Uplo,Trans,N,K,alpha,A,lda,beta,C,ldc);
 
+  {
+    BASE gemm_alpha[2], gemm_beta[2];
+
+    gemm_alpha[0] = alpha;
+    gemm_alpha[1] = 0.0;
+    gemm_beta[0] = beta;
+    gemm_beta[1] = 0.0;
+
+#define NELEM 2
+#define GEMM_ALPHA gemm_alpha
+#define GEMM_BETA gemm_beta
+#define GEMM_TRANS ((Trans == CblasNoTrans) ? CblasConjTrans : CblasNoTrans)
+#include "source_syrk_thread.h"
+#undef GEMM_TRANS
+#undef GEMM_BETA
+#undef GEMM_ALPHA
+#undef NELEM
+  }
+
   if (beta == 1.0 && (alpha == 0.0 || K == 0))
     return;
 
@@ -29,6 +29,17 @@
     return fabs(X[0]);
   }
 
+#ifdef SSQ_UNIT
+  if (incX == 1) {
+    /* plain sum of squares, used when it has neither overflowed nor lost
+       accuracy to underflow; otherwise fall back to the scaled loop */
+    const BASE ssq = SSQ_UNIT (N, X);
+
+    if (ssq >= SSQ_MIN && ssq <= SSQ_MAX)
+      return sqrt(ssq);
+  }
+#endif
+
   for (i = 0; i < N; i++) {
     const BASE x = X[ix];
 
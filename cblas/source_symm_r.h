@@ -24,6 +24,10 @@
 
   CHECK_ARGS13(SYMM,Order,Side,Uplo,M,N,alpha,A,lda,B,ldb,beta,C,ldc);
 
+#define NELEM 1
+#include "source_symm_thread.h"
+#undef NELEM
+
   if (alpha == 0.0 && beta == 1.0)
     return;
 
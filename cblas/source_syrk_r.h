@@ -23,6 +23,16 @@
 
   CHECK_ARGS11(SYRK,Order,Uplo,Trans,N,K,alpha,A,lda,beta,C,ldc);
 
+#define NELEM 1
+#define GEMM_ALPHA alpha
+#define GEMM_BETA beta
+#define GEMM_TRANS ((Trans == CblasNoTrans) ? CblasTrans : CblasNoTrans)
+#include "source_syrk_thread.h"
+#undef GEMM_TRANS
+#undef GEMM_BETA
+#undef GEMM_ALPHA
+#undef NELEM
+
   if (alpha == 0.0 && beta == 1.0)
     return;
 
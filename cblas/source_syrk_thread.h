@@ -0,0 +1,89 @@
+/* blas/source_syrk_thread.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+
+/* Multithreaded SYRK/HERK, included from the serial source after the
+ * arguments have been checked.  C is divided into nthreads x nthreads
+ * blocks; the diagonal blocks of the referenced triangle are updated by
+ * serial calls (CBLAS_FN) and the off-diagonal blocks by GEMM calls
+ * (CBLAS_GEMM_FN).  The blocks are disjoint and their partition depends
+ * only on the number of threads, so the result is reproducible for a
+ * fixed thread count.  NELEM is the number of BASE values per matrix
+ * element and GEMM_ALPHA, GEMM_BETA, GEMM_TRANS the arguments passed to
+ * the GEMM calls, which differ between SYRK and HERK. */
+
+{
+  const int nthreads =
+    cblas_thread_count (NELEM * NELEM * (double) N * N * K);
+
+  if (nthreads > 1) {
+    const size_t size = NELEM * sizeof (BASE);
+    const int nblocks = nthreads;
+    const int ntasks = nblocks * (nblocks + 1) / 2;
+    const int rowA = ((Order == CblasRowMajor) == (Trans == CblasNoTrans));
+    int t;
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+#endif
+    for (t = 0; t < ntasks; t++) {
+      int bi = 0, bj, r = t;
+      int i0, i1, j0, j1;
+      size_t offAi, offAj, offC;
+
+      /* map t onto a block (bi,bj) of the upper triangle, bj >= bi */
+      while (r >= nblocks - bi) {
+        r -= nblocks - bi;
+        bi++;
+      }
+      bj = bi + r;
+
+      if (Uplo == CblasLower) {
+        const int tmp = bi;
+        bi = bj;
+        bj = tmp;
+      }
+
+      i0 = cblas_thread_split (N, nblocks, bi);
+      i1 = cblas_thread_split (N, nblocks, bi + 1);
+      j0 = cblas_thread_split (N, nblocks, bj);
+      j1 = cblas_thread_split (N, nblocks, bj + 1);
+
+      /* rows i0 and j0 of op(A), and element (i0,j0) of C */
+      offAi = rowA ? (size_t) i0 * lda : (size_t) i0;
+      offAj = rowA ? (size_t) j0 * lda : (size_t) j0;
+      offC = (Order == CblasRowMajor)
+        ? (size_t) i0 * ldc + j0 : (size_t) j0 * ldc + i0;
+
+      if (bi == bj) {
+        CBLAS_FN (Order, Uplo, Trans, i1 - i0, K, alpha,
+                  (const void *) ((const char *) A + offAi * size), lda,
+                  beta, (void *) ((char *) C + offC * size), ldc);
+      } else {
+        CBLAS_GEMM_FN (Order, Trans, GEMM_TRANS, i1 - i0, j1 - j0, K,
+                       GEMM_ALPHA,
+                       (const void *) ((const char *) A + offAi * size), lda,
+                       (const void *) ((const char *) A + offAj * size), lda,
+                       GEMM_BETA, (void *) ((char *) C + offC * size), ldc);
+      }
+    }
+
+    return;
+  }
+}
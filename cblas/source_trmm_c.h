@@ -27,6 +27,10 @@
 
   CHECK_ARGS12(TRMM,Order,Side,Uplo,TransA,Diag,M,N,alpha,A,lda,B,ldb);
 
+#define NELEM 2
+#include "source_trxm_thread.h"
+#undef NELEM
+
   {
     const BASE alpha_real = CONST_REAL0(alpha);
     const BASE alpha_imag = CONST_IMAG0(alpha);
@@ -26,6 +26,10 @@
 
   CHECK_ARGS12(TRSM,Order,Side,Uplo,TransA,Diag,M,N,alpha,A,lda,B,ldb);
 
+#define NELEM 1
+#include "source_trxm_thread.h"
+#undef NELEM
+
   if (Order == CblasRowMajor) {
     n1 = M;
     n2 = N;
@@ -0,0 +1,61 @@
+/* blas/source_trxm_thread.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+
+/* Multithreaded TRSM/TRMM, included from the serial source after the
+ * arguments have been checked.  With A on the left the columns of B are
+ * independent, with A on the right the rows are, so that dimension is
+ * split into one slice per thread and each slice is computed in place
+ * by a serial call (CBLAS_FN).  Each element of B is formed exactly as
+ * in the serial routine.  NELEM is the number of BASE values per matrix
+ * element. */
+
+{
+  const double na = (Side == CblasLeft) ? M : N;
+  const int nthreads =
+    cblas_thread_count (NELEM * NELEM * na * na * ((Side == CblasLeft) ? N : M));
+
+  if (nthreads > 1) {
+    const size_t size = NELEM * sizeof (BASE);
+    const int n = (Side == CblasLeft) ? N : M;
+    int t;
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+    for (t = 0; t < nthreads; t++) {
+      const int k0 = cblas_thread_split (n, nthreads, t);
+      const int k1 = cblas_thread_split (n, nthreads, t + 1);
+
+      if (Side == CblasLeft) {
+        /* columns k0:k1 of B */
+        const size_t offB = (Order == CblasRowMajor) ? (size_t) k0 : (size_t) k0 * ldb;
+        CBLAS_FN (Order, Side, Uplo, TransA, Diag, M, k1 - k0, alpha, A, lda,
+                  (void *) ((char *) B + offB * size), ldb);
+      } else {
+        /* rows k0:k1 of B */
+        const size_t offB = (Order == CblasRowMajor) ? (size_t) k0 * ldb : (size_t) k0;
+        CBLAS_FN (Order, Side, Uplo, TransA, Diag, k1 - k0, N, alpha, A, lda,
+                  (void *) ((char *) B + offB * size), ldb);
+      }
+    }
+
+    return;
+  }
+}
@@ -9,7 +9,9 @@ cblas_ssymm (const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side,
              const float alpha, const float *A, const int lda, const float *B,
              const int ldb, const float beta, float *C, const int ldc)
 {
+#define CBLAS_FN cblas_ssymm
 #define BASE float
 #include "source_symm_r.h"
 #undef BASE
+#undef CBLAS_FN
 }
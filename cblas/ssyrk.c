@@ -9,7 +9,11 @@ cblas_ssyrk (const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo,
              const float alpha, const float *A, const int lda,
              const float beta, float *C, const int ldc)
 {
+#define CBLAS_FN cblas_ssyrk
+#define CBLAS_GEMM_FN cblas_sgemm
 #define BASE float
 #include "source_syrk_r.h"
 #undef BASE
+#undef CBLAS_FN
+#undef CBLAS_GEMM_FN
 }
@@ -10,7 +10,9 @@ cblas_strsm (const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side,
              const float alpha, const float *A, const int lda, float *B,
              const int ldb)
 {
+#define CBLAS_FN cblas_strsm
 #define BASE float
 #include "source_trsm_r.h"
 #undef BASE
+#undef CBLAS_FN
 }
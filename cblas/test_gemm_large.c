@@ -0,0 +1,238 @@
+/* blas/test_gemm_large.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* The generated cases in test_gemm.c are too small to reach the
+ * packed (cache blocked) GEMM code path, so compare it here against a
+ * straightforward triple loop for sizes which cross the MC, KC and
+ * register tile boundaries. */
+
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_cblas.h>
+
+#include "tests.h"
+
+static double
+test_gemm_urand (unsigned long *seed)
+{
+  *seed = (*seed * 1103515245UL + 12345UL) & 0x7fffffffUL;
+  return 2.0 * (*seed / 2147483648.0) - 1.0;
+}
+
+/* index of op(X)(i,j) in an array with leading dimension ld */
+static int
+test_gemm_index (int order, int trans, int i, int j, int ld)
+{
+  if (trans != CblasNoTrans)
+    {
+      int tmp = i;
+      i = j;
+      j = tmp;
+    }
+
+  return (order == CblasRowMajor) ? i * ld + j : j * ld + i;
+}
+
+static void
+test_gemm_large_case (int order, int transA, int transB, int M, int N, int K)
+{
+  /* stored dimensions of A and B, and the number of rows (row-major)
+     or columns (column-major) held in each array */
+  const int rA = (transA == CblasNoTrans) ? M : K, cA = (transA == CblasNoTrans) ? K : M;
+  const int rB = (transB == CblasNoTrans) ? K : N, cB = (transB == CblasNoTrans) ? N : K;
+  const int row = (order == CblasRowMajor);
+  const int lda = (row ? cA : rA) + 3, ldb = (row ? cB : rB) + 1, ldc = (row ? N : M) + 2;
+  const size_t nA = (size_t) (row ? rA : cA) * lda;
+  const size_t nB = (size_t) (row ? rB : cB) * ldb;
+  const size_t nC = (size_t) (row ? M : N) * ldc;
+  const double alpha[2] = { 0.7, -0.3 };
+  const double beta[2] = { -0.4, 0.2 };
+  const float alphaf[2] = { 0.7f, -0.3f };
+  const float betaf[2] = { -0.4f, 0.2f };
+  const double conjA = (transA == CblasConjTrans) ? -1.0 : 1.0;
+  const double conjB = (transB == CblasConjTrans) ? -1.0 : 1.0;
+  double *A = malloc (2 * nA * sizeof (double));
+  double *B = malloc (2 * nB * sizeof (double));
+  double *C = malloc (2 * nC * sizeof (double));
+  double *C_expected = malloc (2 * nC * sizeof (double));
+  float *Af = malloc (2 * nA * sizeof (float));
+  float *Bf = malloc (2 * nB * sizeof (float));
+  float *Cf = malloc (2 * nC * sizeof (float));
+  unsigned long seed = 1;
+  double err, errf;
+  size_t n;
+  int i, j, k;
+
+  for (n = 0; n < 2 * nA; n++)
+    Af[n] = (float) (A[n] = test_gemm_urand (&seed));
+
+  for (n = 0; n < 2 * nB; n++)
+    Bf[n] = (float) (B[n] = test_gemm_urand (&seed));
+
+  for (n = 0; n < 2 * nC; n++)
+    Cf[n] = (float) (C[n] = test_gemm_urand (&seed));
+
+  /* real reference, using the real parts of A, B, C */
+
+  for (i = 0; i < M; i++)
+    {
+      for (j = 0; j < N; j++)
+        {
+          const int ic = test_gemm_index (order, CblasNoTrans, i, j, ldc);
+          double sum = 0.0;
+
+          for (k = 0; k < K; k++)
+            {
+              const int ia = test_gemm_index (order, transA, i, k, lda);
+              const int ib = test_gemm_index (order, transB, k, j, ldb);
+              sum += A[2 * ia] * B[2 * ib];
+            }
+
+          C_expected[ic] = alpha[0] * sum + beta[0] * C[2 * ic];
+        }
+    }
+
+  {
+    double *Ar = malloc (nA * sizeof (double));
+    double *Br = malloc (nB * sizeof (double));
+    double *Cr = malloc (nC * sizeof (double));
+    float *Arf = malloc (nA * sizeof (float));
+    float *Brf = malloc (nB * sizeof (float));
+    float *Crf = malloc (nC * sizeof (float));
+
+    for (n = 0; n < nA; n++)
+      Arf[n] = (float) (Ar[n] = A[2 * n]);
+    for (n = 0; n < nB; n++)
+      Brf[n] = (float) (Br[n] = B[2 * n]);
+    for (n = 0; n < nC; n++)
+      Crf[n] = (float) (Cr[n] = C[2 * n]);
+
+    cblas_dgemm (order, transA, transB, M, N, K, alpha[0], Ar, lda, Br, ldb,
+                 beta[0], Cr, ldc);
+    cblas_sgemm (order, transA, transB, M, N, K, alphaf[0], Arf, lda, Brf, ldb,
+                 betaf[0], Crf, ldc);
+
+    err = 0.0;
+    errf = 0.0;
+
+    for (i = 0; i < M; i++)
+      {
+        for (j = 0; j < N; j++)
+          {
+            const int ic = test_gemm_index (order, CblasNoTrans, i, j, ldc);
+            err = GSL_MAX (err, fabs (Cr[ic] - C_expected[ic]));
+            errf = GSL_MAX (errf, fabs (Crf[ic] - C_expected[ic]));
+          }
+      }
+
+    gsl_test (err > 1.0e-12 * K, "dgemm(large) order=%d transA=%d transB=%d M=%d N=%d K=%d",
+              order, transA, transB, M, N, K);
+    gsl_test (errf > 1.0e-5 * K, "sgemm(large) order=%d transA=%d transB=%d M=%d N=%d K=%d",
+              order, transA, transB, M, N, K);
+
+    free (Ar);
+    free (Br);
+    free (Cr);
+    free (Arf);
+    free (Brf);
+    free (Crf);
+  }
+
+  /* complex reference */
+
+  for (i = 0; i < M; i++)
+    {
+      for (j = 0; j < N; j++)
+        {
+          const int ic = test_gemm_index (order, CblasNoTrans, i, j, ldc);
+          double sum_real = 0.0, sum_imag = 0.0;
+
+          for (k = 0; k < K; k++)
+            {
+              const int ia = test_gemm_index (order, transA, i, k, lda);
+              const int ib = test_gemm_index (order, transB, k, j, ldb);
+              const double a_real = A[2 * ia], a_imag = conjA * A[2 * ia + 1];
+              const double b_real = B[2 * ib], b_imag = conjB * B[2 * ib + 1];
+              sum_real += a_real * b_real - a_imag * b_imag;
+              sum_imag += a_real * b_imag + a_imag * b_real;
+            }
+
+          C_expected[2 * ic] = alpha[0] * sum_real - alpha[1] * sum_imag
+            + beta[0] * C[2 * ic] - beta[1] * C[2 * ic + 1];
+          C_expected[2 * ic + 1] = alpha[0] * sum_imag + alpha[1] * sum_real
+            + beta[0] * C[2 * ic + 1] + beta[1] * C[2 * ic];
+        }
+    }
+
+  cblas_zgemm (order, transA, transB, M, N, K, alpha, A, lda, B, ldb,
+               beta, C, ldc);
+  cblas_cgemm (order, transA, transB, M, N, K, alphaf, Af, lda, Bf, ldb,
+               betaf, Cf, ldc);
+
+  err = 0.0;
+  errf = 0.0;
+
+  for (i = 0; i < M; i++)
+    {
+      for (j = 0; j < N; j++)
+        {
+          const int ic = test_gemm_index (order, CblasNoTrans, i, j, ldc);
+          err = GSL_MAX (err, fabs (C[2 * ic] - C_expected[2 * ic]));
+          err = GSL_MAX (err, fabs (C[2 * ic + 1] - C_expected[2 * ic + 1]));
+          errf = GSL_MAX (errf, fabs (Cf[2 * ic] - C_expected[2 * ic]));
+          errf = GSL_MAX (errf, fabs (Cf[2 * ic + 1] - C_expected[2 * ic + 1]));
+        }
+    }
+
+  gsl_test (err > 1.0e-12 * K, "zgemm(large) order=%d transA=%d transB=%d M=%d N=%d K=%d",
+            order, transA, transB, M, N, K);
+  gsl_test (errf > 1.0e-5 * K, "cgemm(large) order=%d transA=%d transB=%d M=%d N=%d K=%d",
+            order, transA, transB, M, N, K);
+
+  free (A);
+  free (B);
+  free (C);
+  free (C_expected);
+  free (Af);
+  free (Bf);
+  free (Cf);
+}
+
+void
+test_gemm_large (void)
+{
+  const int order[] = { CblasRowMajor, CblasColMajor };
+  const int trans[] = { CblasNoTrans, CblasTrans, CblasConjTrans };
+  size_t o, ta, tb;
+
+  for (o = 0; o < 2; o++)
+    {
+      for (ta = 0; ta < 3; ta++)
+        {
+          for (tb = 0; tb < 3; tb++)
+            {
+              test_gemm_large_case (order[o], trans[ta], trans[tb], 37, 45, 300);
+              test_gemm_large_case (order[o], trans[ta], trans[tb], 131, 6, 70);
+            }
+        }
+    }
+}
@@ -0,0 +1,266 @@
+/* blas/test_gemm_large.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* The generated cases in test_dot.c, test_axpy.c etc. are mostly too
+ * short to exercise the vector loops of the unit stride kernels in
+ * simd.c, so compare them here against plain loops for lengths which
+ * cover the vector bodies and remainders of every instruction set.
+ * axpy and ger must reproduce the reference exactly; dot, nrm2 and gemv
+ * may differ by the rounding of a reordered sum. */
+
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_cblas.h>
+
+#include "tests.h"
+
+static double
+test_simd_urand (unsigned long *seed)
+{
+  *seed = (*seed * 1103515245UL + 12345UL) & 0x7fffffffUL;
+  return 2.0 * (*seed / 2147483648.0) - 1.0;
+}
+
+static void
+test_simd_level1 (const int N)
+{
+  double *X = malloc ((N + 1) * sizeof (double));
+  double *Y = malloc ((N + 1) * sizeof (double));
+  double *Z = malloc ((N + 1) * sizeof (double));
+  float *Xf = malloc ((N + 1) * sizeof (float));
+  float *Yf = malloc ((N + 1) * sizeof (float));
+  float *Zf = malloc ((N + 1) * sizeof (float));
+  const double alpha = 0.37;
+  const float alphaf = 0.37f;
+  const double scale[] = { 1.0, 1.0e-200, 1.0e200 };
+  unsigned long seed = 7;
+  double dot, dot_abs, r;
+  float dotf, dot_absf, rf;
+  int i, k, status;
+
+  for (i = 0; i < N; i++)
+    {
+      Xf[i] = (float) (X[i] = test_simd_urand (&seed));
+      Yf[i] = (float) (Y[i] = test_simd_urand (&seed));
+    }
+
+  /* dot */
+
+  dot = 0.0;
+  dot_abs = 0.0;
+  dotf = 0.0f;
+  dot_absf = 0.0f;
+
+  for (i = 0; i < N; i++)
+    {
+      dot += X[i] * Y[i];
+      dot_abs += fabs (X[i] * Y[i]);
+      dotf += Xf[i] * Yf[i];
+      dot_absf += fabsf (Xf[i] * Yf[i]);
+    }
+
+  r = cblas_ddot (N, X, 1, Y, 1);
+  gsl_test (fabs (r - dot) > 2.0 * N * GSL_DBL_EPSILON * dot_abs,
+            "ddot(simd) N=%d", N);
+
+  rf = cblas_sdot (N, Xf, 1, Yf, 1);
+  gsl_test (fabsf (rf - dotf) > 2.0f * N * GSL_FLT_EPSILON * dot_absf,
+            "sdot(simd) N=%d", N);
+
+  /* axpy, bitwise */
+
+  for (i = 0; i < N; i++)
+    {
+      Z[i] = Y[i];
+      Zf[i] = Yf[i];
+    }
+
+  cblas_daxpy (N, alpha, X, 1, Z, 1);
+  cblas_saxpy (N, alphaf, Xf, 1, Zf, 1);
+
+  status = 0;
+  for (i = 0; i < N; i++)
+    {
+      double z = Y[i];
+      float zf = Yf[i];
+      z += alpha * X[i];
+      zf += alphaf * Xf[i];
+      status |= (Z[i] != z);
+      status |= (Zf[i] != zf);
+    }
+
+  gsl_test (status, "daxpy/saxpy(simd) N=%d", N);
+
+  /* nrm2, including scales which overflow or underflow the plain sum
+     of squares */
+
+  for (k = 0; k < 3; k++)
+    {
+      double nrm = 0.0;
+
+      for (i = 0; i < N; i++)
+        {
+          Z[i] = scale[k] * X[i];
+          nrm += X[i] * X[i];
+        }
+
+      nrm = scale[k] * sqrt (nrm);
+      r = cblas_dnrm2 (N, Z, 1);
+      gsl_test (fabs (r - nrm) > 4.0 * N * GSL_DBL_EPSILON * nrm,
+                "dnrm2(simd) N=%d scale=%g", N, scale[k]);
+    }
+
+  {
+    const float scalef[] = { 1.0f, 1.0e-30f, 1.0e30f };
+
+    for (k = 0; k < 3; k++)
+      {
+        double nrm = 0.0;
+
+        for (i = 0; i < N; i++)
+          {
+            Zf[i] = scalef[k] * Xf[i];
+            nrm += (double) Xf[i] * Xf[i];
+          }
+
+        nrm = scalef[k] * sqrt (nrm);
+        rf = cblas_snrm2 (N, Zf, 1);
+        gsl_test (fabs (rf - nrm) > 4.0 * N * GSL_FLT_EPSILON * nrm,
+                  "snrm2(simd) N=%d scale=%g", N, scalef[k]);
+      }
+  }
+
+  free (X);
+  free (Y);
+  free (Z);
+  free (Xf);
+  free (Yf);
+  free (Zf);
+}
+
+static void
+test_simd_level2 (const int order, const int M, const int N)
+{
+  const int lda = ((order == CblasRowMajor) ? N : M) + 1;
+  const size_t nA = (size_t) lda * ((order == CblasRowMajor) ? M : N);
+  double *A = malloc (nA * sizeof (double));
+  double *B = malloc (nA * sizeof (double));
+  double *X = malloc ((M + N + 1) * sizeof (double));
+  double *Y = malloc ((M + N + 1) * sizeof (double));
+  double *Z = malloc ((M + N + 1) * sizeof (double));
+  const double alpha = 0.7, beta = -0.3;
+  unsigned long seed = 11;
+  size_t n;
+  int i, j, t, status;
+
+  for (n = 0; n < nA; n++)
+    A[n] = test_simd_urand (&seed);
+
+  for (i = 0; i < M + N; i++)
+    {
+      X[i] = test_simd_urand (&seed);
+      Y[i] = test_simd_urand (&seed);
+    }
+
+  /* gemv, both transposes */
+
+  for (t = 0; t < 2; t++)
+    {
+      const int trans = t ? CblasTrans : CblasNoTrans;
+      const int lenY = t ? N : M, lenX = t ? M : N;
+      double err = 0.0, tol = 0.0;
+
+      for (i = 0; i < lenY; i++)
+        Z[i] = Y[i];
+
+      cblas_dgemv (order, trans, M, N, alpha, A, lda, X, 1, beta, Z, 1);
+
+      for (i = 0; i < lenY; i++)
+        {
+          double sum = 0.0, sum_abs = 0.0;
+
+          for (j = 0; j < lenX; j++)
+            {
+              const int r = t ? j : i, c = t ? i : j;
+              const double a = (order == CblasRowMajor)
+                ? A[lda * r + c] : A[lda * c + r];
+              sum += a * X[j];
+              sum_abs += fabs (a * X[j]);
+            }
+
+          err = GSL_MAX (err, fabs (Z[i] - (alpha * sum + beta * Y[i])));
+          tol = GSL_MAX (tol, 2.0 * (lenX + 2) * GSL_DBL_EPSILON
+                         * (fabs (alpha) * sum_abs + fabs (beta * Y[i])));
+        }
+
+      gsl_test (err > tol, "dgemv(simd) order=%d trans=%d M=%d N=%d",
+                order, trans, M, N);
+    }
+
+  /* ger, bitwise */
+
+  for (n = 0; n < nA; n++)
+    B[n] = A[n];
+
+  cblas_dger (order, M, N, alpha, X, 1, Y, 1, B, lda);
+
+  status = 0;
+  for (i = 0; i < M; i++)
+    {
+      for (j = 0; j < N; j++)
+        {
+          const size_t idx = (order == CblasRowMajor)
+            ? (size_t) lda * i + j : (size_t) lda * j + i;
+          double a = A[idx];
+
+          if (order == CblasRowMajor)
+            a += Y[j] * (alpha * X[i]);
+          else
+            a += X[i] * (alpha * Y[j]);
+
+          status |= (B[idx] != a);
+        }
+    }
+
+  gsl_test (status, "dger(simd) order=%d M=%d N=%d", order, M, N);
+
+  free (A);
+  free (B);
+  free (X);
+  free (Y);
+  free (Z);
+}
+
+void
+test_simd (void)
+{
+  const int sizes[] = { 0, 1, 3, 7, 16, 33, 100, 1001 };
+  size_t i;
+
+  for (i = 0; i < sizeof (sizes) / sizeof (sizes[0]); i++)
+    test_simd_level1 (sizes[i]);
+
+  test_simd_level2 (CblasRowMajor, 37, 101);
+  test_simd_level2 (CblasColMajor, 37, 101);
+  test_simd_level2 (CblasRowMajor, 64, 9);
+  test_simd_level2 (CblasColMajor, 64, 9);
+}
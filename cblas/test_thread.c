@@ -0,0 +1,163 @@
+/* blas/test_thread.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Compare the multithreaded level 3 routines against single threaded
+ * calls.  GEMM, SYMM/HEMM, TRSM and TRMM split C (or B) into slices
+ * which are computed exactly as in the serial routine, so the results
+ * must agree to the last bit; SYRK/HERK use GEMM for the off-diagonal
+ * blocks and are only required to be reproducible for a fixed thread
+ * count. When the library is built without OpenMP every call is serial
+ * and the tests are trivially satisfied. */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_cblas.h>
+
+#include "tests.h"
+
+#define NT 4
+#define SIZE 250
+
+static void
+test_thread_fill (double *x, const size_t n, unsigned long seed)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      seed = (seed * 1103515245UL + 12345UL) & 0x7fffffffUL;
+      x[i] = 2.0 * (seed / 2147483648.0) - 1.0;
+    }
+}
+
+/* make the diagonal of an n x n matrix (real or complex) dominant */
+static void
+test_thread_diag (double *A, const int n, const int lda, const int nelem)
+{
+  int i;
+
+  for (i = 0; i < n; i++)
+    A[nelem * (i * lda + i)] += n;
+}
+
+static double
+test_thread_maxdiff (const double *x, const double *y, const size_t n)
+{
+  double d = 0.0;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    d = GSL_MAX (d, fabs (x[i] - y[i]));
+
+  return d;
+}
+
+/* run 'call' on C with nt threads, starting from C0 */
+#define THREAD_RUN(nt, C, C0, n, call) \
+  do { cblas_set_num_threads (nt); memcpy (C, C0, (n) * sizeof (double)); call; } while (0)
+
+void
+test_thread (void)
+{
+  const int n = SIZE, lda = SIZE + 1;
+  const size_t len = 2 * (size_t) n * lda;
+  const double alpha[2] = { 0.8, 0.3 }, beta[2] = { -0.5, 0.25 };
+  const int order[] = { CblasRowMajor, CblasColMajor };
+  const int saved = cblas_get_num_threads ();
+  double *A = malloc (len * sizeof (double));
+  double *B = malloc (len * sizeof (double));
+  double *C0 = malloc (len * sizeof (double));
+  double *C1 = malloc (len * sizeof (double));
+  double *Cn = malloc (len * sizeof (double));
+  double *Cm = malloc (len * sizeof (double));
+  size_t o;
+
+  test_thread_fill (A, len, 1);
+  test_thread_fill (B, len, 2);
+  test_thread_fill (C0, len, 3);
+
+  cblas_set_num_threads (NT);
+  gsl_test_int (cblas_get_num_threads (), NT, "cblas_get_num_threads");
+
+  for (o = 0; o < 2; o++)
+    {
+      const int ord = order[o];
+
+      THREAD_RUN (1, C1, C0, len, cblas_dgemm (ord, CblasNoTrans, CblasTrans, n, n - 7, n, alpha[0], A, lda, B, lda, beta[0], C1, lda));
+      THREAD_RUN (NT, Cn, C0, len, cblas_dgemm (ord, CblasNoTrans, CblasTrans, n, n - 7, n, alpha[0], A, lda, B, lda, beta[0], Cn, lda));
+      gsl_test (memcmp (C1, Cn, len * sizeof (double)) != 0, "dgemm threaded order=%d", ord);
+
+      THREAD_RUN (1, C1, C0, len, cblas_zgemm (ord, CblasConjTrans, CblasNoTrans, n - 9, n, n, alpha, A, lda, B, lda, beta, C1, lda));
+      THREAD_RUN (NT, Cn, C0, len, cblas_zgemm (ord, CblasConjTrans, CblasNoTrans, n - 9, n, n, alpha, A, lda, B, lda, beta, Cn, lda));
+      gsl_test (memcmp (C1, Cn, len * sizeof (double)) != 0, "zgemm threaded order=%d", ord);
+
+      THREAD_RUN (1, C1, C0, len, cblas_dsymm (ord, CblasLeft, CblasUpper, n, n - 3, alpha[0], A, lda, B, lda, beta[0], C1, lda));
+      THREAD_RUN (NT, Cn, C0, len, cblas_dsymm (ord, CblasLeft, CblasUpper, n, n - 3, alpha[0], A, lda, B, lda, beta[0], Cn, lda));
+      gsl_test (memcmp (C1, Cn, len * sizeof (double)) != 0, "dsymm threaded order=%d", ord);
+
+      THREAD_RUN (1, C1, C0, len, cblas_zhemm (ord, CblasRight, CblasLower, n - 5, n, alpha, A, lda, B, lda, beta, C1, lda));
+      THREAD_RUN (NT, Cn, C0, len, cblas_zhemm (ord, CblasRight, CblasLower, n - 5, n, alpha, A, lda, B, lda, beta, Cn, lda));
+      gsl_test (memcmp (C1, Cn, len * sizeof (double)) != 0, "zhemm threaded order=%d", ord);
+
+      test_thread_diag (A, n, lda, 1);
+
+      THREAD_RUN (1, C1, C0, len, cblas_dtrsm (ord, CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit, n, n, alpha[0], A, lda, C1, lda));
+      THREAD_RUN (NT, Cn, C0, len, cblas_dtrsm (ord, CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit, n, n, alpha[0], A, lda, Cn, lda));
+      gsl_test (memcmp (C1, Cn, len * sizeof (double)) != 0, "dtrsm threaded order=%d", ord);
+
+      THREAD_RUN (1, C1, C0, len, cblas_dtrmm (ord, CblasRight, CblasUpper, CblasTrans, CblasUnit, n, n, alpha[0], A, lda, C1, lda));
+      THREAD_RUN (NT, Cn, C0, len, cblas_dtrmm (ord, CblasRight, CblasUpper, CblasTrans, CblasUnit, n, n, alpha[0], A, lda, Cn, lda));
+      gsl_test (memcmp (C1, Cn, len * sizeof (double)) != 0, "dtrmm threaded order=%d", ord);
+
+      test_thread_diag (A, n, lda, 2);
+
+      THREAD_RUN (1, C1, C0, len, cblas_ztrsm (ord, CblasRight, CblasUpper, CblasConjTrans, CblasNonUnit, n, n, alpha, A, lda, C1, lda));
+      THREAD_RUN (NT, Cn, C0, len, cblas_ztrsm (ord, CblasRight, CblasUpper, CblasConjTrans, CblasNonUnit, n, n, alpha, A, lda, Cn, lda));
+      gsl_test (memcmp (C1, Cn, len * sizeof (double)) != 0, "ztrsm threaded order=%d", ord);
+
+      THREAD_RUN (1, C1, C0, len, cblas_ztrmm (ord, CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit, n, n, alpha, A, lda, C1, lda));
+      THREAD_RUN (NT, Cn, C0, len, cblas_ztrmm (ord, CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit, n, n, alpha, A, lda, Cn, lda));
+      gsl_test (memcmp (C1, Cn, len * sizeof (double)) != 0, "ztrmm threaded order=%d", ord);
+
+      THREAD_RUN (1, C1, C0, len, cblas_dsyrk (ord, CblasUpper, CblasNoTrans, n, n, alpha[0], A, lda, beta[0], C1, lda));
+      THREAD_RUN (NT, Cn, C0, len, cblas_dsyrk (ord, CblasUpper, CblasNoTrans, n, n, alpha[0], A, lda, beta[0], Cn, lda));
+      THREAD_RUN (NT, Cm, C0, len, cblas_dsyrk (ord, CblasUpper, CblasNoTrans, n, n, alpha[0], A, lda, beta[0], Cm, lda));
+      gsl_test (test_thread_maxdiff (C1, Cn, len) > 1.0e-8, "dsyrk threaded order=%d", ord);
+      gsl_test (memcmp (Cn, Cm, len * sizeof (double)) != 0, "dsyrk threaded reproducible order=%d", ord);
+
+      THREAD_RUN (1, C1, C0, len, cblas_zherk (ord, CblasLower, CblasConjTrans, n, n, alpha[0], A, lda, beta[0], C1, lda));
+      THREAD_RUN (NT, Cn, C0, len, cblas_zherk (ord, CblasLower, CblasConjTrans, n, n, alpha[0], A, lda, beta[0], Cn, lda));
+      THREAD_RUN (NT, Cm, C0, len, cblas_zherk (ord, CblasLower, CblasConjTrans, n, n, alpha[0], A, lda, beta[0], Cm, lda));
+      gsl_test (test_thread_maxdiff (C1, Cn, len) > 1.0e-8, "zherk threaded order=%d", ord);
+      gsl_test (memcmp (Cn, Cm, len * sizeof (double)) != 0, "zherk threaded reproducible order=%d", ord);
+    }
+
+  cblas_set_num_threads (saved);
+
+  free (A);
+  free (B);
+  free (C0);
+  free (C1);
+  free (Cn);
+  free (Cm);
+}
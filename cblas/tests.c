@@ -34,6 +34,7 @@
   test_her2 ();
   test_hpr2 ();
   test_gemm ();
+  test_gemm_large ();
   test_symm ();
   test_hemm ();
   test_syrk ();
@@ -42,3 +43,5 @@
   test_her2k ();
   test_trmm ();
   test_trsm ();
+  test_thread ();
+  test_simd ();
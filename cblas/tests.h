@@ -34,6 +34,7 @@ void test_spr2 (void);
 void test_her2 (void);
 void test_hpr2 (void);
 void test_gemm (void);
+void test_gemm_large (void);
 void test_symm (void);
 void test_hemm (void);
 void test_syrk (void);
@@ -42,3 +43,5 @@ void test_syr2k (void);
 void test_her2k (void);
 void test_trmm (void);
 void test_trsm (void);
+void test_thread (void);
+void test_simd (void);
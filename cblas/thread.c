@@ -0,0 +1,50 @@
+/* blas/thread.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Thread control for the level 3 routines.  Threading is opt-in: the
+ * library runs on a single thread unless cblas_set_num_threads() has
+ * been called or GSL_NUM_THREADS is set in the environment, and it is
+ * only available when the library was built with OpenMP. */
+
+#include <config.h>
+#include <stdlib.h>
+
+#include <gsl/gsl_cblas.h>
+
+/* 0 means not yet initialized from the environment */
+static int cblas_nthreads = 0;
+
+void
+cblas_set_num_threads (const int n)
+{
+  cblas_nthreads = (n > 0) ? n : 1;
+}
+
+int
+cblas_get_num_threads (void)
+{
+  if (cblas_nthreads == 0)
+    {
+      const char *s = getenv ("GSL_NUM_THREADS");
+      const int n = (s != NULL) ? atoi (s) : 1;
+      cblas_nthreads = (n > 0) ? n : 1;
+    }
+
+  return cblas_nthreads;
+}
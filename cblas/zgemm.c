@@ -1,3 +1,4 @@
+#include <stdlib.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_cblas.h>
 #include "cblas.h"
@@ -10,7 +11,9 @@ cblas_zgemm (const enum CBLAS_ORDER Order, const enum CBLAS_TRANSPOSE TransA,
              const void *B, const int ldb, const void *beta, void *C,
              const int ldc)
 {
+#define CBLAS_FN cblas_zgemm
 #define BASE double
 #include "source_gemm_c.h"
 #undef BASE
+#undef CBLAS_FN
 }
@@ -9,7 +9,11 @@ cblas_zherk (const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo,
              const double alpha, const void *A, const int lda,
              const double beta, void *C, const int ldc)
 {
+#define CBLAS_FN cblas_zherk
+#define CBLAS_GEMM_FN cblas_zgemm
 #define BASE double
 #include "source_herk.h"
 #undef BASE
+#undef CBLAS_FN
+#undef CBLAS_GEMM_FN
 }
@@ -9,7 +9,9 @@ cblas_zsymm (const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side,
              const void *alpha, const void *A, const int lda, const void *B,
              const int ldb, const void *beta, void *C, const int ldc)
 {
+#define CBLAS_FN cblas_zsymm
 #define BASE double
 #include "source_symm_c.h"
 #undef BASE
+#undef CBLAS_FN
 }
@@ -9,7 +9,11 @@ cblas_zsyrk (const enum CBLAS_ORDER Order, const enum CBLAS_UPLO Uplo,
              const void *alpha, const void *A, const int lda,
              const void *beta, void *C, const int ldc)
 {
+#define CBLAS_FN cblas_zsyrk
+#define CBLAS_GEMM_FN cblas_zgemm
 #define BASE double
 #include "source_syrk_c.h"
 #undef BASE
+#undef CBLAS_FN
+#undef CBLAS_GEMM_FN
 }
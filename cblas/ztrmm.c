@@ -10,7 +10,9 @@ cblas_ztrmm (const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side,
              const void *alpha, const void *A, const int lda, void *B,
              const int ldb)
 {
+#define CBLAS_FN cblas_ztrmm
 #define BASE double
 #include "source_trmm_c.h"
 #undef BASE
+#undef CBLAS_FN
 }
@@ -12,7 +12,9 @@ cblas_ztrsm (const enum CBLAS_ORDER Order, const enum CBLAS_SIDE Side,
              const void *alpha, const void *A, const int lda, void *B,
              const int ldb)
 {
+#define CBLAS_FN cblas_ztrsm
 #define BASE double
 #include "source_trsm_c.h"
 #undef BASE
+#undef CBLAS_FN
 }
@@ -57,6 +57,22 @@ gsl_eigen_symmv_workspace * gsl_eigen_symmv_alloc (const size_t n);
 void gsl_eigen_symmv_free (gsl_eigen_symmv_workspace * w);
 int gsl_eigen_symmv (gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec, gsl_eigen_symmv_workspace * w);
 
+typedef struct {
+  size_t size;
+  size_t nb;           /* bandwidth of the tridiagonal reduction */
+  double * d;
+  double * sd;
+  double * work;       /* 6 * size */
+  size_t * iwork;      /* 2 * size */
+  gsl_matrix * T;      /* nb-by-size block reflector factors */
+  gsl_matrix * W;      /* size-by-size */
+  gsl_matrix * U;      /* size-by-size */
+} gsl_eigen_symmv_dc_workspace;
+
+gsl_eigen_symmv_dc_workspace * gsl_eigen_symmv_dc_alloc (const size_t n);
+void gsl_eigen_symmv_dc_free (gsl_eigen_symmv_dc_workspace * w);
+int gsl_eigen_symmv_dc (gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec, gsl_eigen_symmv_dc_workspace * w);
+
 typedef struct {
   size_t size;
   double * d;
@@ -297,6 +313,41 @@ int gsl_eigen_genv_sort (gsl_vector_complex * alpha, gsl_vector * beta,
                          gsl_matrix_complex * evec,
                          gsl_eigen_sort_t sort_type);
 
+/* Partial eigensystems of large symmetric matrices and operators */
+
+typedef struct {
+  int (* matvec) (const gsl_vector * x, gsl_vector * y, void * params);
+  void * params;
+} gsl_eigen_symm_op;
+
+typedef struct {
+  size_t size;              /* matrix size n */
+  size_t nev;               /* number of wanted eigenpairs */
+  size_t ncv;               /* size of the Lanczos basis */
+  gsl_eigen_sort_t which;   /* which eigenpairs are wanted */
+  double tol;               /* relative residual tolerance */
+  size_t max_restarts;
+  size_t n_restarts;        /* number of restarts in last call */
+  size_t n_matvec;          /* number of products in last call */
+  gsl_matrix * V;           /* (ncv+1)-by-n Lanczos vectors in rows */
+  gsl_matrix * H;           /* ncv-by-ncv projected matrix */
+  gsl_matrix * S;           /* eigenvectors of H */
+  gsl_matrix * B;           /* restart buffer */
+  gsl_vector * theta;       /* Ritz values */
+  gsl_vector * h;           /* 2*(ncv+1) */
+  gsl_eigen_symmv_workspace * symmv_p;
+} gsl_eigen_symm_partial_workspace;
+
+gsl_eigen_symm_partial_workspace * gsl_eigen_symm_partial_alloc (const size_t n, const size_t k);
+void gsl_eigen_symm_partial_free (gsl_eigen_symm_partial_workspace * w);
+int gsl_eigen_symm_partial_params (const gsl_eigen_sort_t which, const double tol,
+                                   const size_t max_restarts,
+                                   gsl_eigen_symm_partial_workspace * w);
+int gsl_eigen_symm_partial (const gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec,
+                            gsl_eigen_symm_partial_workspace * w);
+int gsl_eigen_symm_partial_op (const gsl_eigen_symm_op * op, gsl_vector * eval,
+                               gsl_matrix * evec, gsl_eigen_symm_partial_workspace * w);
+
 /* Prototypes for the schur module */
 
 int gsl_schur_gen_eigvals(const gsl_matrix *A, const gsl_matrix *B,
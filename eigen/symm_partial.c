@@ -0,0 +1,435 @@
+/* eigen/symm_partial.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Selected eigenpairs of a large real symmetric matrix or operator by
+ * the thick restart Lanczos method.
+ *
+ * A basis V of ncv orthonormal Lanczos vectors is built from the
+ * products A v_j, each orthogonalized against all previous vectors
+ * (classical Gram-Schmidt applied twice), so that H = V^T A V is
+ * formed explicitly. The wanted eigenpairs are approximated by the
+ * Ritz pairs (theta_i, V^T s_i) of H, whose residual norms are
+ * |beta s_{ncv-1,i}|, with beta the norm of the next Lanczos vector.
+ * When they have not converged, the basis is restarted with the best
+ * Ritz vectors and the next Lanczos vector, which keeps the Krylov
+ * information of the wanted part of the spectrum.
+ *
+ * Only products with A are needed, and the storage is O(ncv n), with
+ * ncv about twice the number of wanted eigenpairs.
+ *
+ * See Wu and Simon, "Thick-restart Lanczos method for large symmetric
+ * eigenvalue problems", SIAM J. Matrix Anal. Appl. 22 (2000) 602-616.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_eigen.h>
+
+/* number of columns of V updated at once in a restart */
+#define PARTIAL_BLOCK 256
+
+static int partial_dense_matvec (const gsl_vector * x, gsl_vector * y, void * params);
+static double partial_orthog (const gsl_matrix * V, const size_t j, gsl_vector * x,
+                              gsl_vector * h, double * xnorm);
+static void partial_random (gsl_vector * x, unsigned long * seed);
+static void partial_restart (gsl_matrix * V, const gsl_matrix * S, const size_t l,
+                             const size_t m, gsl_matrix * B);
+
+gsl_eigen_symm_partial_workspace *
+gsl_eigen_symm_partial_alloc (const size_t n, const size_t k)
+{
+  gsl_eigen_symm_partial_workspace * w;
+  size_t m;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("matrix dimension must be positive integer", GSL_EINVAL);
+    }
+  else if (k == 0 || k > n)
+    {
+      GSL_ERROR_NULL ("number of eigenpairs must be between 1 and n", GSL_EINVAL);
+    }
+
+  w = calloc (1, sizeof (gsl_eigen_symm_partial_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  m = GSL_MIN (n, GSL_MAX (2 * k, k + 16));
+
+  w->size = n;
+  w->nev = k;
+  w->ncv = m;
+
+  w->V = gsl_matrix_alloc (m + 1, n);
+  w->H = gsl_matrix_alloc (m, m);
+  w->S = gsl_matrix_alloc (m, m);
+  w->B = gsl_matrix_alloc (m, GSL_MIN (n, PARTIAL_BLOCK));
+  w->theta = gsl_vector_alloc (m);
+  w->h = gsl_vector_alloc (2 * (m + 1));
+  w->symmv_p = gsl_eigen_symmv_alloc (m);
+
+  if (w->V == 0 || w->H == 0 || w->S == 0 || w->B == 0 ||
+      w->theta == 0 || w->h == 0 || w->symmv_p == 0)
+    {
+      gsl_eigen_symm_partial_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for Lanczos basis", GSL_ENOMEM);
+    }
+
+  gsl_eigen_symm_partial_params (GSL_EIGEN_SORT_VAL_DESC, 1.0e-10, 1000, w);
+
+  return w;
+}
+
+void
+gsl_eigen_symm_partial_free (gsl_eigen_symm_partial_workspace * w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->symmv_p)
+    gsl_eigen_symmv_free (w->symmv_p);
+
+  if (w->h)
+    gsl_vector_free (w->h);
+
+  if (w->theta)
+    gsl_vector_free (w->theta);
+
+  if (w->B)
+    gsl_matrix_free (w->B);
+
+  if (w->S)
+    gsl_matrix_free (w->S);
+
+  if (w->H)
+    gsl_matrix_free (w->H);
+
+  if (w->V)
+    gsl_matrix_free (w->V);
+
+  free (w);
+}
+
+/*
+gsl_eigen_symm_partial_params()
+  Set which eigenpairs are computed, the convergence tolerance and
+the maximum number of restarts
+
+Inputs: which        - GSL_EIGEN_SORT_VAL_DESC: largest eigenvalues
+                       GSL_EIGEN_SORT_VAL_ASC: smallest eigenvalues
+                       GSL_EIGEN_SORT_ABS_DESC: largest in magnitude
+        tol          - an eigenpair (lambda, x) has converged when
+                       ||A x - lambda x|| <= tol ||A||
+        max_restarts - maximum number of restarts
+        w            - workspace
+*/
+
+int
+gsl_eigen_symm_partial_params (const gsl_eigen_sort_t which, const double tol,
+                               const size_t max_restarts,
+                               gsl_eigen_symm_partial_workspace * w)
+{
+  if (which != GSL_EIGEN_SORT_VAL_DESC && which != GSL_EIGEN_SORT_VAL_ASC &&
+      which != GSL_EIGEN_SORT_ABS_DESC)
+    {
+      GSL_ERROR ("eigenvalues of smallest magnitude are not supported", GSL_EINVAL);
+    }
+  else if (tol <= 0.0)
+    {
+      GSL_ERROR ("tolerance must be positive", GSL_EINVAL);
+    }
+  else
+    {
+      w->which = which;
+      w->tol = tol;
+      w->max_restarts = max_restarts;
+      return GSL_SUCCESS;
+    }
+}
+
+int
+gsl_eigen_symm_partial (const gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec,
+                        gsl_eigen_symm_partial_workspace * w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square to compute eigenvalues", GSL_ENOTSQR);
+    }
+  else if (A->size1 != w->size)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_eigen_symm_op op;
+
+      /* A is only read by partial_dense_matvec */
+      op.matvec = partial_dense_matvec;
+      op.params = (void *) A;
+
+      return gsl_eigen_symm_partial_op (&op, eval, evec, w);
+    }
+}
+
+/*
+gsl_eigen_symm_partial_op()
+  Compute the eigenpairs selected by gsl_eigen_symm_partial_params()
+of the symmetric operator y = A x
+
+Inputs: op   - operator, op->matvec (x, y, op->params) stores A x in y
+               and returns GSL_SUCCESS, or an error code which is
+               returned to the caller
+        eval - (output) k eigenvalues, sorted as selected
+        evec - (output) n-by-k matrix of eigenvectors
+        w    - workspace
+
+Return: success/error
+*/
+
+int
+gsl_eigen_symm_partial_op (const gsl_eigen_symm_op * op, gsl_vector * eval,
+                           gsl_matrix * evec, gsl_eigen_symm_partial_workspace * w)
+{
+  if (eval->size != w->nev)
+    {
+      GSL_ERROR ("eigenvalue vector must match number of eigenpairs", GSL_EBADLEN);
+    }
+  else if (evec->size1 != w->size || evec->size2 != w->nev)
+    {
+      GSL_ERROR ("eigenvector matrix must be n-by-k", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t k = w->nev;
+      const size_t m = w->ncv;
+      gsl_matrix *V = w->V;
+      gsl_matrix *H = w->H;
+      unsigned long seed = 1;
+      double beta = 0.0;
+      size_t l = 0;
+      size_t i, j;
+      int status = GSL_SUCCESS;
+
+      w->n_restarts = 0;
+      w->n_matvec = 0;
+
+      gsl_matrix_set_zero (H);
+
+      {
+        gsl_vector_view v0 = gsl_matrix_row (V, 0);
+        partial_random (&v0.vector, &seed);
+        gsl_vector_scale (&v0.vector, 1.0 / gsl_blas_dnrm2 (&v0.vector));
+      }
+
+      while (1)
+        {
+          double hnorm = 0.0;
+          size_t nconv = 0;
+
+          /* extend the Lanczos basis to m vectors */
+          for (j = l; j < m; ++j)
+            {
+              gsl_vector_view vj = gsl_matrix_row (V, j);
+              gsl_vector_view vn = gsl_matrix_row (V, j + 1);
+              double xnorm;
+
+              status = op->matvec (&vj.vector, &vn.vector, op->params);
+              if (status)
+                return status;
+
+              ++w->n_matvec;
+
+              beta = partial_orthog (V, j + 1, &vn.vector, w->h, &xnorm);
+
+              for (i = 0; i <= j; ++i)
+                {
+                  const double hij = gsl_vector_get (w->h, i);
+                  gsl_matrix_set (H, i, j, hij);
+                  gsl_matrix_set (H, j, i, hij);
+                }
+
+              if (beta <= 10.0 * GSL_DBL_EPSILON * xnorm)
+                {
+                  /* invariant subspace: continue with a random vector */
+                  beta = 0.0;
+
+                  if (j + 1 < m)
+                    {
+                      double rnorm;
+
+                      partial_random (&vn.vector, &seed);
+                      rnorm = partial_orthog (V, j + 1, &vn.vector, w->h, &xnorm);
+                      gsl_vector_scale (&vn.vector, 1.0 / rnorm);
+                    }
+                }
+              else
+                {
+                  gsl_vector_scale (&vn.vector, 1.0 / beta);
+                }
+
+              if (j + 1 < m)
+                {
+                  gsl_matrix_set (H, j + 1, j, beta);
+                  gsl_matrix_set (H, j, j + 1, beta);
+                }
+            }
+
+          /* Ritz pairs, wanted ones first */
+          gsl_eigen_symmv (H, w->theta, w->S, w->symmv_p);
+          gsl_eigen_symmv_sort (w->theta, w->S, w->which);
+
+          for (i = 0; i < m; ++i)
+            hnorm = GSL_MAX (hnorm, fabs (gsl_vector_get (w->theta, i)));
+
+          for (i = 0; i < k; ++i)
+            {
+              const double res = fabs (beta * gsl_matrix_get (w->S, m - 1, i));
+
+              if (res <= w->tol * hnorm)
+                ++nconv;
+            }
+
+          if (nconv == k)
+            break;
+
+          if (w->n_restarts >= w->max_restarts)
+            {
+              status = GSL_EMAXITER;
+              break;
+            }
+
+          /* thick restart with l Ritz vectors and v_m */
+
+          l = GSL_MIN (k + (m - k) / 2, m - 1);
+
+          partial_restart (V, w->S, l, m, w->B);
+
+          {
+            gsl_vector_view vl = gsl_matrix_row (V, l);
+            gsl_vector_view vm = gsl_matrix_row (V, m);
+            gsl_vector_memcpy (&vl.vector, &vm.vector);
+          }
+
+          gsl_matrix_set_zero (H);
+
+          for (i = 0; i < l; ++i)
+            gsl_matrix_set (H, i, i, gsl_vector_get (w->theta, i));
+
+          ++w->n_restarts;
+        }
+
+      /* Ritz vectors x_i = V^T s_i */
+      {
+        gsl_matrix_const_view Vm = gsl_matrix_const_submatrix (V, 0, 0, m, w->size);
+        gsl_matrix_const_view Sk = gsl_matrix_const_submatrix (w->S, 0, 0, m, k);
+        gsl_vector_const_view tk = gsl_vector_const_subvector (w->theta, 0, k);
+
+        gsl_blas_dgemm (CblasTrans, CblasNoTrans, 1.0, &Vm.matrix, &Sk.matrix, 0.0, evec);
+        gsl_vector_memcpy (eval, &tk.vector);
+      }
+
+      if (status)
+        {
+          GSL_ERROR ("maximum restarts reached without convergence", GSL_EMAXITER);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+static int
+partial_dense_matvec (const gsl_vector * x, gsl_vector * y, void * params)
+{
+  const gsl_matrix *A = (const gsl_matrix *) params;
+  return gsl_blas_dsymv (CblasLower, 1.0, A, x, 0.0, y);
+}
+
+/*
+partial_orthog()
+  Orthogonalize x against rows 0,...,j-1 of V by classical Gram-Schmidt
+applied twice. On output h(0:j) contains the coefficients of x in the
+rows of V and xnorm the norm of x on input.
+
+Return: norm of x on output
+*/
+
+static double
+partial_orthog (const gsl_matrix * V, const size_t j, gsl_vector * x,
+                gsl_vector * h, double * xnorm)
+{
+  gsl_matrix_const_view Vj = gsl_matrix_const_submatrix (V, 0, 0, j, V->size2);
+  gsl_vector_view h1 = gsl_vector_subvector (h, 0, j);
+  gsl_vector_view h2 = gsl_vector_subvector (h, j, j);
+
+  *xnorm = gsl_blas_dnrm2 (x);
+
+  gsl_blas_dgemv (CblasNoTrans, 1.0, &Vj.matrix, x, 0.0, &h1.vector);
+  gsl_blas_dgemv (CblasTrans, -1.0, &Vj.matrix, &h1.vector, 1.0, x);
+
+  gsl_blas_dgemv (CblasNoTrans, 1.0, &Vj.matrix, x, 0.0, &h2.vector);
+  gsl_blas_dgemv (CblasTrans, -1.0, &Vj.matrix, &h2.vector, 1.0, x);
+
+  gsl_vector_add (&h1.vector, &h2.vector);
+
+  return gsl_blas_dnrm2 (x);
+}
+
+/* reproducible starting vectors, uniform in [-1/2,1/2) */
+static void
+partial_random (gsl_vector * x, unsigned long * seed)
+{
+  size_t i;
+
+  for (i = 0; i < x->size; ++i)
+    {
+      *seed = (*seed * 69069UL + 1UL) & 0xffffffffUL;
+      gsl_vector_set (x, i, *seed / 4294967296.0 - 0.5);
+    }
+}
+
+/* V(0:l,:) := S(:,0:l)^T V(0:m,:), in blocks of columns of V */
+static void
+partial_restart (gsl_matrix * V, const gsl_matrix * S, const size_t l,
+                 const size_t m, gsl_matrix * B)
+{
+  const size_t n = V->size2;
+  const size_t nb = B->size2;
+  gsl_matrix_const_view Sl = gsl_matrix_const_submatrix (S, 0, 0, m, l);
+  size_t c;
+
+  for (c = 0; c < n; c += nb)
+    {
+      const size_t nc = GSL_MIN (nb, n - c);
+      gsl_matrix_view Vm = gsl_matrix_submatrix (V, 0, c, m, nc);
+      gsl_matrix_view Vl = gsl_matrix_submatrix (V, 0, c, l, nc);
+      gsl_matrix_view Bl = gsl_matrix_submatrix (B, 0, 0, l, nc);
+
+      gsl_blas_dgemm (CblasTrans, CblasNoTrans, 1.0, &Sl.matrix, &Vm.matrix, 0.0, &Bl.matrix);
+      gsl_matrix_memcpy (&Vl.matrix, &Bl.matrix);
+    }
+}
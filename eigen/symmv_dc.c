@@ -0,0 +1,674 @@
+/* eigen/symmv_dc.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Eigenvalues and eigenvectors of a real symmetric matrix by the
+ * divide and conquer method.
+ *
+ * The matrix is reduced to tridiagonal form with the two-stage
+ * reduction gsl_linalg_symmtd2_decomp. The tridiagonal matrix
+ *
+ *   T = [ T1  0  ] + rho v v^T,  v = e_{n1} + e_{n1+1}
+ *       [ 0   T2 ]
+ *
+ * is split by a rank one modification, the eigensystems T1 = Q1 D1 Q1^T
+ * and T2 = Q2 D2 Q2^T are computed recursively, and those of
+ *
+ *   T = diag(Q1,Q2) (D + rho z z^T) diag(Q1,Q2)^T
+ *
+ * follow from the roots of the secular equation
+ *
+ *   1 + rho sum_i z_i^2 / (d_i - lambda) = 0
+ *
+ * The eigenvectors of T are then formed with one matrix product, so
+ * that most of the work is done by Level 3 BLAS, instead of the
+ * Givens rotations of the implicit QR method of gsl_eigen_symmv.
+ * Components of z which are negligible, or belong to nearly equal
+ * d_i, are deflated. The eigenvectors of the rank one modification are
+ * computed from the recomputed z of Gu and Eisenstat, which keeps them
+ * orthogonal.
+ *
+ * See Cuppen, "A divide and conquer method for the symmetric
+ * tridiagonal eigenproblem", Numer. Math. 36 (1981) 177-195, and Gu and
+ * Eisenstat, SIAM J. Matrix Anal. Appl. 16 (1995) 172-191.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_sort_double.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_eigen.h>
+
+#include "qrstep.c"
+
+/* subproblems up to this size are solved by the QR method */
+#define DC_CROSSOVER 25
+
+/* bandwidth of the first stage of the tridiagonal reduction */
+#define DC_NB 32
+
+/* maximum number of iterations for a root of the secular equation */
+#define DC_MAXITER 100
+
+static void dc_solve (const size_t n, double * d, double * e, gsl_matrix * Q,
+                      gsl_eigen_symmv_dc_workspace * w);
+static void dc_base (const size_t n, double * d, double * e, gsl_matrix * Q,
+                     gsl_eigen_symmv_dc_workspace * w);
+static void dc_merge (const size_t n, const size_t n1, double * d, double rho,
+                      gsl_matrix * Q, gsl_eigen_symmv_dc_workspace * w);
+static double dc_secular (const size_t k, const double * d, const double * z,
+                          const double rho, const size_t j, double * delta);
+
+gsl_eigen_symmv_dc_workspace *
+gsl_eigen_symmv_dc_alloc (const size_t n)
+{
+  gsl_eigen_symmv_dc_workspace * w;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("matrix dimension must be positive integer", GSL_EINVAL);
+    }
+
+  w = calloc (1, sizeof (gsl_eigen_symmv_dc_workspace));
+
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->size = n;
+  w->nb = GSL_MAX (1, GSL_MIN (DC_NB, n - 1));
+
+  w->d = malloc (n * sizeof (double));
+  w->sd = malloc (n * sizeof (double));
+  w->work = malloc (6 * n * sizeof (double));
+  w->iwork = malloc (2 * n * sizeof (size_t));
+
+  if (w->d == 0 || w->sd == 0 || w->work == 0 || w->iwork == 0)
+    {
+      gsl_eigen_symmv_dc_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for work arrays", GSL_ENOMEM);
+    }
+
+  w->T = gsl_matrix_alloc (w->nb, n);
+  w->W = gsl_matrix_alloc (n, n);
+  w->U = gsl_matrix_alloc (n, n);
+
+  if (w->T == 0 || w->W == 0 || w->U == 0)
+    {
+      gsl_eigen_symmv_dc_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for work matrices", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_eigen_symmv_dc_free (gsl_eigen_symmv_dc_workspace * w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->U)
+    gsl_matrix_free (w->U);
+
+  if (w->W)
+    gsl_matrix_free (w->W);
+
+  if (w->T)
+    gsl_matrix_free (w->T);
+
+  free (w->iwork);
+  free (w->work);
+  free (w->sd);
+  free (w->d);
+  free (w);
+}
+
+int
+gsl_eigen_symmv_dc (gsl_matrix * A, gsl_vector * eval, gsl_matrix * evec,
+                    gsl_eigen_symmv_dc_workspace * w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR ("matrix must be square to compute eigenvalues", GSL_ENOTSQR);
+    }
+  else if (eval->size != A->size1)
+    {
+      GSL_ERROR ("eigenvalue vector must match matrix size", GSL_EBADLEN);
+    }
+  else if (evec->size1 != A->size1 || evec->size2 != A->size1)
+    {
+      GSL_ERROR ("eigenvector matrix must match matrix size", GSL_EBADLEN);
+    }
+  else if (A->size1 != w->size)
+    {
+      GSL_ERROR ("matrix size does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t N = A->size1;
+      double *const d = w->d;
+      double *const sd = w->sd;
+      gsl_vector_view d_vec = gsl_vector_view_array (d, N);
+      double scale = 0.0;
+      size_t i;
+
+      if (N == 1)
+        {
+          double A00 = gsl_matrix_get (A, 0, 0);
+          gsl_vector_set (eval, 0, A00);
+          gsl_matrix_set (evec, 0, 0, 1.0);
+          return GSL_SUCCESS;
+        }
+
+      gsl_linalg_symmtd2_decomp (A, w->T);
+
+      {
+        gsl_vector_view sd_vec = gsl_vector_view_array (sd, N - 1);
+        gsl_linalg_symmtd_unpack_T (A, &d_vec.vector, &sd_vec.vector);
+      }
+
+      /* scale T to avoid overflow in the secular equation */
+
+      for (i = 0; i < N; ++i)
+        scale = GSL_MAX (scale, fabs (d[i]));
+
+      for (i = 0; i < N - 1; ++i)
+        scale = GSL_MAX (scale, fabs (sd[i]));
+
+      if (scale > 0.0)
+        {
+          for (i = 0; i < N; ++i)
+            d[i] /= scale;
+
+          for (i = 0; i < N - 1; ++i)
+            sd[i] /= scale;
+        }
+
+      /* eigenvectors of T in evec */
+      dc_solve (N, d, sd, evec, w);
+
+      if (scale > 0.0)
+        {
+          for (i = 0; i < N; ++i)
+            d[i] *= scale;
+        }
+
+      gsl_vector_memcpy (eval, &d_vec.vector);
+
+      /* eigenvectors of A = Q T Q^T */
+      {
+        gsl_matrix_view work = gsl_matrix_submatrix (w->W, 0, 0, w->nb, N);
+        gsl_linalg_symmtd2_Qmat (A, w->T, evec, &work.matrix);
+      }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* eigenvalues d and eigenvectors Q of the n-by-n tridiagonal matrix
+   with diagonal d and subdiagonal e */
+static void
+dc_solve (const size_t n, double * d, double * e, gsl_matrix * Q,
+          gsl_eigen_symmv_dc_workspace * w)
+{
+  if (n <= DC_CROSSOVER)
+    {
+      dc_base (n, d, e, Q, w);
+    }
+  else
+    {
+      const size_t n1 = n / 2;
+      const size_t n2 = n - n1;
+      const double rho = e[n1 - 1];
+      gsl_matrix_view Q11 = gsl_matrix_submatrix (Q, 0, 0, n1, n1);
+      gsl_matrix_view Q12 = gsl_matrix_submatrix (Q, 0, n1, n1, n2);
+      gsl_matrix_view Q21 = gsl_matrix_submatrix (Q, n1, 0, n2, n1);
+      gsl_matrix_view Q22 = gsl_matrix_submatrix (Q, n1, n1, n2, n2);
+
+      /* T = diag(T1, T2) + rho v v^T */
+      d[n1 - 1] -= rho;
+      d[n1] -= rho;
+
+      dc_solve (n1, d, e, &Q11.matrix, w);
+      dc_solve (n2, d + n1, e + n1, &Q22.matrix, w);
+
+      gsl_matrix_set_zero (&Q12.matrix);
+      gsl_matrix_set_zero (&Q21.matrix);
+
+      dc_merge (n, n1, d, rho, Q, w);
+    }
+}
+
+/* small problems: implicit QR as in gsl_eigen_symmv */
+static void
+dc_base (const size_t n, double * d, double * e, gsl_matrix * Q,
+         gsl_eigen_symmv_dc_workspace * w)
+{
+  double *const gc = w->work;
+  double *const gs = w->work + n;
+  size_t a, b;
+
+  gsl_matrix_set_identity (Q);
+
+  if (n == 1)
+    return;
+
+  chop_small_elements (n, d, e);
+
+  b = n - 1;
+
+  while (b > 0)
+    {
+      if (e[b - 1] == 0.0 || isnan (e[b - 1]))
+        {
+          b--;
+          continue;
+        }
+
+      a = b - 1;
+
+      while (a > 0)
+        {
+          if (e[a - 1] == 0.0)
+            break;
+
+          a--;
+        }
+
+      {
+        const size_t n_block = b - a + 1;
+        size_t i, k;
+
+        qrstep (n_block, d + a, e + a, gc, gs);
+
+        for (i = 0; i < n_block - 1; i++)
+          {
+            const double c = gc[i], s = gs[i];
+
+            for (k = 0; k < n; k++)
+              {
+                double qki = gsl_matrix_get (Q, k, a + i);
+                double qkj = gsl_matrix_get (Q, k, a + i + 1);
+                gsl_matrix_set (Q, k, a + i, qki * c - qkj * s);
+                gsl_matrix_set (Q, k, a + i + 1, qki * s + qkj * c);
+              }
+          }
+
+        chop_small_elements (n, d, e);
+      }
+    }
+}
+
+/*
+dc_merge()
+  Eigensystem of diag(Q1,Q2) (D + rho z z^T) diag(Q1,Q2)^T, where
+Q = diag(Q1,Q2) and D = d on input, with Q1 of size n1. On output d
+and Q contain the eigenvalues and eigenvectors, with the eigenvalues
+from the secular equation first, followed by the deflated ones.
+*/
+
+static void
+dc_merge (const size_t n, const size_t n1, double * d, double rho,
+          gsl_matrix * Q, gsl_eigen_symmv_dc_workspace * w)
+{
+  double *const z = w->work;
+  double *const key = z + n;
+  double *const dk = key + n;
+  double *const zk = dk + n;
+  double *const lam = zk + n;
+  double *const delta = lam + n;
+  size_t *const idx = w->iwork;
+  size_t *const cols = w->iwork + n;
+  double sgn, nz = 0.0, dmax = 0.0, zmax = 0.0, tol;
+  size_t i, j, k = 0, nd = 0, prev = n;
+
+  /* z = diag(Q1,Q2)^T v: last row of Q1 and first row of Q2 */
+  for (i = 0; i < n; ++i)
+    {
+      z[i] = gsl_matrix_get (Q, (i < n1) ? n1 - 1 : n1, i);
+      nz += z[i] * z[i];
+    }
+
+  nz = sqrt (nz);
+
+  for (i = 0; i < n; ++i)
+    z[i] /= nz;
+
+  rho *= nz * nz;
+
+  /* D + rho z z^T = sgn (sgn D + |rho| z z^T) */
+  sgn = (rho < 0.0) ? -1.0 : 1.0;
+  rho = fabs (rho);
+
+  for (i = 0; i < n; ++i)
+    {
+      key[i] = sgn * d[i];
+      dmax = GSL_MAX (dmax, fabs (key[i]));
+      zmax = GSL_MAX (zmax, fabs (z[i]));
+    }
+
+  gsl_sort_index (idx, key, 1, n);
+
+  /* deflation */
+
+  tol = 8.0 * GSL_DBL_EPSILON * GSL_MAX (dmax, rho * zmax);
+
+  for (j = 0; j < n; ++j)
+    {
+      const size_t c = idx[j];
+
+      if (rho * fabs (z[c]) <= tol)
+        {
+          /* e_c is an eigenvector */
+          cols[n - 1 - nd++] = c;
+        }
+      else if (prev == n)
+        {
+          prev = c;
+        }
+      else
+        {
+          const double r = hypot (z[prev], z[c]);
+          const double cs = z[c] / r;
+          const double sn = -z[prev] / r;
+          const double t = key[c] - key[prev];
+
+          if (fabs (t * cs * sn) <= tol)
+            {
+              /* nearly equal d: rotate z[prev] to zero */
+              gsl_vector_view qp = gsl_matrix_column (Q, prev);
+              gsl_vector_view qc = gsl_matrix_column (Q, c);
+              const double kp = key[prev], kc = key[c];
+
+              gsl_blas_drot (&qp.vector, &qc.vector, cs, sn);
+
+              key[prev] = cs * cs * kp + sn * sn * kc;
+              key[c] = sn * sn * kp + cs * cs * kc;
+              z[prev] = 0.0;
+              z[c] = r;
+
+              cols[n - 1 - nd++] = prev;
+            }
+          else
+            {
+              cols[k++] = prev;
+            }
+
+          prev = c;
+        }
+    }
+
+  if (prev != n)
+    cols[k++] = prev;
+
+  /* secular equation for the remaining k eigenvalues */
+
+  if (k > 0)
+    {
+      gsl_matrix_view U = gsl_matrix_submatrix (w->U, 0, 0, k, k);
+
+      for (i = 0; i < k; ++i)
+        {
+          dk[i] = key[cols[i]];
+          zk[i] = z[cols[i]];
+        }
+
+      for (j = 0; j < k; ++j)
+        {
+          lam[j] = dc_secular (k, dk, zk, rho, j, delta);
+
+          for (i = 0; i < k; ++i)
+            gsl_matrix_set (&U.matrix, i, j, delta[i]);
+        }
+
+      /* z from the computed eigenvalues (Gu and Eisenstat):
+         z_i^2 = prod_j (lambda_j - d_i) / (rho prod_{j != i} (d_j - d_i)) */
+      for (i = 0; i < k; ++i)
+        {
+          double prod = -gsl_matrix_get (&U.matrix, i, i) / rho;
+
+          for (j = 0; j < k; ++j)
+            {
+              if (j != i)
+                prod *= -gsl_matrix_get (&U.matrix, i, j) / (dk[j] - dk[i]);
+            }
+
+          zk[i] = (zk[i] < 0.0) ? -sqrt (fabs (prod)) : sqrt (fabs (prod));
+        }
+
+      /* eigenvectors u_j = (D - lambda_j)^{-1} z / || . || */
+      for (i = 0; i < k; ++i)
+        {
+          double *row = gsl_matrix_ptr (&U.matrix, i, 0);
+
+          for (j = 0; j < k; ++j)
+            row[j] = zk[i] / row[j];
+        }
+
+      for (j = 0; j < k; ++j)
+        {
+          gsl_vector_view u = gsl_matrix_column (&U.matrix, j);
+          double unorm = gsl_blas_dnrm2 (&u.vector);
+
+          gsl_vector_scale (&u.vector, 1.0 / unorm);
+        }
+    }
+
+  /* W := Q with the columns reordered, Q := [ W(:,1:k) U, W(:,k+1:n) ] */
+
+  for (i = 0; i < n; ++i)
+    {
+      const double *qrow = gsl_matrix_const_ptr (Q, i, 0);
+      double *wrow = gsl_matrix_ptr (w->W, i, 0);
+
+      for (j = 0; j < n; ++j)
+        wrow[j] = qrow[cols[j]];
+    }
+
+  if (k > 0)
+    {
+      gsl_matrix_view Wk = gsl_matrix_submatrix (w->W, 0, 0, n, k);
+      gsl_matrix_view Uk = gsl_matrix_submatrix (w->U, 0, 0, k, k);
+      gsl_matrix_view Qk = gsl_matrix_submatrix (Q, 0, 0, n, k);
+
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &Wk.matrix, &Uk.matrix, 0.0, &Qk.matrix);
+    }
+
+  if (k < n)
+    {
+      gsl_matrix_view Wd = gsl_matrix_submatrix (w->W, 0, k, n, n - k);
+      gsl_matrix_view Qd = gsl_matrix_submatrix (Q, 0, k, n, n - k);
+
+      gsl_matrix_memcpy (&Qd.matrix, &Wd.matrix);
+    }
+
+  for (j = 0; j < k; ++j)
+    d[j] = sgn * lam[j];
+
+  for (j = k; j < n; ++j)
+    d[j] = sgn * key[cols[j]];
+}
+
+/*
+dc_secular()
+  Root j of the secular equation 1 + rho sum_i z_i^2 / (d_i - lambda) = 0,
+with rho > 0 and d strictly increasing, which lies in (d_j, d_{j+1}), or
+in (d_{k-1}, d_{k-1} + rho ||z||^2) for j = k - 1. The root is computed
+relative to the nearest pole d_o, lambda = d_o + tau, so that the
+differences delta_i = d_i - lambda, which are returned in delta, are
+accurate.
+
+Each iteration approximates the terms with poles at or below d_j and
+those above by a single pole each, matching values and derivatives
+(the "middle way" of Li), and solves the resulting quadratic; steps
+leaving the bracket of the root are replaced by bisection.
+*/
+
+static double
+dc_secular (const size_t k, const double * d, const double * z,
+            const double rho, const size_t j, double * delta)
+{
+  size_t o, i, iter;
+  double lo, hi, tau;
+
+  if (j + 1 < k)
+    {
+      const double mid = 0.5 * (d[j + 1] - d[j]);
+      double g = 1.0;
+
+      for (i = 0; i < k; ++i)
+        g += rho * z[i] * z[i] / ((d[i] - d[j]) - mid);
+
+      if (g > 0.0)
+        {
+          o = j;
+          lo = 0.0;
+          hi = mid;
+        }
+      else
+        {
+          o = j + 1;
+          lo = -mid;
+          hi = 0.0;
+        }
+    }
+  else
+    {
+      double zz = 0.0;
+
+      for (i = 0; i < k; ++i)
+        zz += z[i] * z[i];
+
+      o = j;
+      lo = 0.0;
+      hi = rho * zz * (1.0 + 8.0 * GSL_DBL_EPSILON);
+    }
+
+  for (i = 0; i < k; ++i)
+    delta[i] = d[i] - d[o];
+
+  tau = 0.5 * (lo + hi);
+
+  for (iter = 0; iter < DC_MAXITER; ++iter)
+    {
+      double psi = 0.0, dpsi = 0.0, phi = 0.0, dphi = 0.0;
+      double g, tnew = 0.0;
+      int valid = 0;
+
+      for (i = 0; i < k; ++i)
+        {
+          const double q = z[i] / (delta[i] - tau);
+
+          if (i <= j)
+            {
+              psi += z[i] * q;
+              dpsi += q * q;
+            }
+          else
+            {
+              phi += z[i] * q;
+              dphi += q * q;
+            }
+        }
+
+      g = 1.0 + rho * (psi + phi);
+
+      if (g == 0.0)
+        break;
+      else if (g < 0.0)
+        lo = tau;
+      else
+        hi = tau;
+
+      {
+        const double D1 = delta[j] - tau;
+        const double s1 = rho * dpsi * D1 * D1;
+
+        if (j + 1 < k)
+          {
+            const double D2 = delta[j + 1] - tau;
+            const double s2 = rho * dphi * D2 * D2;
+            const double c = g - s1 / D1 - s2 / D2;
+            const double b = c * (D1 + D2) + s1 + s2;
+            const double a0 = D1 * D2 * g;
+            const double disc = b * b - 4.0 * c * a0;
+
+            /* c eta^2 - b eta + a0 = 0 */
+            if (disc >= 0.0)
+              {
+                const double q = 0.5 * (b + ((b < 0.0) ? -sqrt (disc) : sqrt (disc)));
+                double eta[2];
+                int m = 0, l;
+
+                if (c != 0.0)
+                  eta[m++] = q / c;
+
+                if (q != 0.0)
+                  eta[m++] = a0 / q;
+
+                for (l = 0; l < m; ++l)
+                  {
+                    const double t = tau + eta[l];
+
+                    if (t > lo && t < hi && (!valid || fabs (eta[l]) < fabs (tnew - tau)))
+                      {
+                        tnew = t;
+                        valid = 1;
+                      }
+                  }
+              }
+          }
+        else
+          {
+            const double c = g - s1 / D1;
+
+            if (c > 0.0)
+              {
+                tnew = tau + D1 + s1 / c;
+                valid = (tnew > lo && tnew < hi);
+              }
+          }
+      }
+
+      if (!valid)
+        tnew = 0.5 * (lo + hi);
+
+      if (fabs (tnew - tau) <= 2.0 * GSL_DBL_EPSILON * fabs (tnew))
+        {
+          tau = tnew;
+          break;
+        }
+
+      tau = tnew;
+
+      if (hi - lo <= 2.0 * GSL_DBL_EPSILON * GSL_MAX (fabs (lo), fabs (hi)))
+        break;
+    }
+
+  for (i = 0; i < k; ++i)
+    delta[i] -= tau;
+
+  return d[o] + tau;
+}
@@ -22,6 +22,7 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <stdio.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_blas.h>
@@ -343,6 +344,7 @@ test_eigen_symm_matrix(const gsl_matrix * m, size_t count,
   gsl_matrix * evec = gsl_matrix_alloc(N, N);
   gsl_eigen_symm_workspace * w = gsl_eigen_symm_alloc(N);
   gsl_eigen_symmv_workspace * wv = gsl_eigen_symmv_alloc(N);
+  gsl_eigen_symmv_dc_workspace * wdc = gsl_eigen_symmv_dc_alloc(N);
 
   gsl_matrix_memcpy(A, m);
 
@@ -372,6 +374,16 @@ test_eigen_symm_matrix(const gsl_matrix * m, size_t count,
   gsl_eigen_symmv_sort(evalv, evec, GSL_EIGEN_SORT_ABS_DESC);
   test_eigen_symm_results(m, evalv, evec, count, desc, "abs/desc");
 
+  /* divide and conquer */
+  gsl_matrix_memcpy(A, m);
+
+  gsl_eigen_symmv_dc(A, evalv, evec, wdc);
+  test_eigen_symm_results(m, evalv, evec, count, desc, "dc");
+
+  gsl_vector_memcpy(y, evalv);
+  gsl_sort_vector(y);
+  test_eigenvalues_real(y, x, desc, "dc");
+
   gsl_matrix_free(A);
   gsl_vector_free(eval);
   gsl_vector_free(evalv);
@@ -380,6 +392,7 @@ test_eigen_symm_matrix(const gsl_matrix * m, size_t count,
   gsl_matrix_free(evec);
   gsl_eigen_symm_free(w);
   gsl_eigen_symmv_free(wv);
+  gsl_eigen_symmv_dc_free(wdc);
 } /* test_eigen_symm_matrix() */
 
 void
@@ -402,6 +415,41 @@ test_eigen_symm(void)
       gsl_matrix_free(A);
     }
 
+  /* larger matrices, which are split by gsl_eigen_symmv_dc */
+  {
+    const size_t sizes[] = { 30, 64, 100 };
+
+    for (n = 0; n < sizeof(sizes) / sizeof(sizes[0]); ++n)
+      {
+        const size_t N = sizes[n];
+        gsl_matrix * A = gsl_matrix_alloc(N, N);
+
+        create_random_symm_matrix(A, r, -10, 10);
+        test_eigen_symm_matrix(A, N, "symm random");
+
+        /* I + e e^T: eigenvalue 1 of multiplicity N - 1 */
+        gsl_matrix_set_all(A, 1.0);
+        for (i = 0; i < N; ++i)
+          gsl_matrix_set(A, i, i, 2.0);
+        test_eigen_symm_matrix(A, N, "symm rank one");
+
+        /* tridiagonal (-1,2,-1) */
+        gsl_matrix_set_zero(A);
+        for (i = 0; i < N; ++i)
+          {
+            gsl_matrix_set(A, i, i, 2.0);
+            if (i > 0)
+              {
+                gsl_matrix_set(A, i, i - 1, -1.0);
+                gsl_matrix_set(A, i - 1, i, -1.0);
+              }
+          }
+        test_eigen_symm_matrix(A, N, "symm laplacian");
+
+        gsl_matrix_free(A);
+      }
+  }
+
   gsl_rng_free(r);
 
   {
@@ -460,6 +508,165 @@ test_eigen_symm(void)
 
 } /* test_eigen_symm() */
 
+void
+test_eigen_symm_partial_results (const gsl_matrix * A, const gsl_vector * eval,
+                                 const gsl_matrix * evec, const gsl_eigen_sort_t which,
+                                 const double tol, const char * desc)
+{
+  const size_t N = A->size1;
+  const size_t k = eval->size;
+  gsl_matrix * B = gsl_matrix_alloc(N, N);
+  gsl_vector * x = gsl_vector_alloc(N);
+  gsl_vector * y = gsl_vector_alloc(N);
+  gsl_matrix * Z = gsl_matrix_alloc(N, N);
+  gsl_eigen_symmv_workspace * wv = gsl_eigen_symmv_alloc(N);
+  double emax = 0.0;
+  size_t i, j;
+
+  /* reference eigenvalues */
+  gsl_matrix_memcpy(B, A);
+  gsl_eigen_symmv(B, x, Z, wv);
+  gsl_eigen_symmv_sort(x, Z, which);
+
+  for (i = 0; i < N; ++i)
+    emax = GSL_MAX(emax, fabs(gsl_vector_get(x, i)));
+
+  for (i = 0; i < k; ++i)
+    {
+      double ei = gsl_vector_get(eval, i);
+      gsl_vector_const_view vi = gsl_matrix_const_column(evec, i);
+      double r;
+
+      gsl_test_abs(ei, gsl_vector_get(x, i), 10.0 * tol * emax,
+                   "%s, eigenvalue(%d)", desc, i);
+
+      /* || A v - lambda v || */
+      gsl_blas_dsymv(CblasLower, 1.0, A, &vi.vector, 0.0, y);
+      gsl_blas_daxpy(-ei, &vi.vector, y);
+      r = gsl_blas_dnrm2(y);
+      gsl_test_abs(r, 0.0, 10.0 * tol * emax, "%s, residual(%d)", desc, i);
+
+      for (j = 0; j <= i; ++j)
+        {
+          gsl_vector_const_view vj = gsl_matrix_const_column(evec, j);
+          double vivj;
+          gsl_blas_ddot(&vi.vector, &vj.vector, &vivj);
+          gsl_test_abs(vivj, (i == j) ? 1.0 : 0.0, N * GSL_DBL_EPSILON,
+                       "%s, orthonormal(%d,%d)", desc, i, j);
+        }
+    }
+
+  gsl_matrix_free(B);
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+  gsl_matrix_free(Z);
+  gsl_eigen_symmv_free(wv);
+}
+
+/* y = diag(1,2,...,n) x */
+static int
+test_eigen_symm_partial_diag(const gsl_vector * x, gsl_vector * y, void * params)
+{
+  size_t i;
+
+  (void) params;
+
+  for (i = 0; i < x->size; ++i)
+    gsl_vector_set(y, i, (i + 1.0) * gsl_vector_get(x, i));
+
+  return GSL_SUCCESS;
+}
+
+void
+test_eigen_symm_partial(void)
+{
+  const gsl_eigen_sort_t which[] = { GSL_EIGEN_SORT_VAL_DESC, GSL_EIGEN_SORT_VAL_ASC,
+                                     GSL_EIGEN_SORT_ABS_DESC };
+  const char * which_desc[] = { "val/desc", "val/asc", "abs/desc" };
+  const size_t sizes[] = { 1, 5, 40, 200 };
+  const size_t nev[] = { 1, 3, 10 };
+  const double tol = 1.0e-10;
+  gsl_rng *r = gsl_rng_alloc(gsl_rng_default);
+  size_t i, j, l;
+
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+      const size_t N = sizes[i];
+      gsl_matrix * A = gsl_matrix_alloc(N, N);
+
+      create_random_symm_matrix(A, r, -10, 10);
+
+      for (j = 0; j < sizeof(nev) / sizeof(nev[0]); ++j)
+        {
+          const size_t k = nev[j];
+          gsl_eigen_symm_partial_workspace * w;
+          gsl_vector * eval;
+          gsl_matrix * evec;
+
+          if (k > N)
+            continue;
+
+          w = gsl_eigen_symm_partial_alloc(N, k);
+          eval = gsl_vector_alloc(k);
+          evec = gsl_matrix_alloc(N, k);
+
+          for (l = 0; l < sizeof(which) / sizeof(which[0]); ++l)
+            {
+              int s;
+              char desc[64];
+
+              sprintf(desc, "symm partial N=%u k=%u %s", (unsigned int) N,
+                      (unsigned int) k, which_desc[l]);
+
+              gsl_eigen_symm_partial_params(which[l], tol, 1000, w);
+              s = gsl_eigen_symm_partial(A, eval, evec, w);
+              gsl_test(s, "%s, status", desc);
+
+              test_eigen_symm_partial_results(A, eval, evec, which[l], tol, desc);
+            }
+
+          gsl_vector_free(eval);
+          gsl_matrix_free(evec);
+          gsl_eigen_symm_partial_free(w);
+        }
+
+      gsl_matrix_free(A);
+    }
+
+  /* operator with eigenvalues 1,...,N */
+  {
+    const size_t N = 2000;
+    const size_t k = 10;
+    gsl_eigen_symm_partial_workspace * w = gsl_eigen_symm_partial_alloc(N, k);
+    gsl_vector * eval = gsl_vector_alloc(k);
+    gsl_matrix * evec = gsl_matrix_alloc(N, k);
+    gsl_eigen_symm_op op;
+    int s;
+
+    op.matvec = test_eigen_symm_partial_diag;
+    op.params = NULL;
+
+    s = gsl_eigen_symm_partial_op(&op, eval, evec, w);
+    gsl_test(s, "symm partial operator, status");
+
+    for (i = 0; i < k; ++i)
+      {
+        double vi = gsl_matrix_get(evec, N - 1 - i, i);
+
+        gsl_test_rel(gsl_vector_get(eval, i), (double) (N - i), 1.0e-10,
+                     "symm partial operator, eigenvalue(%d)", i);
+        gsl_test_rel(fabs(vi), 1.0, 1.0e-8,
+                     "symm partial operator, eigenvector(%d)", i);
+      }
+
+    gsl_vector_free(eval);
+    gsl_matrix_free(evec);
+    gsl_eigen_symm_partial_free(w);
+  }
+
+  gsl_rng_free(r);
+} /* test_eigen_symm_partial() */
+
 /******************************************
  * herm test code                         *
  ******************************************/
@@ -1337,6 +1544,7 @@ main()
   gsl_rng_env_setup ();
 
   test_eigen_symm();
+  test_eigen_symm_partial();
   test_eigen_herm();
   test_eigen_nonsymm();
   test_eigen_gensymm();
@@ -1,6 +1,7 @@
 /* fft/benchmark.c
  * 
  * Copyright (C) 1996, 1997, 1998, 1999, 2000, 2007 Brian Gough
+ * Copyright (C) 2026 The GSL Team
  * 
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -17,139 +18,300 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+/* MFLOPS of the complex mixed radix transforms.
+ *
+ * usage: benchmark [nmax]
+ *
+ * Forward transforms of unit stride data are timed in double and single
+ * precision for the powers of 2 from 16 to nmax (default 2^20),
+ * followed by lengths with factors 3, 5 and 7, and prime lengths which
+ * use Bluestein's algorithm.  As usual for FFTs the rate is computed
+ * from the nominal count of 5 n log2(n) floating point operations of a
+ * radix 2 transform, so that different lengths can be compared.  The
+ * kernels in use are printed first; set GSL_SIMD=generic to
+ * obtain the scalar passes for comparison.
+ *
+ * Square two-dimensional transforms of up to nmax elements are then
+ * timed in double precision, once as a loop of one-dimensional
+ * transforms over the rows and the strided columns, and once with
+ * gsl_fft_complex_nd_plan_execute, which copies blocks of columns to a
+ * buffer and uses GSL_NUM_THREADS threads.
+ *
+ * Finally real transforms of length n are timed in double precision
+ * with gsl_fft_real_transform and with gsl_fft_real_plan_r2c, next to
+ * the complex transform of the same length.  The rate is n points per
+ * transform, in millions per second, so r2c should be about twice as
+ * fast as the complex transform.  Build with "make benchmark". */
+
 #include <config.h>
-#include <stddef.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
-#include <float.h>
-
 #include <time.h>
 
-#include <gsl/gsl_complex.h>
 #include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_fft_complex_float.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft.h>
 
-#include <gsl/gsl_errno.h>
+#include "simd.h"
 
-#include "complex_internal.h"
-#include "bitreverse.h"
-#include "urand.c"
+/* repeat until at least 0.2 seconds have elapsed and return MFLOPS */
+#define TIME_MFLOPS(call, flops, result)                             \
+  do {                                                               \
+    clock_t start = clock (), end;                                   \
+    size_t count = 0;                                                \
+    do { call; count++; end = clock (); }                            \
+    while (end - start < CLOCKS_PER_SEC / 5);                        \
+    result = (flops) * count / ((double) (end - start) / CLOCKS_PER_SEC) * 1.0e-6; \
+  } while (0)
 
-void my_error_handler (const char *reason, const char *file,
-                       int line, int err);
+/* The transforms are not normalized, so repeated transforms of the same
+   array grow by about sqrt(n) each time; the data is rescaled whenever
+   it becomes large, which is rare enough not to affect the timing. */
 
-int
-main (int argc, char *argv[])
+static void
+execute (const gsl_fft_complex_plan * plan, double *data, double *scratch)
 {
-  double *data, *fft_data;
-  gsl_fft_complex_wavetable * cw;
-  unsigned int i, logn;
-  int result;
-  int status;
-  clock_t start, end;
-  int resolution = CLOCKS_PER_SEC;
-  unsigned int n = 1;
-
-  gsl_set_error_handler (&my_error_handler);
+  gsl_fft_complex_plan_execute (plan, data, 1, scratch);
 
-  if (argc == 2)
+  if (fabs (data[0]) > 1.0e100)
     {
-      n = strtol (argv[1], NULL, 0);
+      size_t i;
+
+      for (i = 0; i < 2 * plan->n; i++)
+        data[i] *= 1.0e-100;
     }
-  else
+}
+
+static void
+execute_float (const gsl_fft_complex_plan_float * plan, float *data, float *scratch)
+{
+  gsl_fft_complex_plan_float_execute (plan, data, 1, scratch);
+
+  if (fabsf (data[0]) > 1.0e10f)
     {
-      printf ("test n\n");
-      exit (EXIT_FAILURE);
-    }
+      size_t i;
 
-  cw = gsl_fft_complex_wavetable_alloc (n);
-  cwork = gsl_fft_complex_wavetable_workspace_alloc (n);
-  status = gsl_fft_complex_init (n, cw, cwork);
-  status = gsl_fft_complex_generate (n, cw, cwork);
+      for (i = 0; i < 2 * plan->n; i++)
+        data[i] *= 1.0e-10f;
+    }
+}
 
-  data = (double *) malloc (n * 2 * sizeof (double));
-  fft_data = (double *) malloc (n * 2 * sizeof (double));
+static void
+bench (const size_t n)
+{
+  const double flops = 5.0 * n * log ((double) n) / log (2.0);
+  gsl_fft_complex_plan *plan = gsl_fft_complex_plan_alloc (n, gsl_fft_forward);
+  gsl_fft_complex_plan_float *plan_float =
+    gsl_fft_complex_plan_float_alloc (n, gsl_fft_forward);
+  double *data = malloc (2 * n * sizeof (double));
+  double *scratch = malloc (gsl_fft_complex_plan_scratch_size (plan) * sizeof (double));
+  float *data_float = malloc (2 * n * sizeof (float));
+  float *scratch_float =
+    malloc (gsl_fft_complex_plan_float_scratch_size (plan_float) * sizeof (float));
+  double mflops, mflops_float;
+  size_t i;
 
-  for (i = 0; i < n; i++)
+  for (i = 0; i < 2 * n; i++)
     {
-      REAL(data,1,i) = urand ();
-      IMAG(data,1,i) = urand ();
+      data[i] = (double) rand () / RAND_MAX - 0.5;
+      data_float[i] = (float) data[i];
     }
 
+  TIME_MFLOPS (execute (plan, data, scratch), flops, mflops);
+  TIME_MFLOPS (execute_float (plan_float, data_float, scratch_float),
+               flops, mflops_float);
 
-  /* compute the fft */
+  printf ("%9lu %9lu %12.1f %12.1f\n", (unsigned long) n,
+          (unsigned long) plan->wavetable->nb, mflops, mflops_float);
+  fflush (stdout);
 
-  memcpy (fft_data, data, n * 2 * sizeof (double));
+  gsl_fft_complex_plan_free (plan);
+  gsl_fft_complex_plan_float_free (plan_float);
+  free (data);
+  free (scratch);
+  free (data_float);
+  free (scratch_float);
+}
 
-  start = clock ();
-  i = 0;
-  do
-    {
-      status = gsl_fft_complex_forward (fft_data, 1, n, cw, cwork);
-      i++;
-      end = clock ();
-    }
-  while (end < start + resolution && status == 0);
+/* the rows and columns of an n x n array one at a time */
+static void
+execute_2d (const gsl_fft_complex_plan * plan, double *data, double *scratch)
+{
+  const size_t n = plan->n;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    gsl_fft_complex_plan_execute (plan, data + 2 * i * n, 1, scratch);
+
+  for (i = 0; i < n; i++)
+    gsl_fft_complex_plan_execute (plan, data + 2 * i, n, scratch);
 
-  if (status == 0)
+  if (fabs (data[0]) > 1.0e100)
     {
-      printf ("n = %d gsl_fft_complex_forward %f seconds\n", n, (end - start) / ((double) i) / ((double) CLOCKS_PER_SEC));
+      for (i = 0; i < 2 * n * n; i++)
+        data[i] *= 1.0e-100;
     }
-  else
+}
+
+static void
+execute_nd (const gsl_fft_complex_nd_plan * plan, double *data)
+{
+  const size_t n = plan->dims[0] * plan->dims[1];
+  size_t i;
+
+  gsl_fft_complex_nd_plan_execute (plan, data);
+
+  if (fabs (data[0]) > 1.0e100)
     {
-      printf ("MR fft failed\n");
+      for (i = 0; i < 2 * n; i++)
+        data[i] *= 1.0e-100;
     }
+}
+
+static void
+bench_2d (const size_t n)
+{
+  const size_t dims[2] = { n, n };
+  const double flops = 5.0 * n * n * log ((double) n * n) / log (2.0);
+  gsl_fft_complex_plan *plan = gsl_fft_complex_plan_alloc (n, gsl_fft_forward);
+  gsl_fft_complex_nd_plan *nd = gsl_fft_complex_nd_plan_alloc (2, dims, gsl_fft_forward);
+  double *data = malloc (2 * n * n * sizeof (double));
+  double *scratch = malloc (gsl_fft_complex_plan_scratch_size (plan) * sizeof (double));
+  double mflops, mflops_nd;
+  size_t i;
+
+  for (i = 0; i < 2 * n * n; i++)
+    data[i] = (double) rand () / RAND_MAX - 0.5;
 
+  TIME_MFLOPS (execute_2d (plan, data, scratch), flops, mflops);
+  TIME_MFLOPS (execute_nd (nd, data), flops, mflops_nd);
 
-  /* compute the fft with radix2 */
-  memcpy (fft_data, data, n * 2 * sizeof (double));
+  printf ("%4lu x %-4lu %12.1f %12.1f\n", (unsigned long) n, (unsigned long) n,
+          mflops, mflops_nd);
+  fflush (stdout);
 
-  result = fft_binary_logn(n) ;
+  gsl_fft_complex_plan_free (plan);
+  gsl_fft_complex_nd_plan_free (nd);
+  free (data);
+  free (scratch);
+}
 
-  if (result == -1) {
-    exit(EXIT_SUCCESS) ;
-  } else {
-    logn = result ;
-  }
+static void
+execute_real (const gsl_fft_real_wavetable * wavetable,
+              gsl_fft_real_workspace * work, double *data)
+{
+  gsl_fft_real_transform (data, 1, wavetable->n, wavetable, work);
 
-  start = clock ();
-  i = 0;
-  do
+  if (fabs (data[0]) > 1.0e100)
     {
-      status = gsl_fft_complex_radix2_forward (fft_data, 1, n);
-      i++;
-      end = clock ();
+      size_t i;
+
+      for (i = 0; i < wavetable->n; i++)
+        data[i] *= 1.0e-100;
     }
-  while (end < start + resolution && status == 0);
+}
+
+/* the input is not modified, so there is no rescaling */
+static void
+execute_r2c (const gsl_fft_real_plan * plan, const double *in, double *out,
+             double *scratch)
+{
+  gsl_fft_real_plan_r2c (plan, in, out, scratch);
+}
+
+static void
+bench_real (const size_t n)
+{
+  const double points = (double) n;
+  gsl_fft_complex_plan *plan = gsl_fft_complex_plan_alloc (n, gsl_fft_forward);
+  gsl_fft_real_wavetable *wavetable = gsl_fft_real_wavetable_alloc (n);
+  gsl_fft_real_workspace *work = gsl_fft_real_workspace_alloc (n);
+  gsl_fft_real_plan *rplan = gsl_fft_real_plan_alloc (n);
+  double *data = malloc (2 * n * sizeof (double));
+  double *in = malloc (n * sizeof (double));
+  double *out = malloc (2 * (n / 2 + 1) * sizeof (double));
+  double *scratch = malloc (GSL_MAX (gsl_fft_complex_plan_scratch_size (plan),
+                                     gsl_fft_real_plan_scratch_size (rplan))
+                            * sizeof (double));
+  double rate_complex, rate_real, rate_r2c;
+  size_t i;
 
-  if (status == 0)
+  for (i = 0; i < 2 * n; i++)
+    data[i] = (double) rand () / RAND_MAX - 0.5;
+
+  for (i = 0; i < n; i++)
+    in[i] = data[i];
+
+  TIME_MFLOPS (execute (plan, data, scratch), points, rate_complex);
+  TIME_MFLOPS (execute_real (wavetable, work, data), points, rate_real);
+  TIME_MFLOPS (execute_r2c (rplan, in, out, scratch), points, rate_r2c);
+
+  printf ("%9lu %12.1f %12.1f %12.1f\n", (unsigned long) n,
+          rate_complex, rate_real, rate_r2c);
+  fflush (stdout);
+
+  gsl_fft_complex_plan_free (plan);
+  gsl_fft_real_wavetable_free (wavetable);
+  gsl_fft_real_workspace_free (work);
+  gsl_fft_real_plan_free (rplan);
+  free (data);
+  free (in);
+  free (out);
+  free (scratch);
+}
+
+int
+main (int argc, char *argv[])
+{
+  const size_t mixed[] = { 60, 360, 1000, 1536, 5040, 24000, 100000 };
+  const size_t primes[] = { 127, 1009, 10007, 100003 };
+  const size_t squares[] = { 64, 128, 256, 360, 512, 1000, 1024 };
+  size_t nmax = 1048576;
+  size_t n, i;
+
+  if (argc == 2)
+    nmax = strtoul (argv[1], NULL, 0);
+
+  printf ("kernels: %s\n", fft_simd_get ()->name);
+  printf ("%9s %9s %12s %12s\n", "n", "bluestein", "double", "float");
+
+  for (n = 16; n <= nmax; n *= 2)
+    bench (n);
+
+  for (i = 0; i < sizeof (mixed) / sizeof (mixed[0]); i++)
     {
-      printf ("n = %d gsl_fft_complex_radix2_forward %f seconds\n", n, (end - start) / ((double) i) / ((double) CLOCKS_PER_SEC));
+      if (mixed[i] <= nmax)
+        bench (mixed[i]);
     }
-  else
+
+  for (i = 0; i < sizeof (primes) / sizeof (primes[0]); i++)
     {
-      printf ("fft_radix2: not a power of 2\n");
+      if (primes[i] <= nmax)
+        bench (primes[i]);
     }
 
-  start = clock ();
-  i = 0;
-  do
+  printf ("\n2d, threads: %lu\n", (unsigned long) gsl_get_num_threads ());
+  printf ("%11s %12s %12s\n", "n", "1d loops", "nd plan");
+
+  for (i = 0; i < sizeof (squares) / sizeof (squares[0]); i++)
     {
-      status = fft_complex_bitreverse_order (fft_data, 1, n, logn);
-      i++;
-      end = clock ();
+      if (squares[i] * squares[i] <= nmax)
+        bench_2d (squares[i]);
     }
-  while (end < start + resolution && status == 0);
-
-  printf ("n = %d gsl_fft_complex_bitreverse_order %f seconds\n", n, (end - start) / ((double) i) / ((double) CLOCKS_PER_SEC));
 
+  printf ("\nreal, Mpoints/s\n");
+  printf ("%9s %12s %12s %12s\n", "n", "complex", "real", "r2c");
 
-  return 0;
-}
+  for (n = 64; n <= nmax; n *= 4)
+    bench_real (n);
 
+  for (i = 0; i < sizeof (mixed) / sizeof (mixed[0]); i++)
+    {
+      if (mixed[i] <= nmax)
+        bench_real (mixed[i]);
+    }
 
-void
-my_error_handler (const char *reason, const char *file, int line, int err)
-{
-  printf ("error: %s in %s at %d (gsl_errno=%d)\n", reason, file, line, err);
+  return 0;
 }
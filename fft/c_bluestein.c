@@ -0,0 +1,202 @@
+/* fft/c_bluestein.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Bluestein's algorithm. With jk = (j^2 + k^2 - (k-j)^2)/2 the forward
+   transform of length n becomes
+
+     x_k = c_k sum_j (x_j c_j) conj(c_{k-j}),   c_k = exp(-i pi k^2/n),
+
+   a convolution which is computed with transforms of the smooth length
+   nb >= 2n - 1. The backward transform uses conj(c_k). The kernel in
+   the wavetable is the transform of conj(c_k) including the factor
+   1/nb; it is symmetric, so the kernel of the backward transform is
+   its conjugate. */
+
+static int
+FUNCTION(fft_complex,bluestein) (BASE data[],
+                                 const size_t stride,
+                                 const size_t n,
+                                 const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                 BASE scratch[],
+                                 const gsl_fft_direction sign)
+{
+  const size_t nb = wavetable->nb;
+  const TYPE(gsl_complex) * chirp = wavetable->chirp;
+  const TYPE(gsl_complex) * kernel = wavetable->kernel;
+  const ATOMIC s = (sign == gsl_fft_forward) ? 1 : -1;
+
+  BASE * const a = scratch;
+  BASE * const work = scratch + 2 * nb;
+
+  size_t i;
+  int status;
+
+  for (i = 0; i < n; i++)
+    {
+      const ATOMIC xr = REAL(data,stride,i);
+      const ATOMIC xi = IMAG(data,stride,i);
+      const ATOMIC cr = GSL_REAL(chirp[i]);
+      const ATOMIC ci = s * GSL_IMAG(chirp[i]);
+
+      REAL(a,1,i) = xr * cr - xi * ci;
+      IMAG(a,1,i) = xr * ci + xi * cr;
+    }
+
+  for (i = 2 * n; i < 2 * nb; i++)
+    {
+      a[i] = 0;
+    }
+
+  status = FUNCTION(fft_complex,passes) (a, 1, nb, wavetable->bluestein,
+                                         work, gsl_fft_forward);
+
+  if (status)
+    {
+      return status;
+    }
+
+  for (i = 0; i < nb; i++)
+    {
+      const ATOMIC ar = REAL(a,1,i);
+      const ATOMIC ai = IMAG(a,1,i);
+      const ATOMIC kr = GSL_REAL(kernel[i]);
+      const ATOMIC ki = s * GSL_IMAG(kernel[i]);
+
+      REAL(a,1,i) = ar * kr - ai * ki;
+      IMAG(a,1,i) = ar * ki + ai * kr;
+    }
+
+  status = FUNCTION(fft_complex,passes) (a, 1, nb, wavetable->bluestein,
+                                         work, gsl_fft_backward);
+
+  if (status)
+    {
+      return status;
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      const ATOMIC ar = REAL(a,1,i);
+      const ATOMIC ai = IMAG(a,1,i);
+      const ATOMIC cr = GSL_REAL(chirp[i]);
+      const ATOMIC ci = s * GSL_IMAG(chirp[i]);
+
+      REAL(data,stride,i) = ar * cr - ai * ci;
+      IMAG(data,stride,i) = ar * ci + ai * cr;
+    }
+
+  return 0;
+}
+
+/* Real data and halfcomplex sequences with a large prime factor in their
+   length are transformed as complex data of length n, using the first
+   2n elements of scratch for the copy and the rest for the complex
+   transform. */
+
+static int
+FUNCTION(fft_real,bluestein) (BASE data[],
+                              const size_t stride,
+                              const size_t n,
+                              const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                              BASE scratch[])
+{
+  BASE * const z = scratch;
+  size_t i;
+  int status;
+
+  for (i = 0; i < n; i++)
+    {
+      REAL(z,1,i) = data[stride*i];
+      IMAG(z,1,i) = 0;
+    }
+
+  status = FUNCTION(fft_complex,passes) (z, 1, n, wavetable, scratch + 2 * n,
+                                         gsl_fft_forward);
+
+  if (status)
+    {
+      return status;
+    }
+
+  /* pack the coefficients of 0 <= k <= n/2 in halfcomplex order */
+
+  data[0] = REAL(z,1,0);
+
+  for (i = 1; 2 * i < n; i++)
+    {
+      data[stride*(2*i - 1)] = REAL(z,1,i);
+      data[stride*(2*i)] = IMAG(z,1,i);
+    }
+
+  if (2 * i == n)
+    {
+      data[stride*(n - 1)] = REAL(z,1,i);
+    }
+
+  return 0;
+}
+
+static int
+FUNCTION(fft_halfcomplex,bluestein) (BASE data[],
+                                     const size_t stride,
+                                     const size_t n,
+                                     const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                     BASE scratch[])
+{
+  BASE * const z = scratch;
+  size_t i;
+  int status;
+
+  /* unpack to the full conjugate-complex sequence */
+
+  REAL(z,1,0) = data[0];
+  IMAG(z,1,0) = 0;
+
+  for (i = 1; 2 * i < n; i++)
+    {
+      const ATOMIC zr = data[stride*(2*i - 1)];
+      const ATOMIC zi = data[stride*(2*i)];
+
+      REAL(z,1,i) = zr;
+      IMAG(z,1,i) = zi;
+      REAL(z,1,n - i) = zr;
+      IMAG(z,1,n - i) = -zi;
+    }
+
+  if (2 * i == n)
+    {
+      REAL(z,1,i) = data[stride*(n - 1)];
+      IMAG(z,1,i) = 0;
+    }
+
+  status = FUNCTION(fft_complex,passes) (z, 1, n, wavetable, scratch + 2 * n,
+                                         gsl_fft_backward);
+
+  if (status)
+    {
+      return status;
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      data[stride*i] = REAL(z,1,i);
+    }
+
+  return 0;
+}
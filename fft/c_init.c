@@ -17,6 +17,90 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+/* set up the tables of Bluestein's algorithm when the length has a
+   large prime factor, see fft_complex_bluestein_length() */
+
+static int
+FUNCTION(fft_complex,bluestein_init) (TYPE(gsl_fft_complex_wavetable) * wavetable)
+{
+  const size_t n = wavetable->n;
+  const size_t nb = fft_complex_bluestein_length (n);
+  TYPE(gsl_fft_complex_workspace) * work;
+  size_t k, k2;
+  int status;
+
+  wavetable->nb = nb;
+  wavetable->chirp = NULL;
+  wavetable->kernel = NULL;
+  wavetable->bluestein = NULL;
+
+  if (nb == 0)
+    {
+      return GSL_SUCCESS;
+    }
+
+  wavetable->chirp = (TYPE(gsl_complex) *) malloc (n * sizeof (TYPE(gsl_complex)));
+  wavetable->kernel = (TYPE(gsl_complex) *) calloc (nb, sizeof (TYPE(gsl_complex)));
+  wavetable->bluestein = FUNCTION(gsl_fft_complex_wavetable,alloc) (nb);
+  work = FUNCTION(gsl_fft_complex_workspace,alloc) (nb);
+
+  if (wavetable->chirp == NULL || wavetable->kernel == NULL
+      || wavetable->bluestein == NULL || work == NULL)
+    {
+      free (wavetable->chirp);
+      free (wavetable->kernel);
+      FUNCTION(gsl_fft_complex_wavetable,free) (wavetable->bluestein);
+      FUNCTION(gsl_fft_complex_workspace,free) (work);
+
+      GSL_ERROR ("failed to allocate Bluestein tables", GSL_ENOMEM);
+    }
+
+  /* chirp_k = exp(-i pi k^2/n), with k^2 reduced mod 2n */
+
+  k2 = 0;
+  for (k = 0; k < n; k++)
+    {
+      const double theta = -M_PI * (double) k2 / (double) n;
+
+      GSL_REAL(wavetable->chirp[k]) = cos (theta);
+      GSL_IMAG(wavetable->chirp[k]) = sin (theta);
+
+      k2 += 2 * k + 1;
+      if (k2 >= 2 * n)
+        {
+          k2 -= 2 * n;
+        }
+    }
+
+  /* the convolution kernel conj(chirp_|k|) for -n < k < n, wrapped
+     around to length nb and transformed */
+
+  for (k = 0; k < n; k++)
+    {
+      GSL_REAL(wavetable->kernel[k]) = GSL_REAL(wavetable->chirp[k]);
+      GSL_IMAG(wavetable->kernel[k]) = -GSL_IMAG(wavetable->chirp[k]);
+
+      if (k > 0)
+        {
+          wavetable->kernel[nb - k] = wavetable->kernel[k];
+        }
+    }
+
+  status = FUNCTION(gsl_fft_complex,forward) ((BASE *) wavetable->kernel, 1, nb,
+                                              wavetable->bluestein, work);
+  FUNCTION(gsl_fft_complex_workspace,free) (work);
+
+  /* include the normalization of the inverse transform */
+
+  for (k = 0; k < nb; k++)
+    {
+      GSL_REAL(wavetable->kernel[k]) /= nb;
+      GSL_IMAG(wavetable->kernel[k]) /= nb;
+    }
+
+  return status;
+}
+
 TYPE(gsl_fft_complex_wavetable) * 
 FUNCTION(gsl_fft_complex_wavetable,alloc) (size_t n)
 {
@@ -109,6 +193,18 @@ FUNCTION(gsl_fft_complex_wavetable,alloc) (size_t n)
                         GSL_ESANITY, 0);
     }
 
+  status = FUNCTION(fft_complex,bluestein_init) (wavetable);
+
+  if (status)
+    {
+      /* exception in constructor, avoid memory leak */
+
+      free (wavetable->trig);
+      free (wavetable);
+
+      GSL_ERROR_VAL ("failed to initialize Bluestein tables", status, 0);
+    }
+
   return wavetable;
 }
 
@@ -133,7 +229,15 @@ FUNCTION(gsl_fft_complex_workspace,alloc) (size_t n)
 
   workspace->n = n ;
 
-  workspace->scratch = (BASE *) malloc (2 * n * sizeof (BASE));
+  /* Bluestein's algorithm needs a convolution array and the scratch
+     space of its transforms, each of length nb */
+
+  {
+    const size_t nb = fft_complex_bluestein_length (n);
+    const size_t size = (nb > 0) ? 4 * nb : 2 * n;
+
+    workspace->scratch = (BASE *) malloc (size * sizeof (BASE));
+  }
 
   if (workspace->scratch == NULL)
     {
@@ -155,6 +259,10 @@ FUNCTION(gsl_fft_complex_wavetable,free) (TYPE(gsl_fft_complex_wavetable) * wave
   free (wavetable->trig);
   wavetable->trig = NULL;
 
+  free (wavetable->chirp);
+  free (wavetable->kernel);
+  FUNCTION(gsl_fft_complex_wavetable,free) (wavetable->bluestein);
+
   free (wavetable) ;
 }
 
@@ -191,5 +299,13 @@ FUNCTION(gsl_fft_complex,memcpy) (TYPE(gsl_fft_complex_wavetable) * dest,
       dest->twiddle[i] = dest->trig + (src->twiddle[i] - src->trig) ;
     }
 
+  if (dest->nb > 0)
+    {
+      memcpy (dest->chirp, src->chirp, n * sizeof (TYPE(gsl_complex))) ;
+      memcpy (dest->kernel, src->kernel, dest->nb * sizeof (TYPE(gsl_complex))) ;
+
+      return FUNCTION(gsl_fft_complex,memcpy) (dest->bluestein, src->bluestein) ;
+    }
+
   return 0 ;
 }
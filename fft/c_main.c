@@ -75,13 +75,18 @@ FUNCTION(gsl_fft_complex,inverse) (TYPE(gsl_complex_packed_array) data,
   return status;
 }
 
-int
-FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data, 
-                                     const size_t stride, 
-                                     const size_t n,
-                                     const TYPE(gsl_fft_complex_wavetable) * wavetable,
-                                     TYPE(gsl_fft_complex_workspace) * work,
-                                     const gsl_fft_direction sign)
+/* the passes of the mixed radix transform of length n > 1, using the
+   2*n elements of scratch (4*nb for Bluestein's algorithm); the
+   wavetable is only read, so the transform may run concurrently with
+   others sharing it */
+
+static int
+FUNCTION(fft_complex,passes) (BASE data[],
+                              const size_t stride,
+                              const size_t n,
+                              const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                              BASE scratch[],
+                              const gsl_fft_direction sign)
 {
   const size_t nf = wavetable->nf;
 
@@ -94,32 +99,16 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
 
   size_t state = 0;
 
-  BASE * const scratch = work->scratch;
-
   BASE * in = data;
   size_t istride = stride;
 
   BASE * out = scratch;
   size_t ostride = 1;
 
-  if (n == 0)
-    {
-      GSL_ERROR ("length n must be positive integer", GSL_EDOM);
-    }
-
-  if (n == 1)
-    {                           /* FFT of 1 data point is the identity */
-      return 0;
-    }
-
-  if (n != wavetable->n)
+  if (wavetable->nb > 0)
     {
-      GSL_ERROR ("wavetable does not match length of data", GSL_EINVAL);
-    }
-
-  if (n != work->n)
-    {
-      GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
+      return FUNCTION(fft_complex,bluestein) (data, stride, n, wavetable,
+                                              scratch, sign);
     }
 
   for (i = 0; i < nf; i++)
@@ -167,6 +156,12 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
                                         product, n, twiddle1, twiddle2, 
                                         twiddle3);
         }
+      else if (factor == 8)
+        {
+          twiddle1 = wavetable->twiddle[i];
+          FUNCTION(fft_complex,pass_8) (in, istride, out, ostride, sign, 
+                                        product, n, twiddle1);
+        }
       else if (factor == 5)
         {
           twiddle1 = wavetable->twiddle[i];
@@ -221,3 +216,35 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
   return 0;
 
 }
+
+int
+FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data, 
+                                     const size_t stride, 
+                                     const size_t n,
+                                     const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                     TYPE(gsl_fft_complex_workspace) * work,
+                                     const gsl_fft_direction sign)
+{
+  if (n == 0)
+    {
+      GSL_ERROR ("length n must be positive integer", GSL_EDOM);
+    }
+
+  if (n == 1)
+    {                           /* FFT of 1 data point is the identity */
+      return 0;
+    }
+
+  if (n != wavetable->n)
+    {
+      GSL_ERROR ("wavetable does not match length of data", GSL_EINVAL);
+    }
+
+  if (n != work->n)
+    {
+      GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
+    }
+
+  return FUNCTION(fft_complex,passes) (data, stride, n, wavetable,
+                                       work->scratch, sign);
+}
@@ -0,0 +1,401 @@
+/* fft/c_many.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Batched and multidimensional complex transforms.
+
+   A batch is howmany transforms of the same length n, where element i
+   of sequence j is data[2*(j*dist + i*stride)]. Sequences with unit
+   stride are transformed where they are. Otherwise they are processed
+   in blocks of up to FFT_MANY_BLOCK sequences, which are copied to a
+   contiguous buffer, transformed there and copied back. When the
+   sequences are interleaved, as the columns of a row-major array are,
+   the copies move whole cache lines of neighbouring sequences, where
+   each pass of a strided transform would use one element of every
+   line it loads.
+
+   A multidimensional transform of a row-major array is a batch along
+   each dimension in turn. The blocks of a batch are independent and
+   are divided among the threads set with gsl_set_num_threads(). */
+
+#undef FFT_MANY_BLOCK
+#define FFT_MANY_BLOCK 16
+
+/* transform the sequences data[2*(o*odist + j*dist + i*stride)] with
+   o < nouter, j < howmany, i < n */
+
+static int
+FUNCTION(fft_complex,many) (const TYPE(gsl_fft_complex_plan) * plan,
+                            BASE data[],
+                            const size_t stride,
+                            const size_t dist,
+                            const size_t howmany,
+                            const size_t nouter,
+                            const size_t odist)
+{
+  const size_t n = plan->n;
+  size_t nb = 1, nblocks;
+  long ntasks, t;
+  int nthreads, nfail = 0;
+
+  if (n == 1 || howmany == 0 || nouter == 0)
+    {
+      return 0;
+    }
+
+  /* blocks of at least 4 sequences, with a buffer of about 2^15
+     complex elements */
+
+  if (stride != 1)
+    {
+      nb = GSL_MAX (4, GSL_MIN (FFT_MANY_BLOCK, 32768 / n));
+      nb = GSL_MIN (nb, howmany);
+    }
+
+  nblocks = (howmany + nb - 1) / nb;
+  ntasks = (long) (nouter * nblocks);
+  nthreads = (int) GSL_MIN (gsl_get_num_threads (), (size_t) ntasks);
+
+#ifdef _OPENMP
+  if (omp_in_parallel ())
+    nthreads = 1;
+
+#pragma omp parallel num_threads(nthreads) reduction(+:nfail) if (nthreads > 1)
+#else
+  (void) nthreads;
+#endif
+  {
+    const size_t nbuf = (nb > 1) ? 2 * nb * n : 0;
+    BASE *scratch = (BASE *) malloc ((plan->scratch_size + nbuf) * sizeof (BASE));
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+    for (t = 0; t < ntasks; t++)
+      {
+        const size_t o = (size_t) t / nblocks;
+        const size_t j0 = ((size_t) t % nblocks) * nb;
+        const size_t m = GSL_MIN (nb, howmany - j0);
+        BASE *x = data + 2 * (o * odist + j0 * dist);
+        BASE *buf;
+        size_t i, j;
+
+        if (scratch == NULL)
+          {
+            nfail++;
+            continue;
+          }
+
+        if (nb == 1)
+          {
+            FUNCTION(fft_complex,passes) (x, stride, n, plan->wavetable,
+                                          scratch, plan->sign);
+            continue;
+          }
+
+        buf = scratch + plan->scratch_size;
+
+        for (i = 0; i < n; i++)
+          {
+            for (j = 0; j < m; j++)
+              {
+                buf[2 * (j * n + i)] = x[2 * (i * stride + j * dist)];
+                buf[2 * (j * n + i) + 1] = x[2 * (i * stride + j * dist) + 1];
+              }
+          }
+
+        for (j = 0; j < m; j++)
+          {
+            FUNCTION(fft_complex,passes) (buf + 2 * j * n, 1, n,
+                                          plan->wavetable, scratch,
+                                          plan->sign);
+          }
+
+        for (i = 0; i < n; i++)
+          {
+            for (j = 0; j < m; j++)
+              {
+                x[2 * (i * stride + j * dist)] = buf[2 * (j * n + i)];
+                x[2 * (i * stride + j * dist) + 1] = buf[2 * (j * n + i) + 1];
+              }
+          }
+      }
+
+    free (scratch);
+  }
+
+  if (nfail)
+    {
+      GSL_ERROR ("failed to allocate scratch space", GSL_ENOMEM);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* transform dimensions 0, ..., naxes-1 of a row-major array with the
+   given dimensions, dimension d with plan[d] */
+
+static int
+FUNCTION(fft_complex,axes) (TYPE(gsl_fft_complex_plan) * const plan[],
+                            const size_t rank,
+                            const size_t dims[],
+                            const size_t naxes,
+                            BASE data[])
+{
+  size_t d, inner = 1, outer = 1;
+  int status = 0;
+
+  for (d = 0; d < rank; d++)
+    {
+      outer *= dims[d];
+    }
+
+  for (d = rank; d-- > 0;)
+    {
+      outer /= dims[d];
+
+      if (d >= naxes)
+        {
+          /* not transformed */
+        }
+      else if (inner == 1)
+        {
+          /* contiguous rows */
+          status = FUNCTION(fft_complex,many) (plan[d], data, 1, dims[d],
+                                               outer, 1, 0);
+        }
+      else
+        {
+          /* the columns of outer arrays of dims[d] x inner elements */
+          status = FUNCTION(fft_complex,many) (plan[d], data, inner, 1,
+                                               inner, outer, dims[d] * inner);
+        }
+
+      if (status)
+        {
+          return status;
+        }
+
+      inner *= dims[d];
+    }
+
+  return 0;
+}
+
+/* allocate a plan for each of the rank dimensions, shared between
+   dimensions of the same length */
+
+static int
+FUNCTION(fft_complex,plans_alloc) (const size_t rank,
+                                   const size_t dims[],
+                                   const gsl_fft_direction sign,
+                                   TYPE(gsl_fft_complex_plan) * plan[])
+{
+  size_t d, e;
+
+  for (d = 0; d < rank; d++)
+    {
+      plan[d] = NULL;
+    }
+
+  for (d = 0; d < rank; d++)
+    {
+      for (e = 0; e < d && dims[e] != dims[d]; e++)
+        ;
+
+      if (e < d)
+        {
+          plan[d] = plan[e];
+        }
+      else
+        {
+          plan[d] = FUNCTION(gsl_fft_complex_plan,alloc) (dims[d], sign);
+
+          if (plan[d] == NULL)
+            {
+              return GSL_ENOMEM;
+            }
+        }
+    }
+
+  return 0;
+}
+
+static void
+FUNCTION(fft_complex,plans_free) (const size_t rank,
+                                  TYPE(gsl_fft_complex_plan) * plan[])
+{
+  size_t d, e;
+
+  for (d = 0; d < rank; d++)
+    {
+      for (e = 0; e < d && plan[e] != plan[d]; e++)
+        ;
+
+      if (e == d)
+        {
+          FUNCTION(gsl_fft_complex_plan,free) (plan[d]);
+        }
+    }
+}
+
+int
+FUNCTION(gsl_fft_complex_plan,execute_many) (const TYPE(gsl_fft_complex_plan) * plan,
+                                             TYPE(gsl_complex_packed_array) data,
+                                             const size_t stride,
+                                             const size_t dist,
+                                             const size_t howmany)
+{
+  if (stride == 0)
+    {
+      GSL_ERROR ("stride must be positive integer", GSL_EINVAL);
+    }
+
+  return FUNCTION(fft_complex,many) (plan, data, stride, dist, howmany,
+                                     1, 0);
+}
+
+TYPE(gsl_fft_complex_nd_plan) *
+FUNCTION(gsl_fft_complex_nd_plan,alloc) (const size_t rank,
+                                         const size_t dims[],
+                                         const gsl_fft_direction sign)
+{
+  TYPE(gsl_fft_complex_nd_plan) * plan;
+  size_t d;
+
+  if (rank == 0)
+    {
+      GSL_ERROR_NULL ("rank must be positive integer", GSL_EINVAL);
+    }
+
+  for (d = 0; d < rank; d++)
+    {
+      if (dims[d] == 0)
+        {
+          GSL_ERROR_NULL ("length n must be positive integer", GSL_EDOM);
+        }
+    }
+
+  plan = (TYPE(gsl_fft_complex_nd_plan) *)
+    malloc (sizeof (TYPE(gsl_fft_complex_nd_plan)));
+
+  if (plan == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate struct", GSL_ENOMEM);
+    }
+
+  plan->rank = rank;
+  plan->sign = sign;
+  plan->dims = (size_t *) malloc (rank * sizeof (size_t));
+  plan->plan = (TYPE(gsl_fft_complex_plan) **)
+    malloc (rank * sizeof (TYPE(gsl_fft_complex_plan) *));
+
+  if (plan->dims == NULL || plan->plan == NULL)
+    {
+      free (plan->dims);
+      free (plan->plan);
+      free (plan);
+      GSL_ERROR_NULL ("failed to allocate dimensions", GSL_ENOMEM);
+    }
+
+  for (d = 0; d < rank; d++)
+    {
+      plan->dims[d] = dims[d];
+    }
+
+  if (FUNCTION(fft_complex,plans_alloc) (rank, dims, sign, plan->plan))
+    {
+      FUNCTION(fft_complex,plans_free) (rank, plan->plan);
+      free (plan->dims);
+      free (plan->plan);
+      free (plan);
+      GSL_ERROR_NULL ("failed to allocate plans", GSL_ENOMEM);
+    }
+
+  return plan;
+}
+
+void
+FUNCTION(gsl_fft_complex_nd_plan,free) (TYPE(gsl_fft_complex_nd_plan) * plan)
+{
+  RETURN_IF_NULL (plan);
+  FUNCTION(fft_complex,plans_free) (plan->rank, plan->plan);
+  free (plan->dims);
+  free (plan->plan);
+  free (plan);
+}
+
+/* transform the row-major array data in place */
+
+int
+FUNCTION(gsl_fft_complex_nd_plan,execute) (const TYPE(gsl_fft_complex_nd_plan) * plan,
+                                           TYPE(gsl_complex_packed_array) data)
+{
+  return FUNCTION(fft_complex,axes) (plan->plan, plan->rank, plan->dims,
+                                     plan->rank, data);
+}
+
+static int
+FUNCTION(fft_complex,nd_transform) (TYPE(gsl_complex_packed_array) data,
+                                    const size_t rank,
+                                    const size_t dims[],
+                                    const gsl_fft_direction sign)
+{
+  TYPE(gsl_fft_complex_nd_plan) * plan;
+  size_t d;
+  int status;
+
+  for (d = 0; d < rank; d++)
+    {
+      if (dims[d] == 0)
+        {
+          GSL_ERROR ("length n must be positive integer", GSL_EDOM);
+        }
+    }
+
+  plan = FUNCTION(gsl_fft_complex_nd_plan,alloc) (rank, dims, sign);
+
+  if (plan == NULL)
+    {
+      GSL_ERROR ("failed to allocate plan", GSL_ENOMEM);
+    }
+
+  status = FUNCTION(gsl_fft_complex_nd_plan,execute) (plan, data);
+  FUNCTION(gsl_fft_complex_nd_plan,free) (plan);
+
+  return status;
+}
+
+int
+FUNCTION(gsl_fft_complex,2d_transform) (TYPE(gsl_complex_packed_array) data,
+                                        const size_t n1, const size_t n2,
+                                        const gsl_fft_direction sign)
+{
+  const size_t dims[2] = { n1, n2 };
+  return FUNCTION(fft_complex,nd_transform) (data, 2, dims, sign);
+}
+
+int
+FUNCTION(gsl_fft_complex,3d_transform) (TYPE(gsl_complex_packed_array) data,
+                                        const size_t n1, const size_t n2,
+                                        const size_t n3,
+                                        const gsl_fft_direction sign)
+{
+  const size_t dims[3] = { n1, n2, n3 };
+  return FUNCTION(fft_complex,nd_transform) (data, 3, dims, sign);
+}
@@ -17,6 +17,21 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+/* vectorized pass with unit strides, see simd.h; -1 if not available */
+
+#undef FFT_SIMD_PASS
+#if defined(BASE_FLOAT)
+#define FFT_SIMD_PASS(name,in,out,sign,product,n,twiddle)               \
+  ((fft_simd_get ()->s ## name == NULL) ? -1 :                          \
+   fft_simd_get ()->s ## name (in, out, (int) (sign), product, n,       \
+                               (const float *) (twiddle)))
+#else
+#define FFT_SIMD_PASS(name,in,out,sign,product,n,twiddle)               \
+  ((fft_simd_get ()->d ## name == NULL) ? -1 :                          \
+   fft_simd_get ()->d ## name (in, out, (int) (sign), product, n,       \
+                               (const double *) (twiddle)))
+#endif
+
 static int
 FUNCTION(fft_complex,pass_2) (const BASE in[],
                               const size_t istride,
@@ -93,6 +108,16 @@ FUNCTION(fft_complex,pass_7) (const BASE in[],
                               const TYPE(gsl_complex) twiddle6[]);
 
 
+static int
+FUNCTION(fft_complex,pass_8) (const BASE in[],
+                              const size_t istride,
+                              BASE out[],
+                              const size_t ostride,
+                              const gsl_fft_direction sign,
+                              const size_t product,
+                              const size_t n,
+                              const TYPE(gsl_complex) twiddle[]);
+
 static int
 FUNCTION(fft_complex,pass_n) (BASE in[],
                               const size_t istride,
@@ -104,3 +129,10 @@ FUNCTION(fft_complex,pass_n) (BASE in[],
                               const size_t n,
                               const TYPE(gsl_complex) twiddle[]);
 
+static int
+FUNCTION(fft_complex,bluestein) (BASE data[],
+                                 const size_t stride,
+                                 const size_t n,
+                                 const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                 BASE scratch[],
+                                 const gsl_fft_direction sign);
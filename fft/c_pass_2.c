@@ -36,6 +36,12 @@ FUNCTION(fft_complex,pass_2) (const BASE in[],
   const size_t product_1 = product / factor;
   const size_t jump = (factor - 1) * product_1;
 
+  if (istride == 1 && ostride == 1
+      && FFT_SIMD_PASS (pass_2, in, out, sign, product, n, twiddle) == 0)
+    {
+      return 0;
+    }
+
   for (k = 0; k < q; k++)
     {
       ATOMIC w_real, w_imag;
@@ -38,6 +38,12 @@ FUNCTION(fft_complex,pass_4) (const BASE in[],
   const size_t p_1 = product / factor;
   const size_t jump = (factor - 1) * p_1;
 
+  if (istride == 1 && ostride == 1
+      && FFT_SIMD_PASS (pass_4, in, out, sign, product, n, twiddle1) == 0)
+    {
+      return 0;
+    }
+
   for (k = 0; k < q; k++)
     {
       ATOMIC w1_real, w1_imag, w2_real, w2_imag, w3_real, w3_imag;
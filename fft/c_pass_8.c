@@ -0,0 +1,186 @@
+/* fft/c_pass_8.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* The radix-8 butterfly is computed as two radix-4 butterflies of the
+   even and odd elements, a = W(4) (z0,z2,z4,z6) and b = W(4)
+   (z1,z3,z5,z7), combined with x_k = a_k + w^k b_k and x_(k+4) = a_k -
+   w^k b_k, where w = exp(sign 2 pi i/8) = (1 + sign i)/sqrt(2). The
+   twiddle factors of x_r, r = 1..7, are twiddle[(r-1)*q + k - 1]. */
+
+static int
+FUNCTION(fft_complex,pass_8) (const BASE in[],
+                              const size_t istride,
+                              BASE out[],
+                              const size_t ostride,
+                              const gsl_fft_direction sign,
+                              const size_t product,
+                              const size_t n,
+                              const TYPE(gsl_complex) twiddle[])
+{
+  size_t i = 0, j = 0;
+  size_t k, k1, r;
+
+  const size_t factor = 8;
+  const size_t m = n / factor;
+  const size_t q = n / product;
+  const size_t p_1 = product / factor;
+  const size_t jump = (factor - 1) * p_1;
+
+  const ATOMIC s = (ATOMIC) ((int) sign);
+  const ATOMIC c = (ATOMIC) M_SQRT1_2;
+
+  if (istride == 1 && ostride == 1
+      && FFT_SIMD_PASS (pass_8, in, out, sign, product, n, twiddle) == 0)
+    {
+      return 0;
+    }
+
+  for (k = 0; k < q; k++)
+    {
+      ATOMIC w_real[8], w_imag[8];
+
+      for (r = 1; r < 8; r++)
+        {
+          if (k == 0)
+            {
+              w_real[r] = 1.0;
+              w_imag[r] = 0.0;
+            }
+          else
+            {
+              /* backward transform: w -> conjugate(w) */
+              w_real[r] = GSL_REAL(twiddle[(r - 1) * q + k - 1]);
+              w_imag[r] = -s * GSL_IMAG(twiddle[(r - 1) * q + k - 1]);
+            }
+        }
+
+      for (k1 = 0; k1 < p_1; k1++)
+        {
+          const ATOMIC z0_real = REAL(in,istride,i);
+          const ATOMIC z0_imag = IMAG(in,istride,i);
+          const ATOMIC z1_real = REAL(in,istride,i+m);
+          const ATOMIC z1_imag = IMAG(in,istride,i+m);
+          const ATOMIC z2_real = REAL(in,istride,i+2*m);
+          const ATOMIC z2_imag = IMAG(in,istride,i+2*m);
+          const ATOMIC z3_real = REAL(in,istride,i+3*m);
+          const ATOMIC z3_imag = IMAG(in,istride,i+3*m);
+          const ATOMIC z4_real = REAL(in,istride,i+4*m);
+          const ATOMIC z4_imag = IMAG(in,istride,i+4*m);
+          const ATOMIC z5_real = REAL(in,istride,i+5*m);
+          const ATOMIC z5_imag = IMAG(in,istride,i+5*m);
+          const ATOMIC z6_real = REAL(in,istride,i+6*m);
+          const ATOMIC z6_imag = IMAG(in,istride,i+6*m);
+          const ATOMIC z7_real = REAL(in,istride,i+7*m);
+          const ATOMIC z7_imag = IMAG(in,istride,i+7*m);
+
+          /* a = W(4) (z0, z2, z4, z6) */
+          const ATOMIC ta1_real = z0_real + z4_real;
+          const ATOMIC ta1_imag = z0_imag + z4_imag;
+          const ATOMIC ta2_real = z2_real + z6_real;
+          const ATOMIC ta2_imag = z2_imag + z6_imag;
+          const ATOMIC ta3_real = z0_real - z4_real;
+          const ATOMIC ta3_imag = z0_imag - z4_imag;
+          const ATOMIC ta4_real = s * (z2_real - z6_real);
+          const ATOMIC ta4_imag = s * (z2_imag - z6_imag);
+
+          const ATOMIC a0_real = ta1_real + ta2_real;
+          const ATOMIC a0_imag = ta1_imag + ta2_imag;
+          const ATOMIC a1_real = ta3_real - ta4_imag;
+          const ATOMIC a1_imag = ta3_imag + ta4_real;
+          const ATOMIC a2_real = ta1_real - ta2_real;
+          const ATOMIC a2_imag = ta1_imag - ta2_imag;
+          const ATOMIC a3_real = ta3_real + ta4_imag;
+          const ATOMIC a3_imag = ta3_imag - ta4_real;
+
+          /* b = W(4) (z1, z3, z5, z7) */
+          const ATOMIC tb1_real = z1_real + z5_real;
+          const ATOMIC tb1_imag = z1_imag + z5_imag;
+          const ATOMIC tb2_real = z3_real + z7_real;
+          const ATOMIC tb2_imag = z3_imag + z7_imag;
+          const ATOMIC tb3_real = z1_real - z5_real;
+          const ATOMIC tb3_imag = z1_imag - z5_imag;
+          const ATOMIC tb4_real = s * (z3_real - z7_real);
+          const ATOMIC tb4_imag = s * (z3_imag - z7_imag);
+
+          const ATOMIC b0_real = tb1_real + tb2_real;
+          const ATOMIC b0_imag = tb1_imag + tb2_imag;
+          const ATOMIC b1_real = tb3_real - tb4_imag;
+          const ATOMIC b1_imag = tb3_imag + tb4_real;
+          const ATOMIC b2_real = tb1_real - tb2_real;
+          const ATOMIC b2_imag = tb1_imag - tb2_imag;
+          const ATOMIC b3_real = tb3_real + tb4_imag;
+          const ATOMIC b3_imag = tb3_imag - tb4_real;
+
+          /* w b1 = (b1 + sign i b1)/sqrt(2) */
+          const ATOMIC wb1_real = c * (b1_real - s * b1_imag);
+          const ATOMIC wb1_imag = c * (b1_imag + s * b1_real);
+
+          /* w^2 b2 = sign i b2 */
+          const ATOMIC wb2_real = -s * b2_imag;
+          const ATOMIC wb2_imag = s * b2_real;
+
+          /* w^3 b3 = (-b3 + sign i b3)/sqrt(2) */
+          const ATOMIC wb3_real = -c * (b3_real + s * b3_imag);
+          const ATOMIC wb3_imag = c * (s * b3_real - b3_imag);
+
+          /* x_k = a_k + w^k b_k, x_(k+4) = a_k - w^k b_k */
+          const ATOMIC x1_real = a1_real + wb1_real;
+          const ATOMIC x1_imag = a1_imag + wb1_imag;
+          const ATOMIC x2_real = a2_real + wb2_real;
+          const ATOMIC x2_imag = a2_imag + wb2_imag;
+          const ATOMIC x3_real = a3_real + wb3_real;
+          const ATOMIC x3_imag = a3_imag + wb3_imag;
+          const ATOMIC x4_real = a0_real - b0_real;
+          const ATOMIC x4_imag = a0_imag - b0_imag;
+          const ATOMIC x5_real = a1_real - wb1_real;
+          const ATOMIC x5_imag = a1_imag - wb1_imag;
+          const ATOMIC x6_real = a2_real - wb2_real;
+          const ATOMIC x6_imag = a2_imag - wb2_imag;
+          const ATOMIC x7_real = a3_real - wb3_real;
+          const ATOMIC x7_imag = a3_imag - wb3_imag;
+
+          /* apply twiddle factors */
+
+          /* to0 = 1 * x0 */
+          REAL(out,ostride,j) = a0_real + b0_real;
+          IMAG(out,ostride,j) = a0_imag + b0_imag;
+
+          /* to_r = w_r * x_r */
+          REAL(out,ostride,j + p_1) = w_real[1] * x1_real - w_imag[1] * x1_imag;
+          IMAG(out,ostride,j + p_1) = w_real[1] * x1_imag + w_imag[1] * x1_real;
+          REAL(out,ostride,j + 2 * p_1) = w_real[2] * x2_real - w_imag[2] * x2_imag;
+          IMAG(out,ostride,j + 2 * p_1) = w_real[2] * x2_imag + w_imag[2] * x2_real;
+          REAL(out,ostride,j + 3 * p_1) = w_real[3] * x3_real - w_imag[3] * x3_imag;
+          IMAG(out,ostride,j + 3 * p_1) = w_real[3] * x3_imag + w_imag[3] * x3_real;
+          REAL(out,ostride,j + 4 * p_1) = w_real[4] * x4_real - w_imag[4] * x4_imag;
+          IMAG(out,ostride,j + 4 * p_1) = w_real[4] * x4_imag + w_imag[4] * x4_real;
+          REAL(out,ostride,j + 5 * p_1) = w_real[5] * x5_real - w_imag[5] * x5_imag;
+          IMAG(out,ostride,j + 5 * p_1) = w_real[5] * x5_imag + w_imag[5] * x5_real;
+          REAL(out,ostride,j + 6 * p_1) = w_real[6] * x6_real - w_imag[6] * x6_imag;
+          IMAG(out,ostride,j + 6 * p_1) = w_real[6] * x6_imag + w_imag[6] * x6_real;
+          REAL(out,ostride,j + 7 * p_1) = w_real[7] * x7_real - w_imag[7] * x7_imag;
+          IMAG(out,ostride,j + 7 * p_1) = w_real[7] * x7_imag + w_imag[7] * x7_real;
+
+          i++;
+          j++;
+        }
+      j += jump;
+    }
+  return 0;
+}
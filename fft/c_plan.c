@@ -0,0 +1,119 @@
+/* fft/c_plan.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* A plan holds everything about a transform which depends only on its
+   length and direction: the factorization of n, the twiddle factors of
+   each pass and the size of the scratch space. It is not modified by
+   gsl_fft_complex_plan_execute(), so one plan may be executed by any
+   number of threads at once, each with its own scratch space. */
+
+TYPE(gsl_fft_complex_plan) *
+FUNCTION(gsl_fft_complex_plan,alloc) (const size_t n,
+                                      const gsl_fft_direction sign)
+{
+  TYPE(gsl_fft_complex_plan) * plan;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("length n must be positive integer", GSL_EDOM);
+    }
+
+  plan = (TYPE(gsl_fft_complex_plan) *) 
+    malloc (sizeof (TYPE(gsl_fft_complex_plan)));
+
+  if (plan == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate struct", GSL_ENOMEM);
+    }
+
+  plan->n = n;
+  plan->sign = sign;
+  plan->wavetable = FUNCTION(gsl_fft_complex_wavetable,alloc) (n);
+
+  if (plan->wavetable == NULL)
+    {
+      free (plan);
+      GSL_ERROR_NULL ("failed to allocate wavetable", GSL_ENOMEM);
+    }
+
+  /* lengths with a large prime factor use Bluestein's algorithm */
+
+  if (plan->wavetable->nb > 0)
+    {
+      plan->scratch_size = 4 * plan->wavetable->nb;
+    }
+  else
+    {
+      plan->scratch_size = 2 * n;
+    }
+
+  return plan;
+}
+
+void
+FUNCTION(gsl_fft_complex_plan,free) (TYPE(gsl_fft_complex_plan) * plan)
+{
+  RETURN_IF_NULL (plan);
+  FUNCTION(gsl_fft_complex_wavetable,free) (plan->wavetable);
+  free (plan);
+}
+
+size_t
+FUNCTION(gsl_fft_complex_plan,scratch_size) (const TYPE(gsl_fft_complex_plan) * plan)
+{
+  return plan->scratch_size;
+}
+
+/* transform data in place; scratch must hold plan->scratch_size
+   elements, or be NULL to allocate them for this call */
+
+int
+FUNCTION(gsl_fft_complex_plan,execute) (const TYPE(gsl_fft_complex_plan) * plan,
+                                        TYPE(gsl_complex_packed_array) data,
+                                        const size_t stride,
+                                        BASE * scratch)
+{
+  int status;
+
+  if (plan->n == 1)
+    {
+      return 0;
+    }
+
+  if (scratch != NULL)
+    {
+      return FUNCTION(fft_complex,passes) (data, stride, plan->n,
+                                           plan->wavetable, scratch,
+                                           plan->sign);
+    }
+
+  scratch = (BASE *) malloc (plan->scratch_size * sizeof (BASE));
+
+  if (scratch == NULL)
+    {
+      GSL_ERROR ("failed to allocate scratch space", GSL_ENOMEM);
+    }
+
+  status = FUNCTION(fft_complex,passes) (data, stride, plan->n,
+                                         plan->wavetable, scratch,
+                                         plan->sign);
+  free (scratch);
+
+  return status;
+}
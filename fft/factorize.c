@@ -18,6 +18,8 @@
  */
 
 #include <config.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_fft_complex.h>
 
@@ -35,6 +37,35 @@ fft_complex_factorize (const size_t n,
      implemented. The end of the list is marked by 0. */
 
   int status = fft_factorize (n, complex_subtransforms, nf, factors);
+
+  /* An odd power of 2 leaves a single radix 2 pass after the radix 4
+     passes. Merge it with the last radix 4 pass into one radix 8 pass,
+     which saves a pass over the data. Radix 8 is not used otherwise,
+     since a radix 8 pass is slower than two radix 4 passes. */
+
+  if (status == 0)
+    {
+      size_t i, i4 = *nf, i2 = *nf;
+
+      for (i = 0; i < *nf; i++)
+        {
+          if (factors[i] == 4)
+            i4 = i;
+          else if (factors[i] == 2)
+            i2 = i;
+        }
+
+      if (i4 < *nf && i2 < *nf)
+        {
+          factors[i4] = 8;
+
+          for (i = i2; i + 1 < *nf; i++)
+            factors[i] = factors[i + 1];
+
+          (*nf)--;
+        }
+    }
+
   return status;
 }
 
@@ -147,6 +178,105 @@ fft_factorize (const size_t n,
   return 0;
 }
 
+/* Bluestein's algorithm writes a transform of length n as a convolution
+   with the chirp exp(-i pi k^2/n), which is computed with two transforms
+   of a length nb >= 2n - 1 having only factors 2, 3, 5 and 7. The general
+   pass used for other prime factors p costs O(p) operations per element,
+   so for lengths with a large prime factor the O(nb log nb) convolution
+   is faster. The costs below are relative times per element and unit of
+   factor, measured for the passes in c_pass_*.c. */
+
+#define FFT_MODULE_COST 1.0     /* cost per element and unit factor of a module */
+#define FFT_GENERIC_COST 2.5    /* cost per element and unit factor of the general pass */
+
+static double
+fft_complex_cost (const size_t n)
+{
+  size_t nf, i;
+  size_t factors[64];
+  double cost = 0.0;
+
+  if (fft_complex_factorize (n, &nf, factors))
+    {
+      return GSL_POSINF;
+    }
+
+  for (i = 0; i < nf; i++)
+    {
+      const size_t f = factors[i];
+      cost += ((f <= 8) ? FFT_MODULE_COST : FFT_GENERIC_COST) * f;
+    }
+
+  return cost * n;
+}
+
+/* smallest m >= n with only factors 2, 3, 5 and 7 */
+
+static size_t
+fft_smooth_length (const size_t n)
+{
+  size_t best = 1;
+  size_t p7, p75, p753, p7532;
+
+  while (best < n)
+    {
+      best *= 2;
+    }
+
+  for (p7 = 1; p7 < best; p7 *= 7)
+    for (p75 = p7; p75 < best; p75 *= 5)
+      for (p753 = p75; p753 < best; p753 *= 3)
+        {
+          p7532 = p753;
+
+          while (p7532 < n)
+            {
+              p7532 *= 2;
+            }
+
+          if (p7532 < best)
+            {
+              best = p7532;
+            }
+        }
+
+  return best;
+}
+
+/* length of the Bluestein convolution for a complex transform of length
+   n, or 0 if the mixed radix passes are estimated to be faster */
+
+static size_t
+fft_complex_bluestein_length (const size_t n)
+{
+  size_t nf, nb;
+  size_t factors[64];
+
+  if (n > ((size_t) -1) / 8 || fft_complex_factorize (n, &nf, factors))
+    {
+      return 0;
+    }
+
+  /* the factors are in increasing order after the modules, so only the
+     last one needs to be checked for the general pass */
+
+  if (factors[nf - 1] <= 8)
+    {
+      return 0;
+    }
+
+  nb = fft_smooth_length (2 * n - 1);
+
+  /* two transforms of length nb and the products with the chirp and
+     the kernel */
+
+  if (2.0 * fft_complex_cost (nb) + 4.0 * nb < fft_complex_cost (n))
+    {
+      return nb;
+    }
+
+  return 0;
+}
 
 static int 
 fft_binary_logn (const size_t n)
@@ -25,5 +25,7 @@ static int fft_real_factorize (const size_t n, size_t *nf, size_t factors[]);
 
 static int fft_factorize (const size_t n, const size_t implemented_subtransforms[], size_t *n_factors, size_t factors[]);
 
+static size_t fft_complex_bluestein_length (const size_t n);
+
 static int fft_binary_logn (const size_t n) ;
 
@@ -3,6 +3,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_complex.h>
@@ -10,6 +13,8 @@
 #include <gsl/gsl_fft_complex.h>
 #include <gsl/gsl_fft_complex_float.h>
 
+#include "simd.h"
+
 #define BASE_DOUBLE
 #include "templates_on.h"
 #include "bitreverse.c"
@@ -34,8 +39,12 @@
 #include "c_pass_5.c"
 #include "c_pass_6.c"
 #include "c_pass_7.c"
+#include "c_pass_8.c"
 #include "c_pass_n.c"
 #include "c_radix2.c"
+#include "c_bluestein.c"
+#include "c_plan.c"
+#include "c_many.c"
 #include "templates_off.h"
 #undef  BASE_DOUBLE
 
@@ -49,8 +58,12 @@
 #include "c_pass_5.c"
 #include "c_pass_6.c"
 #include "c_pass_7.c"
+#include "c_pass_8.c"
 #include "c_pass_n.c"
 #include "c_radix2.c"
+#include "c_bluestein.c"
+#include "c_plan.c"
+#include "c_many.c"
 #include "templates_off.h"
 #undef  BASE_FLOAT
 
@@ -99,6 +112,8 @@
 #include "real_pass_n.c"
 #include "real_radix2.c"
 #include "real_unpack.c"
+#include "real_plan.c"
+#include "real_nd.c"
 #include "templates_off.h"
 #undef  BASE_DOUBLE
 
@@ -113,5 +128,7 @@
 #include "real_pass_n.c"
 #include "real_radix2.c"
 #include "real_unpack.c"
+#include "real_plan.c"
+#include "real_nd.c"
 #include "templates_off.h"
 #undef  BASE_FLOAT
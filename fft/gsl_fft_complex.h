@@ -77,13 +77,17 @@ int gsl_fft_complex_radix2_dif_transform (gsl_complex_packed_array data,
 
 /*  Mixed Radix general-N routines  */
 
-typedef struct
+typedef struct gsl_fft_complex_wavetable_struct
   {
     size_t n;
     size_t nf;
     size_t factor[64];
     gsl_complex *twiddle[64];
     gsl_complex *trig;
+    size_t nb;                  /* length of Bluestein convolution, or 0 */
+    gsl_complex *chirp;       /* chirp exp(-i pi k^2/n), k = 0..n-1 */
+    gsl_complex *kernel;      /* transform of conjugate chirp, over nb */
+    struct gsl_fft_complex_wavetable_struct *bluestein; /* length nb */
   }
 gsl_fft_complex_wavetable;
 
@@ -131,6 +135,64 @@ int gsl_fft_complex_transform (gsl_complex_packed_array data,
                                gsl_fft_complex_workspace * work,
                                const gsl_fft_direction sign);
 
+/*  Plans: precomputed transforms of a given length and direction  */
+
+typedef struct
+{
+  size_t n;                     /* length of transform */
+  gsl_fft_direction sign;       /* direction of transform */
+  gsl_fft_complex_wavetable * wavetable; /* factors and twiddle factors */
+  size_t scratch_size;          /* elements of scratch used by execute */
+}
+gsl_fft_complex_plan;
+
+gsl_fft_complex_plan *gsl_fft_complex_plan_alloc (const size_t n,
+                                              const gsl_fft_direction sign);
+
+void gsl_fft_complex_plan_free (gsl_fft_complex_plan * plan);
+
+size_t gsl_fft_complex_plan_scratch_size (const gsl_fft_complex_plan * plan);
+
+int gsl_fft_complex_plan_execute (const gsl_fft_complex_plan * plan,
+                                  gsl_complex_packed_array data,
+                                  const size_t stride,
+                                  double * scratch);
+
+/*  Batched and multidimensional transforms  */
+
+int gsl_fft_complex_plan_execute_many (const gsl_fft_complex_plan * plan,
+                                  gsl_complex_packed_array data,
+                                  const size_t stride,
+                                  const size_t dist,
+                                  const size_t howmany);
+
+typedef struct
+{
+  size_t rank;                  /* number of dimensions */
+  size_t *dims;                 /* dimensions of the row-major array */
+  gsl_fft_direction sign;       /* direction of transform */
+  gsl_fft_complex_plan ** plan;  /* plan for each dimension */
+}
+gsl_fft_complex_nd_plan;
+
+gsl_fft_complex_nd_plan *gsl_fft_complex_nd_plan_alloc (const size_t rank,
+                                                    const size_t dims[],
+                                                    const gsl_fft_direction sign);
+
+void gsl_fft_complex_nd_plan_free (gsl_fft_complex_nd_plan * plan);
+
+int gsl_fft_complex_nd_plan_execute (const gsl_fft_complex_nd_plan * plan,
+                                     gsl_complex_packed_array data);
+
+int gsl_fft_complex_2d_transform (gsl_complex_packed_array data,
+                                  const size_t n1, const size_t n2,
+                                  const gsl_fft_direction sign);
+
+int gsl_fft_complex_3d_transform (gsl_complex_packed_array data,
+                                  const size_t n1, const size_t n2,
+                                  const size_t n3,
+                                  const gsl_fft_direction sign);
+
 __END_DECLS
 
 #endif /* __GSL_FFT_COMPLEX_H__ */
@@ -25,6 +25,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_complex.h>
 #include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex.h>
 #include <gsl/gsl_fft_real.h>
 
 #undef __BEGIN_DECLS
@@ -50,6 +51,7 @@ typedef struct
     size_t factor[64];
     gsl_complex *twiddle[64];
     gsl_complex *trig;
+    gsl_fft_complex_wavetable *bluestein; /* complex transform for large primes, or NULL */
   }
 gsl_fft_halfcomplex_wavetable;
 
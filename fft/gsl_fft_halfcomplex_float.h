@@ -25,6 +25,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_complex.h>
 #include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex_float.h>
 #include <gsl/gsl_fft_real_float.h>
 
 #undef __BEGIN_DECLS
@@ -50,6 +51,7 @@ typedef struct
     size_t factor[64];
     gsl_complex_float *twiddle[64];
     gsl_complex_float *trig;
+    gsl_fft_complex_wavetable_float *bluestein; /* complex transform for large primes, or NULL */
   }
 gsl_fft_halfcomplex_wavetable_float;
 
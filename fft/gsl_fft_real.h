@@ -25,6 +25,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_complex.h>
 #include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -47,6 +48,7 @@ typedef struct
     size_t factor[64];
     gsl_complex *twiddle[64];
     gsl_complex *trig;
+    gsl_fft_complex_wavetable *bluestein; /* complex transform for large primes, or NULL */
   }
 gsl_fft_real_wavetable;
 
@@ -75,6 +77,59 @@ int gsl_fft_real_unpack (const double real_coefficient[],
                          double complex_coefficient[],
                          const size_t stride, const size_t n);
 
+/*  Plans for transforms of real data with complex output  */
+
+typedef struct
+{
+  size_t n;                     /* length of transform */
+  gsl_fft_complex_plan * plan; /* complex transform of length n/2, or n if odd */
+  gsl_complex * twiddle;  /* exp(-2 pi i k/n) for k <= n/4, if n even */
+  size_t scratch_size;          /* elements of scratch used by r2c and c2r */
+}
+gsl_fft_real_plan;
+
+gsl_fft_real_plan *gsl_fft_real_plan_alloc (const size_t n);
+
+void gsl_fft_real_plan_free (gsl_fft_real_plan * plan);
+
+size_t gsl_fft_real_plan_scratch_size (const gsl_fft_real_plan * plan);
+
+int gsl_fft_real_plan_r2c (const gsl_fft_real_plan * plan,
+                           const double in[],
+                           gsl_complex_packed_array out,
+                           double * scratch);
+
+int gsl_fft_real_plan_c2r (const gsl_fft_real_plan * plan,
+                           gsl_const_complex_packed_array in,
+                           double out[],
+                           double * scratch);
+
+/*  Multidimensional transforms of real data  */
+
+typedef struct
+{
+  size_t rank;                  /* number of dimensions */
+  size_t *dims;                 /* dimensions of the real array */
+  size_t *cdims;                /* dimensions of the complex array */
+  gsl_fft_real_plan * row;     /* rows of the real array */
+  gsl_fft_complex_plan ** forward;  /* other dimensions, forward */
+  gsl_fft_complex_plan ** backward; /* other dimensions, backward */
+}
+gsl_fft_real_nd_plan;
+
+gsl_fft_real_nd_plan *gsl_fft_real_nd_plan_alloc (const size_t rank,
+                                              const size_t dims[]);
+
+void gsl_fft_real_nd_plan_free (gsl_fft_real_nd_plan * plan);
+
+int gsl_fft_real_nd_plan_r2c (const gsl_fft_real_nd_plan * plan,
+                              const double in[],
+                              gsl_complex_packed_array out);
+
+int gsl_fft_real_nd_plan_c2r (const gsl_fft_real_nd_plan * plan,
+                              gsl_complex_packed_array in,
+                              double out[]);
+
 __END_DECLS
 
 #endif /* __GSL_FFT_REAL_H__ */
@@ -25,6 +25,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_complex.h>
 #include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex_float.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -47,6 +48,7 @@ typedef struct
     size_t factor[64];
     gsl_complex_float *twiddle[64];
     gsl_complex_float *trig;
+    gsl_fft_complex_wavetable_float *bluestein; /* complex transform for large primes, or NULL */
   }
 gsl_fft_real_wavetable_float;
 
@@ -74,6 +76,59 @@ int gsl_fft_real_float_unpack (const float real_float_coefficient[],
                                float complex_coefficient[],
                                const size_t stride, const size_t n);
 
+/*  Plans for transforms of real data with complex output  */
+
+typedef struct
+{
+  size_t n;                     /* length of transform */
+  gsl_fft_complex_plan_float * plan; /* complex transform of length n/2, or n if odd */
+  gsl_complex_float * twiddle;  /* exp(-2 pi i k/n) for k <= n/4, if n even */
+  size_t scratch_size;          /* elements of scratch used by r2c and c2r */
+}
+gsl_fft_real_plan_float;
+
+gsl_fft_real_plan_float *gsl_fft_real_plan_float_alloc (const size_t n);
+
+void gsl_fft_real_plan_float_free (gsl_fft_real_plan_float * plan);
+
+size_t gsl_fft_real_plan_float_scratch_size (const gsl_fft_real_plan_float * plan);
+
+int gsl_fft_real_plan_float_r2c (const gsl_fft_real_plan_float * plan,
+                           const float in[],
+                           gsl_complex_packed_array_float out,
+                           float * scratch);
+
+int gsl_fft_real_plan_float_c2r (const gsl_fft_real_plan_float * plan,
+                           gsl_const_complex_packed_array_float in,
+                           float out[],
+                           float * scratch);
+
+/*  Multidimensional transforms of real data  */
+
+typedef struct
+{
+  size_t rank;                  /* number of dimensions */
+  size_t *dims;                 /* dimensions of the real array */
+  size_t *cdims;                /* dimensions of the complex array */
+  gsl_fft_real_plan_float * row;     /* rows of the real array */
+  gsl_fft_complex_plan_float ** forward;  /* other dimensions, forward */
+  gsl_fft_complex_plan_float ** backward; /* other dimensions, backward */
+}
+gsl_fft_real_nd_plan_float;
+
+gsl_fft_real_nd_plan_float *gsl_fft_real_nd_plan_float_alloc (const size_t rank,
+                                              const size_t dims[]);
+
+void gsl_fft_real_nd_plan_float_free (gsl_fft_real_nd_plan_float * plan);
+
+int gsl_fft_real_nd_plan_float_r2c (const gsl_fft_real_nd_plan_float * plan,
+                              const float in[],
+                              gsl_complex_packed_array_float out);
+
+int gsl_fft_real_nd_plan_float_c2r (const gsl_fft_real_nd_plan_float * plan,
+                              gsl_complex_packed_array_float in,
+                              float out[]);
+
 __END_DECLS
 
 #endif /* __GSL_FFT_REAL_FLOAT_H__ */
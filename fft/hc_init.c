@@ -110,6 +110,26 @@ FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (size_t n)
       GSL_ERROR_VAL ("overflowed trigonometric lookup table", GSL_ESANITY, 0);
     }
 
+  /* lengths with a large prime factor are transformed as complex data
+     with Bluestein's algorithm */
+
+  wavetable->bluestein = NULL;
+
+  if (fft_complex_bluestein_length (n) > 0)
+    {
+      wavetable->bluestein = FUNCTION(gsl_fft_complex_wavetable,alloc) (n);
+
+      if (wavetable->bluestein == NULL)
+        {
+          /* error in constructor, prevent memory leak */
+
+          free(wavetable->trig);
+          free(wavetable) ; 
+
+          GSL_ERROR_VAL ("failed to allocate Bluestein tables", GSL_ENOMEM, 0);
+        }
+    }
+
   return wavetable;
 }
 
@@ -123,6 +143,8 @@ FUNCTION(gsl_fft_halfcomplex_wavetable,free) (TYPE(gsl_fft_halfcomplex_wavetable
   free (wavetable->trig);
   wavetable->trig = NULL;
 
+  FUNCTION(gsl_fft_complex_wavetable,free) (wavetable->bluestein);
+
   free (wavetable);
 }
 
@@ -103,6 +103,12 @@ FUNCTION(gsl_fft_halfcomplex,transform) (BASE data[], const size_t stride, const
       GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
     }
 
+  if (wavetable->bluestein != NULL)
+    {
+      return FUNCTION(fft_halfcomplex,bluestein) (data, stride, n, wavetable->bluestein,
+                                         work->scratch);
+    }
+
   nf = wavetable->nf;
   product = 1;
   state = 0;
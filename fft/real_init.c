@@ -119,6 +119,26 @@ FUNCTION(gsl_fft_real_wavetable,alloc) (size_t n)
                         GSL_ESANITY, 0);
     }
 
+  /* lengths with a large prime factor are transformed as complex data
+     with Bluestein's algorithm */
+
+  wavetable->bluestein = NULL;
+
+  if (fft_complex_bluestein_length (n) > 0)
+    {
+      wavetable->bluestein = FUNCTION(gsl_fft_complex_wavetable,alloc) (n);
+
+      if (wavetable->bluestein == NULL)
+        {
+          /* error in constructor, prevent memory leak */
+
+          free(wavetable->trig);
+          free(wavetable) ; 
+
+          GSL_ERROR_VAL ("failed to allocate Bluestein tables", GSL_ENOMEM, 0);
+        }
+    }
+
   return wavetable;
 }
 
@@ -142,7 +162,15 @@ FUNCTION(gsl_fft_real_workspace,alloc) (size_t n)
 
   workspace->n = n;
 
-  workspace->scratch = (BASE *) malloc (n * sizeof (BASE));
+  /* Bluestein's algorithm needs a complex copy of the data and the
+     scratch space of the complex transform */
+
+  {
+    const size_t nb = fft_complex_bluestein_length (n);
+    const size_t size = (nb > 0) ? 2 * n + 4 * nb : n;
+
+    workspace->scratch = (BASE *) malloc (size * sizeof (BASE));
+  }
 
   if (workspace->scratch == NULL)
     {
@@ -167,6 +195,8 @@ FUNCTION(gsl_fft_real_wavetable,free) (TYPE(gsl_fft_real_wavetable) * wavetable)
   free (wavetable->trig);
   wavetable->trig = NULL;
 
+  FUNCTION(gsl_fft_complex_wavetable,free) (wavetable->bluestein);
+
   free (wavetable) ;
 }
 
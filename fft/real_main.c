@@ -69,6 +69,12 @@ FUNCTION(gsl_fft_real,transform) (BASE data[], const size_t stride, const size_t
       GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
     }
 
+  if (wavetable->bluestein != NULL)
+    {
+      return FUNCTION(fft_real,bluestein) (data, stride, n, wavetable->bluestein,
+                                         work->scratch);
+    }
+
   for (i = 0; i < nf; i++)
     {
       const size_t factor = wavetable->factor[i];
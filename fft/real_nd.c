@@ -0,0 +1,250 @@
+/* fft/real_nd.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Multidimensional transforms of real data.
+
+   The forward transform of a real row-major array of dimensions
+   n_1 x ... x n_r is Hermitian, so only the elements 0 <= k_r <= n_r/2
+   of its last dimension are computed: the output is a row-major
+   complex array of dimensions n_1 x ... x n_{r-1} x (n_r/2 + 1). The
+   rows of the real array are transformed first (see real_plan.c),
+   giving the rows of the complex array, followed by complex transforms
+   along the other dimensions (see c_many.c). The backward transform reverses these
+   steps; it overwrites its complex input. */
+
+TYPE(gsl_fft_real_nd_plan) *
+FUNCTION(gsl_fft_real_nd_plan,alloc) (const size_t rank,
+                                      const size_t dims[])
+{
+  TYPE(gsl_fft_real_nd_plan) * plan;
+  size_t d;
+  int status;
+
+  if (rank == 0)
+    {
+      GSL_ERROR_NULL ("rank must be positive integer", GSL_EINVAL);
+    }
+
+  for (d = 0; d < rank; d++)
+    {
+      if (dims[d] == 0)
+        {
+          GSL_ERROR_NULL ("length n must be positive integer", GSL_EDOM);
+        }
+    }
+
+  plan = (TYPE(gsl_fft_real_nd_plan) *) 
+    calloc (1, sizeof (TYPE(gsl_fft_real_nd_plan)));
+
+  if (plan == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate struct", GSL_ENOMEM);
+    }
+
+  plan->rank = rank;
+  plan->dims = (size_t *) malloc (rank * sizeof (size_t));
+  plan->cdims = (size_t *) malloc (rank * sizeof (size_t));
+  plan->forward = (TYPE(gsl_fft_complex_plan) **)
+    calloc (rank, sizeof (TYPE(gsl_fft_complex_plan) *));
+  plan->backward = (TYPE(gsl_fft_complex_plan) **)
+    calloc (rank, sizeof (TYPE(gsl_fft_complex_plan) *));
+
+  if (plan->dims == NULL || plan->cdims == NULL
+      || plan->forward == NULL || plan->backward == NULL)
+    {
+      FUNCTION(gsl_fft_real_nd_plan,free) (plan);
+      GSL_ERROR_NULL ("failed to allocate dimensions", GSL_ENOMEM);
+    }
+
+  for (d = 0; d < rank; d++)
+    {
+      plan->dims[d] = dims[d];
+      plan->cdims[d] = dims[d];
+    }
+
+  plan->cdims[rank - 1] = dims[rank - 1] / 2 + 1;
+
+  plan->row = FUNCTION(gsl_fft_real_plan,alloc) (dims[rank - 1]);
+
+  status = (plan->row == NULL);
+  status |= FUNCTION(fft_complex,plans_alloc) (rank - 1, dims,
+                                               gsl_fft_forward,
+                                               plan->forward);
+  status |= FUNCTION(fft_complex,plans_alloc) (rank - 1, dims,
+                                               gsl_fft_backward,
+                                               plan->backward);
+
+  if (status)
+    {
+      FUNCTION(gsl_fft_real_nd_plan,free) (plan);
+      GSL_ERROR_NULL ("failed to allocate plans", GSL_ENOMEM);
+    }
+
+  return plan;
+}
+
+void
+FUNCTION(gsl_fft_real_nd_plan,free) (TYPE(gsl_fft_real_nd_plan) * plan)
+{
+  RETURN_IF_NULL (plan);
+
+  if (plan->forward != NULL)
+    {
+      FUNCTION(fft_complex,plans_free) (plan->rank - 1, plan->forward);
+    }
+
+  if (plan->backward != NULL)
+    {
+      FUNCTION(fft_complex,plans_free) (plan->rank - 1, plan->backward);
+    }
+
+  FUNCTION(gsl_fft_real_plan,free) (plan->row);
+  free (plan->dims);
+  free (plan->cdims);
+  free (plan->forward);
+  free (plan->backward);
+  free (plan);
+}
+
+/* forward transform of the real array in to the complex array out */
+
+int
+FUNCTION(gsl_fft_real_nd_plan,r2c) (const TYPE(gsl_fft_real_nd_plan) * plan,
+                                    const BASE in[],
+                                    TYPE(gsl_complex_packed_array) out)
+{
+  const size_t rank = plan->rank;
+  const size_t n = plan->dims[rank - 1];
+  const size_t nc = plan->cdims[rank - 1];
+  size_t d, nrows = 1;
+  long r;
+  int nthreads, nfail = 0;
+
+  for (d = 0; d + 1 < rank; d++)
+    {
+      nrows *= plan->dims[d];
+    }
+
+  nthreads = (int) GSL_MIN (gsl_get_num_threads (), nrows);
+
+#ifdef _OPENMP
+  if (omp_in_parallel ())
+    nthreads = 1;
+
+#pragma omp parallel num_threads(nthreads) reduction(+:nfail) if (nthreads > 1)
+#else
+  (void) nthreads;
+#endif
+  {
+    BASE *scratch = (BASE *) malloc (plan->row->scratch_size * sizeof (BASE));
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+    for (r = 0; r < (long) nrows; r++)
+      {
+        if (scratch == NULL)
+          {
+            nfail++;
+            continue;
+          }
+
+        FUNCTION(fft_real,r2c) (plan->row, in + (size_t) r * n,
+                                out + 2 * (size_t) r * nc, scratch);
+      }
+
+    free (scratch);
+  }
+
+  if (nfail)
+    {
+      GSL_ERROR ("failed to allocate scratch space", GSL_ENOMEM);
+    }
+
+  return FUNCTION(fft_complex,axes) (plan->forward, rank, plan->cdims,
+                                     rank - 1, out);
+}
+
+/* backward transform of the complex array in, which is overwritten, to
+   the real array out */
+
+int
+FUNCTION(gsl_fft_real_nd_plan,c2r) (const TYPE(gsl_fft_real_nd_plan) * plan,
+                                    TYPE(gsl_complex_packed_array) in,
+                                    BASE out[])
+{
+  const size_t rank = plan->rank;
+  const size_t n = plan->dims[rank - 1];
+  const size_t nc = plan->cdims[rank - 1];
+  size_t d, nrows = 1;
+  long r;
+  int nthreads, nfail = 0;
+  int status;
+
+  status = FUNCTION(fft_complex,axes) (plan->backward, rank, plan->cdims,
+                                       rank - 1, in);
+
+  if (status)
+    {
+      return status;
+    }
+
+  for (d = 0; d + 1 < rank; d++)
+    {
+      nrows *= plan->dims[d];
+    }
+
+  nthreads = (int) GSL_MIN (gsl_get_num_threads (), nrows);
+
+#ifdef _OPENMP
+  if (omp_in_parallel ())
+    nthreads = 1;
+
+#pragma omp parallel num_threads(nthreads) reduction(+:nfail) if (nthreads > 1)
+#else
+  (void) nthreads;
+#endif
+  {
+    BASE *scratch = (BASE *) malloc (plan->row->scratch_size * sizeof (BASE));
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+    for (r = 0; r < (long) nrows; r++)
+      {
+        if (scratch == NULL)
+          {
+            nfail++;
+            continue;
+          }
+
+        FUNCTION(fft_real,c2r) (plan->row, in + 2 * (size_t) r * nc,
+                                out + (size_t) r * n, scratch);
+      }
+
+    free (scratch);
+  }
+
+  if (nfail)
+    {
+      GSL_ERROR ("failed to allocate scratch space", GSL_ENOMEM);
+    }
+
+  return GSL_SUCCESS;
+}
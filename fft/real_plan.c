@@ -0,0 +1,357 @@
+/* fft/real_plan.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Transforms of real data with interleaved complex output.
+
+   For even n = 2m the real sequence x is read as the m complex numbers
+   z_j = x_{2j} + i x_{2j+1}, which are transformed with a complex
+   transform of length m. The transforms of the even and odd elements
+   of x are then
+
+     E_k = (Z_k + conj(Z_{m-k}))/2,   O_k = (Z_k - conj(Z_{m-k}))/(2i)
+
+   and X_k = E_k + w^k O_k with w = exp(-2 pi i/n), for 0 <= k <= m. The
+   terms k and m-k are computed together, using X_{m-k} = conj(E_k - w^k
+   O_k), so that the post-processing reads and writes the output once
+   and can be done in place. The backward transform inverts these steps
+   before a backward complex transform of length m. This is about twice
+   as fast as a complex transform of length n, and faster than the real
+   passes of gsl_fft_real_transform, whose half-complex output must
+   usually be unpacked as well.
+
+   Odd lengths use a complex transform of length n. */
+
+TYPE(gsl_fft_real_plan) *
+FUNCTION(gsl_fft_real_plan,alloc) (const size_t n)
+{
+  TYPE(gsl_fft_real_plan) * plan;
+  const size_t m = (n % 2 == 0) ? n / 2 : n;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("length n must be positive integer", GSL_EDOM);
+    }
+
+  plan = (TYPE(gsl_fft_real_plan) *) 
+    malloc (sizeof (TYPE(gsl_fft_real_plan)));
+
+  if (plan == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate struct", GSL_ENOMEM);
+    }
+
+  plan->n = n;
+  plan->twiddle = NULL;
+  plan->plan = FUNCTION(gsl_fft_complex_plan,alloc) (m, gsl_fft_forward);
+
+  if (plan->plan == NULL)
+    {
+      free (plan);
+      GSL_ERROR_NULL ("failed to allocate complex plan", GSL_ENOMEM);
+    }
+
+  if (n % 2 == 0)
+    {
+      size_t k;
+
+      plan->twiddle = (TYPE(gsl_complex) *) 
+        malloc ((m / 2 + 1) * sizeof (TYPE(gsl_complex)));
+
+      if (plan->twiddle == NULL)
+        {
+          FUNCTION(gsl_fft_complex_plan,free) (plan->plan);
+          free (plan);
+          GSL_ERROR_NULL ("failed to allocate twiddle factors", GSL_ENOMEM);
+        }
+
+      for (k = 0; k <= m / 2; k++)
+        {
+          const double theta = -2.0 * M_PI * (double) k / (double) n;
+          GSL_REAL(plan->twiddle[k]) = cos (theta);
+          GSL_IMAG(plan->twiddle[k]) = sin (theta);
+        }
+
+      plan->scratch_size = plan->plan->scratch_size;
+    }
+  else
+    {
+      plan->scratch_size = 2 * n + plan->plan->scratch_size;
+    }
+
+  return plan;
+}
+
+void
+FUNCTION(gsl_fft_real_plan,free) (TYPE(gsl_fft_real_plan) * plan)
+{
+  RETURN_IF_NULL (plan);
+  FUNCTION(gsl_fft_complex_plan,free) (plan->plan);
+  free (plan->twiddle);
+  free (plan);
+}
+
+size_t
+FUNCTION(gsl_fft_real_plan,scratch_size) (const TYPE(gsl_fft_real_plan) * plan)
+{
+  return plan->scratch_size;
+}
+
+/* forward transform of the n real elements of in to the n/2 + 1
+   complex elements of out, using scratch */
+
+static void
+FUNCTION(fft_real,r2c) (const TYPE(gsl_fft_real_plan) * plan,
+                        const BASE in[],
+                        BASE out[],
+                        BASE scratch[])
+{
+  const size_t n = plan->n;
+  const TYPE(gsl_fft_complex_wavetable) * wavetable = plan->plan->wavetable;
+  size_t j, k;
+
+  if (n % 2 != 0)
+    {
+      for (j = 0; j < n; j++)
+        {
+          scratch[2 * j] = in[j];
+          scratch[2 * j + 1] = 0;
+        }
+
+      if (n > 1)
+        {
+          FUNCTION(fft_complex,passes) (scratch, 1, n, wavetable,
+                                        scratch + 2 * n, gsl_fft_forward);
+        }
+
+      for (k = 0; k <= n / 2; k++)
+        {
+          out[2 * k] = scratch[2 * k];
+          out[2 * k + 1] = scratch[2 * k + 1];
+        }
+
+      return;
+    }
+
+  {
+    const size_t m = n / 2;
+    const TYPE(gsl_complex) * twiddle = plan->twiddle;
+
+    for (j = 0; j < n; j++)
+      {
+        out[j] = in[j];
+      }
+
+    if (m > 1)
+      {
+        FUNCTION(fft_complex,passes) (out, 1, m, wavetable, scratch,
+                                      gsl_fft_forward);
+      }
+
+    {
+      const BASE re = out[0];
+      const BASE im = out[1];
+
+      out[0] = re + im;
+      out[1] = 0;
+      out[2 * m] = re - im;
+      out[2 * m + 1] = 0;
+    }
+
+    for (k = 1; k < m - k; k++)
+      {
+        BASE *a = out + 2 * k;
+        BASE *b = out + 2 * (m - k);
+        const BASE wr = GSL_REAL(twiddle[k]);
+        const BASE wi = GSL_IMAG(twiddle[k]);
+
+        /* 2 E_k and 2 O_k */
+
+        const BASE evr = a[0] + b[0];
+        const BASE evi = a[1] - b[1];
+        const BASE odr = a[1] + b[1];
+        const BASE odi = b[0] - a[0];
+
+        /* 2 w^k O_k */
+
+        const BASE tr = wr * odr - wi * odi;
+        const BASE ti = wr * odi + wi * odr;
+
+        a[0] = (evr + tr) / 2;
+        a[1] = (evi + ti) / 2;
+        b[0] = (evr - tr) / 2;
+        b[1] = (ti - evi) / 2;
+      }
+
+    /* for m even, X_{m/2} = conj(Z_{m/2}) since w^{m/2} = -i */
+
+    if (k == m - k)
+      {
+        out[2 * k + 1] = -out[2 * k + 1];
+      }
+  }
+}
+
+/* backward transform of the n/2 + 1 complex elements of in to the n
+   real elements of out, using scratch */
+
+static void
+FUNCTION(fft_real,c2r) (const TYPE(gsl_fft_real_plan) * plan,
+                        const BASE in[],
+                        BASE out[],
+                        BASE scratch[])
+{
+  const size_t n = plan->n;
+  const TYPE(gsl_fft_complex_wavetable) * wavetable = plan->plan->wavetable;
+  size_t j, k;
+
+  if (n % 2 != 0)
+    {
+      /* the full sequence from its Hermitian symmetry */
+
+      for (k = 0; k <= n / 2; k++)
+        {
+          scratch[2 * k] = in[2 * k];
+          scratch[2 * k + 1] = in[2 * k + 1];
+        }
+
+      for (k = n / 2 + 1; k < n; k++)
+        {
+          scratch[2 * k] = in[2 * (n - k)];
+          scratch[2 * k + 1] = -in[2 * (n - k) + 1];
+        }
+
+      if (n > 1)
+        {
+          FUNCTION(fft_complex,passes) (scratch, 1, n, wavetable,
+                                        scratch + 2 * n, gsl_fft_backward);
+        }
+
+      for (j = 0; j < n; j++)
+        {
+          out[j] = scratch[2 * j];
+        }
+
+      return;
+    }
+
+  {
+    const size_t m = n / 2;
+    const TYPE(gsl_complex) * twiddle = plan->twiddle;
+
+    /* Z_k = E_k + i O_k, with E_k and O_k scaled by 2 so that the
+       result is n times the inverse transform, as for the other
+       backward transforms; the imaginary parts of X_0 and X_m are
+       ignored */
+
+    {
+      const BASE x0 = in[0];
+      const BASE xm = in[2 * m];
+
+      out[0] = x0 + xm;
+      out[1] = x0 - xm;
+    }
+
+    for (k = 1; k < m - k; k++)
+      {
+        const BASE *a = in + 2 * k;
+        const BASE *b = in + 2 * (m - k);
+        const BASE wr = GSL_REAL(twiddle[k]);
+        const BASE wi = GSL_IMAG(twiddle[k]);
+
+        /* 2 E_k = X_k + conj(X_{m-k}), 2 O_k = (X_k - conj(X_{m-k})) / w^k */
+
+        const BASE evr = a[0] + b[0];
+        const BASE evi = a[1] - b[1];
+        const BASE dr = a[0] - b[0];
+        const BASE di = a[1] + b[1];
+        const BASE odr = dr * wr + di * wi;
+        const BASE odi = di * wr - dr * wi;
+
+        out[2 * k] = evr - odi;
+        out[2 * k + 1] = evi + odr;
+        out[2 * (m - k)] = evr + odi;
+        out[2 * (m - k) + 1] = odr - evi;
+      }
+
+    if (k == m - k)
+      {
+        const BASE xr = in[2 * k];
+        const BASE xi = in[2 * k + 1];
+
+        out[2 * k] = 2 * xr;
+        out[2 * k + 1] = -2 * xi;
+      }
+
+    if (m > 1)
+      {
+        FUNCTION(fft_complex,passes) (out, 1, m, wavetable, scratch,
+                                      gsl_fft_backward);
+      }
+  }
+}
+
+int
+FUNCTION(gsl_fft_real_plan,r2c) (const TYPE(gsl_fft_real_plan) * plan,
+                                 const BASE in[],
+                                 TYPE(gsl_complex_packed_array) out,
+                                 BASE * scratch)
+{
+  if (scratch != NULL)
+    {
+      FUNCTION(fft_real,r2c) (plan, in, out, scratch);
+      return GSL_SUCCESS;
+    }
+
+  scratch = (BASE *) malloc (plan->scratch_size * sizeof (BASE));
+
+  if (scratch == NULL)
+    {
+      GSL_ERROR ("failed to allocate scratch space", GSL_ENOMEM);
+    }
+
+  FUNCTION(fft_real,r2c) (plan, in, out, scratch);
+  free (scratch);
+
+  return GSL_SUCCESS;
+}
+
+int
+FUNCTION(gsl_fft_real_plan,c2r) (const TYPE(gsl_fft_real_plan) * plan,
+                                 TYPE(gsl_const_complex_packed_array) in,
+                                 BASE out[],
+                                 BASE * scratch)
+{
+  if (scratch != NULL)
+    {
+      FUNCTION(fft_real,c2r) (plan, in, out, scratch);
+      return GSL_SUCCESS;
+    }
+
+  scratch = (BASE *) malloc (plan->scratch_size * sizeof (BASE));
+
+  if (scratch == NULL)
+    {
+      GSL_ERROR ("failed to allocate scratch space", GSL_ENOMEM);
+    }
+
+  FUNCTION(fft_real,c2r) (plan, in, out, scratch);
+  free (scratch);
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,206 @@
+/* fft/simd.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Runtime selection of the vectorized radix 2, 4 and 8 passes.  On x86
+ * the wider of AVX2 and SSE2 supported by the CPU (as reported by cpuid)
+ * is used; elsewhere, or when the compiler cannot build the kernels,
+ * the scalar passes are used.  As for the CBLAS kernels, the choice can
+ * be capped with the environment variable GSL_SIMD (see simd_level.h). */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <gsl/gsl_math.h>
+#include "simd_level.h"
+#include "simd.h"
+
+#define KERNEL_X(prefix,name,suffix) prefix ## name ## _ ## suffix
+#define KERNEL_Y(prefix,name,suffix) KERNEL_X(prefix,name,suffix)
+
+static const fft_simd_kernels kernels_generic =
+  { "generic", NULL, NULL, NULL, NULL, NULL, NULL };
+
+#ifdef HAVE_X86_SIMD_DISPATCH
+
+#include <immintrin.h>
+
+/* SSE2, which has no addsub instruction */
+
+#define TARGET __attribute__ ((target ("sse2")))
+#define VZERO() _mm_setzero_pd ()
+#define VLOAD(p) _mm_loadu_pd (p)
+#define VSTORE(p,v) _mm_storeu_pd (p, v)
+#define VSET1(x) _mm_set1_pd (x)
+#define VADD(a,b) _mm_add_pd (a, b)
+#define VSUB(a,b) _mm_sub_pd (a, b)
+#define VMUL(a,b) _mm_mul_pd (a, b)
+#define VSWAP(a) _mm_shuffle_pd (a, a, 1)
+#define VADDSUB(a,b) _mm_add_pd (a, _mm_xor_pd (b, _mm_set_pd (0.0, -0.0)))
+#define BASE double
+#define VEC __m128d
+#define VLEN 2
+#define KERNEL(name) KERNEL_Y(d,name,sse2)
+#include "simd_source.h"
+#undef KERNEL
+#undef VLEN
+#undef VEC
+#undef BASE
+#undef VZERO
+#undef VLOAD
+#undef VSTORE
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VMUL
+#undef VSWAP
+#undef VADDSUB
+
+#define VZERO() _mm_setzero_ps ()
+#define VLOAD(p) _mm_loadu_ps (p)
+#define VSTORE(p,v) _mm_storeu_ps (p, v)
+#define VSET1(x) _mm_set1_ps (x)
+#define VADD(a,b) _mm_add_ps (a, b)
+#define VSUB(a,b) _mm_sub_ps (a, b)
+#define VMUL(a,b) _mm_mul_ps (a, b)
+#define VSWAP(a) _mm_shuffle_ps (a, a, _MM_SHUFFLE (2, 3, 0, 1))
+#define VADDSUB(a,b) _mm_add_ps (a, _mm_xor_ps (b, _mm_set_ps (0.0f, -0.0f, 0.0f, -0.0f)))
+#define BASE float
+#define VEC __m128
+#define VLEN 4
+#define KERNEL(name) KERNEL_Y(s,name,sse2)
+#include "simd_source.h"
+#undef KERNEL
+#undef VLEN
+#undef VEC
+#undef BASE
+#undef VZERO
+#undef VLOAD
+#undef VSTORE
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VMUL
+#undef VSWAP
+#undef VADDSUB
+#undef TARGET
+
+/* AVX2 */
+
+#define TARGET __attribute__ ((target ("avx2")))
+#define VZERO() _mm256_setzero_pd ()
+#define VLOAD(p) _mm256_loadu_pd (p)
+#define VSTORE(p,v) _mm256_storeu_pd (p, v)
+#define VSET1(x) _mm256_set1_pd (x)
+#define VADD(a,b) _mm256_add_pd (a, b)
+#define VSUB(a,b) _mm256_sub_pd (a, b)
+#define VMUL(a,b) _mm256_mul_pd (a, b)
+#define VSWAP(a) _mm256_permute_pd (a, 0x5)
+#define VADDSUB(a,b) _mm256_addsub_pd (a, b)
+#define BASE double
+#define VEC __m256d
+#define VLEN 4
+#define KERNEL(name) KERNEL_Y(d,name,avx2)
+#include "simd_source.h"
+#undef KERNEL
+#undef VLEN
+#undef VEC
+#undef BASE
+#undef VZERO
+#undef VLOAD
+#undef VSTORE
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VMUL
+#undef VSWAP
+#undef VADDSUB
+
+#define VZERO() _mm256_setzero_ps ()
+#define VLOAD(p) _mm256_loadu_ps (p)
+#define VSTORE(p,v) _mm256_storeu_ps (p, v)
+#define VSET1(x) _mm256_set1_ps (x)
+#define VADD(a,b) _mm256_add_ps (a, b)
+#define VSUB(a,b) _mm256_sub_ps (a, b)
+#define VMUL(a,b) _mm256_mul_ps (a, b)
+#define VSWAP(a) _mm256_permute_ps (a, _MM_SHUFFLE (2, 3, 0, 1))
+#define VADDSUB(a,b) _mm256_addsub_ps (a, b)
+#define BASE float
+#define VEC __m256
+#define VLEN 8
+#define KERNEL(name) KERNEL_Y(s,name,avx2)
+#include "simd_source.h"
+#undef KERNEL
+#undef VLEN
+#undef VEC
+#undef BASE
+#undef VZERO
+#undef VLOAD
+#undef VSTORE
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VMUL
+#undef VSWAP
+#undef VADDSUB
+#undef TARGET
+
+static const fft_simd_kernels kernels_sse2 =
+  { "sse2", dpass_2_sse2, dpass_4_sse2, dpass_8_sse2,
+    spass_2_sse2, spass_4_sse2, spass_8_sse2 };
+
+static const fft_simd_kernels kernels_avx2 =
+  { "avx2", dpass_2_avx2, dpass_4_avx2, dpass_8_avx2,
+    spass_2_avx2, spass_4_avx2, spass_8_avx2 };
+
+#endif /* HAVE_X86_SIMD_DISPATCH */
+
+static const fft_simd_kernels *
+simd_select (void)
+{
+  const int level = simd_level ();
+
+#ifdef HAVE_X86_SIMD_DISPATCH
+  switch (level)
+    {
+    case SIMD_AVX512:
+    case SIMD_AVX2:
+      return &kernels_avx2;
+
+    case SIMD_SSE2:
+      return &kernels_sse2;
+    }
+#endif
+
+  (void) level;
+  return &kernels_generic;
+}
+
+static const fft_simd_kernels *simd_kernels = NULL;
+
+const fft_simd_kernels *
+fft_simd_get (void)
+{
+  /* concurrent first calls make the same choice, so the race is benign */
+  if (simd_kernels == NULL)
+    simd_kernels = simd_select ();
+
+  return simd_kernels;
+}
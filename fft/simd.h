@@ -0,0 +1,57 @@
+/* fft/simd.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __FFT_SIMD_H__
+#define __FFT_SIMD_H__
+
+#include <stddef.h>
+
+/* Vectorized passes of the complex mixed radix transform, for the
+ * radix 2, 4 and 8 modules with unit strides.  The arguments are those
+ * of the scalar passes in c_pass_*.c, with the twiddle factors of the
+ * pass as one array of (real, imag) pairs.  The butterflies of
+ * consecutive k1 share their twiddle factors and are computed together,
+ * VLEN/2 per vector, so a kernel returns -1 without touching the data if
+ * product/factor is not a multiple of that; otherwise it returns 0.
+ * The table is selected on first use according to the instruction sets
+ * supported by the CPU (see simd.c); the kernels of the generic table
+ * are NULL. */
+
+typedef int fft_simd_dpass (const double in[], double out[], const int sign,
+                            const size_t product, const size_t n,
+                            const double twiddle[]);
+
+typedef int fft_simd_spass (const float in[], float out[], const int sign,
+                            const size_t product, const size_t n,
+                            const float twiddle[]);
+
+typedef struct
+{
+  const char *name;
+  fft_simd_dpass *dpass_2;
+  fft_simd_dpass *dpass_4;
+  fft_simd_dpass *dpass_8;
+  fft_simd_spass *spass_2;
+  fft_simd_spass *spass_4;
+  fft_simd_spass *spass_8;
+} fft_simd_kernels;
+
+const fft_simd_kernels *fft_simd_get (void);
+
+#endif /* __FFT_SIMD_H__ */
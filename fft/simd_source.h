@@ -0,0 +1,222 @@
+/* fft/simd_source.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Radix 2, 4 and 8 passes for one instruction set, included from simd.c
+ * with the vector type and operations defined as macros:
+ *
+ *   BASE, VEC, VLEN                 scalar type, vector type, lanes
+ *   VLOAD, VSTORE, VSET1, VZERO     unaligned load/store, broadcast, zero
+ *   VADD, VSUB, VMUL                a+b, a-b, a*b
+ *   VSWAP(a)                        exchange the real and imaginary parts
+ *   VADDSUB(a,b)                    a-b in the real, a+b in the imaginary lanes
+ *   TARGET                          target attribute of the kernels
+ *   KERNEL(name)                    name of the kernel
+ *
+ * A vector holds VLEN/2 complex numbers of consecutive k1, which share
+ * their twiddle factors. */
+
+#define CLEN (VLEN / 2)
+
+/* w x for the broadcast twiddle factor w = wr + i wi */
+#define VCMUL(x,wr,wi) VADDSUB (VMUL (x, wr), VMUL (VSWAP (x), wi))
+
+/* i x */
+#define VMULI(x) VADDSUB (VZERO (), VSWAP (x))
+
+/* twiddle factor r = 1 .. factor-1 of butterfly k, conjugated for the
+   backward transform */
+#define TWIDDLE(wr,wi,r)                                        \
+  do {                                                          \
+    if (k == 0)                                                 \
+      {                                                         \
+        wr = VSET1 ((BASE) 1);                                  \
+        wi = VZERO ();                                          \
+      }                                                         \
+    else                                                        \
+      {                                                         \
+        const BASE *t = twiddle + 2 * (((r) - 1) * q + k - 1);  \
+        wr = VSET1 (t[0]);                                      \
+        wi = VSET1 (-sign * t[1]);                              \
+      }                                                         \
+  } while (0)
+
+/* x = W(4) z for the direction s */
+#define VDFT4(z0,z1,z2,z3,x0,x1,x2,x3)                          \
+  do {                                                          \
+    const VEC t1 = VADD (z0, z2);                               \
+    const VEC t2 = VADD (z1, z3);                               \
+    const VEC t3 = VSUB (z0, z2);                               \
+    const VEC t4 = VMULI (VMUL (s, VSUB (z1, z3)));             \
+    x0 = VADD (t1, t2);                                         \
+    x1 = VADD (t3, t4);                                         \
+    x2 = VSUB (t1, t2);                                         \
+    x3 = VSUB (t3, t4);                                         \
+  } while (0)
+
+/* The input of butterfly (k, k1) starts at i = k p_1 + k1 with spacing
+   m = n/factor, its output at j = k product + k1 with spacing p_1. */
+
+static int TARGET
+KERNEL (pass_2) (const BASE in[], BASE out[], const int sign,
+                 const size_t product, const size_t n, const BASE twiddle[])
+{
+  const size_t m = n / 2;
+  const size_t q = n / product;
+  const size_t p_1 = product / 2;
+  size_t k, k1;
+
+  if (p_1 % CLEN != 0)
+    return -1;
+
+  for (k = 0; k < q; k++)
+    {
+      const BASE *x = in + 2 * k * p_1;
+      BASE *y = out + 2 * k * product;
+      VEC w1r, w1i;
+
+      TWIDDLE (w1r, w1i, 1);
+
+      for (k1 = 0; k1 < 2 * p_1; k1 += VLEN)
+        {
+          const VEC z0 = VLOAD (x + k1);
+          const VEC z1 = VLOAD (x + k1 + 2 * m);
+
+          VSTORE (y + k1, VADD (z0, z1));
+          VSTORE (y + k1 + 2 * p_1, VCMUL (VSUB (z0, z1), w1r, w1i));
+        }
+    }
+
+  return 0;
+}
+
+static int TARGET
+KERNEL (pass_4) (const BASE in[], BASE out[], const int sign,
+                 const size_t product, const size_t n, const BASE twiddle[])
+{
+  const size_t m = n / 4;
+  const size_t q = n / product;
+  const size_t p_1 = product / 4;
+  const VEC s = VSET1 ((BASE) sign);
+  size_t k, k1;
+
+  if (p_1 % CLEN != 0)
+    return -1;
+
+  for (k = 0; k < q; k++)
+    {
+      const BASE *x = in + 2 * k * p_1;
+      BASE *y = out + 2 * k * product;
+      VEC w1r, w1i, w2r, w2i, w3r, w3i;
+
+      TWIDDLE (w1r, w1i, 1);
+      TWIDDLE (w2r, w2i, 2);
+      TWIDDLE (w3r, w3i, 3);
+
+      for (k1 = 0; k1 < 2 * p_1; k1 += VLEN)
+        {
+          const VEC z0 = VLOAD (x + k1);
+          const VEC z1 = VLOAD (x + k1 + 2 * m);
+          const VEC z2 = VLOAD (x + k1 + 4 * m);
+          const VEC z3 = VLOAD (x + k1 + 6 * m);
+          VEC x0, x1, x2, x3;
+
+          VDFT4 (z0, z1, z2, z3, x0, x1, x2, x3);
+
+          VSTORE (y + k1, x0);
+          VSTORE (y + k1 + 2 * p_1, VCMUL (x1, w1r, w1i));
+          VSTORE (y + k1 + 4 * p_1, VCMUL (x2, w2r, w2i));
+          VSTORE (y + k1 + 6 * p_1, VCMUL (x3, w3r, w3i));
+        }
+    }
+
+  return 0;
+}
+
+/* two radix-4 butterflies of the even and odd elements, combined with
+   w = exp(sign 2 pi i/8) as in c_pass_8.c */
+static int TARGET
+KERNEL (pass_8) (const BASE in[], BASE out[], const int sign,
+                 const size_t product, const size_t n, const BASE twiddle[])
+{
+  const size_t m = n / 8;
+  const size_t q = n / product;
+  const size_t p_1 = product / 8;
+  const VEC s = VSET1 ((BASE) sign);
+  const VEC c = VSET1 ((BASE) M_SQRT1_2);
+  size_t k, k1;
+
+  if (p_1 % CLEN != 0)
+    return -1;
+
+  for (k = 0; k < q; k++)
+    {
+      const BASE *x = in + 2 * k * p_1;
+      BASE *y = out + 2 * k * product;
+      VEC wr[8], wi[8];
+      size_t r;
+
+      for (r = 1; r < 8; r++)
+        TWIDDLE (wr[r], wi[r], r);
+
+      for (k1 = 0; k1 < 2 * p_1; k1 += VLEN)
+        {
+          VEC a0, a1, a2, a3, b0, b1, b2, b3;
+
+          {
+            const VEC z0 = VLOAD (x + k1);
+            const VEC z2 = VLOAD (x + k1 + 4 * m);
+            const VEC z4 = VLOAD (x + k1 + 8 * m);
+            const VEC z6 = VLOAD (x + k1 + 12 * m);
+
+            VDFT4 (z0, z2, z4, z6, a0, a1, a2, a3);
+          }
+
+          {
+            const VEC z1 = VLOAD (x + k1 + 2 * m);
+            const VEC z3 = VLOAD (x + k1 + 6 * m);
+            const VEC z5 = VLOAD (x + k1 + 10 * m);
+            const VEC z7 = VLOAD (x + k1 + 14 * m);
+
+            VDFT4 (z1, z3, z5, z7, b0, b1, b2, b3);
+          }
+
+          /* w b1, w^2 b2 = sign i b2 and w^3 b3 */
+          b1 = VMUL (c, VADD (b1, VMULI (VMUL (s, b1))));
+          b2 = VMULI (VMUL (s, b2));
+          b3 = VMUL (c, VSUB (VMULI (VMUL (s, b3)), b3));
+
+          VSTORE (y + k1, VADD (a0, b0));
+          VSTORE (y + k1 + 2 * p_1, VCMUL (VADD (a1, b1), wr[1], wi[1]));
+          VSTORE (y + k1 + 4 * p_1, VCMUL (VADD (a2, b2), wr[2], wi[2]));
+          VSTORE (y + k1 + 6 * p_1, VCMUL (VADD (a3, b3), wr[3], wi[3]));
+          VSTORE (y + k1 + 8 * p_1, VCMUL (VSUB (a0, b0), wr[4], wi[4]));
+          VSTORE (y + k1 + 10 * p_1, VCMUL (VSUB (a1, b1), wr[5], wi[5]));
+          VSTORE (y + k1 + 12 * p_1, VCMUL (VSUB (a2, b2), wr[6], wi[6]));
+          VSTORE (y + k1 + 14 * p_1, VCMUL (VSUB (a3, b3), wr[7], wi[7]));
+        }
+    }
+
+  return 0;
+}
+
+#undef VDFT4
+#undef TWIDDLE
+#undef VMULI
+#undef VCMUL
+#undef CLEN
@@ -106,9 +106,64 @@ main (int argc, char *argv[])
         {
           test_complex_func (stride, i) ;
           test_complex_float_func (stride, i) ;
+          test_complex_plan (stride, i) ;
+          test_complex_float_plan (stride, i) ;
           test_real_func (stride, i) ;
           test_real_float_func (stride, i) ;
         }
+
+      test_real_plan (i) ;
+      test_real_float_plan (i) ;
+    }
+
+  /* longer lengths: large prime factors, which use Bluestein's
+     algorithm, and odd powers of 2, which use a radix 8 pass, with
+     enough butterflies per pass for the vectorized kernels */
+
+  if (n == 0)
+    {
+      const size_t nbig[] = { 211, 4 * 263, 512, 960 };
+
+      for (i = 0 ; i < sizeof (nbig) / sizeof (nbig[0]) ; i++) 
+        {
+          for (stride = 1 ; stride < 4 ; stride++)
+            {
+              test_complex_func (stride, nbig[i]) ;
+              test_complex_float_func (stride, nbig[i]) ;
+              test_complex_plan (stride, nbig[i]) ;
+              test_complex_float_plan (stride, nbig[i]) ;
+              test_real_func (stride, nbig[i]) ;
+              test_real_float_func (stride, nbig[i]) ;
+            }
+
+          test_real_plan (nbig[i]) ;
+          test_real_float_plan (nbig[i]) ;
+        }
+    }
+
+  /* batched and multidimensional transforms, with the batches split
+     between threads in the second pass when OpenMP is available */
+
+  if (n == 0)
+    {
+      const size_t dims[][3] = { { 1, 1, 1 }, { 2, 3, 5 }, { 4, 6, 7 },
+                                 { 16, 3, 12 }, { 9, 32, 2 }, { 11, 2, 64 } };
+      size_t nthreads;
+
+      for (nthreads = 1 ; nthreads <= 3 ; nthreads += 2)
+        {
+          gsl_set_num_threads (nthreads);
+
+          for (i = 0 ; i < sizeof (dims) / sizeof (dims[0]) ; i++) 
+            {
+              test_complex_nd (dims[i][0], dims[i][1], dims[i][2]) ;
+              test_complex_float_nd (dims[i][0], dims[i][1], dims[i][2]) ;
+              test_real_nd (dims[i][0], dims[i][1], dims[i][2]) ;
+              test_real_float_nd (dims[i][0], dims[i][1], dims[i][2]) ;
+            }
+        }
+
+      gsl_set_num_threads (1);
     }
 
   gsl_set_error_handler (&my_error_handler);
@@ -26,6 +26,10 @@ int FUNCTION(test,offset) (const BASE data[], size_t stride,
                            size_t n, size_t offset);
 void FUNCTION(test_complex,bitreverse_order) (size_t stride, size_t n) ;
 void FUNCTION(test_complex,radix2) (size_t stride, size_t n);
+void FUNCTION(test_complex,plan) (size_t stride, size_t n);
+void FUNCTION(test_complex,nd) (size_t n1, size_t n2, size_t n3);
+void FUNCTION(test_complex,nd_reference) (BASE data[], size_t n1, size_t n2,
+                                          size_t n3, gsl_fft_direction sign);
 
 int FUNCTION(test,offset) (const BASE data[], size_t stride, 
                            size_t n, size_t offset)
@@ -446,3 +450,225 @@ void FUNCTION(test_complex,radix2) (size_t stride, size_t n)
   free (fft_complex_tmp);
 }
 
+
+
+void FUNCTION(test_complex,plan) (size_t stride, size_t n)
+{
+  size_t i ;
+  int status, dir ;
+
+  TYPE(gsl_fft_complex_wavetable) * cw = FUNCTION(gsl_fft_complex_wavetable,alloc) (n);
+  TYPE(gsl_fft_complex_workspace) * cwork = FUNCTION(gsl_fft_complex_workspace,alloc) (n);
+
+  BASE * complex_data = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+  BASE * fft_complex_data = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+  BASE * plan_data = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+  BASE * plan_data2 = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+
+  for (i = 0 ; i < 2 * n * stride ; i++)
+    {
+      complex_data[i] = (BASE)i ;
+    }
+
+  for (dir = 0 ; dir < 2 ; dir++)
+    {
+      const gsl_fft_direction sign = dir ? gsl_fft_backward : gsl_fft_forward ;
+      TYPE(gsl_fft_complex_plan) * plan = FUNCTION(gsl_fft_complex_plan,alloc) (n, sign);
+      const size_t nscratch = FUNCTION(gsl_fft_complex_plan,scratch_size) (plan);
+      BASE * scratch = (BASE *) malloc (nscratch * sizeof (BASE));
+
+      gsl_test (plan == 0, NAME(gsl_fft_complex_plan) 
+                "_alloc, n = %d, sign = %d", n, sign);
+
+      gsl_test (nscratch < 2 * n, NAME(gsl_fft_complex_plan) 
+                "_scratch_size, n = %d", n);
+
+      FUNCTION(fft_signal,complex_noise) (n, stride, complex_data, fft_complex_data);
+
+      for (i = 0 ; i < 2 * n * stride ; i++)
+        {
+          plan_data[i] = complex_data[i] ;
+          plan_data2[i] = complex_data[i] ;
+        }
+
+      FUNCTION(gsl_fft_complex,transform) (complex_data, stride, n, cw, cwork, sign);
+
+      /* the same plan executed twice, with caller and internal scratch */
+
+      status = FUNCTION(gsl_fft_complex_plan,execute) (plan, plan_data, stride, scratch);
+      status |= FUNCTION(compare_complex,results) ("transform", complex_data,
+                                                   "plan", plan_data,
+                                                   stride, n, 1e6);
+      gsl_test (status, NAME(gsl_fft_complex_plan) 
+                "_execute with scratch, n = %d, stride = %d, sign = %d",
+                n, stride, sign);
+
+      status = FUNCTION(gsl_fft_complex_plan,execute) (plan, plan_data2, stride, NULL);
+      status |= FUNCTION(compare_complex,results) ("transform", complex_data,
+                                                   "plan", plan_data2,
+                                                   stride, n, 1e6);
+      gsl_test (status, NAME(gsl_fft_complex_plan) 
+                "_execute without scratch, n = %d, stride = %d, sign = %d",
+                n, stride, sign);
+
+      if (stride > 1) 
+        {
+          status = FUNCTION(test, offset) (plan_data, stride, n, 0) ;
+        
+          gsl_test (status, NAME(gsl_fft_complex_plan) 
+                    "_execute avoids unstrided data, n = %d, stride = %d",
+                    n, stride);
+        }
+
+      free (scratch) ;
+      FUNCTION(gsl_fft_complex_plan,free) (plan) ;
+    }
+
+  FUNCTION(gsl_fft_complex_wavetable,free) (cw) ;
+  FUNCTION(gsl_fft_complex_workspace,free) (cwork) ;
+
+  free (complex_data) ;
+  free (fft_complex_data) ;
+  free (plan_data) ;
+  free (plan_data2) ;
+}
+
+/* transform the n1 x n2 x n3 array along each dimension with strided
+   one-dimensional transforms */
+
+void FUNCTION(test_complex,nd_reference) (BASE data[], size_t n1, size_t n2,
+                                          size_t n3, gsl_fft_direction sign)
+{
+  const size_t dims[3] = { n1, n2, n3 } ;
+  const size_t inner[3] = { n2 * n3, n3, 1 } ;
+  size_t d, o, c ;
+
+  for (d = 0 ; d < 3 ; d++)
+    {
+      const size_t n = dims[d] ;
+      const size_t nouter = n1 * n2 * n3 / (n * inner[d]) ;
+      TYPE(gsl_fft_complex_wavetable) * cw = FUNCTION(gsl_fft_complex_wavetable,alloc) (n);
+      TYPE(gsl_fft_complex_workspace) * cwork = FUNCTION(gsl_fft_complex_workspace,alloc) (n);
+
+      for (o = 0 ; o < nouter ; o++)
+        {
+          for (c = 0 ; c < inner[d] ; c++)
+            {
+              FUNCTION(gsl_fft_complex,transform) (data + 2 * (o * n * inner[d] + c),
+                                                   inner[d], n, cw, cwork, sign);
+            }
+        }
+
+      FUNCTION(gsl_fft_complex_wavetable,free) (cw) ;
+      FUNCTION(gsl_fft_complex_workspace,free) (cwork) ;
+    }
+}
+
+void FUNCTION(test_complex,nd) (size_t n1, size_t n2, size_t n3)
+{
+  const size_t N = n1 * n2 * n3 ;
+  const size_t dims[3] = { n1, n2, n3 } ;
+  size_t i, j ;
+  int status, dir ;
+
+  TYPE(gsl_fft_complex_wavetable) * cw1 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n1);
+  TYPE(gsl_fft_complex_workspace) * cwork1 = FUNCTION(gsl_fft_complex_workspace,alloc) (n1);
+  TYPE(gsl_fft_complex_wavetable) * cw3 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n3);
+  TYPE(gsl_fft_complex_workspace) * cwork3 = FUNCTION(gsl_fft_complex_workspace,alloc) (n3);
+
+  BASE * data = (BASE *) malloc (2 * N * sizeof (BASE));
+  BASE * ref = (BASE *) malloc (2 * N * sizeof (BASE));
+  BASE * x = (BASE *) malloc (2 * N * sizeof (BASE));
+
+  for (i = 0 ; i < 2 * N ; i++)
+    {
+      data[i] = (BASE) ((i * 7919) % 1000) / 1000 ;
+    }
+
+  for (dir = 0 ; dir < 2 ; dir++)
+    {
+      const gsl_fft_direction sign = dir ? gsl_fft_backward : gsl_fft_forward ;
+      TYPE(gsl_fft_complex_nd_plan) * plan = FUNCTION(gsl_fft_complex_nd_plan,alloc) (3, dims, sign);
+      TYPE(gsl_fft_complex_plan) * plan1 = FUNCTION(gsl_fft_complex_plan,alloc) (n1, sign);
+      TYPE(gsl_fft_complex_plan) * plan3 = FUNCTION(gsl_fft_complex_plan,alloc) (n3, sign);
+
+      gsl_test (plan == 0, NAME(gsl_fft_complex_nd_plan) 
+                "_alloc, %d x %d x %d, sign = %d", n1, n2, n3, sign);
+
+      /* batch of the interleaved columns of an n1 x (n2*n3) array */
+
+      memcpy (ref, data, 2 * N * sizeof (BASE));
+      memcpy (x, data, 2 * N * sizeof (BASE));
+
+      for (j = 0 ; j < n2 * n3 ; j++)
+        {
+          FUNCTION(gsl_fft_complex,transform) (ref + 2 * j, n2 * n3, n1, cw1, cwork1, sign);
+        }
+
+      status = FUNCTION(gsl_fft_complex_plan,execute_many) (plan1, x, n2 * n3, 1, n2 * n3);
+      status |= FUNCTION(compare_complex,results) ("transform", ref, "many", x, 1, N, 1e6);
+      gsl_test (status, NAME(gsl_fft_complex_plan) 
+                "_execute_many, columns, n = %d, howmany = %d, sign = %d",
+                n1, n2 * n3, sign);
+
+      /* batch of contiguous rows */
+
+      memcpy (ref, data, 2 * N * sizeof (BASE));
+      memcpy (x, data, 2 * N * sizeof (BASE));
+
+      for (j = 0 ; j < n1 * n2 ; j++)
+        {
+          FUNCTION(gsl_fft_complex,transform) (ref + 2 * j * n3, 1, n3, cw3, cwork3, sign);
+        }
+
+      status = FUNCTION(gsl_fft_complex_plan,execute_many) (plan3, x, 1, n3, n1 * n2);
+      status |= FUNCTION(compare_complex,results) ("transform", ref, "many", x, 1, N, 1e6);
+      gsl_test (status, NAME(gsl_fft_complex_plan) 
+                "_execute_many, rows, n = %d, howmany = %d, sign = %d",
+                n3, n1 * n2, sign);
+
+      /* three-dimensional transform */
+
+      memcpy (ref, data, 2 * N * sizeof (BASE));
+      memcpy (x, data, 2 * N * sizeof (BASE));
+
+      FUNCTION(test_complex,nd_reference) (ref, n1, n2, n3, sign);
+
+      status = FUNCTION(gsl_fft_complex_nd_plan,execute) (plan, x);
+      status |= FUNCTION(compare_complex,results) ("reference", ref, "nd", x, 1, N, 1e6);
+      gsl_test (status, NAME(gsl_fft_complex_nd_plan) 
+                "_execute, %d x %d x %d, sign = %d", n1, n2, n3, sign);
+
+      memcpy (x, data, 2 * N * sizeof (BASE));
+
+      status = FUNCTION(gsl_fft_complex,3d_transform) (x, n1, n2, n3, sign);
+      status |= FUNCTION(compare_complex,results) ("reference", ref, "3d", x, 1, N, 1e6);
+      gsl_test (status, NAME(gsl_fft_complex) 
+                "_3d_transform, %d x %d x %d, sign = %d", n1, n2, n3, sign);
+
+      /* two-dimensional transform of the n1 x (n2*n3) array */
+
+      memcpy (ref, data, 2 * N * sizeof (BASE));
+      memcpy (x, data, 2 * N * sizeof (BASE));
+
+      FUNCTION(test_complex,nd_reference) (ref, 1, n1, n2 * n3, sign);
+
+      status = FUNCTION(gsl_fft_complex,2d_transform) (x, n1, n2 * n3, sign);
+      status |= FUNCTION(compare_complex,results) ("reference", ref, "2d", x, 1, N, 1e6);
+      gsl_test (status, NAME(gsl_fft_complex) 
+                "_2d_transform, %d x %d, sign = %d", n1, n2 * n3, sign);
+
+      FUNCTION(gsl_fft_complex_nd_plan,free) (plan) ;
+      FUNCTION(gsl_fft_complex_plan,free) (plan1) ;
+      FUNCTION(gsl_fft_complex_plan,free) (plan3) ;
+    }
+
+  FUNCTION(gsl_fft_complex_wavetable,free) (cw1) ;
+  FUNCTION(gsl_fft_complex_workspace,free) (cwork1) ;
+  FUNCTION(gsl_fft_complex_wavetable,free) (cw3) ;
+  FUNCTION(gsl_fft_complex_workspace,free) (cwork3) ;
+
+  free (data) ;
+  free (ref) ;
+  free (x) ;
+}
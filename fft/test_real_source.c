@@ -24,6 +24,8 @@
 void FUNCTION(test_real,func) (size_t stride, size_t n);
 void FUNCTION(test_real,bitreverse_order) (size_t stride, size_t n);
 void FUNCTION(test_real,radix2) (size_t stride, size_t n);
+void FUNCTION(test_real,plan) (size_t n);
+void FUNCTION(test_real,nd) (size_t n1, size_t n2, size_t n3);
 
 void FUNCTION(test_real,func) (size_t stride, size_t n) 
 {
@@ -233,3 +235,141 @@ void FUNCTION(test_real,radix2) (size_t stride, size_t n)
   free(complex_tmp) ;
   free(fft_complex_data) ;
 }
+
+void FUNCTION(test_real,plan) (size_t n)
+{
+  const size_t nc = n / 2 + 1 ;
+  size_t i ;
+  int status ;
+
+  TYPE(gsl_fft_real_plan) * plan = FUNCTION(gsl_fft_real_plan,alloc) (n);
+  const size_t nscratch = FUNCTION(gsl_fft_real_plan,scratch_size) (plan);
+
+  BASE * complex_data = (BASE *) malloc (2 * n * sizeof (BASE));
+  BASE * fft_complex_data = (BASE *) malloc (2 * n * sizeof (BASE));
+  BASE * real_data = (BASE *) malloc (n * sizeof (BASE));
+  BASE * real_tmp = (BASE *) malloc (n * sizeof (BASE));
+  BASE * out = (BASE *) malloc (2 * nc * sizeof (BASE));
+  BASE * inplace = (BASE *) malloc (2 * nc * sizeof (BASE));
+  BASE * scratch = (BASE *) malloc (nscratch * sizeof (BASE));
+
+  gsl_test (plan == 0, NAME(gsl_fft_real_plan) "_alloc, n = %d", n);
+
+  FUNCTION(fft_signal,real_noise) (n, 1, complex_data, fft_complex_data);
+
+  for (i = 0 ; i < n ; i++)
+    {
+      real_data[i] = complex_data[2 * i] ;
+      inplace[i] = real_data[i] ;
+    }
+
+  /* the first n/2 + 1 elements of the dft */
+
+  status = FUNCTION(gsl_fft_real_plan,r2c) (plan, real_data, out, scratch);
+  status |= FUNCTION(compare_complex,results) ("dft", fft_complex_data,
+                                               "r2c", out, 1, nc, 1e6);
+  gsl_test (status, NAME(gsl_fft_real_plan) "_r2c, n = %d", n);
+
+  status = FUNCTION(gsl_fft_real_plan,r2c) (plan, inplace, inplace, NULL);
+  status |= FUNCTION(compare_complex,results) ("dft", fft_complex_data,
+                                               "r2c", inplace, 1, nc, 1e6);
+  gsl_test (status, NAME(gsl_fft_real_plan) "_r2c in place, n = %d", n);
+
+  /* the backward transform recovers n times the data */
+
+  status = FUNCTION(gsl_fft_real_plan,c2r) (plan, out, real_tmp, scratch);
+
+  for (i = 0 ; i < n ; i++)
+    {
+      real_tmp[i] /= n ;
+    }
+
+  status |= FUNCTION(compare_real,results) ("data", real_data,
+                                            "c2r", real_tmp, 1, n, 1e6);
+  gsl_test (status, NAME(gsl_fft_real_plan) "_c2r, n = %d", n);
+
+  status = FUNCTION(gsl_fft_real_plan,c2r) (plan, inplace, inplace, NULL);
+
+  for (i = 0 ; i < n ; i++)
+    {
+      inplace[i] /= n ;
+    }
+
+  status |= FUNCTION(compare_real,results) ("data", real_data,
+                                            "c2r", inplace, 1, n, 1e6);
+  gsl_test (status, NAME(gsl_fft_real_plan) "_c2r in place, n = %d", n);
+
+  FUNCTION(gsl_fft_real_plan,free) (plan) ;
+
+  free (complex_data) ;
+  free (fft_complex_data) ;
+  free (real_data) ;
+  free (real_tmp) ;
+  free (out) ;
+  free (inplace) ;
+  free (scratch) ;
+}
+
+void FUNCTION(test_real,nd) (size_t n1, size_t n2, size_t n3)
+{
+  const size_t N = n1 * n2 * n3 ;
+  const size_t nc = n3 / 2 + 1 ;
+  const size_t dims[3] = { n1, n2, n3 } ;
+  size_t i, r ;
+  int status = 0 ;
+
+  TYPE(gsl_fft_real_nd_plan) * plan = FUNCTION(gsl_fft_real_nd_plan,alloc) (3, dims);
+  TYPE(gsl_fft_complex_nd_plan) * cplan = FUNCTION(gsl_fft_complex_nd_plan,alloc) (3, dims, gsl_fft_forward);
+
+  BASE * real_data = (BASE *) malloc (N * sizeof (BASE));
+  BASE * real_tmp = (BASE *) malloc (N * sizeof (BASE));
+  BASE * complex_data = (BASE *) malloc (2 * N * sizeof (BASE));
+  BASE * fft_data = (BASE *) malloc (2 * n1 * n2 * nc * sizeof (BASE));
+
+  gsl_test (plan == 0, NAME(gsl_fft_real_nd_plan) 
+            "_alloc, %d x %d x %d", n1, n2, n3);
+
+  for (i = 0 ; i < N ; i++)
+    {
+      real_data[i] = (BASE) ((i * 7919) % 1000) / 1000 ;
+      complex_data[2 * i] = real_data[i] ;
+      complex_data[2 * i + 1] = 0 ;
+    }
+
+  /* the first n3/2 + 1 elements of each row of the complex transform */
+
+  FUNCTION(gsl_fft_complex_nd_plan,execute) (cplan, complex_data);
+  FUNCTION(gsl_fft_real_nd_plan,r2c) (plan, real_data, fft_data);
+
+  for (r = 0 ; r < n1 * n2 ; r++)
+    {
+      status |= FUNCTION(compare_complex,results) ("complex", complex_data + 2 * r * n3,
+                                                   "r2c", fft_data + 2 * r * nc,
+                                                   1, nc, 1e6);
+    }
+
+  gsl_test (status, NAME(gsl_fft_real_nd_plan) 
+            "_r2c, %d x %d x %d", n1, n2, n3);
+
+  /* the backward transform recovers N times the data */
+
+  FUNCTION(gsl_fft_real_nd_plan,c2r) (plan, fft_data, real_tmp);
+
+  for (i = 0 ; i < N ; i++)
+    {
+      real_tmp[i] /= N ;
+    }
+
+  status = FUNCTION(compare_real,results) ("data", real_data,
+                                           "c2r", real_tmp, 1, N, 1e6);
+  gsl_test (status, NAME(gsl_fft_real_nd_plan) 
+            "_c2r, %d x %d x %d", n1, n2, n3);
+
+  FUNCTION(gsl_fft_real_nd_plan,free) (plan) ;
+  FUNCTION(gsl_fft_complex_nd_plan,free) (cplan) ;
+
+  free (real_data) ;
+  free (real_tmp) ;
+  free (complex_data) ;
+  free (fft_data) ;
+}
@@ -0,0 +1,289 @@
+/* linalg/gsl-linalg-tune.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Measure the crossover sizes and split block size of the recursive
+ * linalg algorithms which are fastest on this machine, with the BLAS
+ * library this program is linked against, and write them to a profile
+ * file for gsl_linalg_tune_load() or the GSL_LINALG_TUNE environment
+ * variable. */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_permutation.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_rng.h>
+
+static const size_t crossovers[] = { 8, 12, 16, 24, 32, 48, 64, 96, 128 };
+static const size_t splits[] = { 4, 8, 16, 32 };
+
+#define NCROSSOVER (sizeof (crossovers) / sizeof (crossovers[0]))
+#define NSPLIT (sizeof (splits) / sizeof (splits[0]))
+#define NSIZE_MAX 8
+
+static double min_time = 0.1;   /* seconds per measurement */
+
+/* run algorithm alg (or all four if alg < 0) on a copy of A */
+static void
+run (const int alg, const gsl_matrix * A, gsl_matrix * work, gsl_permutation * p)
+{
+  int signum;
+
+  gsl_matrix_memcpy (work, A);
+
+  switch (alg)
+    {
+    case GSL_LINALG_TUNE_LU:
+      gsl_linalg_LU_decomp (work, p, &signum);
+      break;
+
+    case GSL_LINALG_TUNE_CHOLESKY:
+      gsl_linalg_cholesky_decomp1 (work);
+      break;
+
+    case GSL_LINALG_TUNE_INVTRI:
+      gsl_linalg_tri_invert (CblasLower, CblasNonUnit, work);
+      break;
+
+    case GSL_LINALG_TUNE_TRIMULT:
+      gsl_linalg_tri_LTL (work);
+      break;
+
+    default:
+      gsl_linalg_LU_decomp (work, p, &signum);
+      gsl_matrix_memcpy (work, A);
+      gsl_linalg_cholesky_decomp1 (work);
+      gsl_matrix_memcpy (work, A);
+      gsl_linalg_tri_invert (CblasLower, CblasNonUnit, work);
+      gsl_matrix_memcpy (work, A);
+      gsl_linalg_tri_LTL (work);
+      break;
+    }
+}
+
+/* seconds per call */
+static double
+measure (const int alg, const gsl_matrix * A, gsl_matrix * work, gsl_permutation * p)
+{
+  clock_t start, end;
+  size_t count = 0;
+
+  run (alg, A, work, p);        /* warm up */
+
+  start = clock ();
+
+  do
+    {
+      run (alg, A, work, p);
+      ++count;
+      end = clock ();
+    }
+  while ((double) (end - start) < min_time * CLOCKS_PER_SEC);
+
+  return (double) (end - start) / CLOCKS_PER_SEC / count;
+}
+
+/* a symmetric positive definite matrix, whose lower triangle is also
+   a well conditioned triangular matrix */
+static gsl_matrix *
+test_matrix (const size_t n, gsl_rng * r)
+{
+  gsl_matrix *A = gsl_matrix_alloc (n, n);
+  size_t i, j;
+
+  for (i = 0; i < n; ++i)
+    {
+      for (j = 0; j <= i; ++j)
+        {
+          const double aij = gsl_rng_uniform (r) - 0.5;
+          gsl_matrix_set (A, i, j, aij);
+          gsl_matrix_set (A, j, i, aij);
+        }
+
+      gsl_matrix_set (A, i, i, 2.0 * n);
+    }
+
+  return A;
+}
+
+int
+main (int argc, char *argv[])
+{
+  const char *filename = "gsl-linalg.tune";
+  size_t nmax = 512;
+  size_t sizes[NSIZE_MAX];
+  size_t nsizes = 0;
+  gsl_matrix *A[NSIZE_MAX], *work[NSIZE_MAX];
+  gsl_permutation *p[NSIZE_MAX];
+  gsl_rng *r = gsl_rng_alloc (gsl_rng_default);
+  const char *alg_names[] = { "LU", "Cholesky", "invtri", "trimult" };
+  int alg;
+  size_t i, k, n;
+
+  for (i = 1; i < (size_t) argc; ++i)
+    {
+      if (strcmp (argv[i], "-o") == 0 && i + 1 < (size_t) argc)
+        filename = argv[++i];
+      else if (strcmp (argv[i], "-n") == 0 && i + 1 < (size_t) argc)
+        nmax = strtoul (argv[++i], NULL, 0);
+      else if (strcmp (argv[i], "-t") == 0 && i + 1 < (size_t) argc)
+        min_time = atof (argv[++i]);
+      else
+        {
+          fprintf (stderr,
+"Usage: gsl-linalg-tune [-o file] [-n nmax] [-t seconds]\n"
+"Measures the crossover sizes of the recursive LU, Cholesky, triangular\n"
+"inverse and triangular product algorithms and the block size of their\n"
+"recursive splits, for matrices of size 64 to nmax (default 512), and\n"
+"writes them to the profile file (default gsl-linalg.tune). Each\n"
+"measurement takes at least the given time (default 0.1 seconds).\n");
+          exit (EXIT_FAILURE);
+        }
+    }
+
+  for (n = 64; n <= nmax && nsizes < NSIZE_MAX; n *= 2)
+    {
+      sizes[nsizes] = n;
+      A[nsizes] = test_matrix (n, r);
+      work[nsizes] = gsl_matrix_alloc (n, n);
+      p[nsizes] = gsl_permutation_alloc (n);
+      ++nsizes;
+    }
+
+  if (nsizes == 0)
+    {
+      fprintf (stderr, "gsl-linalg-tune: nmax must be at least 64\n");
+      exit (EXIT_FAILURE);
+    }
+
+  /* start from the defaults, ignoring GSL_LINALG_TUNE */
+  for (alg = 0; alg < 4; ++alg)
+    gsl_linalg_tune_set_crossover (alg, 24);
+
+  gsl_linalg_tune_set_crossover (GSL_LINALG_TUNE_BIDIAG, 128);
+  gsl_linalg_tune_set_split (8);
+  gsl_linalg_tune_set_tile (256);
+  gsl_linalg_tune_set_panel (32);
+
+  /* crossovers: minimize the sum over the sizes of the time relative
+     to the fastest crossover for that size */
+
+  for (alg = 0; alg < 4; ++alg)
+    {
+      double t[NCROSSOVER][NSIZE_MAX];
+      double best_score = GSL_POSINF;
+      size_t best = 24;
+
+      printf ("%-9s", alg_names[alg]);
+      for (k = 0; k < NCROSSOVER; ++k)
+        printf (" %7lu", (unsigned long) crossovers[k]);
+      printf ("\n");
+
+      for (k = 0; k < NCROSSOVER; ++k)
+        {
+          gsl_linalg_tune_set_crossover (alg, crossovers[k]);
+
+          for (i = 0; i < nsizes; ++i)
+            t[k][i] = measure (alg, A[i], work[i], p[i]);
+        }
+
+      for (i = 0; i < nsizes; ++i)
+        {
+          double tmin = GSL_POSINF;
+
+          for (k = 0; k < NCROSSOVER; ++k)
+            tmin = GSL_MIN (tmin, t[k][i]);
+
+          printf ("%9lu", (unsigned long) sizes[i]);
+          for (k = 0; k < NCROSSOVER; ++k)
+            printf (" %7.3f", t[k][i] / tmin);
+          printf ("\n");
+
+          for (k = 0; k < NCROSSOVER; ++k)
+            t[k][i] /= tmin;
+        }
+
+      for (k = 0; k < NCROSSOVER; ++k)
+        {
+          double score = 0.0;
+
+          for (i = 0; i < nsizes; ++i)
+            score += t[k][i];
+
+          if (score < best_score)
+            {
+              best_score = score;
+              best = crossovers[k];
+            }
+        }
+
+      gsl_linalg_tune_set_crossover (alg, best);
+      printf ("crossover %lu\n\n", (unsigned long) best);
+    }
+
+  /* split block size, with all four algorithms */
+
+  {
+    double best_score = GSL_POSINF;
+    size_t best = 8;
+
+    for (k = 0; k < NSPLIT; ++k)
+      {
+        double score = 0.0;
+
+        gsl_linalg_tune_set_split (splits[k]);
+
+        for (i = 0; i < nsizes; ++i)
+          score += measure (-1, A[i], work[i], p[i]) / (sizes[i] * sizes[i] * (double) sizes[i]);
+
+        printf ("split %3lu: %.4g\n", (unsigned long) splits[k], score);
+
+        if (score < best_score)
+          {
+            best_score = score;
+            best = splits[k];
+          }
+      }
+
+    gsl_linalg_tune_set_split (best);
+    printf ("split %lu\n\n", (unsigned long) best);
+  }
+
+  if (gsl_linalg_tune_save (filename) != GSL_SUCCESS)
+    exit (EXIT_FAILURE);
+
+  printf ("profile written to %s\n", filename);
+
+  for (i = 0; i < nsizes; ++i)
+    {
+      gsl_matrix_free (A[i]);
+      gsl_matrix_free (work[i]);
+      gsl_permutation_free (p[i]);
+    }
+
+  gsl_rng_free (r);
+
+  return 0;
+}
@@ -0,0 +1,157 @@
+/* gsl-spmatrix-convert.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Convert a sparse matrix in Matrix Market coordinate format (real,
+ * integer or pattern; general, symmetric or skew-symmetric) to the
+ * binary CSR or CSC format which gsl_spmatrix_mmap() maps into memory
+ * without copying. The entries are assembled with gsl_spmatrix_append(),
+ * so duplicate entries are summed. */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+
+static void
+usage (void)
+{
+  fprintf (stderr,
+"Usage: gsl-spmatrix-convert [-c] input.mtx output\n"
+"Converts a Matrix Market coordinate file to the binary CSR format (CSC\n"
+"with -c) read by gsl_spmatrix_mmap(). Use - to read from stdin.\n");
+  exit (EXIT_FAILURE);
+}
+
+static void
+fail (const char *msg, const char *name)
+{
+  fprintf (stderr, "gsl-spmatrix-convert: %s: %s\n", name, msg);
+  exit (EXIT_FAILURE);
+}
+
+int
+main (int argc, char *argv[])
+{
+  int sptype = GSL_SPMATRIX_CSR;
+  const char *input = NULL, *output = NULL;
+  char line[1024], field[64], symmetry[64];
+  int pattern, symmetric, skew;
+  unsigned long m, n, nnz, k;
+  gsl_spmatrix *T, *A;
+  FILE *f;
+  int i;
+
+  for (i = 1; i < argc; ++i)
+    {
+      if (strcmp (argv[i], "-c") == 0)
+        sptype = GSL_SPMATRIX_CSC;
+      else if (input == NULL)
+        input = argv[i];
+      else if (output == NULL)
+        output = argv[i];
+      else
+        usage ();
+    }
+
+  if (output == NULL)
+    usage ();
+
+  f = (strcmp (input, "-") == 0) ? stdin : fopen (input, "r");
+  if (f == NULL)
+    fail ("cannot open file", input);
+
+  /* banner: %%MatrixMarket matrix coordinate <field> <symmetry> */
+  if (fgets (line, sizeof (line), f) == NULL ||
+      sscanf (line, "%%%%MatrixMarket matrix coordinate %63s %63s", field, symmetry) != 2)
+    fail ("not a Matrix Market coordinate file", input);
+
+  for (i = 0; field[i]; ++i)
+    field[i] = tolower ((unsigned char) field[i]);
+  for (i = 0; symmetry[i]; ++i)
+    symmetry[i] = tolower ((unsigned char) symmetry[i]);
+
+  if (strcmp (field, "real") != 0 && strcmp (field, "integer") != 0 &&
+      strcmp (field, "pattern") != 0)
+    fail ("only real, integer and pattern matrices are supported", input);
+
+  pattern = (strcmp (field, "pattern") == 0);
+  symmetric = (strcmp (symmetry, "symmetric") == 0);
+  skew = (strcmp (symmetry, "skew-symmetric") == 0);
+
+  if (!symmetric && !skew && strcmp (symmetry, "general") != 0)
+    fail ("only general, symmetric and skew-symmetric matrices are supported", input);
+
+  /* skip comments */
+  do
+    {
+      if (fgets (line, sizeof (line), f) == NULL)
+        fail ("missing size line", input);
+    }
+  while (line[0] == '%');
+
+  if (sscanf (line, "%lu %lu %lu", &m, &n, &nnz) != 3 || m == 0 || n == 0)
+    fail ("invalid size line", input);
+
+  T = gsl_spmatrix_alloc_nzmax (m, n, (symmetric || skew) ? 2 * nnz : nnz,
+                                GSL_SPMATRIX_COO);
+  if (T == NULL)
+    fail ("cannot allocate matrix", input);
+
+  for (k = 0; k < nnz; ++k)
+    {
+      unsigned long r, c;
+      double x = 1.0;
+
+      if (fgets (line, sizeof (line), f) == NULL)
+        fail ("unexpected end of file", input);
+
+      if (sscanf (line, "%lu %lu %lf", &r, &c, &x) < (pattern ? 2 : 3) ||
+          r < 1 || r > m || c < 1 || c > n)
+        fail ("invalid entry", input);
+
+      gsl_spmatrix_append (T, r - 1, c - 1, x);
+
+      if ((symmetric || skew) && r != c)
+        gsl_spmatrix_append (T, c - 1, r - 1, skew ? -x : x);
+    }
+
+  if (f != stdin)
+    fclose (f);
+
+  A = gsl_spmatrix_compress (T, sptype);
+  gsl_spmatrix_free (T);
+
+  if (A == NULL)
+    fail ("cannot compress matrix", input);
+
+  if (gsl_spmatrix_fwrite_mmap (output, A) != GSL_SUCCESS)
+    fail ("cannot write file", output);
+
+  printf ("%s: %lu x %lu %s matrix with %lu nonzeros\n", output,
+          (unsigned long) A->size1, (unsigned long) A->size2,
+          gsl_spmatrix_type (A), (unsigned long) gsl_spmatrix_nnz (A));
+
+  gsl_spmatrix_free (A);
+
+  return 0;
+}
@@ -0,0 +1,739 @@
+/* linalg/batch.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Batched LU, Cholesky and QR decompositions of many small matrices of
+ * the same size.
+ *
+ * The matrices are stored interleaved, so that element (i,j) of matrix
+ * k is A[(i*N + j)*nbatch + k]. Every step of the factorization is then
+ * a loop over k with unit stride, which the compiler vectorizes, and
+ * there is no per matrix overhead of views, workspaces or argument
+ * checks. The batch is processed in chunks of consecutive matrices
+ * sized to stay in cache; when threads are requested with
+ * gsl_set_num_threads() the chunks are divided among them.
+ *
+ * The results have the same format as the unbatched routines
+ * gsl_linalg_LU_decomp, gsl_linalg_cholesky_decomp1 and
+ * gsl_linalg_QR_decomp, so an unpacked matrix can be passed to the
+ * other gsl_linalg functions.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_permute_double.h>
+#include <gsl/gsl_linalg.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* pointer to the nbatch values of element (i,j) of an interleaved batch
+   of matrices with ncol columns */
+#define ELEM(A, i, j) ((A) + ((i) * ncol + (j)) * nbatch)
+
+/* pointer to the nbatch values of element i of an interleaved batch of
+   vectors */
+#define VELEM(x, i) ((x) + (i) * nbatch)
+
+/* largest number of matrices processed together */
+#define BATCH_CHUNK_MAX 256
+
+typedef struct
+{
+  size_t M;
+  size_t N;
+  size_t nbatch;
+  double *A;
+  const double *cA;
+  double *x;
+  double *tau;
+  const double *ctau;
+  size_t *p;
+  const size_t *cp;
+  int *signum;
+  int *info;
+} batch_params;
+
+typedef int batch_fn (const size_t k0, const size_t k1, batch_params * b);
+
+/* number of matrices per chunk, so that a chunk of matrices with nelem
+   elements each occupies about 256 KB */
+static size_t
+batch_chunk (const size_t nelem)
+{
+  size_t chunk = 32768 / GSL_MAX (nelem, 1);
+
+  chunk = GSL_MIN (chunk, BATCH_CHUNK_MAX);
+  chunk -= chunk % 8;
+
+  return GSL_MAX (chunk, 8);
+}
+
+/* call fn on consecutive chunks of the batch and return the sum of its
+   return values */
+static int
+batch_run (const size_t nbatch, const size_t nelem, batch_fn * fn,
+           batch_params * b)
+{
+  const size_t chunk = batch_chunk (nelem);
+  const long nchunk = (long) ((nbatch + chunk - 1) / chunk);
+  /* num_threads() must be positive even when the batch is empty */
+  int nthreads = (int) GSL_MIN (gsl_get_num_threads (), (size_t) GSL_MAX (nchunk, 1));
+  int sum = 0;
+  long c;
+
+#ifdef _OPENMP
+  if (omp_in_parallel ())
+    nthreads = 1;
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) reduction(+:sum) if (nthreads > 1)
+#else
+  (void) nthreads;
+#endif
+  for (c = 0; c < nchunk; ++c)
+    {
+      const size_t k0 = (size_t) c * chunk;
+      const size_t k1 = GSL_MIN (nbatch, k0 + chunk);
+
+      sum += (*fn) (k0, k1, b);
+    }
+
+  return sum;
+}
+
+int
+gsl_linalg_batch_pack (const size_t M, const size_t N, const size_t nbatch,
+                       const double * src, const size_t stride, double * dest)
+{
+  if (stride < M * N)
+    {
+      GSL_ERROR ("stride must be at least M*N", GSL_EBADLEN);
+    }
+  else
+    {
+      size_t i, k;
+
+      for (k = 0; k < nbatch; ++k)
+        {
+          const double *s = src + k * stride;
+
+          for (i = 0; i < M * N; ++i)
+            dest[i * nbatch + k] = s[i];
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+int
+gsl_linalg_batch_unpack (const size_t M, const size_t N, const size_t nbatch,
+                         const double * src, double * dest, const size_t stride)
+{
+  if (stride < M * N)
+    {
+      GSL_ERROR ("stride must be at least M*N", GSL_EBADLEN);
+    }
+  else
+    {
+      size_t i, k;
+
+      for (k = 0; k < nbatch; ++k)
+        {
+          double *d = dest + k * stride;
+
+          for (i = 0; i < M * N; ++i)
+            d[i] = src[i * nbatch + k];
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+LU_decomp_chunk()
+  LU decomposition with partial pivoting of matrices [k0,k1) of the
+batch. The pivot search and row interchanges are done one matrix at a
+time, the elimination for all matrices together. As in
+gsl_linalg_LU_decomp, a zero pivot column is left unscaled and the
+factorization is completed.
+*/
+
+static int
+LU_decomp_chunk (const size_t k0, const size_t k1, batch_params * b)
+{
+  const size_t N = b->N, ncol = b->N, nbatch = b->nbatch;
+  double *A = b->A;
+  double pivot[BATCH_CHUNK_MAX];
+  size_t i, j, l, k;
+
+  for (k = k0; k < k1; ++k)
+    {
+      size_t *p = b->p + k * N;
+
+      for (i = 0; i < N; ++i)
+        p[i] = i;
+
+      b->signum[k] = 1;
+    }
+
+  for (j = 0; j < N; ++j)
+    {
+      for (k = k0; k < k1; ++k)
+        {
+          size_t i_pivot = j;
+          double amax = fabs (ELEM (A, j, j)[k]);
+
+          for (i = j + 1; i < N; ++i)
+            {
+              const double a = fabs (ELEM (A, i, j)[k]);
+
+              if (a > amax)
+                {
+                  amax = a;
+                  i_pivot = i;
+                }
+            }
+
+          if (i_pivot != j)
+            {
+              size_t *p = b->p + k * N;
+              size_t tmp = p[j];
+
+              for (l = 0; l < N; ++l)
+                {
+                  double t = ELEM (A, j, l)[k];
+                  ELEM (A, j, l)[k] = ELEM (A, i_pivot, l)[k];
+                  ELEM (A, i_pivot, l)[k] = t;
+                }
+
+              p[j] = p[i_pivot];
+              p[i_pivot] = tmp;
+              b->signum[k] = -b->signum[k];
+            }
+
+          pivot[k - k0] = (amax != 0.0) ? ELEM (A, j, j)[k] : 1.0;
+        }
+
+      for (i = j + 1; i < N; ++i)
+        {
+          double *Lij = ELEM (A, i, j);
+
+          for (k = k0; k < k1; ++k)
+            Lij[k] /= pivot[k - k0];
+
+          for (l = j + 1; l < N; ++l)
+            {
+              double *Ail = ELEM (A, i, l);
+              const double *Ajl = ELEM (A, j, l);
+
+              for (k = k0; k < k1; ++k)
+                Ail[k] -= Lij[k] * Ajl[k];
+            }
+        }
+    }
+
+  return 0;
+}
+
+int
+gsl_linalg_LU_decomp_batch (const size_t N, const size_t nbatch, double * A,
+                            size_t * p, int * signum)
+{
+  batch_params b;
+
+  b.N = N;
+  b.nbatch = nbatch;
+  b.A = A;
+  b.p = p;
+  b.signum = signum;
+
+  batch_run (nbatch, N * N, LU_decomp_chunk, &b);
+
+  return GSL_SUCCESS;
+}
+
+static int
+LU_svx_chunk (const size_t k0, const size_t k1, batch_params * b)
+{
+  const size_t N = b->N, ncol = b->N, nbatch = b->nbatch;
+  const double *LU = b->cA;
+  double *x = b->x;
+  size_t i, l, k;
+
+  /* x := P x */
+  for (k = k0; k < k1; ++k)
+    gsl_permute (b->cp + k * N, x + k, nbatch, N);
+
+  /* x := L^{-1} x */
+  for (i = 1; i < N; ++i)
+    {
+      double *xi = VELEM (x, i);
+
+      for (l = 0; l < i; ++l)
+        {
+          const double *Lil = ELEM (LU, i, l);
+          const double *xl = VELEM (x, l);
+
+          for (k = k0; k < k1; ++k)
+            xi[k] -= Lil[k] * xl[k];
+        }
+    }
+
+  /* x := U^{-1} x */
+  for (i = N; i-- > 0; )
+    {
+      double *xi = VELEM (x, i);
+      const double *Uii = ELEM (LU, i, i);
+
+      for (l = i + 1; l < N; ++l)
+        {
+          const double *Uil = ELEM (LU, i, l);
+          const double *xl = VELEM (x, l);
+
+          for (k = k0; k < k1; ++k)
+            xi[k] -= Uil[k] * xl[k];
+        }
+
+      for (k = k0; k < k1; ++k)
+        xi[k] /= Uii[k];
+    }
+
+  return 0;
+}
+
+int
+gsl_linalg_LU_svx_batch (const size_t N, const size_t nbatch, const double * LU,
+                         const size_t * p, double * x)
+{
+  batch_params b;
+
+  b.N = N;
+  b.nbatch = nbatch;
+  b.cA = LU;
+  b.cp = p;
+  b.x = x;
+
+  batch_run (nbatch, N * N, LU_svx_chunk, &b);
+
+  return GSL_SUCCESS;
+}
+
+/*
+cholesky_decomp1_chunk()
+  Cholesky decomposition (column oriented, left looking) of matrices
+[k0,k1) of the batch. As in gsl_linalg_cholesky_decomp1, the diagonal
+and lower triangle of each matrix are replaced by L and the upper
+triangle is not referenced.
+A matrix whose pivot j is not positive has info set to j + 1 (the first
+such j); its factorization is continued with a unit pivot so that the
+other matrices are unaffected, and its contents are not meaningful.
+
+Return: number of matrices which are not positive definite
+*/
+
+static int
+cholesky_decomp1_chunk (const size_t k0, const size_t k1, batch_params * b)
+{
+  const size_t N = b->N, ncol = b->N, nbatch = b->nbatch;
+  double *A = b->A;
+  int fail[BATCH_CHUNK_MAX];
+  int nfail = 0;
+  size_t i, j, l, k;
+
+  for (k = k0; k < k1; ++k)
+    fail[k - k0] = 0;
+
+  for (j = 0; j < N; ++j)
+    {
+      double *Ajj = ELEM (A, j, j);
+
+      for (l = 0; l < j; ++l)
+        {
+          const double *Ajl = ELEM (A, j, l);
+
+          for (k = k0; k < k1; ++k)
+            Ajj[k] -= Ajl[k] * Ajl[k];
+        }
+
+      for (k = k0; k < k1; ++k)
+        {
+          if (Ajj[k] > 0.0)
+            {
+              Ajj[k] = sqrt (Ajj[k]);
+            }
+          else
+            {
+              if (fail[k - k0] == 0)
+                fail[k - k0] = (int) j + 1;
+
+              Ajj[k] = 1.0;
+            }
+        }
+
+      for (i = j + 1; i < N; ++i)
+        {
+          double *Aij = ELEM (A, i, j);
+
+          for (l = 0; l < j; ++l)
+            {
+              const double *Ail = ELEM (A, i, l);
+              const double *Ajl = ELEM (A, j, l);
+
+              for (k = k0; k < k1; ++k)
+                Aij[k] -= Ail[k] * Ajl[k];
+            }
+
+          for (k = k0; k < k1; ++k)
+            Aij[k] /= Ajj[k];
+        }
+    }
+
+  for (k = k0; k < k1; ++k)
+    {
+      if (b->info != NULL)
+        b->info[k] = fail[k - k0];
+
+      nfail += (fail[k - k0] != 0);
+    }
+
+  return nfail;
+}
+
+int
+gsl_linalg_cholesky_decomp1_batch (const size_t N, const size_t nbatch, double * A,
+                                   int * info)
+{
+  batch_params b;
+  int nfail;
+
+  b.N = N;
+  b.nbatch = nbatch;
+  b.A = A;
+  b.info = info;
+
+  nfail = batch_run (nbatch, N * N, cholesky_decomp1_chunk, &b);
+
+  if (nfail > 0)
+    {
+      GSL_ERROR ("matrix is not positive definite", GSL_EDOM);
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+cholesky_svx_chunk (const size_t k0, const size_t k1, batch_params * b)
+{
+  const size_t N = b->N, ncol = b->N, nbatch = b->nbatch;
+  const double *LLT = b->cA;
+  double *x = b->x;
+  size_t i, l, k;
+
+  /* x := L^{-1} x */
+  for (i = 0; i < N; ++i)
+    {
+      double *xi = VELEM (x, i);
+      const double *Lii = ELEM (LLT, i, i);
+
+      for (l = 0; l < i; ++l)
+        {
+          const double *Lil = ELEM (LLT, i, l);
+          const double *xl = VELEM (x, l);
+
+          for (k = k0; k < k1; ++k)
+            xi[k] -= Lil[k] * xl[k];
+        }
+
+      for (k = k0; k < k1; ++k)
+        xi[k] /= Lii[k];
+    }
+
+  /* x := L^{-T} x */
+  for (i = N; i-- > 0; )
+    {
+      double *xi = VELEM (x, i);
+      const double *Lii = ELEM (LLT, i, i);
+
+      for (l = i + 1; l < N; ++l)
+        {
+          const double *Lli = ELEM (LLT, l, i);
+          const double *xl = VELEM (x, l);
+
+          for (k = k0; k < k1; ++k)
+            xi[k] -= Lli[k] * xl[k];
+        }
+
+      for (k = k0; k < k1; ++k)
+        xi[k] /= Lii[k];
+    }
+
+  return 0;
+}
+
+int
+gsl_linalg_cholesky_svx_batch (const size_t N, const size_t nbatch,
+                               const double * LLT, double * x)
+{
+  batch_params b;
+
+  b.N = N;
+  b.nbatch = nbatch;
+  b.cA = LLT;
+  b.x = x;
+
+  batch_run (nbatch, N * N, cholesky_svx_chunk, &b);
+
+  return GSL_SUCCESS;
+}
+
+/*
+QR_decomp_chunk()
+  Householder QR decomposition of matrices [k0,k1) of the batch, in the
+format of gsl_linalg_QR_decomp: R is stored in the upper triangle and
+the Householder vectors v_j (with implicit v_j(j) = 1) below the
+diagonal, with the coefficients in tau. The Householder transforms are
+those of gsl_linalg_householder_transform; the norm of each column is
+computed with scaling to avoid overflow and underflow.
+*/
+
+static int
+QR_decomp_chunk (const size_t k0, const size_t k1, batch_params * b)
+{
+  const size_t M = b->M, N = b->N, ncol = b->N, nbatch = b->nbatch;
+  const size_t K = GSL_MIN (M, N);
+  double *A = b->A;
+  double scale[BATCH_CHUNK_MAX], ssq[BATCH_CHUNK_MAX];
+  double s[BATCH_CHUNK_MAX], w[BATCH_CHUNK_MAX];
+  size_t i, j, l, k;
+
+  for (j = 0; j < K; ++j)
+    {
+      double *Ajj = ELEM (A, j, j);
+      double *tau = VELEM (b->tau, j);
+
+      /* scale[k] = max_{i>j} |A(i,j)|, ssq[k] = sum_{i>j} (A(i,j)/scale)^2 */
+
+      for (k = k0; k < k1; ++k)
+        scale[k - k0] = 0.0;
+
+      for (i = j + 1; i < M; ++i)
+        {
+          const double *Aij = ELEM (A, i, j);
+
+          for (k = k0; k < k1; ++k)
+            {
+              const double a = fabs (Aij[k]);
+              scale[k - k0] = (a > scale[k - k0]) ? a : scale[k - k0];
+            }
+        }
+
+      for (k = k0; k < k1; ++k)
+        {
+          scale[k - k0] = (scale[k - k0] > 0.0) ? 1.0 / scale[k - k0] : 0.0;
+          ssq[k - k0] = 0.0;
+        }
+
+      for (i = j + 1; i < M; ++i)
+        {
+          const double *Aij = ELEM (A, i, j);
+
+          for (k = k0; k < k1; ++k)
+            {
+              const double a = Aij[k] * scale[k - k0];
+              ssq[k - k0] += a * a;
+            }
+        }
+
+      /* Householder transform of column j */
+
+      for (k = k0; k < k1; ++k)
+        {
+          if (scale[k - k0] == 0.0)
+            {
+              tau[k] = 0.0;
+              s[k - k0] = 1.0;
+            }
+          else
+            {
+              const double xnorm = sqrt (ssq[k - k0]) / scale[k - k0];
+              const double alpha = Ajj[k];
+              const double beta = -GSL_SIGN (alpha) * hypot (alpha, xnorm);
+
+              tau[k] = (beta - alpha) / beta;
+              s[k - k0] = alpha - beta;
+              Ajj[k] = beta;
+            }
+        }
+
+      for (i = j + 1; i < M; ++i)
+        {
+          double *Aij = ELEM (A, i, j);
+
+          for (k = k0; k < k1; ++k)
+            Aij[k] /= s[k - k0];
+        }
+
+      /* apply (I - tau v v^T) to the remaining columns */
+
+      for (l = j + 1; l < N; ++l)
+        {
+          double *Ajl = ELEM (A, j, l);
+
+          for (k = k0; k < k1; ++k)
+            w[k - k0] = Ajl[k];
+
+          for (i = j + 1; i < M; ++i)
+            {
+              const double *Aij = ELEM (A, i, j);
+              const double *Ail = ELEM (A, i, l);
+
+              for (k = k0; k < k1; ++k)
+                w[k - k0] += Aij[k] * Ail[k];
+            }
+
+          for (k = k0; k < k1; ++k)
+            {
+              w[k - k0] *= tau[k];
+              Ajl[k] -= w[k - k0];
+            }
+
+          for (i = j + 1; i < M; ++i)
+            {
+              const double *Aij = ELEM (A, i, j);
+              double *Ail = ELEM (A, i, l);
+
+              for (k = k0; k < k1; ++k)
+                Ail[k] -= w[k - k0] * Aij[k];
+            }
+        }
+    }
+
+  return 0;
+}
+
+int
+gsl_linalg_QR_decomp_batch (const size_t M, const size_t N, const size_t nbatch,
+                            double * A, double * tau)
+{
+  batch_params b;
+
+  b.M = M;
+  b.N = N;
+  b.nbatch = nbatch;
+  b.A = A;
+  b.tau = tau;
+
+  batch_run (nbatch, M * N, QR_decomp_chunk, &b);
+
+  return GSL_SUCCESS;
+}
+
+static int
+QR_lssvx_chunk (const size_t k0, const size_t k1, batch_params * b)
+{
+  const size_t M = b->M, N = b->N, ncol = b->N, nbatch = b->nbatch;
+  const double *QR = b->cA;
+  double *x = b->x;
+  double w[BATCH_CHUNK_MAX];
+  size_t i, j, l, k;
+
+  /* x := Q^T x */
+  for (j = 0; j < N; ++j)
+    {
+      const double *tau = VELEM (b->ctau, j);
+      double *xj = VELEM (x, j);
+
+      for (k = k0; k < k1; ++k)
+        w[k - k0] = xj[k];
+
+      for (i = j + 1; i < M; ++i)
+        {
+          const double *Qij = ELEM (QR, i, j);
+          const double *xi = VELEM (x, i);
+
+          for (k = k0; k < k1; ++k)
+            w[k - k0] += Qij[k] * xi[k];
+        }
+
+      for (k = k0; k < k1; ++k)
+        {
+          w[k - k0] *= tau[k];
+          xj[k] -= w[k - k0];
+        }
+
+      for (i = j + 1; i < M; ++i)
+        {
+          const double *Qij = ELEM (QR, i, j);
+          double *xi = VELEM (x, i);
+
+          for (k = k0; k < k1; ++k)
+            xi[k] -= w[k - k0] * Qij[k];
+        }
+    }
+
+  /* x(0:N-1) := R^{-1} x(0:N-1) */
+  for (i = N; i-- > 0; )
+    {
+      double *xi = VELEM (x, i);
+      const double *Rii = ELEM (QR, i, i);
+
+      for (l = i + 1; l < N; ++l)
+        {
+          const double *Ril = ELEM (QR, i, l);
+          const double *xl = VELEM (x, l);
+
+          for (k = k0; k < k1; ++k)
+            xi[k] -= Ril[k] * xl[k];
+        }
+
+      for (k = k0; k < k1; ++k)
+        xi[k] /= Rii[k];
+    }
+
+  return 0;
+}
+
+int
+gsl_linalg_QR_lssvx_batch (const size_t M, const size_t N, const size_t nbatch,
+                           const double * QR, const double * tau, double * x)
+{
+  if (M < N)
+    {
+      GSL_ERROR ("QR matrix must have M >= N", GSL_EBADLEN);
+    }
+  else
+    {
+      batch_params b;
+
+      b.M = M;
+      b.N = N;
+      b.nbatch = nbatch;
+      b.cA = QR;
+      b.ctau = tau;
+      b.x = x;
+
+      batch_run (nbatch, M * N, QR_lssvx_chunk, &b);
+
+      return GSL_SUCCESS;
+    }
+}
@@ -71,6 +71,18 @@
 
 #include <gsl/gsl_linalg.h>
 
+/* panel width, and matrix size above which the blocked reduction is
+   used (see tune.c); the crossover is larger than a panel, so that at
+   least two columns are left for the unblocked reduction */
+#define BIDIAG_NB         gsl_linalg_tune_get_panel ()
+#define BIDIAG_CROSSOVER  GSL_MAX (gsl_linalg_tune_get_crossover (GSL_LINALG_TUNE_BIDIAG), BIDIAG_NB + 1)
+
+static int bidiag_decomp_L2 (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V);
+static int bidiag_decomp_L3 (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V);
+static void bidiag_panel (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V,
+                          gsl_matrix * X, gsl_matrix * Y, gsl_vector * work,
+                          double * d, double * e);
+
 int 
 gsl_linalg_bidiag_decomp (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V)  
 {
@@ -86,55 +98,269 @@ gsl_linalg_bidiag_decomp (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V
     {
       GSL_ERROR ("size of tau_V must be (N - 1)", GSL_EBADLEN);
     }
+  else if (A->size2 > BIDIAG_CROSSOVER)
+    {
+      return bidiag_decomp_L3 (A, tau_U, tau_V);
+    }
   else
     {
-      const size_t M = A->size1;
-      const size_t N = A->size2;
-      gsl_vector * tmp = gsl_vector_alloc(M);
-      size_t j;
-  
-      for (j = 0 ; j < N; j++)
+      return bidiag_decomp_L2 (A, tau_U, tau_V);
+    }
+}
+
+/* unblocked reduction, one Householder reflector at a time */
+static int
+bidiag_decomp_L2 (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  gsl_vector * tmp = gsl_vector_alloc(M);
+  size_t j;
+
+  for (j = 0 ; j < N; j++)
+    {
+      /* apply Householder transformation to current column */
+      gsl_vector_view v = gsl_matrix_subcolumn(A, j, j, M - j);
+      double tau_j = gsl_linalg_householder_transform (&v.vector);
+
+      /* apply the transformation to the remaining columns */
+      if (j + 1 < N)
         {
-          /* apply Householder transformation to current column */
-          gsl_vector_view v = gsl_matrix_subcolumn(A, j, j, M - j);
-          double tau_j = gsl_linalg_householder_transform (&v.vector);
+          gsl_matrix_view m = gsl_matrix_submatrix (A, j, j + 1, M - j, N - j - 1);
+          gsl_vector_view work = gsl_vector_subvector(tau_U, j, N - j - 1);
+          double * ptr = gsl_vector_ptr(&v.vector, 0);
+          double tmp = *ptr;
 
-          /* apply the transformation to the remaining columns */
-          if (j + 1 < N)
-            {
-              gsl_matrix_view m = gsl_matrix_submatrix (A, j, j + 1, M - j, N - j - 1);
-              gsl_vector_view work = gsl_vector_subvector(tau_U, j, N - j - 1);
-              double * ptr = gsl_vector_ptr(&v.vector, 0);
-              double tmp = *ptr;
-
-              *ptr = 1.0;
-              gsl_linalg_householder_left (tau_j, &v.vector, &m.matrix, &work.vector);
-              *ptr = tmp;
-            }
+          *ptr = 1.0;
+          gsl_linalg_householder_left (tau_j, &v.vector, &m.matrix, &work.vector);
+          *ptr = tmp;
+        }
 
-          gsl_vector_set (tau_U, j, tau_j);            
+      gsl_vector_set (tau_U, j, tau_j);            
 
-          /* apply Householder transformation to current row */
-          if (j + 1 < N)
+      /* apply Householder transformation to current row */
+      if (j + 1 < N)
+        {
+          v = gsl_matrix_subrow (A, j, j + 1, N - j - 1);
+          tau_j = gsl_linalg_householder_transform (&v.vector);
+          
+          /* apply the transformation to the remaining rows */
+          if (j + 1 < M)
             {
-              v = gsl_matrix_subrow (A, j, j + 1, N - j - 1);
-              tau_j = gsl_linalg_householder_transform (&v.vector);
-              
-              /* apply the transformation to the remaining rows */
-              if (j + 1 < M)
-                {
-                  gsl_matrix_view m = gsl_matrix_submatrix (A, j + 1, j + 1, M - j - 1, N - j - 1);
-                  gsl_vector_view work = gsl_vector_subvector(tmp, 0, M - j - 1);
-                  gsl_linalg_householder_right (tau_j, &v.vector, &m.matrix, &work.vector);
-                }
-
-              gsl_vector_set (tau_V, j, tau_j);
+              gsl_matrix_view m = gsl_matrix_submatrix (A, j + 1, j + 1, M - j - 1, N - j - 1);
+              gsl_vector_view work = gsl_vector_subvector(tmp, 0, M - j - 1);
+              gsl_linalg_householder_right (tau_j, &v.vector, &m.matrix, &work.vector);
             }
+
+          gsl_vector_set (tau_V, j, tau_j);
         }
+    }
 
-      gsl_vector_free(tmp);
+  gsl_vector_free(tmp);
 
-      return GSL_SUCCESS;
+  return GSL_SUCCESS;
+}
+
+/*
+bidiag_decomp_L3()
+  Blocked reduction. The reflectors of each panel of BIDIAG_NB rows and
+columns are computed with the panel update of the trailing matrix
+deferred, as
+
+A22 := A22 - V Y^T - X U^T
+
+where the columns of V and the rows of U^T are the left and right
+Householder vectors of the panel, so that most of the work is done
+by two matrix-matrix products. The output is identical in format to
+the unblocked reduction.
+
+See LAPACK routines DGEBRD and DLABRD, and Dongarra, Sorensen and
+Hammarling, "Block reduction of matrices to condensed forms for
+eigenvalue computations", J. Comput. Appl. Math. 27 (1989) 215-227.
+*/
+
+static int
+bidiag_decomp_L3 (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  const size_t nb = BIDIAG_NB;
+  const size_t crossover = BIDIAG_CROSSOVER;
+  gsl_matrix *X = gsl_matrix_alloc (M, nb);
+  gsl_matrix *Y = gsl_matrix_alloc (N, nb);
+  gsl_vector *work = gsl_vector_alloc (N + 2 * nb);
+  double *d, *e;
+  size_t j = 0, k;
+
+  if (X == 0 || Y == 0 || work == 0)
+    {
+      if (X)
+        gsl_matrix_free (X);
+      if (Y)
+        gsl_matrix_free (Y);
+      if (work)
+        gsl_vector_free (work);
+
+      GSL_ERROR ("failed to allocate panel workspace", GSL_ENOMEM);
+    }
+
+  /* the bidiagonal elements of a panel are kept after the first N
+     elements of work */
+  d = work->data + N;
+  e = d + nb;
+
+  for (j = 0; N - j > crossover; j += nb)
+    {
+      const size_t m = M - j;
+      const size_t n = N - j;
+      gsl_matrix_view Aj = gsl_matrix_submatrix (A, j, j, m, n);
+      gsl_vector_view tU = gsl_vector_subvector (tau_U, j, nb);
+      gsl_vector_view tV = gsl_vector_subvector (tau_V, j, nb);
+      gsl_matrix_view Xj = gsl_matrix_submatrix (X, 0, 0, m, nb);
+      gsl_matrix_view Yj = gsl_matrix_submatrix (Y, 0, 0, n, nb);
+
+      bidiag_panel (&Aj.matrix, &tU.vector, &tV.vector, &Xj.matrix, &Yj.matrix, work, d, e);
+
+      /* A22 := A22 - V Y^T - X U^T */
+      {
+        gsl_matrix_view A22 = gsl_matrix_submatrix (&Aj.matrix, nb, nb, m - nb, n - nb);
+        gsl_matrix_view V = gsl_matrix_submatrix (&Aj.matrix, nb, 0, m - nb, nb);
+        gsl_matrix_view UT = gsl_matrix_submatrix (&Aj.matrix, 0, nb, nb, n - nb);
+        gsl_matrix_view Y2 = gsl_matrix_submatrix (&Yj.matrix, nb, 0, n - nb, nb);
+        gsl_matrix_view X2 = gsl_matrix_submatrix (&Xj.matrix, nb, 0, m - nb, nb);
+
+        gsl_blas_dgemm (CblasNoTrans, CblasTrans, -1.0, &V.matrix, &Y2.matrix, 1.0, &A22.matrix);
+        gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, -1.0, &X2.matrix, &UT.matrix, 1.0, &A22.matrix);
+      }
+
+      /* restore the bidiagonal elements of the panel */
+      for (k = 0; k < nb; ++k)
+        {
+          gsl_matrix_set (&Aj.matrix, k, k, d[k]);
+          gsl_matrix_set (&Aj.matrix, k, k + 1, e[k]);
+        }
+    }
+
+  gsl_matrix_free (X);
+  gsl_matrix_free (Y);
+  gsl_vector_free (work);
+
+  /* reduce the remaining matrix unblocked */
+  {
+    gsl_matrix_view Aj = gsl_matrix_submatrix (A, j, j, M - j, N - j);
+    gsl_vector_view tU = gsl_vector_subvector (tau_U, j, N - j);
+    gsl_vector_view tV = gsl_vector_subvector (tau_V, j, N - j - 1);
+
+    return bidiag_decomp_L2 (&Aj.matrix, &tU.vector, &tV.vector);
+  }
+}
+
+/*
+bidiag_panel()
+  Reduce the first nb rows and columns of the m-by-n matrix A, m >= n > nb,
+returning the matrices X (m-by-nb) and Y (n-by-nb) needed to update the
+trailing matrix. On output the diagonal and superdiagonal elements of
+the panel, which are stored in d and e, are replaced by 1, the leading
+elements of the Householder vectors. work is a vector of length n.
+*/
+
+static void
+bidiag_panel (gsl_matrix * A, gsl_vector * tau_U, gsl_vector * tau_V,
+              gsl_matrix * X, gsl_matrix * Y, gsl_vector * work,
+              double * d, double * e)
+{
+  const size_t m = A->size1;
+  const size_t n = A->size2;
+  const size_t nb = X->size2;
+  size_t i;
+
+  for (i = 0; i < nb; ++i)
+    {
+      gsl_vector_view ai = gsl_matrix_subcolumn (A, i, i, m - i);
+      gsl_vector_view ri = gsl_matrix_subrow (A, i, i + 1, n - i - 1);
+      gsl_vector_view yi = gsl_matrix_subcolumn (Y, i, i + 1, n - i - 1);
+      gsl_vector_view wi = gsl_vector_subvector (work, 0, n - i - 1);
+      gsl_vector_view xi = gsl_matrix_subcolumn (X, i, i + 1, m - i - 1);
+      gsl_matrix_view A12 = gsl_matrix_submatrix (A, i, i + 1, m - i, n - i - 1);
+      gsl_matrix_view A22 = gsl_matrix_submatrix (A, i + 1, i + 1, m - i - 1, n - i - 1);
+      gsl_matrix_view Y2 = gsl_matrix_submatrix (Y, i + 1, 0, n - i - 1, i + 1);
+      gsl_matrix_view A21 = gsl_matrix_submatrix (A, i + 1, 0, m - i - 1, i + 1);
+      gsl_vector_view arow = gsl_matrix_subrow (A, i, 0, i + 1);
+      gsl_vector_view xtop = gsl_matrix_subcolumn (X, i, 0, i + 1);
+      double tau;
+
+      /* update column i with the previous reflectors */
+      if (i > 0)
+        {
+          gsl_matrix_view Ab = gsl_matrix_submatrix (A, i, 0, m - i, i);
+          gsl_matrix_view Xb = gsl_matrix_submatrix (X, i, 0, m - i, i);
+          gsl_vector_view yrow = gsl_matrix_subrow (Y, i, 0, i);
+          gsl_vector_view acol = gsl_matrix_subcolumn (A, i, 0, i);
+
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Ab.matrix, &yrow.vector, 1.0, &ai.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Xb.matrix, &acol.vector, 1.0, &ai.vector);
+        }
+
+      /* left reflector annihilating A(i+1:m,i) */
+      tau = gsl_linalg_householder_transform (&ai.vector);
+      gsl_vector_set (tau_U, i, tau);
+      d[i] = gsl_matrix_get (A, i, i);
+      gsl_matrix_set (A, i, i, 1.0);
+
+      /* Y(i+1:n,i) = tau (A^T - Y V^T - U X^T) v; the product with A^T
+         is formed in contiguous storage, as it accumulates rows of A */
+      gsl_blas_dgemv (CblasTrans, 1.0, &A12.matrix, &ai.vector, 0.0, &wi.vector);
+      gsl_vector_memcpy (&yi.vector, &wi.vector);
+
+      if (i > 0)
+        {
+          gsl_matrix_view Ab = gsl_matrix_submatrix (A, i, 0, m - i, i);
+          gsl_matrix_view Xb = gsl_matrix_submatrix (X, i, 0, m - i, i);
+          gsl_matrix_view Yb = gsl_matrix_submatrix (Y, i + 1, 0, n - i - 1, i);
+          gsl_matrix_view Ut = gsl_matrix_submatrix (A, 0, i + 1, i, n - i - 1);
+          gsl_vector_view ytop = gsl_matrix_subcolumn (Y, i, 0, i);
+
+          gsl_blas_dgemv (CblasTrans, 1.0, &Ab.matrix, &ai.vector, 0.0, &ytop.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Yb.matrix, &ytop.vector, 1.0, &yi.vector);
+          gsl_blas_dgemv (CblasTrans, 1.0, &Xb.matrix, &ai.vector, 0.0, &ytop.vector);
+          gsl_blas_dgemv (CblasTrans, -1.0, &Ut.matrix, &ytop.vector, 1.0, &yi.vector);
+        }
+
+      gsl_blas_dscal (tau, &yi.vector);
+
+      /* update row i */
+      gsl_blas_dgemv (CblasNoTrans, -1.0, &Y2.matrix, &arow.vector, 1.0, &ri.vector);
+
+      if (i > 0)
+        {
+          gsl_matrix_view Ut = gsl_matrix_submatrix (A, 0, i + 1, i, n - i - 1);
+          gsl_vector_view xrow = gsl_matrix_subrow (X, i, 0, i);
+
+          gsl_blas_dgemv (CblasTrans, -1.0, &Ut.matrix, &xrow.vector, 1.0, &ri.vector);
+        }
+
+      /* right reflector annihilating A(i,i+2:n) */
+      tau = gsl_linalg_householder_transform (&ri.vector);
+      gsl_vector_set (tau_V, i, tau);
+      e[i] = gsl_matrix_get (A, i, i + 1);
+      gsl_matrix_set (A, i, i + 1, 1.0);
+
+      /* X(i+1:m,i) = tau (A - V Y^T - X U^T) u */
+      gsl_blas_dgemv (CblasNoTrans, 1.0, &A22.matrix, &ri.vector, 0.0, &xi.vector);
+      gsl_blas_dgemv (CblasTrans, 1.0, &Y2.matrix, &ri.vector, 0.0, &xtop.vector);
+      gsl_blas_dgemv (CblasNoTrans, -1.0, &A21.matrix, &xtop.vector, 1.0, &xi.vector);
+
+      if (i > 0)
+        {
+          gsl_matrix_view Ut = gsl_matrix_submatrix (A, 0, i + 1, i, n - i - 1);
+          gsl_matrix_view Xb = gsl_matrix_submatrix (X, i + 1, 0, m - i - 1, i);
+          gsl_vector_view xtop2 = gsl_matrix_subcolumn (X, i, 0, i);
+
+          gsl_blas_dgemv (CblasNoTrans, 1.0, &Ut.matrix, &ri.vector, 0.0, &xtop2.vector);
+          gsl_blas_dgemv (CblasNoTrans, -1.0, &Xb.matrix, &xtop2.vector, 1.0, &xi.vector);
+        }
+
+      gsl_blas_dscal (tau, &xi.vector);
     }
 }
 
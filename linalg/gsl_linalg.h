@@ -175,6 +175,26 @@ int gsl_linalg_SV_decomp_jacobi (gsl_matrix * A,
                                  gsl_matrix * Q,
                                  gsl_vector * S);
 
+/* gsl_rng, see gsl_rng.h */
+struct gsl_rng;
+
+/* linear operator A, given by the products Y = op(A) X */
+typedef struct
+{
+  size_t size1;   /* number of rows of A */
+  size_t size2;   /* number of columns of A */
+  int (* mult) (const CBLAS_TRANSPOSE_t TransA, const gsl_matrix * X, gsl_matrix * Y, void * params);
+  void * params;
+} gsl_linalg_SV_op;
+
+int gsl_linalg_SV_decomp_rand (const gsl_matrix * A, gsl_matrix * U, gsl_vector * S,
+                               gsl_matrix * V, const size_t oversample, const size_t npower,
+                               struct gsl_rng * r);
+
+int gsl_linalg_SV_decomp_rand_op (const gsl_linalg_SV_op * op, gsl_matrix * U, gsl_vector * S,
+                                  gsl_matrix * V, const size_t oversample, const size_t npower,
+                                  struct gsl_rng * r);
+
 int
 gsl_linalg_SV_solve (const gsl_matrix * U,
                      const gsl_matrix * Q,
@@ -329,6 +349,8 @@ int gsl_linalg_QR_unpack (const gsl_matrix * QR, const gsl_vector * tau, gsl_mat
 
 int gsl_linalg_QR_unpack_r(const gsl_matrix * QR, const gsl_matrix * T, gsl_matrix * Q, gsl_matrix * R);
 
+int gsl_linalg_QR_Q1_r(gsl_matrix * QR, const gsl_matrix * T);
+
 int gsl_linalg_R_solve (const gsl_matrix * R, const gsl_vector * b, gsl_vector * x);
 
 int gsl_linalg_R_svx (const gsl_matrix * R, gsl_vector * x);
@@ -783,6 +805,12 @@ int gsl_linalg_symmtd_unpack_T (const gsl_matrix * A,
                                 gsl_vector * diag, 
                                 gsl_vector * subdiag);
 
+int gsl_linalg_symmtd2_decomp (gsl_matrix * A, gsl_matrix * T);
+int gsl_linalg_symmtd2_unpack (const gsl_matrix * A, const gsl_matrix * T, gsl_matrix * Q,
+                               gsl_vector * diag, gsl_vector * subdiag);
+int gsl_linalg_symmtd2_Qmat (const gsl_matrix * A, const gsl_matrix * T, gsl_matrix * B,
+                             gsl_matrix * work);
+
 /* Hermitian to symmetric tridiagonal decomposition */
 
 int gsl_linalg_hermtd_decomp (gsl_matrix_complex * A, 
@@ -925,6 +953,59 @@ int gsl_linalg_tri_UL(gsl_matrix * LU);
 int gsl_linalg_complex_tri_LHL(gsl_matrix_complex * L);
 int gsl_linalg_complex_tri_UL(gsl_matrix_complex * LU);
 
+/* Tuning parameters of the recursive and blocked algorithms */
+
+typedef enum
+  {
+    GSL_LINALG_TUNE_LU = 0,
+    GSL_LINALG_TUNE_CHOLESKY = 1,
+    GSL_LINALG_TUNE_INVTRI = 2,
+    GSL_LINALG_TUNE_TRIMULT = 3,
+    GSL_LINALG_TUNE_BIDIAG = 4
+  }
+gsl_linalg_tune_t;
+
+int gsl_linalg_tune_set_crossover (const gsl_linalg_tune_t alg, const size_t n);
+size_t gsl_linalg_tune_get_crossover (const gsl_linalg_tune_t alg);
+int gsl_linalg_tune_set_split (const size_t nb);
+size_t gsl_linalg_tune_get_split (void);
+int gsl_linalg_tune_set_tile (const size_t nb);
+size_t gsl_linalg_tune_get_tile (void);
+int gsl_linalg_tune_set_panel (const size_t nb);
+size_t gsl_linalg_tune_get_panel (void);
+int gsl_linalg_tune_load (const char * filename);
+int gsl_linalg_tune_save (const char * filename);
+
+/* Batched decompositions of many small matrices of the same size,
+ * stored interleaved: element (i,j) of matrix k is A[(i*N + j)*nbatch + k]
+ */
+
+int gsl_linalg_batch_pack (const size_t M, const size_t N, const size_t nbatch,
+                           const double * src, const size_t stride, double * dest);
+int gsl_linalg_batch_unpack (const size_t M, const size_t N, const size_t nbatch,
+                             const double * src, double * dest, const size_t stride);
+
+int gsl_linalg_LU_decomp_batch (const size_t N, const size_t nbatch, double * A,
+                                size_t * p, int * signum);
+int gsl_linalg_LU_svx_batch (const size_t N, const size_t nbatch, const double * LU,
+                             const size_t * p, double * x);
+
+int gsl_linalg_cholesky_decomp1_batch (const size_t N, const size_t nbatch, double * A,
+                                       int * info);
+int gsl_linalg_cholesky_svx_batch (const size_t N, const size_t nbatch,
+                                   const double * LLT, double * x);
+
+int gsl_linalg_QR_decomp_batch (const size_t M, const size_t N, const size_t nbatch,
+                                double * A, double * tau);
+int gsl_linalg_QR_lssvx_batch (const size_t M, const size_t N, const size_t nbatch,
+                               const double * QR, const double * tau, double * x);
+
+/* Tiled decompositions of large matrices, parallelized over tiles */
+
+int gsl_linalg_cholesky_decomp1_tiled (gsl_matrix * A);
+int gsl_linalg_LU_decomp_tiled (gsl_matrix * A, gsl_permutation * p, int * signum);
+int gsl_linalg_QR_decomp_r_tiled (gsl_matrix * A, gsl_matrix * T);
+
 INLINE_DECL void gsl_linalg_givens (const double a, const double b,
                                     double *c, double *s);
 INLINE_DECL void gsl_linalg_givens_gv (gsl_vector * v, const size_t i,
@@ -1,10 +1,13 @@
-/* define how a problem is split recursively */
-#define GSL_LINALG_SPLIT(n)         ((n >= 16) ? ((n + 8) / 16) * 8 : n / 2)
-#define GSL_LINALG_SPLIT_COMPLEX(n) ((n >= 8) ? ((n + 4) / 8) * 4 : n / 2)
+/* define how a problem is split recursively: for n >= 2*nb the first
+   part is n/2 rounded to a multiple of the block size nb, which is
+   gsl_linalg_tune_get_split() for real and half of it for complex
+   matrices */
+#define GSL_LINALG_SPLIT_NB(n,nb)   (((n) >= 2 * (nb)) ? (((n) + (nb)) / (2 * (nb))) * (nb) : (n) / 2)
+#define GSL_LINALG_SPLIT(n)         GSL_LINALG_SPLIT_NB(n, gsl_linalg_tune_get_split ())
+#define GSL_LINALG_SPLIT_COMPLEX(n) GSL_LINALG_SPLIT_NB(n, GSL_MAX (gsl_linalg_tune_get_split () / 2, 1))
 
-/* matrix size for crossover to Level 2 algorithms */
-#define CROSSOVER              24
-#define CROSSOVER_LU           CROSSOVER
-#define CROSSOVER_CHOLESKY     CROSSOVER
-#define CROSSOVER_INVTRI       CROSSOVER
-#define CROSSOVER_TRIMULT      CROSSOVER
+/* matrix size for crossover to Level 2 algorithms, see tune.c */
+#define CROSSOVER_LU           gsl_linalg_tune_get_crossover (GSL_LINALG_TUNE_LU)
+#define CROSSOVER_CHOLESKY     gsl_linalg_tune_get_crossover (GSL_LINALG_TUNE_CHOLESKY)
+#define CROSSOVER_INVTRI       gsl_linalg_tune_get_crossover (GSL_LINALG_TUNE_INVTRI)
+#define CROSSOVER_TRIMULT      gsl_linalg_tune_get_crossover (GSL_LINALG_TUNE_TRIMULT)
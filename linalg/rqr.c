@@ -442,6 +442,44 @@ gsl_linalg_QR_unpack_r(const gsl_matrix * QR, const gsl_matrix * T, gsl_matrix *
     }
 }
 
+/*
+gsl_linalg_QR_Q1_r()
+  Form the first N columns Q_1 = Q [ I_N; 0 ] of the orthogonal matrix
+of a QR decomposition, in place of the decomposition
+
+Inputs: QR - on input, [R; V] matrix encoded by gsl_linalg_QR_decomp_r
+             on output, Q_1
+             M-by-N
+        T  - block reflector matrix, N-by-N
+
+Return: success/error
+*/
+
+int
+gsl_linalg_QR_Q1_r(gsl_matrix * QR, const gsl_matrix * T)
+{
+  const size_t M = QR->size1;
+  const size_t N = QR->size2;
+
+  if (M < N)
+    {
+      GSL_ERROR ("M must be >= N", GSL_EBADLEN);
+    }
+  else if (T->size1 != N || T->size2 != N)
+    {
+      GSL_ERROR ("T matrix must be N-by-N", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_matrix_view m = gsl_matrix_submatrix(QR, 0, 0, N, N);
+
+      /* QR := [ T; V ], with T in the upper triangle */
+      gsl_matrix_tricpy(CblasUpper, CblasNonUnit, &m.matrix, T);
+
+      return unpack_Q1(QR);
+    }
+}
+
 /*
 gsl_linalg_QR_QTvec_r()
   Apply M-by-M Q^T to the M-by-1 vector b
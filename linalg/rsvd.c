@@ -0,0 +1,225 @@
+/* linalg/rsvd.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Randomized truncated singular value decomposition,
+ *
+ * A ~= U S V^T
+ *
+ * with U M-by-K, S K-by-K and V N-by-K, computed from the products of
+ * A with L = K + p vectors only.
+ *
+ * 1. Y = A Omega, with Omega an N-by-L Gaussian random matrix, and
+ *    Q = orth(Y), so that the range of Q approximates the range of A
+ * 2. q power iterations Q = orth(A orth(A^T Q)), which improve the
+ *    approximation when the singular values decay slowly
+ * 3. B = Q^T A (L-by-N) and its SVD B = W S V^T, so that U = Q W
+ *
+ * The orthonormal bases are formed with gsl_linalg_QR_decomp_r.
+ *
+ * See Halko, Martinsson and Tropp, "Finding structure with randomness:
+ * probabilistic algorithms for constructing approximate matrix
+ * decompositions", SIAM Review 53 (2011) 217-288.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_linalg.h>
+
+static int rsvd_dense_mult (const CBLAS_TRANSPOSE_t TransA, const gsl_matrix * X,
+                            gsl_matrix * Y, void * params);
+static int rsvd_orth (gsl_matrix * Y, gsl_matrix * T);
+
+/*
+gsl_linalg_SV_decomp_rand()
+  Randomized truncated SVD of a matrix
+
+Inputs: A          - M-by-N matrix, not modified
+        U          - (output) M-by-K left singular vectors
+        S          - (output) K largest singular values
+        V          - (output) N-by-K right singular vectors
+        oversample - number p of additional sample vectors
+        npower     - number q of power iterations
+        r          - random number generator for the test matrix
+
+Return: success/error
+*/
+
+int
+gsl_linalg_SV_decomp_rand (const gsl_matrix * A, gsl_matrix * U, gsl_vector * S,
+                           gsl_matrix * V, const size_t oversample, const size_t npower,
+                           gsl_rng * r)
+{
+  gsl_linalg_SV_op op;
+
+  op.size1 = A->size1;
+  op.size2 = A->size2;
+  op.mult = rsvd_dense_mult;
+  op.params = (void *) A;       /* only read by rsvd_dense_mult */
+
+  return gsl_linalg_SV_decomp_rand_op (&op, U, S, V, oversample, npower, r);
+}
+
+/*
+gsl_linalg_SV_decomp_rand_op()
+  Randomized truncated SVD of a linear operator
+
+Inputs: op         - operator, op->mult (TransA, X, Y, op->params) stores
+                     op(A) X in Y, for N-by-L or M-by-L matrices X, and
+                     returns GSL_SUCCESS, or an error code which is
+                     returned to the caller
+        U          - (output) M-by-K left singular vectors
+        S          - (output) K largest singular values
+        V          - (output) N-by-K right singular vectors
+        oversample - number p of additional sample vectors
+        npower     - number q of power iterations
+        r          - random number generator for the test matrix
+
+Return: success/error
+*/
+
+int
+gsl_linalg_SV_decomp_rand_op (const gsl_linalg_SV_op * op, gsl_matrix * U, gsl_vector * S,
+                              gsl_matrix * V, const size_t oversample, const size_t npower,
+                              gsl_rng * r)
+{
+  const size_t M = op->size1;
+  const size_t N = op->size2;
+  const size_t K = S->size;
+
+  if (K == 0 || K > GSL_MIN (M, N))
+    {
+      GSL_ERROR ("rank K must be between 1 and min(M,N)", GSL_EBADLEN);
+    }
+  else if (U->size1 != M || U->size2 != K)
+    {
+      GSL_ERROR ("U matrix must be M-by-K", GSL_EBADLEN);
+    }
+  else if (V->size1 != N || V->size2 != K)
+    {
+      GSL_ERROR ("V matrix must be N-by-K", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t L = GSL_MIN (K + oversample, GSL_MIN (M, N));
+      gsl_matrix *Y = gsl_matrix_alloc (M, L);
+      gsl_matrix *Z = gsl_matrix_alloc (N, L);
+      gsl_matrix *T = gsl_matrix_alloc (L, L);
+      gsl_matrix *W = gsl_matrix_alloc (L, L);
+      gsl_vector *s = gsl_vector_alloc (L);
+      gsl_vector *work = gsl_vector_alloc (L);
+      int status = GSL_SUCCESS;
+      size_t i, j;
+
+      if (Y == 0 || Z == 0 || T == 0 || W == 0 || s == 0 || work == 0)
+        {
+          status = GSL_ENOMEM;
+        }
+      else
+        {
+          /* Gaussian test matrix Omega in Z */
+          for (i = 0; i < N; ++i)
+            {
+              for (j = 0; j < L; ++j)
+                gsl_matrix_set (Z, i, j, gsl_ran_gaussian_ziggurat (r, 1.0));
+            }
+
+          /* Q = orth(A Omega) in Y */
+          status = op->mult (CblasNoTrans, Z, Y, op->params);
+          if (!status)
+            status = rsvd_orth (Y, T);
+
+          for (i = 0; i < npower && !status; ++i)
+            {
+              status = op->mult (CblasTrans, Y, Z, op->params);
+              if (!status)
+                status = rsvd_orth (Z, T);
+              if (!status)
+                status = op->mult (CblasNoTrans, Z, Y, op->params);
+              if (!status)
+                status = rsvd_orth (Y, T);
+            }
+
+          /* B^T = A^T Q = V S W^T */
+          if (!status)
+            status = op->mult (CblasTrans, Y, Z, op->params);
+          if (!status)
+            status = gsl_linalg_SV_decomp (Z, W, s, work);
+
+          if (!status)
+            {
+              gsl_matrix_const_view Vk = gsl_matrix_const_submatrix (Z, 0, 0, N, K);
+              gsl_matrix_const_view Wk = gsl_matrix_const_submatrix (W, 0, 0, L, K);
+              gsl_vector_const_view sk = gsl_vector_const_subvector (s, 0, K);
+
+              /* U = Q W */
+              gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, Y, &Wk.matrix, 0.0, U);
+              gsl_matrix_memcpy (V, &Vk.matrix);
+              gsl_vector_memcpy (S, &sk.vector);
+            }
+        }
+
+      if (Y)
+        gsl_matrix_free (Y);
+      if (Z)
+        gsl_matrix_free (Z);
+      if (T)
+        gsl_matrix_free (T);
+      if (W)
+        gsl_matrix_free (W);
+      if (s)
+        gsl_vector_free (s);
+      if (work)
+        gsl_vector_free (work);
+
+      if (status == GSL_ENOMEM)
+        {
+          GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+        }
+
+      return status;
+    }
+}
+
+static int
+rsvd_dense_mult (const CBLAS_TRANSPOSE_t TransA, const gsl_matrix * X,
+                 gsl_matrix * Y, void * params)
+{
+  const gsl_matrix *A = (const gsl_matrix *) params;
+  return gsl_blas_dgemm (TransA, CblasNoTrans, 1.0, A, X, 0.0, Y);
+}
+
+/* replace Y by an orthonormal basis of its range */
+static int
+rsvd_orth (gsl_matrix * Y, gsl_matrix * T)
+{
+  int status = gsl_linalg_QR_decomp_r (Y, T);
+
+  if (status)
+    return status;
+
+  return gsl_linalg_QR_Q1_r (Y, T);
+}
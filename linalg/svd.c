@@ -29,6 +29,11 @@
 
 #include "svdstep.c"
 
+/* number of rows of U = L X formed at once by gsl_linalg_SV_decomp_mod */
+#define SVD_ROW_BLOCK 256
+
+static int svd_mult_rows (gsl_matrix * A, const gsl_matrix * X);
+
 /* Factorise a general M x N matrix A into,
  *
  *   A = U D V^T
@@ -276,6 +281,7 @@ gsl_linalg_SV_decomp_mod (gsl_matrix * A,
                           gsl_matrix * V, gsl_vector * S, gsl_vector * work)
 {
   size_t i, j;
+  int status;
 
   const size_t M = A->size1;
   const size_t N = A->size2;
@@ -382,28 +388,41 @@ gsl_linalg_SV_decomp_mod (gsl_matrix * A,
 
   /* unpack R into X V S */
 
-  gsl_linalg_SV_decomp (X, V, S, work);
+  status = gsl_linalg_SV_decomp (X, V, S, work);
+  if (status)
+    return status;
 
   /* Multiply L by X, to obtain U = L X, stored in U */
 
-  {
-    gsl_vector_view sum = gsl_vector_subvector (work, 0, N);
+  return svd_mult_rows (A, X);
+}
 
-    for (i = 0; i < M; i++)
-      {
-        gsl_vector_view L_i = gsl_matrix_row (A, i);
-        gsl_vector_set_zero (&sum.vector);
+/* A := A X for the M-by-N matrix A and N-by-N matrix X, in blocks of rows */
+static int
+svd_mult_rows (gsl_matrix * A, const gsl_matrix * X)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  const size_t nb = GSL_MIN (M, SVD_ROW_BLOCK);
+  gsl_matrix * B = gsl_matrix_alloc (nb, N);
+  size_t i;
 
-        for (j = 0; j < N; j++)
-          {
-            double Lij = gsl_vector_get (&L_i.vector, j);
-            gsl_vector_view X_j = gsl_matrix_row (X, j);
-            gsl_blas_daxpy (Lij, &X_j.vector, &sum.vector);
-          }
+  if (B == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for row block", GSL_ENOMEM);
+    }
 
-        gsl_vector_memcpy (&L_i.vector, &sum.vector);
-      }
-  }
+  for (i = 0; i < M; i += nb)
+    {
+      const size_t mb = GSL_MIN (nb, M - i);
+      gsl_matrix_view Ai = gsl_matrix_submatrix (A, i, 0, mb, N);
+      gsl_matrix_view Bi = gsl_matrix_submatrix (B, 0, 0, mb, N);
+
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, 1.0, &Ai.matrix, X, 0.0, &Bi.matrix);
+      gsl_matrix_memcpy (&Ai.matrix, &Bi.matrix);
+    }
+
+  gsl_matrix_free (B);
 
   return GSL_SUCCESS;
 }
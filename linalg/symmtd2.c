@@ -0,0 +1,528 @@
+/* linalg/symmtd2.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Two-stage reduction of a symmetric matrix to tridiagonal form,
+ *
+ * A = Q T Q^T,  Q = Q_1 Q_2
+ *
+ * Stage 1 reduces A to the band matrix B = Q_1^T A Q_1 of lower
+ * bandwidth nb. Each panel of nb columns below the band is factored
+ * with the recursive QR decomposition, Q_k = I - V T_k V^T, and the
+ * trailing matrix is updated with
+ *
+ *   A22 := A22 - V W^T - W V^T,  W = A22 V T_k - 1/2 V (T_k^T V^T A22 V T_k)
+ *
+ * so that nearly all of the work is done by Level 3 BLAS (dsymm,
+ * dsyr2k) instead of the matrix-vector products of
+ * gsl_linalg_symmtd_decomp.
+ *
+ * Stage 2 reduces B to tridiagonal form by bulge chasing. Column i is
+ * annihilated below the subdiagonal by a reflector of length nb, which
+ * creates a bulge below the band; the bulge is chased down the band by
+ * further reflectors of length nb, each applied to an nb-by-nb block
+ * only. This takes O(N^2 nb) operations on a copy of the band.
+ *
+ * See Bischof, Lang and Sun, "A framework for symmetric band
+ * reduction", ACM Trans. Math. Soft. 26 (2000) 581-601.
+ *
+ * On output:
+ *
+ * - the diagonal and first subdiagonal of A contain T, and the other
+ *   elements of the band are set to zero
+ *
+ * - the elements of the lower triangle below the band contain the
+ *   Householder vectors V of stage 1: the panel starting at column j
+ *   is stored in A(j+nb:N, j:j+w) as by gsl_linalg_QR_decomp_r, and
+ *   its triangular factor T_k in T(0:w, j:j+w), with w = min(nb, N-j-nb)
+ *
+ * - row i of the strict upper triangle contains the reflectors of
+ *   sweep i of stage 2: a reflector I - tau v v^T acting on rows
+ *   r,...,r+m-1 is stored in A(i,r:r+m), with tau in place of its
+ *   leading element v_0 = 1
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+
+/* element (p,q), p >= q, of the lower band stored by columns */
+#define BAND(p, q) band[(q) * ldb + (p) - (q)]
+
+static int symmtd2_band (gsl_matrix * A, gsl_matrix * T);
+static int symmtd2_chase (gsl_matrix * A, const size_t nb);
+static void symmtd2_sym_update (double * band, const size_t ldb, const size_t r,
+                                const size_t m, const double * u, const double tau,
+                                double * w);
+
+/*
+gsl_linalg_symmtd2_decomp()
+  Two-stage tridiagonal decomposition of a symmetric matrix
+
+Inputs: A - (input) symmetric matrix, only the lower triangle is referenced
+            (output) T, V and the reflectors of stage 2, see above
+        T - (output) nb-by-N matrix of block reflector factors; its
+            number of rows nb is the bandwidth of stage 1
+
+Return: success/error
+*/
+
+int
+gsl_linalg_symmtd2_decomp (gsl_matrix * A, gsl_matrix * T)
+{
+  const size_t N = A->size1;
+
+  if (N != A->size2)
+    {
+      GSL_ERROR ("symmetric tridiagonal decomposition requires square matrix",
+                 GSL_ENOTSQR);
+    }
+  else if (T->size2 != N)
+    {
+      GSL_ERROR ("T matrix must have N columns", GSL_EBADLEN);
+    }
+  else
+    {
+      int status;
+
+      status = symmtd2_band (A, T);
+      if (status)
+        return status;
+
+      status = symmtd2_chase (A, T->size1);
+
+      return status;
+    }
+}
+
+/*
+gsl_linalg_symmtd2_unpack()
+  Unpack the orthogonal matrix Q and the tridiagonal matrix T of a
+two-stage decomposition
+
+Inputs: A       - output of gsl_linalg_symmtd2_decomp
+        T       - block reflector factors
+        Q       - (output) N-by-N orthogonal matrix
+        diag    - (output) diagonal of T
+        subdiag - (output) subdiagonal of T
+
+Return: success/error
+*/
+
+int
+gsl_linalg_symmtd2_unpack (const gsl_matrix * A, const gsl_matrix * T, gsl_matrix * Q,
+                           gsl_vector * diag, gsl_vector * subdiag)
+{
+  const size_t N = A->size1;
+
+  if (Q->size1 != N || Q->size2 != N)
+    {
+      GSL_ERROR ("size of Q must match size of A", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_matrix *work = gsl_matrix_alloc (T->size1, N);
+      int status;
+
+      gsl_matrix_set_identity (Q);
+
+      status = gsl_linalg_symmtd2_Qmat (A, T, Q, work);
+
+      gsl_matrix_free (work);
+
+      if (status)
+        return status;
+
+      return gsl_linalg_symmtd_unpack_T (A, diag, subdiag);
+    }
+}
+
+/*
+gsl_linalg_symmtd2_Qmat()
+  Compute B := Q B, where Q is the orthogonal matrix of a two-stage
+tridiagonal decomposition
+
+Inputs: A    - output of gsl_linalg_symmtd2_decomp
+        T    - nb-by-N block reflector factors
+        B    - N-by-K matrix, replaced by Q B on output
+        work - nb-by-K workspace
+
+Return: success/error
+*/
+
+int
+gsl_linalg_symmtd2_Qmat (const gsl_matrix * A, const gsl_matrix * T, gsl_matrix * B,
+                         gsl_matrix * work)
+{
+  const size_t N = A->size1;
+  const size_t K = B->size2;
+  const size_t nb = T->size1;
+
+  if (N != A->size2)
+    {
+      GSL_ERROR ("matrix A must be square", GSL_ENOTSQR);
+    }
+  else if (T->size2 != N)
+    {
+      GSL_ERROR ("T matrix must have N columns", GSL_EBADLEN);
+    }
+  else if (B->size1 != N)
+    {
+      GSL_ERROR ("B matrix must have N rows", GSL_EBADLEN);
+    }
+  else if (work->size1 != nb || work->size2 != K)
+    {
+      GSL_ERROR ("workspace must be nb-by-K", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_vector_view wv = gsl_matrix_row (work, 0);
+      gsl_vector *u = gsl_vector_alloc (nb);
+      size_t i, j;
+
+      /* Q_2 B: the reflectors of stage 2 in reverse order */
+
+      for (i = (N > 2) ? N - 2 : 0; i-- > 0; )
+        {
+          size_t ns = 0, s;
+
+          /* number of reflectors of length at least 2 in sweep i */
+          while (nb >= 2 && i + 1 + ns * nb + 2 <= N)
+            ++ns;
+
+          for (s = ns; s-- > 0; )
+            {
+              const size_t r = i + 1 + s * nb;
+              const size_t m = GSL_MIN (nb, N - r);
+              const double tau = gsl_matrix_get (A, i, r);
+              gsl_vector_view uv = gsl_vector_subvector (u, 0, m);
+              gsl_matrix_view Bs = gsl_matrix_submatrix (B, r, 0, m, K);
+              size_t p;
+
+              if (tau == 0.0)
+                continue;
+
+              gsl_vector_set (u, 0, 1.0);
+              for (p = 1; p < m; ++p)
+                gsl_vector_set (u, p, gsl_matrix_get (A, i, r + p));
+
+              /* B(r:r+m,:) := (I - tau u u^T) B(r:r+m,:) */
+              gsl_blas_dgemv (CblasTrans, 1.0, &Bs.matrix, &uv.vector, 0.0, &wv.vector);
+              gsl_blas_dger (-tau, &uv.vector, &wv.vector, &Bs.matrix);
+            }
+        }
+
+      /* Q_1 B: the block reflectors of stage 1 in reverse order */
+
+      for (j = 0; j + nb + 1 < N; j += nb)
+        ;
+
+      while (j > 0)
+        {
+          size_t p0, h, w;
+
+          j -= nb;
+          p0 = j + nb;
+          h = N - p0;
+          w = GSL_MIN (nb, h);
+
+          {
+            gsl_matrix_const_view V1 = gsl_matrix_const_submatrix (A, p0, j, w, w);
+            gsl_matrix_const_view Tk = gsl_matrix_const_submatrix (T, 0, j, w, w);
+            gsl_matrix_view B1 = gsl_matrix_submatrix (B, p0, 0, w, K);
+            gsl_matrix_view W = gsl_matrix_submatrix (work, 0, 0, w, K);
+
+            /* W := V^T B */
+            gsl_matrix_memcpy (&W.matrix, &B1.matrix);
+            gsl_blas_dtrmm (CblasLeft, CblasLower, CblasTrans, CblasUnit, 1.0, &V1.matrix, &W.matrix);
+
+            if (h > w)
+              {
+                gsl_matrix_const_view V2 = gsl_matrix_const_submatrix (A, p0 + w, j, h - w, w);
+                gsl_matrix_view B2 = gsl_matrix_submatrix (B, p0 + w, 0, h - w, K);
+
+                gsl_blas_dgemm (CblasTrans, CblasNoTrans, 1.0, &V2.matrix, &B2.matrix, 1.0, &W.matrix);
+              }
+
+            /* W := T_k W */
+            gsl_blas_dtrmm (CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0, &Tk.matrix, &W.matrix);
+
+            /* B := B - V W */
+            if (h > w)
+              {
+                gsl_matrix_const_view V2 = gsl_matrix_const_submatrix (A, p0 + w, j, h - w, w);
+                gsl_matrix_view B2 = gsl_matrix_submatrix (B, p0 + w, 0, h - w, K);
+
+                gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, -1.0, &V2.matrix, &W.matrix, 1.0, &B2.matrix);
+              }
+
+            gsl_blas_dtrmm (CblasLeft, CblasLower, CblasNoTrans, CblasUnit, 1.0, &V1.matrix, &W.matrix);
+            gsl_matrix_sub (&B1.matrix, &W.matrix);
+          }
+        }
+
+      gsl_vector_free (u);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+symmtd2_band()
+  Stage 1: reduce A to a band matrix of lower bandwidth nb = T->size1
+with blocked Householder transformations
+*/
+
+static int
+symmtd2_band (gsl_matrix * A, gsl_matrix * T)
+{
+  const size_t N = A->size1;
+  const size_t nb = T->size1;
+  gsl_matrix *V, *W, *Y;
+  size_t j;
+
+  if (nb + 1 >= N)
+    return GSL_SUCCESS;          /* A is already a band matrix */
+
+  V = gsl_matrix_alloc (N - nb, nb);
+  W = gsl_matrix_alloc (N - nb, nb);
+  Y = gsl_matrix_alloc (nb, nb);
+
+  for (j = 0; j + nb + 1 < N; j += nb)
+    {
+      const size_t p0 = j + nb;
+      const size_t h = N - p0;
+      const size_t w = GSL_MIN (nb, h);
+      gsl_matrix_view P = gsl_matrix_submatrix (A, p0, j, h, w);
+      gsl_matrix_view Tk = gsl_matrix_submatrix (T, 0, j, w, w);
+      gsl_matrix_view A22 = gsl_matrix_submatrix (A, p0, p0, h, h);
+      gsl_matrix_view Vk = gsl_matrix_submatrix (V, 0, 0, h, w);
+      gsl_matrix_view Wk = gsl_matrix_submatrix (W, 0, 0, h, w);
+      gsl_matrix_view Yk = gsl_matrix_submatrix (Y, 0, 0, w, w);
+      size_t p, q;
+
+      gsl_linalg_QR_decomp_r (&P.matrix, &Tk.matrix);
+
+      if (w < nb)
+        {
+          /* the last columns of a short panel are inside the band, but
+             still transformed by Q_k^T */
+          gsl_matrix_view P2 = gsl_matrix_submatrix (A, p0, j + w, h, nb - w);
+          gsl_matrix_view W2 = gsl_matrix_submatrix (W, 0, 0, w, nb - w);
+
+          gsl_linalg_QR_QTmat_r (&P.matrix, &Tk.matrix, &P2.matrix, &W2.matrix);
+        }
+
+      /* V := unit lower trapezoidal part of the panel */
+      gsl_matrix_memcpy (&Vk.matrix, &P.matrix);
+
+      for (q = 0; q < w; ++q)
+        {
+          for (p = 0; p < q; ++p)
+            gsl_matrix_set (&Vk.matrix, p, q, 0.0);
+
+          gsl_matrix_set (&Vk.matrix, q, q, 1.0);
+        }
+
+      /* W := A22 V T_k */
+      gsl_blas_dsymm (CblasLeft, CblasLower, 1.0, &A22.matrix, &Vk.matrix, 0.0, &Wk.matrix);
+      gsl_blas_dtrmm (CblasRight, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0, &Tk.matrix, &Wk.matrix);
+
+      /* W := W - 1/2 V (T_k^T V^T W) */
+      gsl_blas_dgemm (CblasTrans, CblasNoTrans, 1.0, &Vk.matrix, &Wk.matrix, 0.0, &Yk.matrix);
+      gsl_blas_dtrmm (CblasLeft, CblasUpper, CblasTrans, CblasNonUnit, 1.0, &Tk.matrix, &Yk.matrix);
+      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, -0.5, &Vk.matrix, &Yk.matrix, 1.0, &Wk.matrix);
+
+      /* A22 := A22 - V W^T - W V^T */
+      gsl_blas_dsyr2k (CblasLower, CblasNoTrans, -1.0, &Vk.matrix, &Wk.matrix, 1.0, &A22.matrix);
+    }
+
+  gsl_matrix_free (V);
+  gsl_matrix_free (W);
+  gsl_matrix_free (Y);
+
+  return GSL_SUCCESS;
+}
+
+/*
+symmtd2_chase()
+  Stage 2: reduce the band matrix in the lower triangle of A, of lower
+bandwidth nb, to tridiagonal form. The band is copied to a work array
+wide enough to hold the bulges.
+*/
+
+static int
+symmtd2_chase (gsl_matrix * A, const size_t nb)
+{
+  const size_t N = A->size1;
+  const size_t ldb = 2 * nb + 1;
+  double *band = calloc (N * ldb, sizeof (double));
+  double *u = malloc (2 * nb * sizeof (double));
+  double *w = u + nb;
+  size_t i, p, q;
+
+  if (band == NULL || u == NULL)
+    {
+      free (band);
+      free (u);
+      GSL_ERROR ("failed to allocate space for band", GSL_ENOMEM);
+    }
+
+  for (q = 0; q < N; ++q)
+    {
+      for (p = q; p < GSL_MIN (N, q + nb + 1); ++p)
+        BAND (p, q) = gsl_matrix_get (A, p, q);
+    }
+
+  for (i = 0; i + 2 < N; ++i)
+    {
+      size_t c = i;              /* column annihilated by the reflector */
+      size_t c1 = i + 1;         /* end of the other columns of the bulge */
+      size_t r = i + 1;          /* first row of the reflector */
+      size_t m = GSL_MIN (nb, N - r);
+
+      while (m >= 2)
+        {
+          double *x = &BAND (r, c);
+          gsl_vector_view xv = gsl_vector_view_array (x, m);
+          const double tau = gsl_linalg_householder_transform (&xv.vector);
+          size_t e = GSL_MIN (N, r + m + nb);
+
+          gsl_matrix_set (A, i, r, tau);
+          u[0] = 1.0;
+
+          for (p = 1; p < m; ++p)
+            {
+              u[p] = x[p];
+              gsl_matrix_set (A, i, r + p, x[p]);
+              x[p] = 0.0;
+            }
+
+          if (tau != 0.0)
+            {
+              /* rest of the bulge from the left */
+              for (q = c + 1; q < c1; ++q)
+                {
+                  double *col = &BAND (r, q);
+                  double s = 0.0;
+
+                  for (p = 0; p < m; ++p)
+                    s += u[p] * col[p];
+
+                  s *= tau;
+
+                  for (p = 0; p < m; ++p)
+                    col[p] -= s * u[p];
+                }
+
+              /* diagonal block from both sides */
+              symmtd2_sym_update (band, ldb, r, m, u, tau, w);
+
+              /* block below from the right, creating the next bulge */
+              for (q = r + m; q < e; ++q)
+                {
+                  double s = 0.0;
+
+                  for (p = 0; p < m; ++p)
+                    s += BAND (q, r + p) * u[p];
+
+                  s *= tau;
+
+                  for (p = 0; p < m; ++p)
+                    BAND (q, r + p) -= s * u[p];
+                }
+            }
+
+          if (r + m >= N)
+            break;
+
+          c = r;
+          c1 = r + m;
+          r += m;
+          m = e - r;
+        }
+    }
+
+  for (q = 0; q < N; ++q)
+    {
+      gsl_matrix_set (A, q, q, BAND (q, q));
+
+      for (p = q + 1; p < GSL_MIN (N, q + nb + 1); ++p)
+        gsl_matrix_set (A, p, q, (p == q + 1) ? BAND (p, q) : 0.0);
+    }
+
+  free (band);
+  free (u);
+
+  return GSL_SUCCESS;
+}
+
+/* S := H S H for the symmetric m-by-m block S = B(r:r+m,r:r+m) of the
+   band and H = I - tau u u^T, with m-vector workspace w */
+static void
+symmtd2_sym_update (double * band, const size_t ldb, const size_t r,
+                    const size_t m, const double * u, const double tau,
+                    double * w)
+{
+  double alpha = 0.0;
+  size_t p, q;
+
+  /* w := tau S u */
+  for (p = 0; p < m; ++p)
+    w[p] = 0.0;
+
+  for (q = 0; q < m; ++q)
+    {
+      const double *col = &BAND (r + q, r + q);
+
+      w[q] += col[0] * u[q];
+
+      for (p = q + 1; p < m; ++p)
+        {
+          w[p] += col[p - q] * u[q];
+          w[q] += col[p - q] * u[p];
+        }
+    }
+
+  for (p = 0; p < m; ++p)
+    {
+      w[p] *= tau;
+      alpha += w[p] * u[p];
+    }
+
+  /* w := w - 1/2 tau (w^T u) u */
+  alpha *= -0.5 * tau;
+
+  for (p = 0; p < m; ++p)
+    w[p] += alpha * u[p];
+
+  /* S := S - u w^T - w u^T */
+  for (q = 0; q < m; ++q)
+    {
+      double *col = &BAND (r + q, r + q);
+
+      for (p = q; p < m; ++p)
+        col[p - q] -= u[p] * w[q] + w[p] * u[q];
+    }
+}
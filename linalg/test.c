@@ -90,6 +90,7 @@ int test_TDN_cyc_solve_dim(unsigned long dim, double d, double a, double b, cons
 int test_TDN_cyc_solve(void);
 int test_bidiag_decomp_dim(const gsl_matrix * m, double eps);
 int test_bidiag_decomp(void);
+int test_bidiag_decomp_random(gsl_rng * r);
 
 int 
 check (double x, double actual, double eps)
@@ -387,6 +388,7 @@ double vander12_solution[] = {0.0, 0.0, 0.0, 0.0,
 gsl_matrix * moler10;
 
 #include "test_common.c"
+#include "test_batch.c"
 #include "test_cholesky.c"
 #include "test_choleskyc.c"
 #include "test_cod.c"
@@ -395,7 +397,9 @@ gsl_matrix * moler10;
 #include "test_luc.c"
 #include "test_lu_band.c"
 #include "test_lq.c"
+#include "test_tiled.c"
 #include "test_tri.c"
+#include "test_tune.c"
 #include "test_ql.c"
 #include "test_qr.c"
 #include "test_qrc.c"
@@ -3045,6 +3049,74 @@ int test_bidiag_decomp(void)
   return s;
 }
 
+/* large random matrices, reduced by the blocked algorithm */
+int
+test_bidiag_decomp_random(gsl_rng * r)
+{
+  int s = 0;
+  const size_t dims[][2] = { { 129, 129 }, { 200, 200 }, { 300, 170 }, { 500, 140 } };
+  size_t k, i, j;
+
+  for (k = 0; k < sizeof(dims) / sizeof(dims[0]); ++k)
+    {
+      const size_t M = dims[k][0];
+      const size_t N = dims[k][1];
+      gsl_matrix * m = gsl_matrix_alloc(M, N);
+      gsl_matrix * A = gsl_matrix_alloc(M, N);
+      gsl_matrix * UB = gsl_matrix_alloc(M, N);
+      gsl_matrix * a = gsl_matrix_alloc(M, N);
+      gsl_matrix * u = gsl_matrix_alloc(M, N);
+      gsl_matrix * v = gsl_matrix_alloc(N, N);
+      gsl_matrix * b = gsl_matrix_calloc(N, N);
+      gsl_vector * tau1 = gsl_vector_alloc(N);
+      gsl_vector * tau2 = gsl_vector_alloc(N - 1);
+      gsl_vector * d = gsl_vector_alloc(N);
+      gsl_vector * sd = gsl_vector_alloc(N - 1);
+      const double eps = 1.0e3 * M * GSL_DBL_EPSILON;
+
+      create_random_matrix(m, r);
+      gsl_matrix_memcpy(A, m);
+
+      s += gsl_linalg_bidiag_decomp(A, tau1, tau2);
+      s += gsl_linalg_bidiag_unpack(A, tau1, u, tau2, v, d, sd);
+
+      for (i = 0; i < N; i++)
+        gsl_matrix_set(b, i, i, gsl_vector_get(d, i));
+      for (i = 0; i < N - 1; i++)
+        gsl_matrix_set(b, i, i + 1, gsl_vector_get(sd, i));
+
+      /* A = U B V^T */
+      gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, u, b, 0.0, UB);
+      gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, UB, v, 0.0, a);
+
+      for (i = 0; i < M; i++)
+        {
+          for (j = 0; j < N; j++)
+            {
+              double aij = gsl_matrix_get(a, i, j);
+              double mij = gsl_matrix_get(m, i, j);
+
+              gsl_test_abs(aij, mij, eps, "bidiag_decomp random (%3lu,%3lu)[%lu,%lu]",
+                           M, N, i, j);
+            }
+        }
+
+      gsl_matrix_free(m);
+      gsl_matrix_free(A);
+      gsl_matrix_free(UB);
+      gsl_matrix_free(a);
+      gsl_matrix_free(u);
+      gsl_matrix_free(v);
+      gsl_matrix_free(b);
+      gsl_vector_free(tau1);
+      gsl_vector_free(tau2);
+      gsl_vector_free(d);
+      gsl_vector_free(sd);
+    }
+
+  return s;
+}
+
 int
 test_tri_invert2(CBLAS_UPLO_t Uplo, CBLAS_DIAG_t Diag, gsl_rng * r, const double tol)
 {
@@ -3272,6 +3344,7 @@ main(void)
   gsl_test(test_SV_decomp_mod(),         "Singular Value Decomposition (Mod)");
   gsl_test(test_SV_solve(),              "SVD Solve");
   gsl_test(test_SV_lssolve(r),           "SVD LS Solve");
+  gsl_test(test_SV_decomp_rand(r),       "Randomized SVD");
 
   gsl_test(test_cholesky_decomp_unit(),  "Cholesky Decomposition [unit triangular]");
   gsl_test(test_cholesky_solve(),        "Cholesky Solve");
@@ -3301,6 +3374,7 @@ main(void)
   gsl_test(test_ldlt_band_solve(r),      "Banded LDLT Solve");
 
   gsl_test(test_symmtd_decomp(r),        "Symmetric Tridiagonal Decomposition");
+  gsl_test(test_symmtd2_decomp(r),       "Symmetric Tridiagonal Decomposition (two-stage)");
   gsl_test(test_hermtd_decomp(r),        "Hermitian Tridiagonal Decomposition");
 
   gsl_test(test_HH_solve(),              "Householder solve");
@@ -3309,6 +3383,13 @@ main(void)
   gsl_test(test_TDN_solve(),             "Tridiagonal nonsymmetric solve");
   gsl_test(test_TDN_cyc_solve(),         "Tridiagonal nonsymmetric cyclic solve");
 
+  gsl_test(test_batch(r),                "Batched LU, Cholesky and QR decompositions");
+  gsl_test(test_tune(r),                 "Tuning of recursive algorithms");
+  gsl_test(test_tiled(r),                "Tiled LU, Cholesky and QR decompositions");
+
+  gsl_test(test_bidiag_decomp_random(r), "Bidiagonal Decomposition (blocked)");
+  gsl_test(test_SV_decomp_tall(r),       "Singular Value Decomposition (tall)");
+
   gsl_matrix_free(m11);
   gsl_matrix_free(m35);
   gsl_matrix_free(m51);
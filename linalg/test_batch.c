@@ -0,0 +1,372 @@
+/* linalg/test_batch.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_ieee_utils.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_permutation.h>
+
+/* number of matrices in each test batch; not a multiple of the chunk
+   size, so that a partial chunk is processed */
+#define TEST_NBATCH 301
+
+/* copy matrix k of a strided array into m */
+static void
+test_batch_get(const double * mats, const size_t k, gsl_matrix * m)
+{
+  const size_t M = m->size1;
+  const size_t N = m->size2;
+  size_t i, j;
+
+  for (i = 0; i < M; ++i)
+    {
+      for (j = 0; j < N; ++j)
+        gsl_matrix_set(m, i, j, mats[k * M * N + i * N + j]);
+    }
+}
+
+/* compare the factors and solutions computed for an interleaved batch
+   with those of the unbatched routines applied to each matrix */
+
+static int
+test_LU_batch_eps(const size_t N, gsl_rng * r, const double eps, const char * desc)
+{
+  int s = 0;
+  const size_t nbatch = TEST_NBATCH;
+  double * mats = malloc(nbatch * N * N * sizeof(double));
+  double * A = malloc(nbatch * N * N * sizeof(double));
+  double * LU = malloc(nbatch * N * N * sizeof(double));
+  double * x = malloc(nbatch * N * sizeof(double));
+  double * rhs = malloc(nbatch * N * sizeof(double));
+  size_t * p = malloc(nbatch * N * sizeof(size_t));
+  int * signum = malloc(nbatch * sizeof(int));
+  gsl_matrix * m = gsl_matrix_alloc(N, N);
+  gsl_vector * b = gsl_vector_alloc(N);
+  gsl_permutation * perm = gsl_permutation_alloc(N);
+  size_t i, j, k;
+  double xmax;
+
+  for (k = 0; k < nbatch; ++k)
+    {
+      gsl_matrix_view v = gsl_matrix_view_array(mats + k * N * N, N, N);
+      create_random_matrix(&v.matrix, r);
+
+      for (i = 0; i < N; ++i)
+        rhs[i * nbatch + k] = x[i * nbatch + k] = gsl_rng_uniform(r);
+    }
+
+  gsl_linalg_batch_pack(N, N, nbatch, mats, N * N, A);
+  gsl_linalg_LU_decomp_batch(N, nbatch, A, p, signum);
+  gsl_linalg_batch_unpack(N, N, nbatch, A, LU, N * N);
+  gsl_linalg_LU_svx_batch(N, nbatch, A, p, x);
+
+  for (k = 0; k < nbatch; ++k)
+    {
+      int sgn;
+
+      test_batch_get(mats, k, m);
+      for (i = 0; i < N; ++i)
+        gsl_vector_set(b, i, rhs[i * nbatch + k]);
+
+      gsl_linalg_LU_decomp(m, perm, &sgn);
+      gsl_linalg_LU_svx(m, perm, b);
+      xmax = GSL_MAX(1.0, gsl_vector_max(b));
+      xmax = GSL_MAX(xmax, -gsl_vector_min(b));
+
+      gsl_test_int(signum[k], sgn, "%s: N=%lu signum[%lu]", desc, N, k);
+
+      for (i = 0; i < N; ++i)
+        {
+          gsl_test_int((int) p[k * N + i], (int) gsl_permutation_get(perm, i),
+                       "%s: N=%lu p[%lu](%lu)", desc, N, k, i);
+
+          for (j = 0; j < N; ++j)
+            {
+              gsl_test_abs(LU[k * N * N + i * N + j], gsl_matrix_get(m, i, j), eps,
+                           "%s: N=%lu LU[%lu](%lu,%lu)", desc, N, k, i, j);
+            }
+
+          gsl_test_abs(x[i * nbatch + k], gsl_vector_get(b, i), eps * xmax,
+                       "%s: N=%lu x[%lu](%lu)", desc, N, k, i);
+        }
+    }
+
+  free(mats);
+  free(A);
+  free(LU);
+  free(x);
+  free(rhs);
+  free(p);
+  free(signum);
+  gsl_matrix_free(m);
+  gsl_vector_free(b);
+  gsl_permutation_free(perm);
+
+  return s;
+}
+
+static int
+test_cholesky_batch_eps(const size_t N, gsl_rng * r, const double eps, const char * desc)
+{
+  int s = 0;
+  const size_t nbatch = TEST_NBATCH;
+  double * mats = malloc(nbatch * N * N * sizeof(double));
+  double * A = malloc(nbatch * N * N * sizeof(double));
+  double * LLT = malloc(nbatch * N * N * sizeof(double));
+  double * x = malloc(nbatch * N * sizeof(double));
+  double * rhs = malloc(nbatch * N * sizeof(double));
+  int * info = malloc(nbatch * sizeof(int));
+  gsl_matrix * m = gsl_matrix_alloc(N, N);
+  gsl_vector * b = gsl_vector_alloc(N);
+  size_t i, j, k;
+  double xmax;
+  int status;
+
+  for (k = 0; k < nbatch; ++k)
+    {
+      gsl_matrix_view v = gsl_matrix_view_array(mats + k * N * N, N, N);
+      create_posdef_matrix(&v.matrix, r);
+
+      for (i = 0; i < N; ++i)
+        rhs[i * nbatch + k] = x[i * nbatch + k] = gsl_rng_uniform(r);
+    }
+
+  gsl_linalg_batch_pack(N, N, nbatch, mats, N * N, A);
+  status = gsl_linalg_cholesky_decomp1_batch(N, nbatch, A, info);
+  gsl_test_int(status, GSL_SUCCESS, "%s: N=%lu status", desc, N);
+  gsl_linalg_batch_unpack(N, N, nbatch, A, LLT, N * N);
+  gsl_linalg_cholesky_svx_batch(N, nbatch, A, x);
+
+  for (k = 0; k < nbatch; ++k)
+    {
+      test_batch_get(mats, k, m);
+      for (i = 0; i < N; ++i)
+        gsl_vector_set(b, i, rhs[i * nbatch + k]);
+
+      gsl_linalg_cholesky_decomp1(m);
+      gsl_linalg_cholesky_svx(m, b);
+      xmax = GSL_MAX(1.0, gsl_vector_max(b));
+      xmax = GSL_MAX(xmax, -gsl_vector_min(b));
+
+      gsl_test_int(info[k], 0, "%s: N=%lu info[%lu]", desc, N, k);
+
+      for (i = 0; i < N; ++i)
+        {
+          for (j = 0; j < N; ++j)
+            {
+              gsl_test_abs(LLT[k * N * N + i * N + j], gsl_matrix_get(m, i, j), eps,
+                           "%s: N=%lu LLT[%lu](%lu,%lu)", desc, N, k, i, j);
+            }
+
+          gsl_test_abs(x[i * nbatch + k], gsl_vector_get(b, i), eps * xmax,
+                       "%s: N=%lu x[%lu](%lu)", desc, N, k, i);
+        }
+    }
+
+  /* make one matrix indefinite: only it is flagged */
+  if (N > 1)
+    {
+      gsl_linalg_batch_pack(N, N, nbatch, mats, N * N, A);
+      A[(N * N - 1) * nbatch + 7] = -1.0;
+
+      status = gsl_linalg_cholesky_decomp1_batch(N, nbatch, A, info);
+      gsl_test_int(status, GSL_EDOM, "%s: N=%lu indefinite status", desc, N);
+
+      for (k = 0; k < nbatch; ++k)
+        {
+          gsl_test_int(info[k], (k == 7) ? (int) N : 0,
+                       "%s: N=%lu indefinite info[%lu]", desc, N, k);
+        }
+    }
+
+  free(mats);
+  free(A);
+  free(LLT);
+  free(x);
+  free(rhs);
+  free(info);
+  gsl_matrix_free(m);
+  gsl_vector_free(b);
+
+  return s;
+}
+
+static int
+test_QR_batch_eps(const size_t M, const size_t N, gsl_rng * r, const double eps, const char * desc)
+{
+  int s = 0;
+  const size_t nbatch = TEST_NBATCH;
+  double * mats = malloc(nbatch * M * N * sizeof(double));
+  double * A = malloc(nbatch * M * N * sizeof(double));
+  double * QR = malloc(nbatch * M * N * sizeof(double));
+  double * tau = malloc(nbatch * N * sizeof(double));
+  double * x = malloc(nbatch * M * sizeof(double));
+  double * xs = malloc(nbatch * N * sizeof(double));
+  gsl_matrix * m = gsl_matrix_alloc(M, N);
+  gsl_vector * t = gsl_vector_alloc(N);
+  gsl_vector * b = gsl_vector_alloc(M);
+  gsl_vector * sol = gsl_vector_alloc(N);
+  gsl_vector * res = gsl_vector_alloc(M);
+  size_t i, j, k;
+
+  for (k = 0; k < nbatch; ++k)
+    {
+      gsl_matrix_view v = gsl_matrix_view_array(mats + k * M * N, M, N);
+      create_random_matrix(&v.matrix, r);
+
+      for (i = 0; i < M; ++i)
+        x[i * nbatch + k] = gsl_rng_uniform(r);
+    }
+
+  gsl_linalg_batch_pack(M, N, nbatch, mats, M * N, A);
+  gsl_linalg_QR_decomp_batch(M, N, nbatch, A, tau);
+  gsl_linalg_batch_unpack(M, N, nbatch, A, QR, M * N);
+
+  for (k = 0; k < nbatch; ++k)
+    {
+      test_batch_get(mats, k, m);
+      gsl_linalg_QR_decomp(m, t);
+
+      for (i = 0; i < M; ++i)
+        {
+          for (j = 0; j < N; ++j)
+            {
+              gsl_test_abs(QR[k * M * N + i * N + j], gsl_matrix_get(m, i, j), eps,
+                           "%s: (%lu,%lu) QR[%lu](%lu,%lu)", desc, M, N, k, i, j);
+            }
+        }
+
+      for (j = 0; j < GSL_MIN(M, N); ++j)
+        {
+          gsl_test_abs(tau[j * nbatch + k], gsl_vector_get(t, j), eps,
+                       "%s: (%lu,%lu) tau[%lu](%lu)", desc, M, N, k, j);
+        }
+
+      if (M >= N)
+        {
+          for (i = 0; i < M; ++i)
+            gsl_vector_set(b, i, x[i * nbatch + k]);
+
+          gsl_linalg_QR_lssolve(m, t, b, sol, res);
+
+          for (i = 0; i < N; ++i)
+            xs[k * N + i] = gsl_vector_get(sol, i);
+        }
+    }
+
+  if (M >= N)
+    {
+      gsl_linalg_QR_lssvx_batch(M, N, nbatch, A, tau, x);
+
+      for (k = 0; k < nbatch; ++k)
+        {
+          /* errors are relative to the largest component */
+          double xmax = 1.0;
+
+          for (i = 0; i < N; ++i)
+            xmax = GSL_MAX(xmax, fabs(xs[k * N + i]));
+
+          for (i = 0; i < N; ++i)
+            {
+              gsl_test_abs(x[i * nbatch + k], xs[k * N + i], eps * xmax,
+                           "%s: (%lu,%lu) x[%lu](%lu)", desc, M, N, k, i);
+            }
+        }
+    }
+
+  free(mats);
+  free(A);
+  free(QR);
+  free(tau);
+  free(x);
+  free(xs);
+  gsl_matrix_free(m);
+  gsl_vector_free(t);
+  gsl_vector_free(b);
+  gsl_vector_free(sol);
+  gsl_vector_free(res);
+
+  return s;
+}
+
+/* results with several threads must equal the single threaded ones */
+static int
+test_batch_threads(const size_t N, gsl_rng * r)
+{
+  int s = 0;
+  const size_t nbatch = 4 * TEST_NBATCH;
+  double * A1 = malloc(nbatch * N * N * sizeof(double));
+  double * A2 = malloc(nbatch * N * N * sizeof(double));
+  double * tau1 = malloc(nbatch * N * sizeof(double));
+  double * tau2 = malloc(nbatch * N * sizeof(double));
+  size_t i;
+
+  for (i = 0; i < nbatch * N * N; ++i)
+    A1[i] = A2[i] = gsl_rng_uniform(r);
+
+  gsl_linalg_QR_decomp_batch(N, N, nbatch, A1, tau1);
+
+  gsl_set_num_threads(3);
+  gsl_test_int((int) gsl_get_num_threads(), 3, "batch threads");
+  gsl_linalg_QR_decomp_batch(N, N, nbatch, A2, tau2);
+  gsl_test_int(gsl_linalg_QR_decomp_batch(N, N, 0, A2, tau2), GSL_SUCCESS,
+               "empty batch threads");
+  gsl_set_num_threads(1);
+
+  for (i = 0; i < nbatch * N * N; ++i)
+    s |= (A1[i] != A2[i]);
+
+  for (i = 0; i < nbatch * N; ++i)
+    s |= (tau1[i] != tau2[i]);
+
+  free(A1);
+  free(A2);
+  free(tau1);
+  free(tau2);
+
+  return s;
+}
+
+static int
+test_batch(gsl_rng * r)
+{
+  int s = 0;
+  const size_t sizes[] = { 1, 3, 8, 17 };
+  size_t n;
+
+  for (n = 0; n < sizeof(sizes) / sizeof(sizes[0]); ++n)
+    {
+      const size_t N = sizes[n];
+
+      s += test_LU_batch_eps(N, r, 1.0e5 * N * GSL_DBL_EPSILON, "LU_decomp_batch");
+      s += test_cholesky_batch_eps(N, r, 1.0e2 * N * GSL_DBL_EPSILON, "cholesky_decomp1_batch");
+      s += test_QR_batch_eps(N, N, r, 1.0e3 * N * GSL_DBL_EPSILON, "QR_decomp_batch");
+      s += test_QR_batch_eps(N + 3, N, r, 1.0e3 * N * GSL_DBL_EPSILON, "QR_decomp_batch");
+      s += test_QR_batch_eps(N, N + 2, r, 1.0e3 * N * GSL_DBL_EPSILON, "QR_decomp_batch");
+    }
+
+  s += test_batch_threads(8, r);
+
+  return s;
+}
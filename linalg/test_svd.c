@@ -30,6 +30,10 @@
 
 static int test_SV_lssolve_eps(const double lambda, const gsl_matrix * A, const gsl_vector * b, const double eps, const char *desc);
 static int test_SV_lssolve(gsl_rng * r);
+static int test_SV_decomp_rand_eps(const size_t K, const size_t p, const size_t q, const gsl_matrix * A,
+                                   const gsl_vector * sigma, const double eps, const char *desc, gsl_rng * r);
+static int test_SV_decomp_rand(gsl_rng * r);
+static int test_SV_decomp_tall(gsl_rng * r);
 
 /* solve: min ||b - A x||^2 + lambda^2 ||x||^2 */
 static int
@@ -151,3 +155,240 @@ test_SV_lssolve(gsl_rng * r)
 
   return s;
 }
+
+/* A = Q1 diag(sigma) Q2^T with random orthonormal Q1, Q2 */
+static void
+create_sv_matrix(const gsl_vector * sigma, gsl_matrix * A, gsl_rng * r)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  const size_t P = sigma->size;
+  gsl_matrix *Q1 = gsl_matrix_alloc(M, P);
+  gsl_matrix *Q2 = gsl_matrix_alloc(N, P);
+  gsl_matrix *T = gsl_matrix_alloc(P, P);
+  size_t j;
+
+  create_random_matrix(Q1, r);
+  gsl_linalg_QR_decomp_r(Q1, T);
+  gsl_linalg_QR_Q1_r(Q1, T);
+
+  create_random_matrix(Q2, r);
+  gsl_linalg_QR_decomp_r(Q2, T);
+  gsl_linalg_QR_Q1_r(Q2, T);
+
+  for (j = 0; j < P; ++j)
+    {
+      gsl_vector_view c = gsl_matrix_column(Q1, j);
+      gsl_vector_scale(&c.vector, gsl_vector_get(sigma, j));
+    }
+
+  gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, Q1, Q2, 0.0, A);
+
+  gsl_matrix_free(Q1);
+  gsl_matrix_free(Q2);
+  gsl_matrix_free(T);
+}
+
+/* Y = op(A) X through the operator interface */
+static int
+test_SV_mult(const CBLAS_TRANSPOSE_t TransA, const gsl_matrix * X, gsl_matrix * Y, void * params)
+{
+  const gsl_matrix *A = (const gsl_matrix *) params;
+  return gsl_blas_dgemm(TransA, CblasNoTrans, 1.0, A, X, 0.0, Y);
+}
+
+static int
+test_SV_decomp_rand_eps(const size_t K, const size_t p, const size_t q, const gsl_matrix * A,
+                        const gsl_vector * sigma, const double eps, const char *desc, gsl_rng * r)
+{
+  int s = 0;
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  gsl_matrix *U = gsl_matrix_alloc(M, K);
+  gsl_matrix *V = gsl_matrix_alloc(N, K);
+  gsl_vector *S = gsl_vector_alloc(K);
+  gsl_matrix *U2 = gsl_matrix_alloc(M, K);
+  gsl_matrix *V2 = gsl_matrix_alloc(N, K);
+  gsl_vector *S2 = gsl_vector_alloc(K);
+  gsl_matrix *UTU = gsl_matrix_alloc(K, K);
+  gsl_matrix *VTV = gsl_matrix_alloc(K, K);
+  gsl_matrix *AV = gsl_matrix_alloc(M, K);
+  gsl_rng *r2 = gsl_rng_clone(r);
+  const double s0 = gsl_vector_get(sigma, 0);
+  gsl_linalg_SV_op op;
+  size_t i, j;
+
+  s += gsl_linalg_SV_decomp_rand(A, U, S, V, p, q, r);
+
+  op.size1 = M;
+  op.size2 = N;
+  op.mult = test_SV_mult;
+  op.params = (void *) A;
+  s += gsl_linalg_SV_decomp_rand_op(&op, U2, S2, V2, p, q, r2);
+
+  /* U^T U = V^T V = I */
+  gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, U, U, 0.0, UTU);
+  gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, V, V, 0.0, VTV);
+
+  /* A V = U S */
+  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, A, V, 0.0, AV);
+
+  for (j = 0; j < K; ++j)
+    {
+      double sj = gsl_vector_get(S, j);
+
+      gsl_test_abs(sj, gsl_vector_get(sigma, j), eps * s0,
+                   "%s (%3lu,%3lu)[%lu] K=%lu: singular value", desc, M, N, j, K);
+
+      gsl_test_abs(gsl_vector_get(S2, j), sj, 0.0,
+                   "%s (%3lu,%3lu)[%lu] K=%lu: operator", desc, M, N, j, K);
+
+      for (i = 0; i < K; ++i)
+        {
+          double delta = (i == j) ? 1.0 : 0.0;
+
+          gsl_test_abs(gsl_matrix_get(UTU, i, j), delta, 100.0 * GSL_DBL_EPSILON,
+                       "%s (%3lu,%3lu)[%lu,%lu] K=%lu: U orthonormal", desc, M, N, i, j, K);
+          gsl_test_abs(gsl_matrix_get(VTV, i, j), delta, 100.0 * GSL_DBL_EPSILON,
+                       "%s (%3lu,%3lu)[%lu,%lu] K=%lu: V orthonormal", desc, M, N, i, j, K);
+        }
+
+      for (i = 0; i < M; ++i)
+        {
+          gsl_test_abs(gsl_matrix_get(AV, i, j), sj * gsl_matrix_get(U, i, j), eps * s0,
+                       "%s (%3lu,%3lu)[%lu,%lu] K=%lu: A V = U S", desc, M, N, i, j, K);
+        }
+    }
+
+  gsl_matrix_free(U);
+  gsl_matrix_free(V);
+  gsl_vector_free(S);
+  gsl_matrix_free(U2);
+  gsl_matrix_free(V2);
+  gsl_vector_free(S2);
+  gsl_matrix_free(UTU);
+  gsl_matrix_free(VTV);
+  gsl_matrix_free(AV);
+  gsl_rng_free(r2);
+
+  return s;
+}
+
+static int
+test_SV_decomp_rand(gsl_rng * r)
+{
+  int s = 0;
+  const size_t dims[][2] = { { 200, 60 }, { 60, 200 }, { 30, 30 } };
+  size_t k, j;
+
+  for (k = 0; k < sizeof(dims) / sizeof(dims[0]); ++k)
+    {
+      const size_t M = dims[k][0];
+      const size_t N = dims[k][1];
+      const size_t P = GSL_MIN(M, N);
+      gsl_matrix *A = gsl_matrix_alloc(M, N);
+      gsl_vector *sigma = gsl_vector_calloc(P);
+
+      /* exact rank 8 */
+      for (j = 0; j < 8; ++j)
+        gsl_vector_set(sigma, j, 8.0 - j);
+
+      create_sv_matrix(sigma, A, r);
+      s += test_SV_decomp_rand_eps(8, 4, 0, A, sigma, 1.0e3 * GSL_DBL_EPSILON, "SV_decomp_rand rank 8", r);
+      s += test_SV_decomp_rand_eps(5, 10, 0, A, sigma, 1.0e3 * GSL_DBL_EPSILON, "SV_decomp_rand rank 8", r);
+
+      /* fast decay */
+      for (j = 0; j < P; ++j)
+        gsl_vector_set(sigma, j, pow(0.25, (double) j));
+
+      create_sv_matrix(sigma, A, r);
+      s += test_SV_decomp_rand_eps(6, 10, 1, A, sigma, 1.0e-10, "SV_decomp_rand decay", r);
+
+      /* slow decay, needs power iterations */
+      for (j = 0; j < P; ++j)
+        gsl_vector_set(sigma, j, 1.0 / (1.0 + j));
+
+      create_sv_matrix(sigma, A, r);
+      s += test_SV_decomp_rand_eps(3, 10, 4, A, sigma, 1.0e-2, "SV_decomp_rand slow decay", r);
+
+      gsl_matrix_free(A);
+      gsl_vector_free(sigma);
+    }
+
+  return s;
+}
+
+/* M >> N, with gsl_linalg_SV_decomp and with gsl_linalg_SV_decomp_mod,
+   which computes the SVD of R in A = Q R */
+static int
+test_SV_decomp_tall(gsl_rng * r)
+{
+  int s = 0;
+  const size_t dims[][2] = { { 50, 2 }, { 300, 20 }, { 1000, 150 }, { 160, 100 } };
+  const char *names[] = { "SV_decomp", "SV_decomp_mod" };
+  size_t k, i, j;
+  int mod;
+
+  for (k = 0; k < sizeof(dims) / sizeof(dims[0]); ++k)
+    {
+      const size_t M = dims[k][0];
+      const size_t N = dims[k][1];
+      gsl_matrix *A = gsl_matrix_alloc(M, N);
+      gsl_matrix *U = gsl_matrix_alloc(M, N);
+      gsl_matrix *V = gsl_matrix_alloc(N, N);
+      gsl_matrix *X = gsl_matrix_alloc(N, N);
+      gsl_matrix *AV = gsl_matrix_alloc(M, N);
+      gsl_matrix *UTU = gsl_matrix_alloc(N, N);
+      gsl_vector *S = gsl_vector_alloc(N);
+      gsl_vector *work = gsl_vector_alloc(N);
+      const double eps = 1.0e2 * M * GSL_DBL_EPSILON;
+
+      create_random_matrix(A, r);
+
+      for (mod = 0; mod < 2; ++mod)
+        {
+          gsl_matrix_memcpy(U, A);
+
+          if (mod)
+            s += gsl_linalg_SV_decomp_mod(U, X, V, S, work);
+          else
+            s += gsl_linalg_SV_decomp(U, V, S, work);
+
+          /* A V = U S, U^T U = I */
+          gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, A, V, 0.0, AV);
+          gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, U, U, 0.0, UTU);
+
+          for (j = 0; j < N; j++)
+            {
+              double sj = gsl_vector_get(S, j);
+
+              if (j > 0)
+                gsl_test(sj > gsl_vector_get(S, j - 1), "%s tall (%3lu,%3lu)[%lu]: ordered",
+                         names[mod], M, N, j);
+
+              for (i = 0; i < M; i++)
+                {
+                  gsl_test_abs(gsl_matrix_get(AV, i, j), sj * gsl_matrix_get(U, i, j), eps,
+                               "%s tall (%3lu,%3lu)[%lu,%lu]: A V = U S", names[mod], M, N, i, j);
+                }
+
+              for (i = 0; i < N; i++)
+                {
+                  gsl_test_abs(gsl_matrix_get(UTU, i, j), (i == j) ? 1.0 : 0.0, eps,
+                               "%s tall (%3lu,%3lu)[%lu,%lu]: U orthonormal", names[mod], M, N, i, j);
+                }
+            }
+        }
+
+      gsl_matrix_free(A);
+      gsl_matrix_free(U);
+      gsl_matrix_free(V);
+      gsl_matrix_free(X);
+      gsl_matrix_free(AV);
+      gsl_matrix_free(UTU);
+      gsl_vector_free(S);
+      gsl_vector_free(work);
+    }
+
+  return s;
+}
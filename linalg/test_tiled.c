@@ -0,0 +1,157 @@
+/* linalg/test_tiled.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_permutation.h>
+
+static int
+test_tiled_compare(const gsl_matrix * A, const gsl_matrix * B, const double eps,
+                   const char * desc, const size_t M, const size_t N, const size_t nb)
+{
+  int s = 0;
+  size_t i, j;
+
+  for (i = 0; i < A->size1; ++i)
+    {
+      for (j = 0; j < A->size2; ++j)
+        {
+          double aij = gsl_matrix_get(A, i, j);
+          double bij = gsl_matrix_get(B, i, j);
+
+          if (fabs(aij - bij) > eps * GSL_MAX(1.0, fabs(bij)))
+            s = 1;
+        }
+    }
+
+  gsl_test(s, "%s (%lu,%lu) tile=%lu", desc, M, N, nb);
+
+  return s;
+}
+
+/* the tiled decompositions of an M-by-N matrix with tile size nb must
+   agree with the sequential ones */
+static int
+test_tiled_eps(const size_t M, const size_t N, const size_t nb, gsl_rng * r)
+{
+  int s = 0;
+  const double eps = 1.0e3 * GSL_MAX(M, N) * GSL_DBL_EPSILON;
+  gsl_matrix * A = gsl_matrix_alloc(M, N);
+  gsl_matrix * A0 = gsl_matrix_alloc(M, N);
+  gsl_matrix * A1 = gsl_matrix_alloc(M, N);
+  gsl_permutation * p0 = gsl_permutation_alloc(M);
+  gsl_permutation * p1 = gsl_permutation_alloc(M);
+  int signum0, signum1;
+  int sp = 0;
+  size_t i;
+
+  gsl_linalg_tune_set_tile(nb);
+
+  /* LU */
+
+  create_random_matrix(A, r);
+
+  gsl_matrix_memcpy(A0, A);
+  gsl_linalg_LU_decomp(A0, p0, &signum0);
+
+  gsl_matrix_memcpy(A1, A);
+  gsl_set_num_threads(3);
+  gsl_linalg_LU_decomp_tiled(A1, p1, &signum1);
+  gsl_set_num_threads(1);
+
+  s += test_tiled_compare(A1, A0, eps, "tiled LU", M, N, nb);
+  gsl_test_int(signum1, signum0, "tiled LU signum (%lu,%lu) tile=%lu", M, N, nb);
+
+  for (i = 0; i < M; ++i)
+    sp += (p1->data[i] != p0->data[i]);
+
+  s += sp;
+  gsl_test(sp, "tiled LU permutation (%lu,%lu) tile=%lu", M, N, nb);
+
+  /* QR, M >= N */
+
+  if (M >= N)
+    {
+      gsl_matrix * T0 = gsl_matrix_calloc(N, N);
+      gsl_matrix * T1 = gsl_matrix_calloc(N, N);
+
+      gsl_matrix_memcpy(A0, A);
+      gsl_linalg_QR_decomp_r(A0, T0);
+
+      gsl_matrix_memcpy(A1, A);
+      gsl_set_num_threads(3);
+      gsl_linalg_QR_decomp_r_tiled(A1, T1);
+      gsl_set_num_threads(1);
+
+      s += test_tiled_compare(A1, A0, eps, "tiled QR", M, N, nb);
+      s += test_tiled_compare(T1, T0, eps, "tiled QR T", M, N, nb);
+
+      gsl_matrix_free(T0);
+      gsl_matrix_free(T1);
+    }
+
+  /* Cholesky, square */
+
+  if (M == N)
+    {
+      create_posdef_matrix(A, r);
+
+      gsl_matrix_memcpy(A0, A);
+      gsl_linalg_cholesky_decomp1(A0);
+
+      gsl_matrix_memcpy(A1, A);
+      gsl_set_num_threads(3);
+      gsl_linalg_cholesky_decomp1_tiled(A1);
+      gsl_set_num_threads(1);
+
+      s += test_tiled_compare(A1, A0, eps, "tiled Cholesky", M, N, nb);
+    }
+
+  gsl_matrix_free(A);
+  gsl_matrix_free(A0);
+  gsl_matrix_free(A1);
+  gsl_permutation_free(p0);
+  gsl_permutation_free(p1);
+
+  return s;
+}
+
+static int
+test_tiled(gsl_rng * r)
+{
+  int s = 0;
+
+  s += test_tiled_eps(100, 100, 16, r);
+  s += test_tiled_eps(67, 67, 16, r);
+  s += test_tiled_eps(50, 50, 7, r);
+  s += test_tiled_eps(120, 70, 16, r);
+  s += test_tiled_eps(70, 120, 16, r);
+  s += test_tiled_eps(45, 45, 100, r);
+
+  /* the default tile size */
+  gsl_linalg_tune_set_tile(256);
+
+  return s;
+}
@@ -91,6 +91,86 @@ test_symmtd_decomp(gsl_rng * r)
   return s;
 }
 
+static int
+test_symmtd2_decomp_eps(const gsl_matrix * m, const size_t nb, const double eps, const char * desc)
+{
+  int s = 0;
+  const size_t N = m->size1;
+  size_t i, j;
+
+  gsl_matrix * Q = gsl_matrix_alloc(N, N);
+  gsl_matrix * T = gsl_matrix_calloc(N, N);
+  gsl_matrix * A  = gsl_matrix_alloc(N, N);
+  gsl_matrix * B  = gsl_matrix_alloc(N, N);
+  gsl_matrix * Tb = gsl_matrix_alloc(nb, N);
+  gsl_vector_view diag = gsl_matrix_diagonal(T);
+  gsl_vector_view subdiag = gsl_matrix_subdiagonal(T, 1);
+  gsl_vector_view superdiag = gsl_matrix_superdiagonal(T, 1);
+
+  gsl_matrix_memcpy(A, m);
+  s += gsl_linalg_symmtd2_decomp(A, Tb);
+
+  s += gsl_linalg_symmtd2_unpack(A, Tb, Q, &diag.vector, &subdiag.vector);
+  gsl_vector_memcpy(&superdiag.vector, &subdiag.vector);
+
+  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, Q, T, 0.0, A); /* A := Q T */
+  gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, A, Q, 0.0, B);   /* B := Q T Q^T */
+
+  for (i = 0; i < N; i++)
+    {
+      for (j = 0; j <= i; j++)
+        {
+          double bij = gsl_matrix_get(B, i, j);
+          double mij = gsl_matrix_get(m, i, j);
+
+          gsl_test_rel(bij, mij, eps, "%s (%3lu,nb=%lu)[%lu,%lu]: %22.18g   %22.18g\n",
+                       desc, N, nb, i, j, bij, mij);
+        }
+    }
+
+  /* Q^T Q = I */
+  gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, Q, Q, 0.0, B);
+
+  for (i = 0; i < N; i++)
+    {
+      for (j = 0; j < N; j++)
+        {
+          gsl_test_abs(gsl_matrix_get(B, i, j), (i == j) ? 1.0 : 0.0, N * GSL_DBL_EPSILON,
+                       "%s (%3lu,nb=%lu) orthogonal Q[%lu,%lu]", desc, N, nb, i, j);
+        }
+    }
+
+  gsl_matrix_free(T);
+  gsl_matrix_free(A);
+  gsl_matrix_free(Q);
+  gsl_matrix_free(B);
+  gsl_matrix_free(Tb);
+
+  return s;
+}
+
+static int
+test_symmtd2_decomp(gsl_rng * r)
+{
+  int s = 0;
+  const size_t nb[] = { 1, 2, 3, 8 };
+  size_t N, k;
+
+  for (N = 2; N <= 50; ++N)
+    {
+      gsl_matrix * A = gsl_matrix_alloc(N, N);
+
+      create_symm_matrix(A, r);
+
+      for (k = 0; k < sizeof(nb) / sizeof(nb[0]); ++k)
+        s += test_symmtd2_decomp_eps(A, nb[k], 1.0e5 * N * GSL_DBL_EPSILON, "symmtd2_decomp random");
+
+      gsl_matrix_free(A);
+    }
+
+  return s;
+}
+
 static int
 test_hermtd_decomp_eps(const gsl_matrix_complex * m, const double eps, const char * desc)
 {
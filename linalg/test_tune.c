@@ -0,0 +1,251 @@
+/* linalg/test_tune.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_permutation.h>
+
+/* run the recursive algorithms on A and return the results in
+   LU, LLT, Tinv, LTL */
+static void
+test_tune_run(const gsl_matrix * A, gsl_matrix * LU, gsl_matrix * LLT,
+              gsl_matrix * Tinv, gsl_matrix * LTL, gsl_permutation * p)
+{
+  int signum;
+
+  gsl_matrix_memcpy(LU, A);
+  gsl_linalg_LU_decomp(LU, p, &signum);
+
+  gsl_matrix_memcpy(LLT, A);
+  gsl_linalg_cholesky_decomp1(LLT);
+
+  gsl_matrix_memcpy(Tinv, A);
+  gsl_linalg_tri_invert(CblasLower, CblasNonUnit, Tinv);
+
+  gsl_matrix_memcpy(LTL, A);
+  gsl_linalg_tri_LTL(LTL);
+}
+
+static int
+test_tune_compare(const gsl_matrix * A, const gsl_matrix * B, const double eps,
+                  const char * desc, const size_t crossover, const size_t split)
+{
+  int s = 0;
+  size_t i, j;
+
+  for (i = 0; i < A->size1; ++i)
+    {
+      for (j = 0; j < A->size2; ++j)
+        {
+          double aij = gsl_matrix_get(A, i, j);
+          double bij = gsl_matrix_get(B, i, j);
+
+          if (fabs(aij - bij) > eps * GSL_MAX(1.0, fabs(bij)))
+            s = 1;
+        }
+    }
+
+  gsl_test(s, "%s crossover=%lu split=%lu", desc, crossover, split);
+
+  return s;
+}
+
+/* compare the bidiagonal decomposition of A with the current parameters
+   to the unblocked one */
+static int
+test_tune_bidiag(const gsl_matrix * A, const char * desc, const size_t crossover,
+                 const size_t panel)
+{
+  const size_t N = A->size2;
+  gsl_matrix * B = gsl_matrix_alloc(A->size1, N);
+  gsl_matrix * B0 = gsl_matrix_alloc(A->size1, N);
+  gsl_vector * tau_U = gsl_vector_alloc(N);
+  gsl_vector * tau_V = gsl_vector_alloc(N - 1);
+  const size_t crossover0 = gsl_linalg_tune_get_crossover(GSL_LINALG_TUNE_BIDIAG);
+  int s;
+
+  gsl_matrix_memcpy(B, A);
+  gsl_linalg_bidiag_decomp(B, tau_U, tau_V);
+
+  gsl_linalg_tune_set_crossover(GSL_LINALG_TUNE_BIDIAG, N);
+  gsl_matrix_memcpy(B0, A);
+  gsl_linalg_bidiag_decomp(B0, tau_U, tau_V);
+  gsl_linalg_tune_set_crossover(GSL_LINALG_TUNE_BIDIAG, crossover0);
+
+  /* the Householder vectors of the last columns are sensitive to
+     rounding, so the tolerance is relative to the size of A */
+  s = test_tune_compare(B, B0, 1.0e4 * N * GSL_DBL_EPSILON * gsl_matrix_max(A),
+                        desc, crossover, panel);
+
+  gsl_matrix_free(B);
+  gsl_matrix_free(B0);
+  gsl_vector_free(tau_U);
+  gsl_vector_free(tau_V);
+
+  return s;
+}
+
+static int
+test_tune(gsl_rng * r)
+{
+  int s = 0;
+  const char *filename = "test_tune.dat";
+  const size_t N = 75;
+  const size_t crossover[] = { 1, 2, 5, 100 };
+  const size_t split[] = { 1, 3, 8, 16 };
+  gsl_matrix * A = gsl_matrix_alloc(N, N);
+  gsl_matrix * LU = gsl_matrix_alloc(N, N);
+  gsl_matrix * LLT = gsl_matrix_alloc(N, N);
+  gsl_matrix * Tinv = gsl_matrix_alloc(N, N);
+  gsl_matrix * LTL = gsl_matrix_alloc(N, N);
+  gsl_matrix * LU0 = gsl_matrix_alloc(N, N);
+  gsl_matrix * LLT0 = gsl_matrix_alloc(N, N);
+  gsl_matrix * Tinv0 = gsl_matrix_alloc(N, N);
+  gsl_matrix * LTL0 = gsl_matrix_alloc(N, N);
+  gsl_permutation * p = gsl_permutation_alloc(N);
+  gsl_linalg_tune_t alg;
+  size_t k;
+  int status;
+  FILE * f;
+
+  /* defaults */
+  for (alg = GSL_LINALG_TUNE_LU; alg <= GSL_LINALG_TUNE_TRIMULT; ++alg)
+    gsl_test_int((int) gsl_linalg_tune_get_crossover(alg), 24, "tune default crossover %d", alg);
+
+  gsl_test_int((int) gsl_linalg_tune_get_split(), 8, "tune default split");
+  gsl_test_int((int) gsl_linalg_tune_get_tile(), 256, "tune default tile");
+  gsl_test_int((int) gsl_linalg_tune_get_crossover(GSL_LINALG_TUNE_BIDIAG), 128, "tune default bidiag crossover");
+  gsl_test_int((int) gsl_linalg_tune_get_panel(), 32, "tune default panel");
+
+  status = gsl_linalg_tune_set_crossover(GSL_LINALG_TUNE_LU, 0);
+  gsl_test_int(status, GSL_EINVAL, "tune set_crossover(0)");
+
+  status = gsl_linalg_tune_set_split(0);
+  gsl_test_int(status, GSL_EINVAL, "tune set_split(0)");
+
+  status = gsl_linalg_tune_set_tile(0);
+  gsl_test_int(status, GSL_EINVAL, "tune set_tile(0)");
+
+  status = gsl_linalg_tune_set_panel(0);
+  gsl_test_int(status, GSL_EINVAL, "tune set_panel(0)");
+
+  /* results must not depend on the parameters beyond rounding */
+
+  create_posdef_matrix(A, r);
+  test_tune_run(A, LU0, LLT0, Tinv0, LTL0, p);
+
+  for (k = 0; k < sizeof(crossover) / sizeof(crossover[0]); ++k)
+    {
+      for (alg = GSL_LINALG_TUNE_LU; alg <= GSL_LINALG_TUNE_TRIMULT; ++alg)
+        gsl_linalg_tune_set_crossover(alg, crossover[k]);
+
+      gsl_linalg_tune_set_split(split[k]);
+
+      test_tune_run(A, LU, LLT, Tinv, LTL, p);
+
+      s += test_tune_compare(LU, LU0, 1.0e2 * N * GSL_DBL_EPSILON, "tune LU", crossover[k], split[k]);
+      s += test_tune_compare(LLT, LLT0, 1.0e2 * N * GSL_DBL_EPSILON, "tune Cholesky", crossover[k], split[k]);
+      s += test_tune_compare(Tinv, Tinv0, 1.0e2 * N * GSL_DBL_EPSILON, "tune invtri", crossover[k], split[k]);
+      s += test_tune_compare(LTL, LTL0, 1.0e2 * N * GSL_DBL_EPSILON, "tune trimult", crossover[k], split[k]);
+    }
+
+  /* blocked bidiagonalization with narrow panels, against unblocked */
+
+  for (k = 0; k < sizeof(split) / sizeof(split[0]); ++k)
+    {
+      gsl_linalg_tune_set_crossover(GSL_LINALG_TUNE_BIDIAG, crossover[k]);
+      gsl_linalg_tune_set_panel(split[k]);
+      s += test_tune_bidiag(A, "tune bidiag", crossover[k], split[k]);
+    }
+
+  gsl_linalg_tune_set_crossover(GSL_LINALG_TUNE_BIDIAG, 128);
+  gsl_linalg_tune_set_panel(32);
+
+  /* profile round trip */
+
+  gsl_linalg_tune_set_crossover(GSL_LINALG_TUNE_LU, 32);
+  gsl_linalg_tune_set_crossover(GSL_LINALG_TUNE_CHOLESKY, 40);
+  gsl_linalg_tune_set_crossover(GSL_LINALG_TUNE_INVTRI, 48);
+  gsl_linalg_tune_set_crossover(GSL_LINALG_TUNE_TRIMULT, 56);
+  gsl_linalg_tune_set_split(4);
+  gsl_linalg_tune_set_tile(128);
+  gsl_linalg_tune_set_crossover(GSL_LINALG_TUNE_BIDIAG, 64);
+  gsl_linalg_tune_set_panel(16);
+
+  status = gsl_linalg_tune_save(filename);
+  gsl_test_int(status, GSL_SUCCESS, "tune save");
+
+  for (alg = GSL_LINALG_TUNE_LU; alg <= GSL_LINALG_TUNE_TRIMULT; ++alg)
+    gsl_linalg_tune_set_crossover(alg, 24);
+
+  gsl_linalg_tune_set_split(8);
+  gsl_linalg_tune_set_tile(256);
+  gsl_linalg_tune_set_crossover(GSL_LINALG_TUNE_BIDIAG, 128);
+  gsl_linalg_tune_set_panel(32);
+
+  status = gsl_linalg_tune_load(filename);
+  gsl_test_int(status, GSL_SUCCESS, "tune load");
+
+  for (alg = GSL_LINALG_TUNE_LU; alg <= GSL_LINALG_TUNE_TRIMULT; ++alg)
+    gsl_test_int((int) gsl_linalg_tune_get_crossover(alg), 32 + 8 * (int) alg, "tune load crossover %d", alg);
+
+  gsl_test_int((int) gsl_linalg_tune_get_split(), 4, "tune load split");
+  gsl_test_int((int) gsl_linalg_tune_get_tile(), 128, "tune load tile");
+  gsl_test_int((int) gsl_linalg_tune_get_crossover(GSL_LINALG_TUNE_BIDIAG), 64, "tune load bidiag crossover");
+  gsl_test_int((int) gsl_linalg_tune_get_panel(), 16, "tune load panel");
+
+  /* an invalid profile is rejected and leaves the parameters unchanged */
+
+  f = fopen(filename, "w");
+  fprintf(f, "# comment\ncrossover_lu 64\ncrossover_xyz 12\n");
+  fclose(f);
+
+  status = gsl_linalg_tune_load(filename);
+  gsl_test_int(status, GSL_EINVAL, "tune load invalid");
+  gsl_test_int((int) gsl_linalg_tune_get_crossover(GSL_LINALG_TUNE_LU), 32, "tune load invalid unchanged");
+
+  remove(filename);
+
+  for (alg = GSL_LINALG_TUNE_LU; alg <= GSL_LINALG_TUNE_TRIMULT; ++alg)
+    gsl_linalg_tune_set_crossover(alg, 24);
+
+  gsl_linalg_tune_set_split(8);
+  gsl_linalg_tune_set_tile(256);
+  gsl_linalg_tune_set_crossover(GSL_LINALG_TUNE_BIDIAG, 128);
+  gsl_linalg_tune_set_panel(32);
+
+  gsl_matrix_free(A);
+  gsl_matrix_free(LU);
+  gsl_matrix_free(LLT);
+  gsl_matrix_free(Tinv);
+  gsl_matrix_free(LTL);
+  gsl_matrix_free(LU0);
+  gsl_matrix_free(LLT0);
+  gsl_matrix_free(Tinv0);
+  gsl_matrix_free(LTL0);
+  gsl_permutation_free(p);
+
+  return s;
+}
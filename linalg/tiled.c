@@ -0,0 +1,573 @@
+/* linalg/tiled.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Tiled Cholesky, LU and QR decompositions of large matrices.
+ *
+ * The matrix is divided into square tiles of size nb (see
+ * gsl_linalg_tune_set_tile) and each step of the right-looking blocked
+ * algorithm is split into one task per tile (Cholesky) or per column
+ * block (LU and QR). The tasks are scheduled by the OpenMP runtime from
+ * the data dependencies between them, so that the trailing updates of
+ * one step overlap with the panel factorizations of the next steps,
+ * without a barrier between the steps. The tiles themselves are
+ * factored by the sequential recursive routines.
+ *
+ * The results have the same format as gsl_linalg_cholesky_decomp1,
+ * gsl_linalg_LU_decomp and gsl_linalg_QR_decomp_r, and agree with them
+ * to rounding error. When the library was built without OpenMP, when
+ * a single thread is requested with gsl_set_num_threads(), when
+ * called from a parallel region, or when the matrix fits in one tile,
+ * the sequential routines are called directly.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_permutation.h>
+#include <gsl/gsl_permute_vector.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+
+static int cholesky_tiled (gsl_matrix * A, const size_t nb, const int nthreads);
+static int LU_tiled (gsl_matrix * A, gsl_permutation * p, int * signum,
+                     const size_t nb, const int nthreads);
+static int QR_r_tiled (gsl_matrix * A, gsl_matrix * T, const size_t nb, const int nthreads);
+#endif
+
+/* number of threads to use for a matrix of ntiles column blocks */
+static int
+tiled_num_threads (const size_t ntiles)
+{
+#ifdef _OPENMP
+  const size_t n = gsl_get_num_threads ();
+
+  if (n <= 1 || ntiles < 2 || omp_in_parallel ())
+    return 1;
+
+  return (int) n;
+#else
+  (void) ntiles;
+  return 1;
+#endif
+}
+
+/*
+gsl_linalg_cholesky_decomp1_tiled()
+  Tiled Cholesky decomposition A = L L^T
+
+Inputs: A - (input) symmetric, positive definite matrix
+            (output) lower triangle contains Cholesky factor
+
+Return: success/error
+
+Notes:
+1) as in gsl_linalg_cholesky_decomp1, the original matrix is saved in
+the upper triangle on output
+*/
+
+int
+gsl_linalg_cholesky_decomp1_tiled (gsl_matrix * A)
+{
+  const size_t N = A->size1;
+
+  if (N != A->size2)
+    {
+      GSL_ERROR("Cholesky decomposition requires square matrix", GSL_ENOTSQR);
+    }
+  else
+    {
+      const size_t nb = gsl_linalg_tune_get_tile ();
+      const int nthreads = tiled_num_threads ((N + nb - 1) / nb);
+
+#ifdef _OPENMP
+      if (nthreads > 1)
+        return cholesky_tiled (A, nb, nthreads);
+#else
+      (void) nthreads;
+#endif
+
+      return gsl_linalg_cholesky_decomp1 (A);
+    }
+}
+
+/*
+gsl_linalg_LU_decomp_tiled()
+  Tiled LU decomposition with partial pivoting, P A = L U
+
+Inputs: A      - M-by-N matrix, replaced by L and U on output
+        p      - (output) permutation of length M
+        signum - (output) sign of the permutation
+
+Return: success/error
+*/
+
+int
+gsl_linalg_LU_decomp_tiled (gsl_matrix * A, gsl_permutation * p, int * signum)
+{
+  const size_t M = A->size1;
+
+  if (p->size != M)
+    {
+      GSL_ERROR ("permutation length must match matrix size1", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t nb = gsl_linalg_tune_get_tile ();
+      const size_t minMN = GSL_MIN (M, A->size2);
+      const int nthreads = tiled_num_threads ((minMN + nb - 1) / nb);
+
+#ifdef _OPENMP
+      if (nthreads > 1)
+        return LU_tiled (A, p, signum, nb, nthreads);
+#else
+      (void) nthreads;
+#endif
+
+      return gsl_linalg_LU_decomp (A, p, signum);
+    }
+}
+
+/*
+gsl_linalg_QR_decomp_r_tiled()
+  Tiled QR decomposition A = Q R, with Q = I - V T V^T
+
+Inputs: A - M-by-N matrix with M >= N, replaced by R and V on output
+        T - (output) N-by-N upper triangular factor of the block reflector
+
+Return: success/error
+*/
+
+int
+gsl_linalg_QR_decomp_r_tiled (gsl_matrix * A, gsl_matrix * T)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+
+  if (M < N)
+    {
+      GSL_ERROR ("M must be >= N", GSL_EBADLEN);
+    }
+  else if (T->size1 != T->size2)
+    {
+      GSL_ERROR ("T matrix must be square", GSL_ENOTSQR);
+    }
+  else if (T->size1 != N)
+    {
+      GSL_ERROR ("T matrix does not match dimensions of A", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t nb = gsl_linalg_tune_get_tile ();
+      const int nthreads = tiled_num_threads ((N + nb - 1) / nb);
+
+#ifdef _OPENMP
+      if (nthreads > 1)
+        return QR_r_tiled (A, T, nb, nthreads);
+#else
+      (void) nthreads;
+#endif
+
+      return gsl_linalg_QR_decomp_r (A, T);
+    }
+}
+
+#ifdef _OPENMP
+
+/* first index and size of block k of a dimension of length n */
+#define BLOCK_START(k) ((k) * nb)
+#define BLOCK_SIZE(k, n) GSL_MIN (nb, (n) - (k) * nb)
+
+/* record the first nonzero status returned by a task */
+static void
+tiled_status (int * status, const int s)
+{
+  if (s)
+    {
+#pragma omp critical (gsl_linalg_tiled)
+      if (*status == GSL_SUCCESS)
+        *status = s;
+    }
+}
+
+/*
+cholesky_tiled()
+  Right-looking tiled Cholesky decomposition. For each diagonal tile k,
+the tasks are
+
+  A_kk := chol(A_kk)                     (potrf)
+  A_ik := A_ik L_kk^{-T},       i > k    (trsm)
+  A_ii := A_ii - A_ik A_ik^T,   i > k    (syrk)
+  A_ij := A_ij - A_ik A_jk^T,   i > j > k (gemm)
+
+with a dependency object for each tile of the lower triangle.
+*/
+
+static int
+cholesky_tiled (gsl_matrix * A, const size_t nb, const int nthreads)
+{
+  const size_t N = A->size1;
+  const size_t nt = (N + nb - 1) / nb;
+  char *dep = malloc (nt * nt);
+  gsl_matrix *work = gsl_matrix_alloc (nb, nb);
+  int status = GSL_SUCCESS;
+  size_t i, j, k;
+
+  if (dep == NULL || work == NULL)
+    {
+      free (dep);
+      gsl_matrix_free (work);
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  /* save the original matrix in the upper triangle, as
+     gsl_linalg_cholesky_decomp1 does; the tasks only write the
+     lower triangle */
+  gsl_matrix_transpose_tricpy (CblasLower, CblasUnit, A, A);
+
+#pragma omp parallel num_threads(nthreads)
+#pragma omp single
+  {
+    for (k = 0; k < nt; ++k)
+      {
+#pragma omp task firstprivate(k) depend(inout: dep[k * nt + k])
+        {
+          const size_t nk = BLOCK_SIZE (k, N);
+          gsl_matrix_view Akk = gsl_matrix_submatrix (A, BLOCK_START (k), BLOCK_START (k), nk, nk);
+          gsl_matrix_view U = gsl_matrix_submatrix (work, 0, 0, nk, nk);
+          int s;
+
+          /* gsl_linalg_cholesky_decomp1 overwrites the upper triangle of
+             the tile with its updated lower triangle; the potrf tasks
+             are serialized, so one work matrix suffices to restore it */
+          gsl_matrix_tricpy (CblasUpper, CblasUnit, &U.matrix, &Akk.matrix);
+          s = gsl_linalg_cholesky_decomp1 (&Akk.matrix);
+          gsl_matrix_tricpy (CblasUpper, CblasUnit, &Akk.matrix, &U.matrix);
+
+          tiled_status (&status, s);
+        }
+
+        for (i = k + 1; i < nt; ++i)
+          {
+#pragma omp task firstprivate(i, k) depend(in: dep[k * nt + k]) depend(inout: dep[i * nt + k])
+            {
+              gsl_matrix_view Akk = gsl_matrix_submatrix (A, BLOCK_START (k), BLOCK_START (k), nb, nb);
+              gsl_matrix_view Aik = gsl_matrix_submatrix (A, BLOCK_START (i), BLOCK_START (k), BLOCK_SIZE (i, N), nb);
+
+              gsl_blas_dtrsm (CblasRight, CblasLower, CblasTrans, CblasNonUnit, 1.0, &Akk.matrix, &Aik.matrix);
+            }
+          }
+
+        for (i = k + 1; i < nt; ++i)
+          {
+#pragma omp task firstprivate(i, k) depend(in: dep[i * nt + k]) depend(inout: dep[i * nt + i])
+            {
+              const size_t ni = BLOCK_SIZE (i, N);
+              gsl_matrix_view Aik = gsl_matrix_submatrix (A, BLOCK_START (i), BLOCK_START (k), ni, nb);
+              gsl_matrix_view Aii = gsl_matrix_submatrix (A, BLOCK_START (i), BLOCK_START (i), ni, ni);
+
+              gsl_blas_dsyrk (CblasLower, CblasNoTrans, -1.0, &Aik.matrix, 1.0, &Aii.matrix);
+            }
+
+            for (j = k + 1; j < i; ++j)
+              {
+#pragma omp task firstprivate(i, j, k) depend(in: dep[i * nt + k], dep[j * nt + k]) depend(inout: dep[i * nt + j])
+                {
+                  gsl_matrix_view Aik = gsl_matrix_submatrix (A, BLOCK_START (i), BLOCK_START (k), BLOCK_SIZE (i, N), nb);
+                  gsl_matrix_view Ajk = gsl_matrix_submatrix (A, BLOCK_START (j), BLOCK_START (k), nb, nb);
+                  gsl_matrix_view Aij = gsl_matrix_submatrix (A, BLOCK_START (i), BLOCK_START (j), BLOCK_SIZE (i, N), nb);
+
+                  gsl_blas_dgemm (CblasNoTrans, CblasTrans, -1.0, &Aik.matrix, &Ajk.matrix, 1.0, &Aij.matrix);
+                }
+              }
+          }
+      }
+  }
+
+  gsl_matrix_free (work);
+  free (dep);
+
+  return status;
+}
+
+/*
+LU_tiled()
+  Right-looking LU decomposition by column blocks. For each column
+block k with k*nb < min(M,N), the tasks are
+
+  P_k [ L_kk; L_ik ] U_kk := A(k*nb:M, k)      (panel)
+  A(k*nb:M, j) := P_k A(k*nb:M, j),   j != k   (pivots)
+  A_kj := L_kk^{-1} A_kj,             j > k    (trsm)
+  A_ij := A_ij - L_ik A_kj,           j > k    (gemm)
+
+with a dependency object for each column block. The panel of step k+1
+can start as soon as column block k+1 has been updated by step k.
+The permutations P_k of the panels are combined into p at the end.
+*/
+
+static int
+LU_tiled (gsl_matrix * A, gsl_permutation * p, int * signum,
+          const size_t nb, const int nthreads)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  const size_t nc = (N + nb - 1) / nb;                /* column blocks */
+  const size_t np = (GSL_MIN (M, N) + nb - 1) / nb;   /* panels */
+  gsl_permutation **pk = malloc (np * sizeof (gsl_permutation *));
+  int *sk = malloc (np * sizeof (int));
+  size_t *tmp = malloc (M * sizeof (size_t));
+  char *dep = malloc (nc);
+  int status = GSL_SUCCESS;
+  size_t i, j, k;
+
+  if (pk == NULL || sk == NULL || tmp == NULL || dep == NULL)
+    {
+      free (pk);
+      free (sk);
+      free (tmp);
+      free (dep);
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  for (k = 0; k < np; ++k)
+    {
+      pk[k] = gsl_permutation_alloc (M - BLOCK_START (k));
+
+      if (pk[k] == NULL)
+        {
+          while (k > 0)
+            gsl_permutation_free (pk[--k]);
+
+          free (pk);
+          free (sk);
+          free (tmp);
+          free (dep);
+          GSL_ERROR ("failed to allocate panel permutations", GSL_ENOMEM);
+        }
+    }
+
+#pragma omp parallel num_threads(nthreads)
+#pragma omp single
+  {
+    for (k = 0; k < np; ++k)
+      {
+#pragma omp task firstprivate(k) depend(inout: dep[k])
+        {
+          const size_t k0 = BLOCK_START (k);
+          gsl_matrix_view P = gsl_matrix_submatrix (A, k0, k0, M - k0, BLOCK_SIZE (k, N));
+          int s = gsl_linalg_LU_decomp (&P.matrix, pk[k], &sk[k]);
+
+          tiled_status (&status, s);
+        }
+
+        for (j = 0; j < nc; ++j)
+          {
+            if (j == k)
+              continue;
+
+#pragma omp task firstprivate(j, k) depend(in: dep[k]) depend(inout: dep[j])
+            {
+              const size_t k0 = BLOCK_START (k);
+              const size_t nj = BLOCK_SIZE (j, N);
+              gsl_matrix_view B = gsl_matrix_submatrix (A, k0, BLOCK_START (j), M - k0, nj);
+              size_t c;
+
+              for (c = 0; c < nj; ++c)
+                {
+                  gsl_vector_view v = gsl_matrix_column (&B.matrix, c);
+                  gsl_permute_vector (pk[k], &v.vector);
+                }
+
+              if (j > k)
+                {
+                  const size_t r = GSL_MIN (BLOCK_SIZE (k, N), M - k0);
+                  gsl_matrix_view Lkk = gsl_matrix_submatrix (A, k0, k0, r, r);
+                  gsl_matrix_view B1 = gsl_matrix_submatrix (&B.matrix, 0, 0, r, nj);
+
+                  gsl_blas_dtrsm (CblasLeft, CblasLower, CblasNoTrans, CblasUnit, 1.0, &Lkk.matrix, &B1.matrix);
+
+                  if (M > k0 + r)
+                    {
+                      gsl_matrix_view L21 = gsl_matrix_submatrix (A, k0 + r, k0, M - k0 - r, r);
+                      gsl_matrix_view B2 = gsl_matrix_submatrix (&B.matrix, r, 0, M - k0 - r, nj);
+
+                      gsl_blas_dgemm (CblasNoTrans, CblasNoTrans, -1.0, &L21.matrix, &B1.matrix, 1.0, &B2.matrix);
+                    }
+                }
+            }
+          }
+      }
+  }
+
+  /* row k0+i after step k is row k0+pk[i] before it */
+
+  gsl_permutation_init (p);
+  *signum = 1;
+
+  for (k = 0; k < np; ++k)
+    {
+      const size_t k0 = BLOCK_START (k);
+
+      for (i = k0; i < M; ++i)
+        tmp[i] = p->data[i];
+
+      for (i = k0; i < M; ++i)
+        p->data[i] = tmp[k0 + pk[k]->data[i - k0]];
+
+      *signum *= sk[k];
+
+      gsl_permutation_free (pk[k]);
+    }
+
+  free (pk);
+  free (sk);
+  free (tmp);
+  free (dep);
+
+  return status;
+}
+
+/*
+QR_r_tiled()
+  Right-looking QR decomposition by column blocks, in the format of
+gsl_linalg_QR_decomp_r. For each column block k the tasks are
+
+  Q_k R_kk := A(k*nb:M, k)                     (panel, T_kk = T(k,k))
+  A(k*nb:M, j) := Q_k^T A(k*nb:M, j),  j > k   (update)
+  T(0:k*nb, k) := -T(0:k*nb, 0:k*nb) V(:, 0:k*nb)^T V_k T_kk
+
+where Q_k = I - V_k T_kk V_k^T. The last task assembles the
+off-diagonal blocks of T as in Eq. 13 of gsl_linalg_QR_decomp_r; these
+tasks are chained, since each reads the blocks written by the
+previous ones.
+*/
+
+static int
+QR_r_tiled (gsl_matrix * A, gsl_matrix * T, const size_t nb, const int nthreads)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  const size_t nc = (N + nb - 1) / nb;
+  gsl_matrix **work = malloc (nc * sizeof (gsl_matrix *));
+  char *dep = malloc (nc + 1);         /* dep[nc] orders the T tasks */
+  int status = GSL_SUCCESS;
+  size_t j, k;
+
+  if (work == NULL || dep == NULL)
+    {
+      free (work);
+      free (dep);
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  /* workspace of the updates of column block j */
+  for (j = 0; j < nc; ++j)
+    {
+      work[j] = gsl_matrix_alloc (nb, BLOCK_SIZE (j, N));
+
+      if (work[j] == NULL)
+        {
+          while (j > 0)
+            gsl_matrix_free (work[--j]);
+
+          free (work);
+          free (dep);
+          GSL_ERROR ("failed to allocate update workspace", GSL_ENOMEM);
+        }
+    }
+
+#pragma omp parallel num_threads(nthreads)
+#pragma omp single
+  {
+    for (k = 0; k < nc; ++k)
+      {
+#pragma omp task firstprivate(k) depend(inout: dep[k])
+        {
+          const size_t k0 = BLOCK_START (k);
+          const size_t nk = BLOCK_SIZE (k, N);
+          gsl_matrix_view P = gsl_matrix_submatrix (A, k0, k0, M - k0, nk);
+          gsl_matrix_view Tkk = gsl_matrix_submatrix (T, k0, k0, nk, nk);
+          int s = gsl_linalg_QR_decomp_r (&P.matrix, &Tkk.matrix);
+
+          tiled_status (&status, s);
+        }
+
+        for (j = k + 1; j < nc; ++j)
+          {
+#pragma omp task firstprivate(j, k) depend(in: dep[k]) depend(inout: dep[j])
+            {
+              const size_t k0 = BLOCK_START (k);
+              const size_t nk = BLOCK_SIZE (k, N);
+              const size_t nj = BLOCK_SIZE (j, N);
+              gsl_matrix_const_view P = gsl_matrix_const_submatrix (A, k0, k0, M - k0, nk);
+              gsl_matrix_const_view Tkk = gsl_matrix_const_submatrix (T, k0, k0, nk, nk);
+              gsl_matrix_view B = gsl_matrix_submatrix (A, k0, BLOCK_START (j), M - k0, nj);
+              gsl_matrix_view W = gsl_matrix_submatrix (work[j], 0, 0, nk, nj);
+
+              gsl_linalg_QR_QTmat_r (&P.matrix, &Tkk.matrix, &B.matrix, &W.matrix);
+            }
+          }
+
+        if (k > 0)
+          {
+#pragma omp task firstprivate(k) depend(in: dep[k]) depend(inout: dep[nc])
+            {
+              const size_t k0 = BLOCK_START (k);
+              const size_t nk = BLOCK_SIZE (k, N);
+              gsl_matrix_view T11 = gsl_matrix_submatrix (T, 0, 0, k0, k0);
+              gsl_matrix_view T12 = gsl_matrix_submatrix (T, 0, k0, k0, nk);
+              gsl_matrix_view Tkk = gsl_matrix_submatrix (T, k0, k0, nk, nk);
+              gsl_matrix_view V21 = gsl_matrix_submatrix (A, k0, 0, nk, k0);
+              gsl_matrix_view V22 = gsl_matrix_submatrix (A, k0, k0, nk, nk);
+
+              /* T12 := V1^T V2 = V21^T V22 + V31^T V32, V22 unit lower triangular */
+              gsl_matrix_transpose_memcpy (&T12.matrix, &V21.matrix);
+              gsl_blas_dtrmm (CblasRight, CblasLower, CblasNoTrans, CblasUnit, 1.0, &V22.matrix, &T12.matrix);
+
+              if (M > k0 + nk)
+                {
+                  gsl_matrix_view V31 = gsl_matrix_submatrix (A, k0 + nk, 0, M - k0 - nk, k0);
+                  gsl_matrix_view V32 = gsl_matrix_submatrix (A, k0 + nk, k0, M - k0 - nk, nk);
+
+                  gsl_blas_dgemm (CblasTrans, CblasNoTrans, 1.0, &V31.matrix, &V32.matrix, 1.0, &T12.matrix);
+                }
+
+              gsl_blas_dtrmm (CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, -1.0, &T11.matrix, &T12.matrix);
+              gsl_blas_dtrmm (CblasRight, CblasUpper, CblasNoTrans, CblasNonUnit, 1.0, &Tkk.matrix, &T12.matrix);
+            }
+          }
+      }
+  }
+
+  for (j = 0; j < nc; ++j)
+    gsl_matrix_free (work[j]);
+
+  free (work);
+  free (dep);
+
+  return status;
+}
+
+#endif /* _OPENMP */
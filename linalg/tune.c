@@ -0,0 +1,352 @@
+/* linalg/tune.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Runtime parameters of the recursive and blocked (Level 3 BLAS)
+ * algorithms: the matrix size below which each algorithm switches to
+ * its Level 2 version, the block size to which the recursive splits are
+ * aligned (see recurse.h), the tile size of the tiled decompositions
+ * (see tiled.c) and the panel width of the blocked bidiagonalization
+ * (see bidiag.c).
+ *
+ * The parameters can be set individually, or read from a profile file
+ * written by gsl_linalg_tune_save() or by the gsl-linalg-tune program.
+ * If the environment variable GSL_LINALG_TUNE names a profile file, it
+ * is loaded the first time a parameter is read or set; explicit settings
+ * then override the values from the file.
+ *
+ * The profile is a text file of "name value" lines; lines starting with
+ * '#' are comments:
+ *
+ * # GSL linalg tuning profile
+ * crossover_lu 24
+ * crossover_cholesky 24
+ * crossover_invtri 24
+ * crossover_trimult 24
+ * crossover_bidiag 128
+ * split 8
+ * tile 256
+ * panel 32
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_linalg.h>
+
+#define TUNE_NALG 5
+
+static const char *tune_names[TUNE_NALG] =
+  { "crossover_lu", "crossover_cholesky", "crossover_invtri", "crossover_trimult",
+    "crossover_bidiag" };
+
+/* compiled-in defaults */
+static size_t tune_crossover[TUNE_NALG] = { 24, 24, 24, 24, 128 };
+static size_t tune_split = 8;
+static size_t tune_tile = 256;
+static size_t tune_panel = 32;
+
+static int tune_initialized = 0;
+
+static int tune_read (FILE * stream);
+static int tune_read_file (const char * filename);
+
+/* load the profile named by GSL_LINALG_TUNE, once, before any parameter
+   is read or set. This may first happen inside an OpenMP parallel
+   region, so the loading is serialized there. Without OpenMP the check
+   is unsynchronized, like the thread count of sys/thread.c: programs
+   with threads of their own should read or set a parameter before
+   starting them. A profile which cannot be read is ignored here,
+   leaving the defaults, rather than reported as an error from whichever
+   routine happened to need a parameter first. */
+static void
+tune_init (void)
+{
+  int initialized;
+
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+  initialized = tune_initialized;
+
+  if (!initialized)
+    {
+#ifdef _OPENMP
+#pragma omp critical (gsl_linalg_tune)
+#endif
+      {
+        if (!tune_initialized)
+          {
+            const char *p = getenv ("GSL_LINALG_TUNE");
+
+            if (p != NULL && *p != '\0')
+              tune_read_file (p);
+
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+            tune_initialized = 1;
+          }
+      }
+    }
+}
+
+int
+gsl_linalg_tune_set_crossover (const gsl_linalg_tune_t alg, const size_t n)
+{
+  if ((int) alg < 0 || (int) alg >= TUNE_NALG)
+    {
+      GSL_ERROR ("unknown algorithm", GSL_EINVAL);
+    }
+  else if (n < 1)
+    {
+      GSL_ERROR ("crossover must be at least 1", GSL_EINVAL);
+    }
+  else
+    {
+      tune_init ();
+      tune_crossover[alg] = n;
+      return GSL_SUCCESS;
+    }
+}
+
+size_t
+gsl_linalg_tune_get_crossover (const gsl_linalg_tune_t alg)
+{
+  tune_init ();
+
+  if ((int) alg < 0 || (int) alg >= TUNE_NALG)
+    {
+      GSL_ERROR_VAL ("unknown algorithm", GSL_EINVAL, 0);
+    }
+
+  return tune_crossover[alg];
+}
+
+int
+gsl_linalg_tune_set_split (const size_t nb)
+{
+  if (nb < 1)
+    {
+      GSL_ERROR ("split block size must be at least 1", GSL_EINVAL);
+    }
+  else
+    {
+      tune_init ();
+      tune_split = nb;
+      return GSL_SUCCESS;
+    }
+}
+
+size_t
+gsl_linalg_tune_get_split (void)
+{
+  tune_init ();
+  return tune_split;
+}
+
+int
+gsl_linalg_tune_set_tile (const size_t nb)
+{
+  if (nb < 1)
+    {
+      GSL_ERROR ("tile size must be at least 1", GSL_EINVAL);
+    }
+  else
+    {
+      tune_init ();
+      tune_tile = nb;
+      return GSL_SUCCESS;
+    }
+}
+
+size_t
+gsl_linalg_tune_get_tile (void)
+{
+  tune_init ();
+  return tune_tile;
+}
+
+int
+gsl_linalg_tune_set_panel (const size_t nb)
+{
+  if (nb < 1)
+    {
+      GSL_ERROR ("panel width must be at least 1", GSL_EINVAL);
+    }
+  else
+    {
+      tune_init ();
+      tune_panel = nb;
+      return GSL_SUCCESS;
+    }
+}
+
+size_t
+gsl_linalg_tune_get_panel (void)
+{
+  tune_init ();
+  return tune_panel;
+}
+
+/*
+gsl_linalg_tune_load()
+  Read parameters from a profile file. Parameters which do not appear
+in the file keep their current values. On error the current
+parameters are unchanged.
+*/
+
+int
+gsl_linalg_tune_load (const char * filename)
+{
+  int status;
+
+  tune_init ();
+
+  status = tune_read_file (filename);
+
+  if (status == GSL_EFAILED)
+    {
+      GSL_ERROR ("cannot open tuning profile", GSL_EFAILED);
+    }
+  else if (status)
+    {
+      GSL_ERROR ("invalid tuning profile", status);
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_linalg_tune_save (const char * filename)
+{
+  FILE *f = fopen (filename, "w");
+
+  if (f == NULL)
+    {
+      GSL_ERROR ("cannot open tuning profile", GSL_EFAILED);
+    }
+  else
+    {
+      size_t i;
+      int status = 0;
+
+      tune_init ();
+
+      status |= (fprintf (f, "# GSL linalg tuning profile\n") < 0);
+
+      for (i = 0; i < TUNE_NALG; ++i)
+        status |= (fprintf (f, "%s %lu\n", tune_names[i], (unsigned long) tune_crossover[i]) < 0);
+
+      status |= (fprintf (f, "split %lu\n", (unsigned long) tune_split) < 0);
+      status |= (fprintf (f, "tile %lu\n", (unsigned long) tune_tile) < 0);
+      status |= (fprintf (f, "panel %lu\n", (unsigned long) tune_panel) < 0);
+      status |= (fclose (f) != 0);
+
+      if (status)
+        {
+          GSL_ERROR ("error writing tuning profile", GSL_EFAILED);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* read a profile file without reporting errors through the error
+   handler; returns GSL_EFAILED if it cannot be opened */
+static int
+tune_read_file (const char * filename)
+{
+  FILE *f = fopen (filename, "r");
+  int status;
+
+  if (f == NULL)
+    return GSL_EFAILED;
+
+  status = tune_read (f);
+  fclose (f);
+
+  return status;
+}
+
+static int
+tune_read (FILE * stream)
+{
+  size_t crossover[TUNE_NALG];
+  size_t split = tune_split;
+  size_t tile = tune_tile;
+  size_t panel = tune_panel;
+  char line[256];
+  size_t i;
+
+  for (i = 0; i < TUNE_NALG; ++i)
+    crossover[i] = tune_crossover[i];
+
+  while (fgets (line, sizeof (line), stream) != NULL)
+    {
+      char name[64];
+      unsigned long value;
+      int found = 0;
+
+      if (line[0] == '#' || strspn (line, " \t\r\n") == strlen (line))
+        continue;
+
+      if (sscanf (line, "%63s %lu", name, &value) != 2 || value < 1)
+        return GSL_EINVAL;
+
+      for (i = 0; i < TUNE_NALG; ++i)
+        {
+          if (strcmp (name, tune_names[i]) == 0)
+            {
+              crossover[i] = value;
+              found = 1;
+            }
+        }
+
+      if (strcmp (name, "split") == 0)
+        {
+          split = value;
+          found = 1;
+        }
+      else if (strcmp (name, "tile") == 0)
+        {
+          tile = value;
+          found = 1;
+        }
+      else if (strcmp (name, "panel") == 0)
+        {
+          panel = value;
+          found = 1;
+        }
+
+      if (!found)
+        return GSL_EINVAL;
+    }
+
+  for (i = 0; i < TUNE_NALG; ++i)
+    tune_crossover[i] = crossover[i];
+
+  tune_split = split;
+  tune_tile = tile;
+  tune_panel = panel;
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,77 @@
+/* simd_level.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Runtime choice of the instruction set of the vectorized kernels...
+ * not meant for client consumption.  It is a header so that
+ * libgslcblas, which does not link against libgsl, can share it with
+ * the rest of the library. */
+
+#ifndef SIMD_LEVEL_H_
+#define SIMD_LEVEL_H_
+
+#include <stdlib.h>
+#include <string.h>
+
+#define SIMD_GENERIC 0
+#define SIMD_SSE2    1
+#define SIMD_AVX2    2          /* AVX2 and FMA */
+#define SIMD_AVX512  3          /* AVX-512F */
+
+/* The widest level supported by the CPU (as reported by cpuid), or
+   SIMD_GENERIC when the compiler cannot build the x86 kernels.  It can
+   be capped with the environment variable GSL_SIMD, set to one of
+   "generic", "sse2", "avx2" or "avx512", which is useful for obtaining
+   identical results on different machines.  Callers without kernels
+   for a level use the next lower one. */
+
+static int
+simd_level (void)
+{
+  const char *s = getenv ("GSL_SIMD");
+  int level = SIMD_AVX512;
+
+  if (s != NULL)
+    {
+      if (strcmp (s, "generic") == 0)
+        level = SIMD_GENERIC;
+      else if (strcmp (s, "sse2") == 0)
+        level = SIMD_SSE2;
+      else if (strcmp (s, "avx2") == 0)
+        level = SIMD_AVX2;
+    }
+
+#ifdef HAVE_X86_SIMD_DISPATCH
+  __builtin_cpu_init ();
+
+  if (level >= SIMD_AVX512 && __builtin_cpu_supports ("avx512f"))
+    return SIMD_AVX512;
+
+  if (level >= SIMD_AVX2 && __builtin_cpu_supports ("avx2")
+      && __builtin_cpu_supports ("fma"))
+    return SIMD_AVX2;
+
+  if (level >= SIMD_SSE2 && __builtin_cpu_supports ("sse2"))
+    return SIMD_SSE2;
+#endif
+
+  (void) level;
+  return SIMD_GENERIC;
+}
+
+#endif /* !SIMD_LEVEL_H_ */
@@ -0,0 +1,299 @@
+/* spblas/benchmark.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Memory bandwidth and GFLOP/s of gsl_spblas_dgemv.
+ *
+ * usage: benchmark [-t nthreads] [-b blocksize] [file.mtx ...]
+ *
+ * Each matrix is stored in CSR, CSC, BSR (blocksize x blocksize blocks,
+ * default 4) and SELL-8-256 format and y = A x and y = A^T x are timed with 1, 2, 4, ... up to
+ * nthreads threads (default 1). The bandwidth counts the bytes which
+ * must be moved at least once per product: the stored values and
+ * indices of A (including the zeros of BSR blocks and SELL padding), its
+ * pointers, x, and y read and written; the GFLOP/s count only the
+ * nonzeros of the matrix. Matrices may be given as Matrix Market files
+ * in the coordinate real general format written by gsl_spmatrix_fprintf;
+ * otherwise the following standard cases are generated:
+ *
+ * lap2d  5 point Laplacian on a 1000 x 1000 grid (regular, local access)
+ * lap3d  7 point Laplacian on a 100^3 grid (three bands far apart)
+ * rand   3*10^5 x 3*10^5 with 10 random columns per row (random access to x)
+ * power  3*10^5 x 3*10^5 with row lengths from a power law (load imbalance)
+ * block  lap2d on a 250 x 250 grid with dense blocksize^2 blocks (BSR)
+ *
+ * Build with "make benchmark". Set GSL_SIMD=generic to compare
+ * with the scalar gathers. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+
+static double
+wall_time (void)
+{
+#ifdef _OPENMP
+  return omp_get_wtime ();
+#else
+  return (double) clock () / CLOCKS_PER_SEC;
+#endif
+}
+
+/* uniform random integer in [0,n) */
+static size_t
+rand_index (const size_t n)
+{
+  const double u = ((double) rand () * ((double) RAND_MAX + 1.0) + rand ())
+    / (((double) RAND_MAX + 1.0) * ((double) RAND_MAX + 1.0));
+
+  return (size_t) (u * n);
+}
+
+static gsl_spmatrix *
+make_laplacian (const size_t n, const int dim)
+{
+  const size_t N = (dim == 2) ? n * n : n * n * n;
+  gsl_spmatrix *T = gsl_spmatrix_alloc_nzmax (N, N, (2 * dim + 1) * N, GSL_SPMATRIX_COO);
+  const size_t stride[3] = { 1, n, n * n };
+  size_t i;
+  int d;
+
+  for (i = 0; i < N; ++i)
+    {
+      gsl_spmatrix_append (T, i, i, 2.0 * dim);
+
+      for (d = 0; d < dim; ++d)
+        {
+          const size_t c = (i / stride[d]) % n;
+
+          if (c > 0)
+            gsl_spmatrix_append (T, i, i - stride[d], -1.0);
+          if (c + 1 < n)
+            gsl_spmatrix_append (T, i, i + stride[d], -1.0);
+        }
+    }
+
+  return T;
+}
+
+/* the Kronecker product of T with a dense b-by-b block */
+static gsl_spmatrix *
+make_block (gsl_spmatrix * T, const size_t b)
+{
+  gsl_spmatrix *B = gsl_spmatrix_alloc_nzmax (T->size1 * b, T->size2 * b,
+                                              T->nz * b * b, GSL_SPMATRIX_COO);
+  size_t n, ii, jj;
+
+  for (n = 0; n < T->nz; ++n)
+    {
+      for (ii = 0; ii < b; ++ii)
+        for (jj = 0; jj < b; ++jj)
+          gsl_spmatrix_append (B, T->i[n] * b + ii, T->p[n] * b + jj,
+                            T->data[n] / (1.0 + ii + jj));
+    }
+
+  gsl_spmatrix_free (T);
+
+  return B;
+}
+
+/* row i has about len(i) entries in random columns */
+static gsl_spmatrix *
+make_random (const size_t N, const int power)
+{
+  gsl_spmatrix *T = gsl_spmatrix_alloc_nzmax (N, N, 10 * N, GSL_SPMATRIX_COO);
+  size_t i, k;
+
+  for (i = 0; i < N; ++i)
+    {
+      size_t len = 10;
+
+      /* lengths 2/(1-u) for u uniform in [0,0.9999], with mean
+         about 18 and a few rows of up to 2*10^4 */
+      if (power)
+        len = (size_t) (2.0 / (1.0 - 0.9999 * rand_index (1000000) / 1.0e6));
+
+      for (k = 0; k < len; ++k)
+        gsl_spmatrix_append (T, i, rand_index (N), 1.0 / (k + 1.0));
+    }
+
+  return T;
+}
+
+/* bytes of the values, indices and pointers of A */
+static double
+matrix_bytes (const gsl_spmatrix * A)
+{
+  const double nz = (double) gsl_spmatrix_nnz (A);
+
+  if (GSL_SPMATRIX_ISBSR (A))
+    {
+      const size_t nb1 = (A->size1 + A->block_size1 - 1) / A->block_size1;
+      return 8.0 * nz + 4.0 * A->p[nb1] + 4.0 * (nb1 + 1);
+    }
+  else if (GSL_SPMATRIX_ISSELL (A))
+    {
+      const size_t nslice = (A->size1 + A->block_size1 - 1) / A->block_size1;
+      return 12.0 * nz + 4.0 * (nslice + 1) + 4.0 * A->size1;
+    }
+  else
+    {
+      const size_t outer = GSL_SPMATRIX_ISCSR (A) ? A->size1 : A->size2;
+      return 12.0 * nz + 4.0 * (outer + 1);
+    }
+}
+
+/* time y = op(A) x, where A has nnz nonzeros, and print GB/s and GFLOP/s */
+static void
+run (const char *name, const gsl_spmatrix * A, const size_t nnz,
+     const size_t maxthreads)
+{
+  const char *fmt = gsl_spmatrix_type (A);
+  int trans;
+
+  for (trans = 0; trans < 2; ++trans)
+    {
+      const CBLAS_TRANSPOSE_t TransA = trans ? CblasTrans : CblasNoTrans;
+      const size_t lenX = trans ? A->size1 : A->size2;
+      const size_t lenY = trans ? A->size2 : A->size1;
+      const double bytes = matrix_bytes (A) + 8.0 * lenX + 16.0 * lenY;
+      gsl_vector *x = gsl_vector_alloc (lenX);
+      gsl_vector *y = gsl_vector_calloc (lenY);
+      size_t nthreads;
+
+      gsl_vector_set_all (x, 1.0);
+
+      for (nthreads = 1; nthreads <= maxthreads; nthreads *= 2)
+        {
+          double start, t;
+          size_t count = 0;
+
+          gsl_set_num_threads (nthreads);
+          gsl_spblas_dgemv (TransA, 1.0, A, x, 0.0, y);
+
+          start = wall_time ();
+
+          do
+            {
+              gsl_spblas_dgemv (TransA, 1.0, A, x, 0.0, y);
+              ++count;
+              t = wall_time () - start;
+            }
+          while (t < 0.5);
+
+          t /= count;
+
+          printf ("%-12s %-4s %-5s %3zu %9.2f %9.3f\n", name, fmt,
+                  trans ? "A^T x" : "A x", nthreads,
+                  bytes / t * 1.0e-9, 2.0 * nnz / t * 1.0e-9);
+          fflush (stdout);
+        }
+
+      gsl_vector_free (x);
+      gsl_vector_free (y);
+    }
+}
+
+static size_t blocksize = 4;
+
+static void
+bench (const char *name, gsl_spmatrix * T, const size_t maxthreads)
+{
+  gsl_spmatrix *A = gsl_spmatrix_compress (T, GSL_SPMATRIX_CSR);
+  const size_t nnz = gsl_spmatrix_nnz (A);
+  gsl_spmatrix *B = gsl_spmatrix_compress (T, GSL_SPMATRIX_CSC);
+  gsl_spmatrix *C = gsl_spmatrix_compress_bsr (A, blocksize, blocksize);
+  gsl_spmatrix *D = gsl_spmatrix_compress_sell (A, 8, 256);
+
+  run (name, A, nnz, maxthreads);
+  run (name, B, nnz, maxthreads);
+  run (name, C, nnz, maxthreads);
+  run (name, D, nnz, maxthreads);
+
+  gsl_spmatrix_free (A);
+  gsl_spmatrix_free (B);
+  gsl_spmatrix_free (C);
+  gsl_spmatrix_free (D);
+  gsl_spmatrix_free (T);
+}
+
+int
+main (int argc, char *argv[])
+{
+  size_t maxthreads = 1;
+  int nfiles = 0;
+  int i;
+
+  printf ("%-12s %-4s %-5s %3s %9s %9s\n", "matrix", "fmt", "op", "thr", "GB/s", "GFLOP/s");
+
+  for (i = 1; i < argc; ++i)
+    {
+      if (strcmp (argv[i], "-t") == 0 && i + 1 < argc)
+        {
+          maxthreads = strtoul (argv[++i], NULL, 0);
+        }
+      else if (strcmp (argv[i], "-b") == 0 && i + 1 < argc)
+        {
+          blocksize = strtoul (argv[++i], NULL, 0);
+          if (blocksize == 0)
+            blocksize = 1;
+        }
+      else
+        {
+          FILE *f = fopen (argv[i], "r");
+          gsl_spmatrix *T;
+          const char *name = strrchr (argv[i], '/');
+
+          if (f == NULL)
+            {
+              fprintf (stderr, "benchmark: cannot open %s\n", argv[i]);
+              exit (EXIT_FAILURE);
+            }
+
+          T = gsl_spmatrix_fscanf (f);
+          fclose (f);
+
+          if (T == NULL)
+            exit (EXIT_FAILURE);
+
+          bench (name ? name + 1 : argv[i], T, maxthreads);
+          ++nfiles;
+        }
+    }
+
+  if (nfiles == 0)
+    {
+      bench ("lap2d", make_laplacian (1000, 2), maxthreads);
+      bench ("lap3d", make_laplacian (100, 3), maxthreads);
+      bench ("rand", make_random (300000, 0), maxthreads);
+      bench ("power", make_random (300000, 1), maxthreads);
+      bench ("block", make_block (make_laplacian (250, 2), blocksize), maxthreads);
+    }
+
+  return 0;
+}
@@ -26,6 +26,7 @@
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spmatrix64.h>
 #include <gsl/gsl_blas.h>
 
 #undef __BEGIN_DECLS
@@ -40,6 +41,26 @@
 
 __BEGIN_DECLS
 
+/* level schedule of a sparse triangular matrix op(A) */
+typedef struct
+{
+  size_t n;                 /* size of matrix */
+  size_t nz;                /* number of stored elements of A */
+  int sptype;               /* storage format of A */
+  CBLAS_UPLO_t Uplo;        /* triangle of A */
+  CBLAS_TRANSPOSE_t TransA; /* op(A) = A or A^T */
+  size_t nlevels;           /* number of levels */
+  size_t *levptr;           /* level l is row[levptr[l]..levptr[l+1]-1] */
+  int *row;                 /* rows of op(A) by levels */
+  int *diag;                /* position in A->data of the diagonal of each row, or -1 */
+  size_t ndiag;             /* number of diagonal elements present */
+  int *Rp;                  /* off-diagonal elements of each row of op(A), size n+1 */
+  int *Rj;                  /* column of each element in op(A) */
+  int *Rq;                  /* position of each element in A->data */
+  int *Rs;                  /* if not NULL, row i is A->data[Rs[i]..], and Rj, Rq are NULL */
+  size_t nnz;               /* number of off-diagonal elements */
+} gsl_spblas_trsv_workspace;
+
 /*
  * Prototypes
  */
@@ -47,8 +68,22 @@ __BEGIN_DECLS
 int gsl_spblas_dgemv(const CBLAS_TRANSPOSE_t TransA, const double alpha,
                      const gsl_spmatrix *A, const gsl_vector *x,
                      const double beta, gsl_vector *y);
+int gsl_spblas_dgemv64(const CBLAS_TRANSPOSE_t TransA, const double alpha,
+                       const gsl_spmatrix64 *A, const gsl_vector *x,
+                       const double beta, gsl_vector *y);
 int gsl_spblas_dgemm(const double alpha, const gsl_spmatrix *A,
                      const gsl_spmatrix *B, gsl_spmatrix *C);
+int gsl_spblas_dgemm_symbolic(const gsl_spmatrix *A, const gsl_spmatrix *B,
+                              gsl_spmatrix *C);
+int gsl_spblas_dgemm_numeric(const double alpha, const gsl_spmatrix *A,
+                             const gsl_spmatrix *B, gsl_spmatrix *C);
+gsl_spblas_trsv_workspace *
+gsl_spblas_dtrsv_alloc(const CBLAS_UPLO_t Uplo, const CBLAS_TRANSPOSE_t TransA,
+                       const gsl_spmatrix *A);
+void gsl_spblas_dtrsv_free(gsl_spblas_trsv_workspace *w);
+int gsl_spblas_dtrsv(const CBLAS_UPLO_t Uplo, const CBLAS_TRANSPOSE_t TransA,
+                     const CBLAS_DIAG_t Diag, const gsl_spmatrix *A,
+                     gsl_vector *x, const gsl_spblas_trsv_workspace *w);
 size_t gsl_spblas_scatter(const gsl_spmatrix *A, const size_t j,
                           const double alpha, int *w, double *x,
                           const int mark, gsl_spmatrix *C, size_t nz);
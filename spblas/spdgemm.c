@@ -20,10 +20,67 @@
 #include <config.h>
 #include <stdlib.h>
 #include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_spmatrix.h>
 #include <gsl/gsl_spblas.h>
 #include <gsl/gsl_errno.h>
 
+/*
+ * The product C = alpha A B of two CSC matrices is computed a column at
+ * a time with Gustavson's algorithm, in two phases:
+ *
+ * symbolic: the pattern of C(:,j) is the union of the patterns of the
+ * columns A(:,k) with B(k,j) != 0. The columns are first counted, so
+ * that C is allocated once at its final size, and then filled.
+ *
+ * numeric: C(:,j) is accumulated in a dense vector indexed by row,
+ * which is cleared only on the pattern of C(:,j), and gathered into C.
+ *
+ * A pattern from gsl_spblas_dgemm_symbolic() is reused by
+ * gsl_spblas_dgemm_numeric() as long as the patterns of A and B do not
+ * change. For two CSR matrices the same code computes the rows of C,
+ * C(i,:) = sum_k A(i,k) B(k,:), with the roles of A and B exchanged.
+ *
+ * With more than one thread (see gsl_set_num_threads), the
+ * columns of C are split into one contiguous range per requested
+ * thread, with about the same number of multiply-adds, and each range
+ * has private marker and accumulator vectors. The ranges are shared out
+ * among the threads the OpenMP runtime actually provides. The result
+ * does not depend on the number of threads.
+ */
+
+/* minimum number of multiply-adds per thread */
+#define SPBLAS_THREAD_MIN_FLOPS 32768
+
+/* the outer vectors of C are C_j = sum_{p in Y_j} Y[p] X_{Yi[p]} */
+typedef struct
+{
+  const gsl_spmatrix *X; /* scattered matrix: A for CSC, B for CSR */
+  const gsl_spmatrix *Y; /* driving matrix: B for CSC, A for CSR */
+  size_t nouter;         /* number of columns (CSC) or rows (CSR) of C */
+  size_t ninner;         /* number of rows (CSC) or columns (CSR) of C */
+} spdgemm_operands;
+
+static int spdgemm_check(const gsl_spmatrix *A, const gsl_spmatrix *B,
+                         const gsl_spmatrix *C, spdgemm_operands *op);
+static double *spdgemm_flops(const spdgemm_operands *op);
+static int spdgemm_nthreads(const double flops);
+#ifdef _OPENMP
+static size_t spdgemm_split(const double *flops, const size_t n,
+                            const int nthreads, const int t);
+#endif
+static void spdgemm_count(const size_t j0, const size_t j1,
+                          const spdgemm_operands *op, int *w, int *Cp);
+static void spdgemm_fill(const size_t j0, const size_t j1,
+                         const spdgemm_operands *op, int *w, gsl_spmatrix *C);
+static void spdgemm_values(const size_t j0, const size_t j1,
+                           const double alpha, const spdgemm_operands *op,
+                           double *x, gsl_spmatrix *C);
+
 /*
 gsl_spblas_dgemm()
   Multiply two sparse matrices
@@ -36,12 +93,212 @@ Inputs: alpha - scalar factor
 Return: success or error
 
 Notes:
-1) based on CSparse routine cs_multiply
+1) A, B and C must all be in CSC, or all in CSR format
+2) equivalent to gsl_spblas_dgemm_symbolic() followed by
+   gsl_spblas_dgemm_numeric()
 */
 
 int
 gsl_spblas_dgemm(const double alpha, const gsl_spmatrix *A,
                  const gsl_spmatrix *B, gsl_spmatrix *C)
+{
+  int status = gsl_spblas_dgemm_symbolic(A, B, C);
+
+  if (status)
+    return status;
+
+  return gsl_spblas_dgemm_numeric(alpha, A, B, C);
+} /* gsl_spblas_dgemm() */
+
+/*
+gsl_spblas_dgemm_symbolic()
+  Compute the sparsity pattern of the product A * B
+
+Inputs: A - sparse matrix
+        B - sparse matrix
+        C - (output) pattern of A * B, with zero values; C is
+            reallocated if needed
+
+Return: success or error
+*/
+
+int
+gsl_spblas_dgemm_symbolic(const gsl_spmatrix *A, const gsl_spmatrix *B,
+                          gsl_spmatrix *C)
+{
+  spdgemm_operands op;
+  int status = spdgemm_check(A, B, C, &op);
+
+  if (status)
+    {
+      return status;
+    }
+  else
+    {
+      double *flops = spdgemm_flops(&op);
+      int nthreads;
+      int *w;
+      size_t k, nz;
+
+      if (flops == NULL)
+        {
+          GSL_ERROR("failed to allocate space for workspace", GSL_ENOMEM);
+        }
+
+      nthreads = spdgemm_nthreads(flops[op.nouter]);
+
+      w = malloc(nthreads * op.ninner * sizeof(int));
+      if (w == NULL)
+        {
+          free(flops);
+          GSL_ERROR("failed to allocate space for workspace", GSL_ENOMEM);
+        }
+
+      for (k = 0; k < nthreads * op.ninner; ++k)
+        w[k] = -1;
+
+      /* number of entries in each column of C */
+      if (nthreads == 1)
+        {
+          spdgemm_count(0, op.nouter, &op, w, C->p);
+        }
+      else
+        {
+#ifdef _OPENMP
+          int t;
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+          for (t = 0; t < nthreads; ++t)
+            spdgemm_count(spdgemm_split(flops, op.nouter, nthreads, t),
+                          spdgemm_split(flops, op.nouter, nthreads, t + 1),
+                          &op, w + t * op.ninner, C->p);
+#endif
+        }
+
+      gsl_spmatrix_cumsum(op.nouter, C->p);
+      nz = (size_t) C->p[op.nouter];
+
+      if (C->nzmax < nz)
+        {
+          status = gsl_spmatrix_realloc(nz, C);
+          if (status)
+            {
+              free(flops);
+              free(w);
+              GSL_ERROR("unable to realloc matrix C", status);
+            }
+        }
+
+      for (k = 0; k < nthreads * op.ninner; ++k)
+        w[k] = -1;
+
+      /* row indices of each column of C */
+      if (nthreads == 1)
+        {
+          spdgemm_fill(0, op.nouter, &op, w, C);
+        }
+      else
+        {
+#ifdef _OPENMP
+          int t;
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+          for (t = 0; t < nthreads; ++t)
+            spdgemm_fill(spdgemm_split(flops, op.nouter, nthreads, t),
+                         spdgemm_split(flops, op.nouter, nthreads, t + 1),
+                         &op, w + t * op.ninner, C);
+#endif
+        }
+
+      C->nz = nz;
+
+      free(flops);
+      free(w);
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_spblas_dgemm_symbolic() */
+
+/*
+gsl_spblas_dgemm_numeric()
+  Compute the values of C = alpha * A * B on the pattern computed
+by gsl_spblas_dgemm_symbolic()
+
+Inputs: alpha - scalar factor
+        A     - sparse matrix
+        B     - sparse matrix
+        C     - (input/output) on input, the pattern of A * B from
+                gsl_spblas_dgemm_symbolic(); on output C = alpha * A * B
+
+Return: success or error
+
+Notes:
+1) A and B must have the same patterns as in the call to
+gsl_spblas_dgemm_symbolic(); only their values may change
+*/
+
+int
+gsl_spblas_dgemm_numeric(const double alpha, const gsl_spmatrix *A,
+                         const gsl_spmatrix *B, gsl_spmatrix *C)
+{
+  spdgemm_operands op;
+  int status = spdgemm_check(A, B, C, &op);
+
+  if (status)
+    {
+      return status;
+    }
+  else if ((size_t) C->p[op.nouter] != C->nz)
+    {
+      GSL_ERROR("C does not contain a symbolic product", GSL_EINVAL);
+    }
+  else
+    {
+      double *flops = spdgemm_flops(&op);
+      int nthreads;
+      double *x;
+
+      if (flops == NULL)
+        {
+          GSL_ERROR("failed to allocate space for workspace", GSL_ENOMEM);
+        }
+
+      nthreads = spdgemm_nthreads(flops[op.nouter]);
+
+      x = malloc(nthreads * op.ninner * sizeof(double));
+      if (x == NULL)
+        {
+          free(flops);
+          GSL_ERROR("failed to allocate space for workspace", GSL_ENOMEM);
+        }
+
+      if (nthreads == 1)
+        {
+          spdgemm_values(0, op.nouter, alpha, &op, x, C);
+        }
+      else
+        {
+#ifdef _OPENMP
+          int t;
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+          for (t = 0; t < nthreads; ++t)
+            spdgemm_values(spdgemm_split(flops, op.nouter, nthreads, t),
+                         spdgemm_split(flops, op.nouter, nthreads, t + 1),
+                           alpha, &op, x + t * op.ninner, C);
+#endif
+        }
+
+      free(flops);
+      free(x);
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_spblas_dgemm_numeric() */
+
+static int
+spdgemm_check(const gsl_spmatrix *A, const gsl_spmatrix *B,
+              const gsl_spmatrix *C, spdgemm_operands *op)
 {
   if (A->size2 != B->size1 || A->size1 != C->size1 || B->size2 != C->size2)
     {
@@ -51,78 +308,219 @@ gsl_spblas_dgemm(const double alpha, const gsl_spmatrix *A,
     {
       GSL_ERROR("matrix storage formats do not match", GSL_EINVAL);
     }
-  else if (!GSL_SPMATRIX_ISCCS(A))
+  else if (GSL_SPMATRIX_ISCSC(A))
+    {
+      op->X = A;
+      op->Y = B;
+      op->nouter = C->size2;
+      op->ninner = C->size1;
+      return GSL_SUCCESS;
+    }
+  else if (GSL_SPMATRIX_ISCSR(A))
     {
-      GSL_ERROR("compressed column format required", GSL_EINVAL);
+      op->X = B;
+      op->Y = A;
+      op->nouter = C->size1;
+      op->ninner = C->size2;
+      return GSL_SUCCESS;
     }
   else
     {
-      int status = GSL_SUCCESS;
-      const size_t M = A->size1;
-      const size_t N = B->size2;
-      int *Bi = B->i;
-      int *Bp = B->p;
-      double *Bd = B->data;
-      int *w = A->work.work_int;      /* workspace of length M */
-      double *x = C->work.work_atomic; /* workspace of length M */
-      int *Cp, *Ci;
-      double *Cd;
-      size_t j;
-      int p;
-      size_t nz = 0;
-
-      if (C->nzmax < A->nz + B->nz)
-        {
-          status = gsl_spmatrix_realloc(A->nz + B->nz, C);
-          if (status)
-            {
-              GSL_ERROR("unable to realloc matrix C", status);
-            }
+      GSL_ERROR("compressed column or row format required", GSL_EINVAL);
+    }
+}
+
+/* flops[j] = number of multiply-adds for the first j columns of C */
+static double *
+spdgemm_flops(const spdgemm_operands *op)
+{
+  const int *Xp = op->X->p;
+  const int *Yi = op->Y->i;
+  const int *Yp = op->Y->p;
+  double *flops = malloc((op->nouter + 1) * sizeof(double));
+  size_t j;
+  int p;
+
+  if (flops == NULL)
+    return NULL;
+
+  flops[0] = 0.0;
+
+  for (j = 0; j < op->nouter; ++j)
+    {
+      double f = 0.0;
+
+      for (p = Yp[j]; p < Yp[j + 1]; ++p)
+        f += Xp[Yi[p] + 1] - Xp[Yi[p]];
+
+      flops[j + 1] = flops[j] + f;
+    }
+
+  return flops;
+}
+
+/* number of threads to use for a product with the given work */
+static int
+spdgemm_nthreads(const double flops)
+{
+#ifdef _OPENMP
+  size_t nthreads = gsl_get_num_threads();
+
+  if (nthreads <= 1 || omp_in_parallel())
+    return 1;
+
+  nthreads = GSL_MIN(nthreads, (size_t) (flops / SPBLAS_THREAD_MIN_FLOPS));
+
+  return (nthreads > 1) ? (int) nthreads : 1;
+#else
+  (void) flops;
+  return 1;
+#endif
+}
+
+#ifdef _OPENMP
+
+/* first column of slice t (0 <= t <= nthreads) when the n columns are
+   split into nthreads slices of about the same work */
+static size_t
+spdgemm_split(const double *flops, const size_t n, const int nthreads,
+              const int t)
+{
+  if (t >= nthreads)
+    return n;
+  else
+    {
+      const double target = flops[n] * t / nthreads;
+      size_t lo = 0, hi = n;
+
+      /* smallest j with flops[j] >= target */
+      while (lo < hi)
+        {
+          const size_t mid = lo + (hi - lo) / 2;
+
+          if (flops[mid] < target)
+            lo = mid + 1;
+          else
+            hi = mid;
         }
 
-      /* initialize workspace to 0 */
-      for (j = 0; j < M; ++j)
-        w[j] = 0;
+      return lo;
+    }
+}
+
+#endif /* _OPENMP */
 
-      Cp = C->p;
-      Ci = C->i;
-      Cd = C->data;
+/* Cp[j] = number of entries of C(:,j) for j in [j0,j1); w[i] is the
+   last column in which row i was found */
+static void
+spdgemm_count(const size_t j0, const size_t j1, const spdgemm_operands *op,
+              int *w, int *Cp)
+{
+  const int *Xi = op->X->i;
+  const int *Xp = op->X->p;
+  const int *Yi = op->Y->i;
+  const int *Yp = op->Y->p;
+  size_t j;
+  int p, q;
 
-      for (j = 0; j < N; ++j)
+  for (j = j0; j < j1; ++j)
+    {
+      int nz = 0;
+
+      for (p = Yp[j]; p < Yp[j + 1]; ++p)
         {
-          if (nz + M > C->nzmax)
+          const int k = Yi[p];
+
+          for (q = Xp[k]; q < Xp[k + 1]; ++q)
             {
-              status = gsl_spmatrix_realloc(2 * C->nzmax + M, C);
-              if (status)
+              const int i = Xi[q];
+
+              if (w[i] != (int) j)
                 {
-                  GSL_ERROR("unable to realloc matrix C", status);
+                  w[i] = (int) j;
+                  ++nz;
                 }
-
-              /* these pointers could have changed due to reallocation */
-              Ci = C->i;
-              Cd = C->data;
             }
+        }
+
+      Cp[j] = nz;
+    }
+}
 
-          Cp[j] = nz; /* column j of C starts here */
+/* row indices of C(:,j) for j in [j0,j1), in order of first occurrence */
+static void
+spdgemm_fill(const size_t j0, const size_t j1, const spdgemm_operands *op,
+             int *w, gsl_spmatrix *C)
+{
+  const int *Xi = op->X->i;
+  const int *Xp = op->X->p;
+  const int *Yi = op->Y->i;
+  const int *Yp = op->Y->p;
+  int *Ci = C->i;
+  double *Cd = C->data;
+  size_t j;
+  int p, q;
+
+  for (j = j0; j < j1; ++j)
+    {
+      int nz = C->p[j];
+
+      for (p = Yp[j]; p < Yp[j + 1]; ++p)
+        {
+          const int k = Yi[p];
 
-          for (p = Bp[j]; p < Bp[j + 1]; ++p)
+          for (q = Xp[k]; q < Xp[k + 1]; ++q)
             {
-              nz = gsl_spblas_scatter(A, Bi[p], Bd[p], w, x, (int) (j + 1), C, nz);
-            }
+              const int i = Xi[q];
 
-          for (p = Cp[j]; p < (int) nz; ++p)
-            Cd[p] = x[Ci[p]];
+              if (w[i] != (int) j)
+                {
+                  w[i] = (int) j;
+                  Ci[nz] = i;
+                  Cd[nz] = 0.0;
+                  ++nz;
+                }
+            }
         }
+    }
+}
 
-      Cp[N] = nz;
-      C->nz = nz;
+/* C(:,j) = alpha * sum_k A(:,k) B(k,j) for j in [j0,j1), accumulated
+   in x */
+static void
+spdgemm_values(const size_t j0, const size_t j1, const double alpha,
+               const spdgemm_operands *op, double *x, gsl_spmatrix *C)
+{
+  const int *Xi = op->X->i;
+  const int *Xp = op->X->p;
+  const double *Xd = op->X->data;
+  const int *Yi = op->Y->i;
+  const int *Yp = op->Y->p;
+  const double *Yd = op->Y->data;
+  const int *Ci = C->i;
+  const int *Cp = C->p;
+  double *Cd = C->data;
+  size_t j;
+  int p, q;
 
-      /* scale by alpha */
-      gsl_spmatrix_scale(C, alpha);
+  for (j = j0; j < j1; ++j)
+    {
+      for (p = Cp[j]; p < Cp[j + 1]; ++p)
+        x[Ci[p]] = 0.0;
 
-      return status;
+      for (p = Yp[j]; p < Yp[j + 1]; ++p)
+        {
+          const int k = Yi[p];
+          const double y = Yd[p];
+
+          for (q = Xp[k]; q < Xp[k + 1]; ++q)
+            x[Xi[q]] += y * Xd[q];
+        }
+
+      for (p = Cp[j]; p < Cp[j + 1]; ++p)
+        Cd[p] = alpha * x[Ci[p]];
     }
-} /* gsl_spblas_dgemm() */
+}
 
 /*
 gsl_spblas_scatter()
@@ -19,7 +19,11 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_vector.h>
@@ -28,6 +32,545 @@
 #include <gsl/gsl_spblas.h>
 #include <gsl/gsl_blas.h>
 
+#include "simd_level.h"
+
+/*
+ * The product is computed in one of two forms, depending on the storage
+ * of A and on TransA:
+ *
+ * row form (CSR and y = A x, or CSC and y = A^T x): each element of y
+ * is the dot product of a compressed row with x, gathered through the
+ * row's indices. On x86 the gathers are vectorized with AVX2 or
+ * AVX-512F when the CPU supports them (the choice can be capped with
+ * the GSL_SIMD environment variable, as for the CBLAS kernels).
+ *
+ * scatter form (CSC and y = A x, or CSR and y = A^T x): each compressed
+ * column is scaled by an element of x and added into y.
+ *
+ * BSR and SELL matrices use the row form for y = A x, a block row or a
+ * slice at a time, and the scatter form for y = A^T x, which is not
+ * multithreaded for these formats.
+ *
+ * With more than one thread (see gsl_set_num_threads), the
+ * compressed rows or columns are split into one contiguous range per
+ * requested thread, with about the same number of nonzeros, and the
+ * ranges are shared out among the threads the OpenMP runtime actually
+ * provides. In the row form each range gives its own elements of y. In
+ * the scatter form each range is accumulated into a private vector, and
+ * the vectors are summed into y in range order, so no atomic updates
+ * are needed and the result is reproducible for a given number of
+ * threads. The scatter form uses at most nnz / lenY private vectors, so
+ * its workspace is never larger than A itself.
+ */
+
+typedef double spdot_fn (const int n, const double *a, const int *ia,
+                         const double *x);
+
+static double
+spdot_generic (const int n, const double *a, const int *ia, const double *x)
+{
+  double r = 0.0;
+  int k;
+
+  for (k = 0; k < n; ++k)
+    r += a[k] * x[ia[k]];
+
+  return r;
+}
+
+#ifdef HAVE_X86_SIMD_DISPATCH
+
+#include <immintrin.h>
+
+__attribute__ ((target ("avx2,fma")))
+static double
+spdot_avx2 (const int n, const double *a, const int *ia, const double *x)
+{
+  __m256d s0 = _mm256_setzero_pd ();
+  __m256d s1 = _mm256_setzero_pd ();
+  double t[4], r;
+  int k = 0;
+
+  for (; k + 8 <= n; k += 8)
+    {
+      const __m128i i0 = _mm_loadu_si128 ((const __m128i *) (ia + k));
+      const __m128i i1 = _mm_loadu_si128 ((const __m128i *) (ia + k + 4));
+      const __m256d x0 = _mm256_i32gather_pd (x, i0, 8);
+      const __m256d x1 = _mm256_i32gather_pd (x, i1, 8);
+
+      s0 = _mm256_fmadd_pd (_mm256_loadu_pd (a + k), x0, s0);
+      s1 = _mm256_fmadd_pd (_mm256_loadu_pd (a + k + 4), x1, s1);
+    }
+
+  if (k + 4 <= n)
+    {
+      const __m128i i0 = _mm_loadu_si128 ((const __m128i *) (ia + k));
+      const __m256d x0 = _mm256_i32gather_pd (x, i0, 8);
+
+      s0 = _mm256_fmadd_pd (_mm256_loadu_pd (a + k), x0, s0);
+      k += 4;
+    }
+
+  _mm256_storeu_pd (t, _mm256_add_pd (s0, s1));
+  r = (t[0] + t[1]) + (t[2] + t[3]);
+
+  for (; k < n; ++k)
+    r += a[k] * x[ia[k]];
+
+  return r;
+}
+
+__attribute__ ((target ("avx512f")))
+static double
+spdot_avx512 (const int n, const double *a, const int *ia, const double *x)
+{
+  __m512d s0 = _mm512_setzero_pd ();
+  double r;
+  int k = 0;
+
+  for (; k + 8 <= n; k += 8)
+    {
+      const __m256i i0 = _mm256_loadu_si256 ((const __m256i *) (ia + k));
+      const __m512d x0 = _mm512_i32gather_pd (i0, x, 8);
+
+      s0 = _mm512_fmadd_pd (_mm512_loadu_pd (a + k), x0, s0);
+    }
+
+  r = _mm512_reduce_add_pd (s0);
+
+  for (; k < n; ++k)
+    r += a[k] * x[ia[k]];
+
+  return r;
+}
+
+#endif /* HAVE_X86_SIMD_DISPATCH */
+
+static spdot_fn *
+spdot_select (void)
+{
+  const int level = simd_level ();
+
+#ifdef HAVE_X86_SIMD_DISPATCH
+  switch (level)
+    {
+    case SIMD_AVX512:
+      return spdot_avx512;
+
+    case SIMD_AVX2:
+      return spdot_avx2;
+    }
+#endif
+
+  (void) level;
+  return spdot_generic;
+}
+
+static spdot_fn *spdot_kernel = NULL;
+
+/* number of rows of a SELL slice processed together */
+#define SPBLAS_SELL_CHUNK 32
+
+/* t[r] = sum_k a[k*C + r] x[ia[k*C + r]] for the nr <= SPBLAS_SELL_CHUNK
+   rows of a SELL slice of height C and the given width */
+typedef void spslice_fn (const size_t nr, const size_t width, const size_t C,
+                         const double *a, const int *ia, const double *x,
+                         double *t);
+
+static void
+spslice_generic (const size_t nr, const size_t width, const size_t C,
+                 const double *a, const int *ia, const double *x, double *t)
+{
+  size_t k, r;
+
+  for (r = 0; r < nr; ++r)
+    t[r] = 0.0;
+
+  for (k = 0; k < width; ++k)
+    {
+      for (r = 0; r < nr; ++r)
+        t[r] += a[k * C + r] * x[ia[k * C + r]];
+    }
+}
+
+#ifdef HAVE_X86_SIMD_DISPATCH
+
+__attribute__ ((target ("avx2,fma")))
+static void
+spslice_avx2 (const size_t nr, const size_t width, const size_t C,
+              const double *a, const int *ia, const double *x, double *t)
+{
+  size_t k, r = 0;
+
+  /* 4 rows at a time, one gather per column of the slice */
+  for (; r + 4 <= nr; r += 4)
+    {
+      __m256d s0 = _mm256_setzero_pd ();
+
+      for (k = 0; k < width; ++k)
+        {
+          const __m128i i0 = _mm_loadu_si128 ((const __m128i *) (ia + k * C + r));
+          s0 = _mm256_fmadd_pd (_mm256_loadu_pd (a + k * C + r),
+                                _mm256_i32gather_pd (x, i0, 8), s0);
+        }
+
+      _mm256_storeu_pd (t + r, s0);
+    }
+
+  if (r < nr)
+    spslice_generic (nr - r, width, C, a + r, ia + r, x, t + r);
+}
+
+__attribute__ ((target ("avx512f")))
+static void
+spslice_avx512 (const size_t nr, const size_t width, const size_t C,
+                const double *a, const int *ia, const double *x, double *t)
+{
+  size_t k, r = 0;
+
+  /* 8 rows at a time, one gather per column of the slice */
+  for (; r + 8 <= nr; r += 8)
+    {
+      __m512d s0 = _mm512_setzero_pd ();
+
+      for (k = 0; k < width; ++k)
+        {
+          const __m256i i0 = _mm256_loadu_si256 ((const __m256i *) (ia + k * C + r));
+          s0 = _mm512_fmadd_pd (_mm512_loadu_pd (a + k * C + r),
+                                _mm512_i32gather_pd (i0, x, 8), s0);
+        }
+
+      _mm512_storeu_pd (t + r, s0);
+    }
+
+  if (r < nr)
+    spslice_avx2 (nr - r, width, C, a + r, ia + r, x, t + r);
+}
+
+#endif /* HAVE_X86_SIMD_DISPATCH */
+
+static spslice_fn *
+spslice_select (void)
+{
+  const int level = simd_level ();
+
+#ifdef HAVE_X86_SIMD_DISPATCH
+  switch (level)
+    {
+    case SIMD_AVX512:
+      return spslice_avx512;
+
+    case SIMD_AVX2:
+      return spslice_avx2;
+    }
+#endif
+
+  (void) level;
+  return spslice_generic;
+}
+
+static spslice_fn *spslice_kernel = NULL;
+
+/* sum_k a[k] x[ia[k]*incx], vectorized for unit stride */
+static double
+spdgemv_dot (const int n, const double *a, const int *ia, const double *x,
+             const size_t incx)
+{
+  if (incx == 1)
+    {
+      return (*spdot_kernel) (n, a, ia, x);
+    }
+  else
+    {
+      double r = 0.0;
+      int k;
+
+      for (k = 0; k < n; ++k)
+        r += a[k] * x[ia[k] * incx];
+
+      return r;
+    }
+}
+
+#define INDEX int
+#define FUNCTION(name) spdgemv_ ## name
+#include "spdgemv_source.c"
+#undef FUNCTION
+#undef INDEX
+
+/* largest block height handled by the unit stride BSR kernel */
+#define SPBLAS_BSR_MAX 16
+
+/* t += sum of the blocks k0 <= k < k1 of a block row times x, for
+   r-by-c blocks inside the matrix */
+static void
+spdgemv_bsr_row (const size_t r, const size_t c, const int k0, const int k1,
+                 const double *Ad, const int *Ai, const double *X, double *t)
+{
+  int k;
+
+  if (r == 2 && c == 2)
+    {
+      double t0 = 0.0, t1 = 0.0;
+
+      for (k = k0; k < k1; ++k)
+        {
+          const double *B = Ad + 4 * (size_t) k;
+          const double *xb = X + 2 * (size_t) Ai[k];
+          const double x0 = xb[0], x1 = xb[1];
+
+          t0 += B[0] * x0 + B[1] * x1;
+          t1 += B[2] * x0 + B[3] * x1;
+        }
+
+      t[0] += t0;
+      t[1] += t1;
+    }
+  else if (r == 4 && c == 4)
+    {
+      double t0 = 0.0, t1 = 0.0, t2 = 0.0, t3 = 0.0;
+
+      for (k = k0; k < k1; ++k)
+        {
+          const double *B = Ad + 16 * (size_t) k;
+          const double *xb = X + 4 * (size_t) Ai[k];
+          const double x0 = xb[0], x1 = xb[1], x2 = xb[2], x3 = xb[3];
+
+          t0 += B[0] * x0 + B[1] * x1 + B[2] * x2 + B[3] * x3;
+          t1 += B[4] * x0 + B[5] * x1 + B[6] * x2 + B[7] * x3;
+          t2 += B[8] * x0 + B[9] * x1 + B[10] * x2 + B[11] * x3;
+          t3 += B[12] * x0 + B[13] * x1 + B[14] * x2 + B[15] * x3;
+        }
+
+      t[0] += t0;
+      t[1] += t1;
+      t[2] += t2;
+      t[3] += t3;
+    }
+  else
+    {
+      for (k = k0; k < k1; ++k)
+        {
+          const double *B = Ad + (size_t) k * r * c;
+          const double *xb = X + (size_t) Ai[k] * c;
+          size_t ii, jj;
+
+          for (ii = 0; ii < r; ++ii)
+            {
+              double temp = 0.0;
+
+              for (jj = 0; jj < c; ++jj)
+                temp += B[ii * c + jj] * xb[jj];
+
+              t[ii] += temp;
+            }
+        }
+    }
+}
+
+/* Y += alpha * A X for block rows [I0,I1) of a BSR matrix A */
+static void
+spdgemv_bsr (const size_t I0, const size_t I1, const double alpha,
+             const gsl_spmatrix * A, const double *X, const size_t incX,
+             double *Y, const size_t incY)
+{
+  const size_t r = A->block_size1;
+  const size_t c = A->block_size2;
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  const int *Ap = A->p;
+  const int *Ai = A->i;
+  size_t I;
+
+  if (incX == 1 && r <= SPBLAS_BSR_MAX)
+    {
+      double t[SPBLAS_BSR_MAX];
+
+      for (I = I0; I < I1; ++I)
+        {
+          const size_t mr = GSL_MIN (r, M - I * r);
+          size_t ii;
+          int k1;
+
+          for (ii = 0; ii < r; ++ii)
+            t[ii] = 0.0;
+
+          k1 = Ap[I + 1];
+
+          /* only the last block column can be partly outside of the
+             matrix, and it is the last block of the row */
+          if (k1 > Ap[I] && (size_t) (Ai[k1 - 1] + 1) * c > N)
+            {
+              const double *B = A->data + (size_t) (k1 - 1) * r * c;
+              const size_t j0 = (size_t) Ai[k1 - 1] * c;
+              size_t jj;
+
+              for (ii = 0; ii < r; ++ii)
+                for (jj = 0; jj < N - j0; ++jj)
+                  t[ii] += B[ii * c + jj] * X[j0 + jj];
+
+              --k1;
+            }
+
+          spdgemv_bsr_row (r, c, Ap[I], k1, A->data, Ai, X, t);
+
+          for (ii = 0; ii < mr; ++ii)
+            Y[(I * r + ii) * incY] += alpha * t[ii];
+        }
+    }
+  else
+    {
+      for (I = I0; I < I1; ++I)
+        {
+          const size_t mr = GSL_MIN (r, M - I * r);
+          size_t ii;
+
+          for (ii = 0; ii < mr; ++ii)
+            {
+              double temp = 0.0;
+              int k;
+
+              for (k = Ap[I]; k < Ap[I + 1]; ++k)
+                {
+                  const double *B = A->data + ((size_t) k * r + ii) * c;
+                  const double *xb = X + (size_t) Ai[k] * c * incX;
+                  const size_t nc = GSL_MIN (c, N - (size_t) Ai[k] * c);
+                  size_t jj;
+
+                  for (jj = 0; jj < nc; ++jj)
+                    temp += B[jj] * xb[jj * incX];
+                }
+
+              Y[(I * r + ii) * incY] += alpha * temp;
+            }
+        }
+    }
+}
+
+/* Y += alpha * A^T X for a BSR matrix A */
+static void
+spdgemv_bsr_trans (const double alpha, const gsl_spmatrix * A,
+                   const double *X, const size_t incX,
+                   double *Y, const size_t incY)
+{
+  const size_t r = A->block_size1;
+  const size_t c = A->block_size2;
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+  const size_t nb1 = (M + r - 1) / r;
+  const int *Ap = A->p;
+  const int *Ai = A->i;
+  size_t I;
+
+  for (I = 0; I < nb1; ++I)
+    {
+      const size_t mr = GSL_MIN (r, M - I * r);
+      int k;
+
+      for (k = Ap[I]; k < Ap[I + 1]; ++k)
+        {
+          double *yb = Y + (size_t) Ai[k] * c * incY;
+          const size_t nc = GSL_MIN (c, N - (size_t) Ai[k] * c);
+          size_t ii, jj;
+
+          for (ii = 0; ii < mr; ++ii)
+            {
+              const double *b = A->data + ((size_t) k * r + ii) * c;
+              const double temp = alpha * X[(I * r + ii) * incX];
+
+              for (jj = 0; jj < nc; ++jj)
+                yb[jj * incY] += b[jj] * temp;
+            }
+        }
+    }
+}
+
+/* Y += alpha * A X for slices [s0,s1) of a SELL matrix A */
+static void
+spdgemv_sell (const size_t s0, const size_t s1, const double alpha,
+              const gsl_spmatrix * A, const double *X, const size_t incX,
+              double *Y, const size_t incY)
+{
+  const size_t C = A->block_size1;
+  const size_t M = A->size1;
+  const size_t nslice = (M + C - 1) / C;
+  const int *Ap = A->p;
+  const int *perm = A->p + nslice + 1;
+  spslice_fn *slice = spslice_kernel;
+  size_t s;
+
+  for (s = s0; s < s1; ++s)
+    {
+      const size_t p0 = Ap[s];
+      const size_t width = (Ap[s + 1] - Ap[s]) / C;
+      const size_t nt = GSL_MIN (C, M - s * C);
+      size_t t0;
+
+      /* the elements of a slice are stored by columns, so the rows are
+         accumulated together, SPBLAS_SELL_CHUNK at a time */
+      for (t0 = 0; t0 < nt; t0 += SPBLAS_SELL_CHUNK)
+        {
+          const size_t nr = GSL_MIN (SPBLAS_SELL_CHUNK, nt - t0);
+          const double *a = A->data + p0 + t0;
+          const int *ia = A->i + p0 + t0;
+          double temp[SPBLAS_SELL_CHUNK];
+          size_t k, t;
+
+          if (incX == 1)
+            {
+              (*slice) (nr, width, C, a, ia, X, temp);
+            }
+          else
+            {
+              for (t = 0; t < nr; ++t)
+                temp[t] = 0.0;
+
+              for (k = 0; k < width; ++k)
+                {
+                  for (t = 0; t < nr; ++t)
+                    temp[t] += a[k * C + t] * X[ia[k * C + t] * incX];
+                }
+            }
+
+          for (t = 0; t < nr; ++t)
+            Y[perm[s * C + t0 + t] * incY] += alpha * temp[t];
+        }
+    }
+}
+
+/* Y += alpha * A^T X for a SELL matrix A */
+static void
+spdgemv_sell_trans (const double alpha, const gsl_spmatrix * A,
+                    const double *X, const size_t incX,
+                    double *Y, const size_t incY)
+{
+  const size_t C = A->block_size1;
+  const size_t M = A->size1;
+  const size_t nslice = (M + C - 1) / C;
+  const int *Ap = A->p;
+  const int *perm = A->p + nslice + 1;
+  size_t s;
+
+  for (s = 0; s < nslice; ++s)
+    {
+      const size_t p0 = Ap[s];
+      const size_t width = (Ap[s + 1] - Ap[s]) / C;
+      const size_t nt = GSL_MIN (C, M - s * C);
+      size_t k, t;
+
+      for (t = 0; t < nt; ++t)
+        {
+          const double temp = alpha * X[perm[s * C + t] * incX];
+
+          for (k = 0; k < width; ++k)
+            {
+              const size_t n = p0 + k * C + t;
+              Y[A->i[n] * incY] += A->data[n] * temp;
+            }
+        }
+    }
+}
+
 /*
 gsl_spblas_dgemv()
   Multiply a sparse matrix and a vector
@@ -113,31 +656,60 @@ gsl_spblas_dgemv(const CBLAS_TRANSPOSE_t TransA, const double alpha,
       X = x->data;
       incX = x->stride;
 
-      if ((GSL_SPMATRIX_ISCCS(A) && (TransA == CblasNoTrans)) ||
-          (GSL_SPMATRIX_ISCRS(A) && (TransA == CblasTrans)))
+      if (GSL_SPMATRIX_ISCCS(A) || GSL_SPMATRIX_ISCRS(A))
         {
-          Ai = A->i;
+          const int rowform = GSL_SPMATRIX_ISCRS(A) == (TransA == CblasNoTrans);
 
-          for (j = 0; j < lenX; ++j)
-            {
-              for (p = Ap[j]; p < Ap[j + 1]; ++p)
-                {
-                  Y[Ai[p] * incY] += alpha * Ad[p] * X[j * incX];
-                }
-            }
+          /* concurrent first calls make the same choice */
+          if (spdot_kernel == NULL)
+            spdot_kernel = spdot_select ();
+
+          spdgemv_compressed (rowform, alpha, A->nz, lenX, lenY,
+                              Ap, A->i, Ad, X, incX, Y, incY);
         }
-      else if ((GSL_SPMATRIX_ISCCS(A) && (TransA == CblasTrans)) ||
-               (GSL_SPMATRIX_ISCRS(A) && (TransA == CblasNoTrans)))
+      else if (GSL_SPMATRIX_ISBSR(A) || GSL_SPMATRIX_ISSELL(A))
         {
-          Ai = A->i;
+          /* block rows or slices, split by stored elements */
+          const size_t nb = (M + A->block_size1 - 1) / A->block_size1;
+          const int isbsr = GSL_SPMATRIX_ISBSR(A);
+          const int nthreads = (TransA == CblasNoTrans) ? spdgemv_nthreads (A->nz) : 1;
 
-          for (j = 0; j < lenY; ++j)
+          /* concurrent first calls make the same choice */
+          if (spslice_kernel == NULL)
+            spslice_kernel = spslice_select ();
+
+          if (TransA == CblasTrans)
             {
-              for (p = Ap[j]; p < Ap[j + 1]; ++p)
+              if (isbsr)
+                spdgemv_bsr_trans (alpha, A, X, incX, Y, incY);
+              else
+                spdgemv_sell_trans (alpha, A, X, incX, Y, incY);
+            }
+          else if (nthreads == 1)
+            {
+              if (isbsr)
+                spdgemv_bsr (0, nb, alpha, A, X, incX, Y, incY);
+              else
+                spdgemv_sell (0, nb, alpha, A, X, incX, Y, incY);
+            }
+#ifdef _OPENMP
+          else
+            {
+              int k;
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+              for (k = 0; k < nthreads; ++k)
                 {
-                  Y[j * incY] += alpha * Ad[p] * X[Ai[p] * incX];
+                  const size_t b0 = spdgemv_split (Ap, nb, nthreads, k);
+                  const size_t b1 = spdgemv_split (Ap, nb, nthreads, k + 1);
+
+                  if (isbsr)
+                    spdgemv_bsr (b0, b1, alpha, A, X, incX, Y, incY);
+                  else
+                    spdgemv_sell (b0, b1, alpha, A, X, incX, Y, incY);
                 }
             }
+#endif
         }
       else if (GSL_SPMATRIX_ISTRIPLET(A))
         {
@@ -0,0 +1,146 @@
+/* spblas/spdgemv64.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spmatrix64.h>
+#include <gsl/gsl_spblas.h>
+
+/*
+ * y = alpha*op(A)*x + beta*y for a matrix with size_t indices. The
+ * row and scatter forms and their threading are shared with
+ * gsl_spblas_dgemv (see spdgemv_source.c); the rows are not vectorized
+ * since there are no gathers with 64 bit indices below AVX-512.
+ */
+
+/* sum_k a[k] x[ia[k]*incx] */
+static double
+spdgemv64_dot (const size_t n, const double *a, const size_t *ia,
+               const double *x, const size_t incx)
+{
+  double r = 0.0;
+  size_t k;
+
+  for (k = 0; k < n; ++k)
+    r += a[k] * x[ia[k] * incx];
+
+  return r;
+}
+
+#define INDEX size_t
+#define FUNCTION(name) spdgemv64_ ## name
+#include "spdgemv_source.c"
+#undef FUNCTION
+#undef INDEX
+
+/*
+gsl_spblas_dgemv64()
+  Multiply a sparse matrix with size_t indices and a vector
+
+Inputs: alpha - scalar factor
+        A     - sparse matrix in COO, CSC or CSR format
+        x     - dense vector
+        beta  - scalar factor
+        y     - (input/output) dense vector
+
+Return: y = alpha*op(A)*x + beta*y
+*/
+
+int
+gsl_spblas_dgemv64(const CBLAS_TRANSPOSE_t TransA, const double alpha,
+                   const gsl_spmatrix64 *A, const gsl_vector *x,
+                   const double beta, gsl_vector *y)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+
+  if ((TransA == CblasNoTrans && N != x->size) ||
+      (TransA == CblasTrans && M != x->size))
+    {
+      GSL_ERROR("invalid length of x vector", GSL_EBADLEN);
+    }
+  else if ((TransA == CblasNoTrans && M != y->size) ||
+           (TransA == CblasTrans && N != y->size))
+    {
+      GSL_ERROR("invalid length of y vector", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t lenX = (TransA == CblasNoTrans) ? N : M;
+      const size_t lenY = (TransA == CblasNoTrans) ? M : N;
+      const size_t incX = x->stride;
+      const size_t incY = y->stride;
+      const double *X = x->data;
+      double *Y = y->data;
+      const size_t *Ap = A->p;
+      const size_t *Ai = A->i;
+      const double *Ad = A->data;
+      size_t j;
+
+      /* form y := beta*y */
+
+      if (beta == 0.0)
+        {
+          for (j = 0; j < lenY; ++j)
+            Y[j * incY] = 0.0;
+        }
+      else if (beta != 1.0)
+        {
+          for (j = 0; j < lenY; ++j)
+            Y[j * incY] *= beta;
+        }
+
+      if (alpha == 0.0)
+        return GSL_SUCCESS;
+
+      /* form y := alpha*op(A)*x + y */
+
+      if (GSL_SPMATRIX_ISCSC(A) || GSL_SPMATRIX_ISCSR(A))
+        {
+          const int rowform = GSL_SPMATRIX_ISCSR(A) == (TransA == CblasNoTrans);
+
+          spdgemv64_compressed (rowform, alpha, A->nz, lenX, lenY,
+                                Ap, Ai, Ad, X, incX, Y, incY);
+        }
+      else if (GSL_SPMATRIX_ISCOO(A))
+        {
+          const size_t *Yi = (TransA == CblasNoTrans) ? A->i : A->p;
+          const size_t *Xi = (TransA == CblasNoTrans) ? A->p : A->i;
+          size_t p;
+
+          for (p = 0; p < A->nz; ++p)
+            Y[Yi[p] * incY] += alpha * Ad[p] * X[Xi[p] * incX];
+        }
+      else
+        {
+          GSL_ERROR("unsupported matrix type", GSL_EINVAL);
+        }
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_spblas_dgemv64() */
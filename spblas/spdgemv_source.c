@@ -0,0 +1,215 @@
+/* spblas/spdgemv_source.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Row and scatter forms of y += alpha*op(A)*x for compressed matrices,
+ * shared by gsl_spblas_dgemv and gsl_spblas_dgemv64. The including file
+ * defines INDEX, the index type of the matrix, FUNCTION(name), which
+ * prefixes the names of the static functions below, and
+ *
+ *   double FUNCTION(dot) (const INDEX n, const double *a, const INDEX *ia,
+ *                         const double *x, const size_t incx)
+ *
+ * which returns sum_k a[k] x[ia[k]*incx] for the row form.
+ */
+
+/* minimum number of nonzeros per thread */
+#define SPBLAS_THREAD_MIN_NNZ 32768
+
+/* number of threads to use for a product with nnz nonzeros */
+static int
+FUNCTION (nthreads) (const size_t nnz)
+{
+#ifdef _OPENMP
+  size_t nthreads = gsl_get_num_threads ();
+
+  if (nthreads <= 1 || omp_in_parallel ())
+    return 1;
+
+  nthreads = GSL_MIN (nthreads, nnz / SPBLAS_THREAD_MIN_NNZ);
+
+  return (nthreads > 1) ? (int) nthreads : 1;
+#else
+  (void) nnz;
+  return 1;
+#endif
+}
+
+#ifdef _OPENMP
+
+/* first compressed row or column of slice t (0 <= t <= nthreads) when
+   the n rows or columns are split into nthreads slices of about the same
+   number of nonzeros */
+static size_t
+FUNCTION (split) (const INDEX *Ap, const size_t n, const int nthreads, const int t)
+{
+  if (t >= nthreads)
+    return n;
+  else
+    {
+      const double target = (double) Ap[n] * t / nthreads;
+      size_t lo = 0, hi = n;
+
+      /* smallest j with Ap[j] >= target */
+      while (lo < hi)
+        {
+          const size_t mid = lo + (hi - lo) / 2;
+
+          if ((double) Ap[mid] < target)
+            lo = mid + 1;
+          else
+            hi = mid;
+        }
+
+      return lo;
+    }
+}
+
+#endif /* _OPENMP */
+
+/* Y[j] += alpha * (row j) . X for rows [j0,j1) */
+static void
+FUNCTION (rows) (const size_t j0, const size_t j1, const double alpha,
+                 const INDEX *Ap, const INDEX *Ai, const double *Ad,
+                 const double *X, const size_t incX, double *Y, const size_t incY)
+{
+  size_t j;
+
+  for (j = j0; j < j1; ++j)
+    {
+      const INDEX p = Ap[j];
+      Y[j * incY] += alpha * FUNCTION (dot) (Ap[j + 1] - p, Ad + p, Ai + p, X, incX);
+    }
+}
+
+/* Y += alpha * (column j) X[j] for columns [j0,j1) */
+static void
+FUNCTION (cols) (const size_t j0, const size_t j1, const double alpha,
+                 const INDEX *Ap, const INDEX *Ai, const double *Ad,
+                 const double *X, const size_t incX, double *Y, const size_t incY)
+{
+  size_t j;
+
+  for (j = j0; j < j1; ++j)
+    {
+      const double temp = alpha * X[j * incX];
+      INDEX p;
+
+      for (p = Ap[j]; p < Ap[j + 1]; ++p)
+        Y[Ai[p] * incY] += Ad[p] * temp;
+    }
+}
+
+/* Y += alpha * op(A) X for a compressed matrix with nnz nonzeros, in the
+   row form if rowform is set and in the scatter form otherwise. Ap has
+   lenY + 1 elements in the row form and lenX + 1 in the scatter form */
+static void
+FUNCTION (compressed) (const int rowform, const double alpha, const size_t nnz,
+                       const size_t lenX, const size_t lenY,
+                       const INDEX *Ap, const INDEX *Ai, const double *Ad,
+                       const double *X, const size_t incX,
+                       double *Y, const size_t incY)
+{
+  int nthreads = FUNCTION (nthreads) (nnz);
+
+  if (rowform)
+    {
+      if (nthreads == 1)
+        {
+          FUNCTION (rows) (0, lenY, alpha, Ap, Ai, Ad, X, incX, Y, incY);
+          return;
+        }
+
+#ifdef _OPENMP
+      {
+        int k;
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+        for (k = 0; k < nthreads; ++k)
+          FUNCTION (rows) (FUNCTION (split) (Ap, lenY, nthreads, k),
+                           FUNCTION (split) (Ap, lenY, nthreads, k + 1),
+                           alpha, Ap, Ai, Ad, X, incX, Y, incY);
+      }
+#endif
+    }
+  else
+    {
+      double *work = NULL;
+
+      /* the private vectors take no more memory than A */
+      if (nthreads > 1)
+        nthreads = (int) GSL_MIN ((size_t) nthreads, nnz / GSL_MAX (lenY, 1));
+
+      if (nthreads > 1)
+        {
+          work = malloc (nthreads * lenY * sizeof (double));
+          if (work == NULL)
+            nthreads = 1;
+        }
+
+      if (nthreads == 1)
+        {
+          FUNCTION (cols) (0, lenX, alpha, Ap, Ai, Ad, X, incX, Y, incY);
+          return;
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads)
+      {
+        int k;
+
+        /* accumulate the columns of slice k into private vector k */
+#pragma omp for schedule(static)
+        for (k = 0; k < nthreads; ++k)
+          {
+            double *w = work + k * lenY;
+
+            memset (w, 0, lenY * sizeof (double));
+            FUNCTION (cols) (FUNCTION (split) (Ap, lenX, nthreads, k),
+                             FUNCTION (split) (Ap, lenX, nthreads, k + 1),
+                             alpha, Ap, Ai, Ad, X, incX, w, 1);
+          }
+
+        /* sum the private vectors into y, by slices of y */
+#pragma omp for schedule(static)
+        for (k = 0; k < nthreads; ++k)
+          {
+            const size_t i0 = lenY * k / nthreads;
+            const size_t i1 = lenY * (k + 1) / nthreads;
+            size_t i;
+            int l;
+
+            for (i = i0; i < i1; ++i)
+              {
+                double sum = 0.0;
+
+                for (l = 0; l < nthreads; ++l)
+                  sum += work[l * lenY + i];
+
+                Y[i * incY] += sum;
+              }
+          }
+      }
+#endif
+
+      free (work);
+    }
+}
+
+#undef SPBLAS_THREAD_MIN_NNZ
@@ -0,0 +1,464 @@
+/* spblas/sptrsv.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_errno.h>
+
+/*
+ * The triangular system op(A) x = b, with A in CSR or CSC format, is
+ * solved in two phases:
+ *
+ * analysis: the off-diagonal elements of the referenced triangle of
+ * op(A) are collected by rows of op(A), which for CSC and op(A) = A, or
+ * CSR and op(A) = A^T, transposes the pattern. The values are not
+ * copied, but referenced by their positions in A->data. Each row is
+ * assigned a level, one more than the largest level of the rows it
+ * depends on, so that the rows of a level depend only on rows of
+ * earlier levels, and the rows are listed level by level.
+ *
+ * solve: each row is a gathered dot product with the solved elements
+ * of x. On one thread the rows are solved in natural order, which
+ * keeps the accesses to x local; otherwise level by level.
+ *
+ * The analysis depends only on the pattern of A, and is reused by
+ * gsl_spblas_dtrsv() for any number of right hand sides and for new
+ * values of A with the same pattern.
+ *
+ * With more than one thread (see gsl_set_num_threads), the rows
+ * of each level with at least SPBLAS_TRSV_MIN_ROWS rows are split
+ * evenly between the threads the OpenMP runtime provides, which
+ * synchronize after each level; smaller levels are solved by one
+ * thread. The operations on each element of x are the same for any
+ * number of threads.
+ */
+
+/* minimum number of nonzeros per thread */
+#define SPBLAS_THREAD_MIN_NNZ 32768
+
+/* minimum number of rows of a level solved in parallel */
+#define SPBLAS_TRSV_MIN_ROWS 256
+
+/*
+gsl_spblas_dtrsv_alloc()
+  Analyze the triangular matrix op(A) for gsl_spblas_dtrsv()
+
+Inputs: Uplo   - CblasLower or CblasUpper, the triangle of A referenced
+        TransA - CblasNoTrans or CblasTrans
+        A      - square matrix in CSR or CSC format
+
+Return: workspace holding the level schedule of op(A)
+*/
+
+gsl_spblas_trsv_workspace *
+gsl_spblas_dtrsv_alloc(const CBLAS_UPLO_t Uplo, const CBLAS_TRANSPOSE_t TransA,
+                       const gsl_spmatrix *A)
+{
+  const size_t n = A->size1;
+
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR_NULL("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (!GSL_SPMATRIX_ISCSR(A) && !GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR_NULL("compressed column or row format required", GSL_EINVAL);
+    }
+  else
+    {
+      /* the solved triangle of op(A) is lower for forward substitution */
+      const int lower = (Uplo == CblasLower) != (TransA == CblasTrans);
+      /* whether the compressed vectors of A are the rows of op(A) */
+      const int rowform = GSL_SPMATRIX_ISCSR(A) == (TransA == CblasNoTrans);
+      const size_t nz = A->p[n];
+      gsl_spblas_trsv_workspace *w;
+      int *level, *cnt;
+      size_t i, k, l;
+      int p;
+
+      w = calloc(1, sizeof(gsl_spblas_trsv_workspace));
+      if (!w)
+        {
+          GSL_ERROR_NULL("failed to allocate space for workspace", GSL_ENOMEM);
+        }
+
+      w->n = n;
+      w->nz = nz;
+      w->sptype = A->sptype;
+      w->Uplo = Uplo;
+      w->TransA = TransA;
+      w->row = malloc(GSL_MAX(n, 1) * sizeof(int));
+      w->diag = malloc(GSL_MAX(n, 1) * sizeof(int));
+      w->Rp = calloc(n + 1, sizeof(int));
+
+      level = malloc(GSL_MAX(n, 1) * sizeof(int));
+      cnt = calloc(n + 2, sizeof(int));
+
+      if (!w->row || !w->diag || !w->Rp || !level || !cnt)
+        {
+          free(level);
+          free(cnt);
+          gsl_spblas_dtrsv_free(w);
+          GSL_ERROR_NULL("failed to allocate space for workspace", GSL_ENOMEM);
+        }
+
+      /* diagonal, and number of off-diagonal elements of each row */
+      for (i = 0; i < n; ++i)
+        w->diag[i] = -1;
+
+      for (i = 0; i < n; ++i)
+        {
+          for (p = A->p[i]; p < A->p[i + 1]; ++p)
+            {
+              const size_t r = rowform ? i : (size_t) A->i[p];
+              const size_t c = rowform ? (size_t) A->i[p] : i;
+
+              if (r == c)
+                w->diag[r] = p;
+              else if ((c < r) == lower)
+                w->Rp[r + 1]++;
+            }
+        }
+
+      w->ndiag = 0;
+
+      for (i = 0; i < n; ++i)
+        {
+          w->ndiag += (w->diag[i] >= 0);
+          w->Rp[i + 1] += w->Rp[i];
+          level[i] = w->Rp[i];
+        }
+
+      w->nnz = (size_t) w->Rp[n];
+      w->Rj = malloc(GSL_MAX(w->nnz, 1) * sizeof(int));
+      w->Rq = malloc(GSL_MAX(w->nnz, 1) * sizeof(int));
+
+      if (!w->Rj || !w->Rq)
+        {
+          free(level);
+          free(cnt);
+          gsl_spblas_dtrsv_free(w);
+          GSL_ERROR_NULL("failed to allocate space for workspace", GSL_ENOMEM);
+        }
+
+      for (i = 0; i < n; ++i)
+        {
+          for (p = A->p[i]; p < A->p[i + 1]; ++p)
+            {
+              const size_t r = rowform ? i : (size_t) A->i[p];
+              const size_t c = rowform ? (size_t) A->i[p] : i;
+
+              if (r != c && (c < r) == lower)
+                {
+                  const int dest = level[r]++;
+
+                  w->Rj[dest] = (int) c;
+                  w->Rq[dest] = p;
+                }
+            }
+        }
+
+      /* levels, in the order of the substitution */
+      w->nlevels = 0;
+
+      for (k = 0; k < n; ++k)
+        {
+          const size_t r = lower ? k : n - 1 - k;
+          int lev = 0;
+
+          for (p = w->Rp[r]; p < w->Rp[r + 1]; ++p)
+            lev = GSL_MAX(lev, level[w->Rj[p]] + 1);
+
+          level[r] = lev;
+          cnt[lev + 1]++;
+          w->nlevels = GSL_MAX(w->nlevels, (size_t) lev + 1);
+        }
+
+      /* in the row form the elements of each row are usually contiguous
+         in A, and are then read directly from A */
+      if (rowform)
+        {
+          int contiguous = 1;
+
+          for (i = 0; i < n && contiguous; ++i)
+            {
+              for (p = w->Rp[i] + 1; p < w->Rp[i + 1]; ++p)
+                contiguous &= (w->Rq[p] == w->Rq[p - 1] + 1);
+            }
+
+          if (contiguous)
+            w->Rs = malloc(GSL_MAX(n, 1) * sizeof(int));
+
+          if (w->Rs)
+            {
+              for (i = 0; i < n; ++i)
+                w->Rs[i] = (w->Rp[i] < w->Rp[i + 1]) ? w->Rq[w->Rp[i]] : 0;
+
+              free(w->Rj);
+              free(w->Rq);
+              w->Rj = NULL;
+              w->Rq = NULL;
+            }
+        }
+
+      w->levptr = malloc((w->nlevels + 1) * sizeof(size_t));
+      if (!w->levptr)
+        {
+          free(level);
+          free(cnt);
+          gsl_spblas_dtrsv_free(w);
+          GSL_ERROR_NULL("failed to allocate space for workspace", GSL_ENOMEM);
+        }
+
+      /* rows sorted by level, and by index within each level */
+      for (l = 0; l < w->nlevels; ++l)
+        cnt[l + 1] += cnt[l];
+
+      for (l = 0; l <= w->nlevels; ++l)
+        w->levptr[l] = (size_t) cnt[l];
+
+      for (i = 0; i < n; ++i)
+        w->row[cnt[level[i]]++] = (int) i;
+
+      free(level);
+      free(cnt);
+
+      return w;
+    }
+} /* gsl_spblas_dtrsv_alloc() */
+
+void
+gsl_spblas_dtrsv_free(gsl_spblas_trsv_workspace *w)
+{
+  RETURN_IF_NULL(w);
+
+  free(w->levptr);
+  free(w->row);
+  free(w->diag);
+  free(w->Rp);
+  free(w->Rj);
+  free(w->Rq);
+  free(w->Rs);
+  free(w);
+}
+
+/* solve row i of op(A) x = b */
+static inline void
+sptrsv_row(const size_t i, const gsl_spblas_trsv_workspace *w,
+           const int nonunit, const gsl_spmatrix *A, double *X,
+           const size_t incX)
+{
+  const double *Ad = A->data;
+  double t = X[i * incX];
+  int p;
+
+  if (w->Rs != NULL)
+    {
+      const int *Ai = A->i + w->Rs[i];
+      const double *Ax = Ad + w->Rs[i];
+      const int len = w->Rp[i + 1] - w->Rp[i];
+
+      if (incX == 1)
+        {
+          for (p = 0; p < len; ++p)
+            t -= Ax[p] * X[Ai[p]];
+        }
+      else
+        {
+          for (p = 0; p < len; ++p)
+            t -= Ax[p] * X[Ai[p] * incX];
+        }
+    }
+  else
+    {
+      const int *Rj = w->Rj;
+      const int *Rq = w->Rq;
+
+      if (incX == 1)
+        {
+          for (p = w->Rp[i]; p < w->Rp[i + 1]; ++p)
+            t -= Ad[Rq[p]] * X[Rj[p]];
+        }
+      else
+        {
+          for (p = w->Rp[i]; p < w->Rp[i + 1]; ++p)
+            t -= Ad[Rq[p]] * X[Rj[p] * incX];
+        }
+    }
+
+  X[i * incX] = nonunit ? t / Ad[w->diag[i]] : t;
+}
+
+#ifdef _OPENMP
+
+/* solve the rows row[k0..k1-1] of a level */
+static void
+sptrsv_level(const size_t k0, const size_t k1,
+             const gsl_spblas_trsv_workspace *w, const int nonunit,
+             const gsl_spmatrix *A, double *X, const size_t incX)
+{
+  size_t k;
+
+  for (k = k0; k < k1; ++k)
+    sptrsv_row(w->row[k], w, nonunit, A, X, incX);
+}
+
+#endif /* _OPENMP */
+
+/* number of threads to use for the solve */
+static int
+sptrsv_nthreads(const gsl_spblas_trsv_workspace *w)
+{
+#ifdef _OPENMP
+  size_t nthreads = gsl_get_num_threads();
+
+  if (nthreads <= 1 || omp_in_parallel())
+    return 1;
+
+  /* levels too narrow to be split */
+  if (w->n < SPBLAS_TRSV_MIN_ROWS * w->nlevels)
+    return 1;
+
+  nthreads = GSL_MIN(nthreads, (w->nnz + w->n) / SPBLAS_THREAD_MIN_NNZ);
+
+  return (nthreads > 1) ? (int) nthreads : 1;
+#else
+  (void) w;
+  return 1;
+#endif
+}
+
+/*
+gsl_spblas_dtrsv()
+  Solve a sparse triangular system op(A) x = b
+
+Inputs: Uplo   - CblasLower or CblasUpper, the triangle of A referenced
+        TransA - CblasNoTrans or CblasTrans
+        Diag   - CblasUnit if the diagonal of A is taken to be one,
+                 CblasNonUnit otherwise
+        A      - square matrix in CSR or CSC format
+        x      - (input/output) on input b, on output the solution x
+        w      - analysis of op(A) from gsl_spblas_dtrsv_alloc() with
+                 the same Uplo and TransA and the same pattern of A,
+                 or NULL to analyze A for this solve only
+*/
+
+int
+gsl_spblas_dtrsv(const CBLAS_UPLO_t Uplo, const CBLAS_TRANSPOSE_t TransA,
+                 const CBLAS_DIAG_t Diag, const gsl_spmatrix *A,
+                 gsl_vector *x, const gsl_spblas_trsv_workspace *w)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != x->size)
+    {
+      GSL_ERROR("invalid length of x vector", GSL_EBADLEN);
+    }
+  else if (!GSL_SPMATRIX_ISCSR(A) && !GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR("compressed column or row format required", GSL_EINVAL);
+    }
+  else if (w == NULL)
+    {
+      gsl_spblas_trsv_workspace *work = gsl_spblas_dtrsv_alloc(Uplo, TransA, A);
+      int status;
+
+      if (work == NULL)
+        {
+          GSL_ERROR("failed to analyze matrix", GSL_ENOMEM);
+        }
+
+      status = gsl_spblas_dtrsv(Uplo, TransA, Diag, A, x, work);
+      gsl_spblas_dtrsv_free(work);
+
+      return status;
+    }
+  else if (w->n != A->size1 || w->nz != (size_t) A->p[A->size1] ||
+           w->sptype != A->sptype)
+    {
+      GSL_ERROR("workspace does not match matrix", GSL_EBADLEN);
+    }
+  else if (w->Uplo != Uplo || w->TransA != TransA)
+    {
+      GSL_ERROR("workspace was computed for a different triangle",
+                GSL_EINVAL);
+    }
+  else if (Diag == CblasNonUnit && w->ndiag < w->n)
+    {
+      GSL_ERROR("matrix has a missing diagonal element", GSL_ESING);
+    }
+  else
+    {
+      const int nonunit = (Diag == CblasNonUnit);
+      const int nthreads = sptrsv_nthreads(w);
+      double *X = x->data;
+      const size_t incX = x->stride;
+
+      if (nthreads == 1)
+        {
+          /* forward or backward substitution in natural order */
+          const int lower = (Uplo == CblasLower) != (TransA == CblasTrans);
+          size_t k;
+
+          for (k = 0; k < w->n; ++k)
+            sptrsv_row(lower ? k : w->n - 1 - k, w, nonunit, A, X, incX);
+
+          return GSL_SUCCESS;
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads)
+      {
+        size_t l;
+
+        for (l = 0; l < w->nlevels; ++l)
+          {
+            const size_t k0 = w->levptr[l];
+            const size_t k1 = w->levptr[l + 1];
+
+            if (k1 - k0 < SPBLAS_TRSV_MIN_ROWS)
+              {
+#pragma omp single
+                sptrsv_level(k0, k1, w, nonunit, A, X, incX);
+              }
+            else
+              {
+                int k;
+
+#pragma omp for schedule(static)
+                for (k = (int) k0; k < (int) k1; ++k)
+                  sptrsv_row(w->row[k], w, nonunit, A, X, incX);
+              }
+          }
+      }
+#endif
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_spblas_dtrsv() */
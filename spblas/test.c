@@ -176,6 +176,157 @@ test_dgemv(const size_t N, const size_t M, const double alpha,
   gsl_vector_free(y_sp);
 } /* test_dgemv() */
 
+/* compare the CSR and CSC products with 1 and nthreads threads, with unit
+   and non-unit strides, against the triplet product */
+static void
+test_dgemv_threads(const size_t M, const size_t N, const double density,
+                   const size_t nthreads, const gsl_rng *r)
+{
+  gsl_spmatrix *A = create_random_sparse(M, N, density, r);
+  gsl_spmatrix *C[2];
+  const char *fmt[2] = { "CSR", "CSC" };
+  int t, k;
+
+  C[0] = gsl_spmatrix_crs(A);
+  C[1] = gsl_spmatrix_ccs(A);
+
+  for (t = 0; t < 2; ++t)
+    {
+      const CBLAS_TRANSPOSE_t TransA = (t == 0) ? CblasNoTrans : CblasTrans;
+      const size_t lenX = (t == 0) ? N : M;
+      const size_t lenY = (t == 0) ? M : N;
+      gsl_vector *x = gsl_vector_alloc(lenX);
+      gsl_vector *y = gsl_vector_alloc(lenY);
+      gsl_vector *y_exp = gsl_vector_alloc(lenY);
+      gsl_matrix *xs = gsl_matrix_alloc(lenX, 2);
+      gsl_matrix *ys = gsl_matrix_alloc(lenY, 3);
+      gsl_vector_view xv = gsl_matrix_column(xs, 1);
+      gsl_vector_view yv = gsl_matrix_column(ys, 2);
+
+      create_random_vector(x, r);
+      create_random_vector(y, r);
+      gsl_vector_memcpy(&xv.vector, x);
+
+      gsl_vector_memcpy(y_exp, y);
+      gsl_spblas_dgemv(TransA, 1.5, A, x, -0.5, y_exp);
+
+      for (k = 0; k < 2; ++k)
+        {
+          size_t n;
+
+          for (n = 1; n <= nthreads; n += nthreads - 1)
+            {
+              gsl_set_num_threads(n);
+
+              gsl_vector_memcpy(&yv.vector, y);
+              gsl_spblas_dgemv(TransA, 1.5, C[k], x, -0.5, &yv.vector);
+              test_vectors(&yv.vector, y_exp, 1.0e-12, fmt[k]);
+
+              gsl_vector_memcpy(&yv.vector, y);
+              gsl_spblas_dgemv(TransA, 1.5, C[k], &xv.vector, -0.5, &yv.vector);
+              test_vectors(&yv.vector, y_exp, 1.0e-12, fmt[k]);
+
+              if (nthreads == 1)
+                break;
+            }
+        }
+
+      gsl_vector_free(x);
+      gsl_vector_free(y);
+      gsl_vector_free(y_exp);
+      gsl_matrix_free(xs);
+      gsl_matrix_free(ys);
+    }
+
+  gsl_set_num_threads(1);
+
+  gsl_spmatrix_free(A);
+  gsl_spmatrix_free(C[0]);
+  gsl_spmatrix_free(C[1]);
+} /* test_dgemv_threads() */
+
+/* compare the BSR and SELL products, with 1 and nthreads threads, against
+   the CSR product */
+static void
+test_dgemv_block(const size_t M, const size_t N, const double density,
+                 const size_t nthreads, const gsl_rng *r)
+{
+  const size_t params[][3] = { { GSL_SPMATRIX_BSR, 1, 1 },
+                               { GSL_SPMATRIX_BSR, 2, 2 },
+                               { GSL_SPMATRIX_BSR, 3, 5 },
+                               { GSL_SPMATRIX_SELL, 4, 1 },
+                               { GSL_SPMATRIX_SELL, 8, 64 },
+                               { GSL_SPMATRIX_SELL, 37, 100 } };
+  const size_t nparams = sizeof(params) / sizeof(params[0]);
+  gsl_spmatrix *A = create_random_sparse(M, N, density, r);
+  gsl_spmatrix *B = gsl_spmatrix_crs(A);
+  size_t k;
+  int t;
+
+  for (k = 0; k < nparams; ++k)
+    {
+      gsl_spmatrix *S = (params[k][0] == GSL_SPMATRIX_BSR) ?
+                        gsl_spmatrix_compress_bsr(B, params[k][1], params[k][2]) :
+                        gsl_spmatrix_compress_sell(A, params[k][1], params[k][2]);
+
+      for (t = 0; t < 2; ++t)
+        {
+          const CBLAS_TRANSPOSE_t TransA = (t == 0) ? CblasNoTrans : CblasTrans;
+          const size_t lenX = (t == 0) ? N : M;
+          const size_t lenY = (t == 0) ? M : N;
+          gsl_vector *x = gsl_vector_alloc(lenX);
+          gsl_vector *y = gsl_vector_alloc(lenY);
+          gsl_vector *y_exp = gsl_vector_alloc(lenY);
+          gsl_matrix *xs = gsl_matrix_alloc(lenX, 2);
+          gsl_matrix *ys = gsl_matrix_alloc(lenY, 3);
+          gsl_vector_view xv = gsl_matrix_column(xs, 1);
+          gsl_vector_view yv = gsl_matrix_column(ys, 2);
+          char name[64];
+          size_t n;
+
+          sprintf(name, "test_dgemv_block: %s(%zu,%zu) %s",
+                  gsl_spmatrix_type(S), params[k][1], params[k][2],
+                  (t == 0) ? "N" : "T");
+
+          create_random_vector(x, r);
+          create_random_vector(y, r);
+          gsl_vector_memcpy(&xv.vector, x);
+
+          gsl_vector_memcpy(y_exp, y);
+          gsl_spblas_dgemv(TransA, 1.5, B, x, -0.5, y_exp);
+
+          for (n = 1; n <= nthreads; n += nthreads - 1)
+            {
+              gsl_set_num_threads(n);
+
+              gsl_vector_memcpy(&yv.vector, y);
+              gsl_spblas_dgemv(TransA, 1.5, S, x, -0.5, &yv.vector);
+              test_vectors(&yv.vector, y_exp, 1.0e-12, name);
+
+              gsl_vector_memcpy(&yv.vector, y);
+              gsl_spblas_dgemv(TransA, 1.5, S, &xv.vector, -0.5, &yv.vector);
+              test_vectors(&yv.vector, y_exp, 1.0e-12, name);
+
+              if (nthreads == 1)
+                break;
+            }
+
+          gsl_vector_free(x);
+          gsl_vector_free(y);
+          gsl_vector_free(y_exp);
+          gsl_matrix_free(xs);
+          gsl_matrix_free(ys);
+        }
+
+      gsl_spmatrix_free(S);
+    }
+
+  gsl_set_num_threads(1);
+
+  gsl_spmatrix_free(A);
+  gsl_spmatrix_free(B);
+} /* test_dgemv_block() */
+
 static void
 test_dgemm(const double alpha, const size_t M, const size_t N,
            const gsl_rng *r)
@@ -229,6 +380,351 @@ test_dgemm(const double alpha, const size_t M, const size_t N,
   gsl_matrix_free(C_dense);
 } /* test_dgemm() */
 
+/* compare the symbolic/numeric product, with 1 and nthreads threads, in
+   CSC and CSR format against the dense product, then change the values
+   of A and B and recompute C on the same pattern */
+static void
+test_dgemm_reuse(const size_t M, const size_t K, const size_t N,
+                 const double density, const size_t nthreads,
+                 const gsl_rng *r)
+{
+  gsl_spmatrix *TA = create_random_sparse(M, K, density, r);
+  gsl_spmatrix *TB = create_random_sparse(K, N, density, r);
+  gsl_matrix *A_dense = gsl_matrix_alloc(M, K);
+  gsl_matrix *B_dense = gsl_matrix_alloc(K, N);
+  gsl_matrix *C_dense = gsl_matrix_alloc(M, N);
+  gsl_matrix *C_exp = gsl_matrix_alloc(M, N);
+  const int sptype[2] = { GSL_SPMATRIX_CSC, GSL_SPMATRIX_CSR };
+  int k, pass;
+  size_t n, i;
+
+  for (k = 0; k < 2; ++k)
+    {
+      gsl_spmatrix *A = gsl_spmatrix_compress(TA, sptype[k]);
+      gsl_spmatrix *B = gsl_spmatrix_compress(TB, sptype[k]);
+      gsl_spmatrix *C = gsl_spmatrix_alloc_nzmax(M, N, 1, sptype[k]);
+      const char *fmt = gsl_spmatrix_type(A);
+
+      for (n = 1; n <= nthreads; n += nthreads - 1)
+        {
+          gsl_set_num_threads(n);
+          gsl_spblas_dgemm_symbolic(A, B, C);
+
+          for (pass = 0; pass < 2; ++pass)
+            {
+              double dmax = 0.0;
+
+              if (pass == 1)
+                {
+                  /* new values on the same patterns */
+                  for (i = 0; i < A->nz; ++i)
+                    A->data[i] = gsl_rng_uniform(r) - 0.5;
+                  for (i = 0; i < B->nz; ++i)
+                    B->data[i] = gsl_rng_uniform(r) - 0.5;
+                }
+
+              gsl_spblas_dgemm_numeric(-1.3, A, B, C);
+
+              gsl_spmatrix_sp2d(A_dense, A);
+              gsl_spmatrix_sp2d(B_dense, B);
+              gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, -1.3, A_dense,
+                             B_dense, 0.0, C_exp);
+              gsl_spmatrix_sp2d(C_dense, C);
+
+              gsl_matrix_sub(C_dense, C_exp);
+              dmax = GSL_MAX(fabs(gsl_matrix_max(C_dense)),
+                             fabs(gsl_matrix_min(C_dense)));
+
+              gsl_test(dmax > 1.0e-12,
+                       "test_dgemm_reuse: M=%zu K=%zu N=%zu %s threads=%zu pass=%d",
+                       M, K, N, fmt, n, pass);
+            }
+
+          if (nthreads == 1)
+            break;
+        }
+
+      gsl_spmatrix_free(A);
+      gsl_spmatrix_free(B);
+      gsl_spmatrix_free(C);
+    }
+
+  gsl_set_num_threads(1);
+
+  gsl_spmatrix_free(TA);
+  gsl_spmatrix_free(TB);
+  gsl_matrix_free(A_dense);
+  gsl_matrix_free(B_dense);
+  gsl_matrix_free(C_dense);
+  gsl_matrix_free(C_exp);
+} /* test_dgemm_reuse() */
+
+/* compare the products of the COO, CSR and CSC matrices with size_t
+   indices, with 1 and nthreads threads, against the int index product */
+static void
+test_dgemv64(const size_t M, const size_t N, const double density,
+             const size_t nthreads, const gsl_rng *r)
+{
+  gsl_spmatrix *A = create_random_sparse(M, N, density, r);
+  gsl_spmatrix64 *C[3];
+  int t, k;
+
+  C[0] = gsl_spmatrix64_from_spmatrix(A);
+  C[1] = gsl_spmatrix64_compress(C[0], GSL_SPMATRIX_CSR);
+  C[2] = gsl_spmatrix64_compress(C[0], GSL_SPMATRIX_CSC);
+
+  for (t = 0; t < 2; ++t)
+    {
+      const CBLAS_TRANSPOSE_t TransA = (t == 0) ? CblasNoTrans : CblasTrans;
+      const size_t lenX = (t == 0) ? N : M;
+      const size_t lenY = (t == 0) ? M : N;
+      gsl_vector *x = gsl_vector_alloc(lenX);
+      gsl_vector *y = gsl_vector_alloc(lenY);
+      gsl_vector *y_exp = gsl_vector_alloc(lenY);
+      gsl_matrix *xs = gsl_matrix_alloc(lenX, 2);
+      gsl_matrix *ys = gsl_matrix_alloc(lenY, 3);
+      gsl_vector_view xv = gsl_matrix_column(xs, 1);
+      gsl_vector_view yv = gsl_matrix_column(ys, 2);
+
+      create_random_vector(x, r);
+      create_random_vector(y, r);
+      gsl_vector_memcpy(&xv.vector, x);
+
+      gsl_vector_memcpy(y_exp, y);
+      gsl_spblas_dgemv(TransA, 1.5, A, x, -0.5, y_exp);
+
+      for (k = 0; k < 3; ++k)
+        {
+          size_t n;
+
+          for (n = 1; n <= nthreads; n += nthreads - 1)
+            {
+              gsl_set_num_threads(n);
+
+              gsl_vector_memcpy(&yv.vector, y);
+              gsl_spblas_dgemv64(TransA, 1.5, C[k], &xv.vector, -0.5, &yv.vector);
+              test_vectors(&yv.vector, y_exp, 1.0e-12,
+                           gsl_spmatrix64_type(C[k]));
+
+              if (nthreads == 1)
+                break;
+            }
+        }
+
+      gsl_vector_free(x);
+      gsl_vector_free(y);
+      gsl_vector_free(y_exp);
+      gsl_matrix_free(xs);
+      gsl_matrix_free(ys);
+    }
+
+  gsl_set_num_threads(1);
+
+  gsl_spmatrix_free(A);
+  for (k = 0; k < 3; ++k)
+    gsl_spmatrix64_free(C[k]);
+} /* test_dgemv64() */
+
+/* random N-by-N matrix with a full diagonal and off-diagonal elements
+   small enough that all its triangles are well conditioned */
+static gsl_spmatrix *
+create_random_triangular(const size_t N, const double density,
+                         const gsl_rng *r)
+{
+  gsl_spmatrix *A = create_random_sparse(N, N, density, r);
+  const double scale = 1.0 / (1.0 + density * N);
+  size_t k;
+
+  for (k = 0; k < A->nz; ++k)
+    A->data[k] = (A->data[k] - 0.5) * scale;
+
+  for (k = 0; k < N; ++k)
+    gsl_spmatrix_set(A, k, k, 1.0 + gsl_rng_uniform(r));
+
+  return A;
+}
+
+static void
+test_dtrsv(const size_t N, const double density, const gsl_rng *r)
+{
+  gsl_spmatrix *A = create_random_triangular(N, density, r);
+  gsl_matrix *D = gsl_matrix_alloc(N, N);
+  gsl_vector *b = gsl_vector_alloc(N);
+  gsl_vector *x_exp = gsl_vector_alloc(N);
+  gsl_vector *y_exp = gsl_vector_alloc(N);
+  gsl_matrix *D2 = gsl_matrix_alloc(N, N);
+  gsl_matrix *xs = gsl_matrix_alloc(N, 3);
+  gsl_vector_view xv = gsl_matrix_column(xs, 1);
+  gsl_spmatrix *C[2];
+  const char *fmt[2] = { "CSR", "CSC" };
+  int u, t, d, k;
+
+  gsl_spmatrix_sp2d(D, A);
+  gsl_matrix_memcpy(D2, D);
+  gsl_matrix_scale(D2, 2.0);
+  C[0] = gsl_spmatrix_crs(A);
+  C[1] = gsl_spmatrix_ccs(A);
+  create_random_vector(b, r);
+
+  for (u = 0; u < 2; ++u)
+    {
+      const CBLAS_UPLO_t Uplo = u ? CblasUpper : CblasLower;
+
+      for (t = 0; t < 2; ++t)
+        {
+          const CBLAS_TRANSPOSE_t TransA = t ? CblasTrans : CblasNoTrans;
+
+          for (d = 0; d < 2; ++d)
+            {
+              const CBLAS_DIAG_t Diag = d ? CblasUnit : CblasNonUnit;
+              char buf[64];
+
+              gsl_vector_memcpy(x_exp, b);
+              gsl_blas_dtrsv(Uplo, TransA, Diag, D, x_exp);
+
+              for (k = 0; k < 2; ++k)
+                {
+                  gsl_spblas_trsv_workspace *w =
+                    gsl_spblas_dtrsv_alloc(Uplo, TransA, C[k]);
+
+                  sprintf(buf, "dtrsv %s uplo=%d trans=%d unit=%d",
+                          fmt[k], u, t, d);
+
+                  gsl_vector_memcpy(&xv.vector, b);
+                  gsl_spblas_dtrsv(Uplo, TransA, Diag, C[k], &xv.vector, w);
+                  test_vectors(&xv.vector, x_exp, 1.0e-12, buf);
+
+                  /* without a stored analysis */
+                  gsl_vector_memcpy(&xv.vector, b);
+                  gsl_spblas_dtrsv(Uplo, TransA, Diag, C[k], &xv.vector, NULL);
+                  test_vectors(&xv.vector, x_exp, 1.0e-12, buf);
+
+                  /* the analysis is reused for new values */
+                  gsl_spmatrix_scale(C[k], 2.0);
+                  gsl_vector_memcpy(&xv.vector, b);
+                  gsl_spblas_dtrsv(Uplo, TransA, Diag, C[k], &xv.vector, w);
+                  gsl_spmatrix_scale(C[k], 0.5);
+
+                  gsl_vector_memcpy(y_exp, b);
+                  gsl_blas_dtrsv(Uplo, TransA, Diag, D2, y_exp);
+                  test_vectors(&xv.vector, y_exp, 1.0e-12, buf);
+
+                  gsl_spblas_dtrsv_free(w);
+                }
+            }
+        }
+    }
+
+  gsl_spmatrix_free(A);
+  gsl_spmatrix_free(C[0]);
+  gsl_spmatrix_free(C[1]);
+  gsl_matrix_free(D);
+  gsl_matrix_free(D2);
+  gsl_matrix_free(xs);
+  gsl_vector_free(b);
+  gsl_vector_free(x_exp);
+  gsl_vector_free(y_exp);
+} /* test_dtrsv() */
+
+/* lower triangular matrix whose rows fall in nlev levels: the rows of
+   each block of N/nlev rows depend on a few rows of the previous block */
+static void
+test_dtrsv_threads(const size_t N, const size_t nlev, const size_t nthreads,
+                   const gsl_rng *r)
+{
+  const size_t bs = N / nlev;
+  gsl_spmatrix *T = gsl_spmatrix_alloc_nzmax(N, N, 4 * N, GSL_SPMATRIX_COO);
+  gsl_spmatrix *C[2];
+  const char *fmt[2] = { "CSR", "CSC" };
+  gsl_vector *b = gsl_vector_alloc(N);
+  gsl_vector *x = gsl_vector_alloc(N);
+  gsl_vector *x_exp = gsl_vector_alloc(N);
+  size_t i, k;
+  int t;
+
+  for (i = 0; i < N; ++i)
+    {
+      gsl_spmatrix_set(T, i, i, 1.0 + gsl_rng_uniform(r));
+
+      if (i >= bs)
+        {
+          const size_t j0 = (i / bs - 1) * bs;
+
+          for (k = 0; k < 3; ++k)
+            gsl_spmatrix_set(T, i, j0 + gsl_rng_uniform_int(r, bs),
+                             0.3 * (gsl_rng_uniform(r) - 0.5));
+        }
+    }
+
+  C[0] = gsl_spmatrix_crs(T);
+  C[1] = gsl_spmatrix_ccs(T);
+  create_random_vector(b, r);
+
+  for (k = 0; k < 2; ++k)
+    {
+      for (t = 0; t < 2; ++t)
+        {
+          const CBLAS_TRANSPOSE_t TransA = t ? CblasTrans : CblasNoTrans;
+          gsl_spblas_trsv_workspace *w =
+            gsl_spblas_dtrsv_alloc(CblasLower, TransA, C[k]);
+          char buf[64];
+          size_t n;
+
+          sprintf(buf, "dtrsv threads %s trans=%d", fmt[k], t);
+          gsl_test(w->nlevels != N / bs, "%s nlevels=%zu", buf, w->nlevels);
+
+          gsl_set_num_threads(1);
+          gsl_vector_memcpy(x_exp, b);
+          gsl_spblas_dtrsv(CblasLower, TransA, CblasNonUnit, C[k], x_exp, w);
+
+          for (n = 2; n <= nthreads; ++n)
+            {
+              gsl_set_num_threads(n);
+              gsl_vector_memcpy(x, b);
+              gsl_spblas_dtrsv(CblasLower, TransA, CblasNonUnit, C[k], x, w);
+              test_vectors(x, x_exp, 1.0e-15, buf);
+            }
+
+          gsl_spblas_dtrsv_free(w);
+        }
+    }
+
+  /* a missing diagonal element */
+  {
+    gsl_spmatrix *S = gsl_spmatrix_alloc_nzmax(N, N, T->nz, GSL_SPMATRIX_COO);
+
+    for (k = 0; k < T->nz; ++k)
+      {
+        if (T->i[k] != (int) (N / 2) || T->p[k] != (int) (N / 2))
+          gsl_spmatrix_set(S, T->i[k], T->p[k], T->data[k]);
+      }
+
+    gsl_spmatrix_free(C[0]);
+    C[0] = gsl_spmatrix_crs(S);
+    gsl_spmatrix_free(S);
+  }
+
+  {
+    int status;
+
+    gsl_set_error_handler_off();
+    status = gsl_spblas_dtrsv(CblasLower, CblasNoTrans, CblasNonUnit, C[0], x, NULL);
+    gsl_test(status != GSL_ESING, "dtrsv missing diagonal status=%d", status);
+    status = gsl_spblas_dtrsv(CblasLower, CblasNoTrans, CblasUnit, C[0], x, NULL);
+    gsl_test(status != GSL_SUCCESS, "dtrsv unit missing diagonal status=%d", status);
+    gsl_set_error_handler(NULL);
+  }
+
+  gsl_set_num_threads(1);
+
+  gsl_spmatrix_free(T);
+  gsl_spmatrix_free(C[0]);
+  gsl_spmatrix_free(C[1]);
+  gsl_vector_free(b);
+  gsl_vector_free(x);
+  gsl_vector_free(x_exp);
+} /* test_dtrsv_threads() */
+
 int
 main()
 {
@@ -251,11 +747,34 @@ main()
         }
     }
 
+  test_dgemv_threads(1000, 800, 0.1, 4, r);
+  test_dgemv_threads(300, 3000, 0.1, 3, r);
+
   test_dgemm(1.0, 10, 10, r);
   test_dgemm(2.3, 20, 15, r);
   test_dgemm(1.8, 12, 30, r);
   test_dgemm(0.4, 45, 35, r);
 
+  test_dgemv_block(1000, 800, 0.1, 4, r);
+  test_dgemv_block(97, 1203, 0.05, 3, r);
+
+  test_dgemm_reuse(600, 500, 700, 0.05, 4, r);
+  test_dgemm_reuse(37, 900, 45, 0.1, 3, r);
+
+  test_dgemv64(1000, 800, 0.1, 4, r);
+  test_dgemv64(300, 3000, 0.1, 3, r);
+
+  for (n = 1; n <= N_max; n += 3)
+    {
+      test_dtrsv(n, 0.1, r);
+      test_dtrsv(n, 0.5, r);
+    }
+
+  test_dtrsv(500, 0.02, r);
+
+  test_dtrsv_threads(40000, 8, 4, r);
+  test_dtrsv_threads(1000, 5, 3, r);
+
   gsl_rng_free(r);
 
   exit (gsl_test_summary());
@@ -0,0 +1,387 @@
+/* splinalg/amd.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Approximate minimum degree ordering of a symmetric sparsity pattern,
+ * following
+ *
+ * P. R. Amestoy, T. A. Davis and I. S. Duff, An approximate minimum
+ * degree ordering algorithm, SIAM J. Matrix Anal. Appl. 17(4), 1996.
+ *
+ * The elimination is simulated on the quotient graph: a variable i is
+ * adjacent to the variables A_i and to the elements E_i, where each
+ * element e is an eliminated variable whose clique L_e is stored instead
+ * of the fill edges it creates. Eliminating the variable p of least
+ * degree forms the element
+ *
+ * L_p = ( A_p u (union of L_e for e in E_p) ) \ {p}
+ *
+ * and absorbs the elements E_p. The degrees of the variables i in L_p
+ * are then replaced by the upper bound
+ *
+ * d_i = |A_i \ L_p| + |L_p \ {i}| + sum_{e in E_i \ {p}} |L_e \ L_p|
+ *
+ * where the |L_e \ L_p| are computed for all e at once by a scan of the
+ * E_i. Elements with L_e a subset of L_p are absorbed into p (aggressive
+ * absorption). Supervariables (indistinguishable nodes) are not
+ * detected, so each step eliminates a single variable.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+
+#include "order.h"
+
+typedef struct
+{
+  int *a;
+  int len;
+  int cap;
+} amd_list;
+
+static int
+amd_push(amd_list *l, const int x)
+{
+  if (l->len == l->cap)
+    {
+      int cap = GSL_MAX(2 * l->cap, 4);
+      int *a = realloc(l->a, cap * sizeof(int));
+
+      if (a == NULL)
+        return GSL_ENOMEM;
+
+      l->a = a;
+      l->cap = cap;
+    }
+
+  l->a[l->len++] = x;
+
+  return GSL_SUCCESS;
+}
+
+static void
+amd_release(amd_list *l)
+{
+  free(l->a);
+  l->a = NULL;
+  l->len = l->cap = 0;
+}
+
+/* degree lists */
+static void
+amd_insert(const int i, const int d, int *head, int *next, int *prev)
+{
+  next[i] = head[d];
+  prev[i] = -1;
+  if (head[d] >= 0)
+    prev[head[d]] = i;
+  head[d] = i;
+}
+
+static void
+amd_remove(const int i, const int d, int *head, int *next, int *prev)
+{
+  if (prev[i] >= 0)
+    next[prev[i]] = next[i];
+  else
+    head[d] = next[i];
+
+  if (next[i] >= 0)
+    prev[next[i]] = prev[i];
+}
+
+/*
+splinalg_amd()
+  Compute a fill-reducing ordering of the pattern of A + A^T, where
+the square matrix A is stored in COO, CSR or CSC format. On output,
+perm[k] is the k-th variable to eliminate, ie: row and column k of
+P A P^T are row and column perm[k] of A.
+*/
+
+int
+splinalg_amd(const gsl_spmatrix *A, size_t *perm)
+{
+  const int n = (int) A->size1;
+  amd_list *vars, *elts;
+  int *status, *deg, *head, *next, *prev, *flag, *w, *wstamp;
+  int stamp = 0, mindeg = 0, k, status_code = GSL_SUCCESS;
+  size_t q;
+
+  if (A->size1 > INT_MAX || A->nz > INT_MAX)
+    {
+      GSL_ERROR("matrix too large", GSL_EOVRFLW);
+    }
+
+  vars = calloc(n, sizeof(amd_list));
+  elts = calloc(n, sizeof(amd_list));
+  status = calloc(n, sizeof(int));
+  deg = malloc(n * sizeof(int));
+  head = malloc(n * sizeof(int));
+  next = malloc(n * sizeof(int));
+  prev = malloc(n * sizeof(int));
+  flag = calloc(n, sizeof(int));
+  w = malloc(n * sizeof(int));
+  wstamp = calloc(n, sizeof(int));
+  if (!vars || !elts || !status || !deg || !head || !next || !prev ||
+      !flag || !w || !wstamp)
+    {
+      status_code = GSL_ENOMEM;
+      goto cleanup;
+    }
+
+  /* adjacency lists of A + A^T, without the diagonal */
+  if (GSL_SPMATRIX_ISCOO(A))
+    {
+      for (q = 0; q < A->nz; ++q)
+        {
+          int i = A->i[q], j = A->p[q];
+
+          if (i != j && (amd_push(&vars[i], j) || amd_push(&vars[j], i)))
+            {
+              status_code = GSL_ENOMEM;
+              goto cleanup;
+            }
+        }
+    }
+  else
+    {
+      for (k = 0; k < n; ++k)
+        {
+          int p;
+
+          for (p = A->p[k]; p < A->p[k + 1]; ++p)
+            {
+              int i = A->i[p];
+
+              if (i != k && (amd_push(&vars[i], k) || amd_push(&vars[k], i)))
+                {
+                  status_code = GSL_ENOMEM;
+                  goto cleanup;
+                }
+            }
+        }
+    }
+
+  for (k = 0; k < n; ++k)
+    head[k] = -1;
+
+  /* remove duplicate edges and set up the degree lists */
+  for (k = 0; k < n; ++k)
+    {
+      int p, len = 0;
+
+      ++stamp;
+      flag[k] = stamp;
+
+      for (p = 0; p < vars[k].len; ++p)
+        {
+          int v = vars[k].a[p];
+
+          if (flag[v] != stamp)
+            {
+              flag[v] = stamp;
+              vars[k].a[len++] = v;
+            }
+        }
+
+      vars[k].len = len;
+      deg[k] = len;
+      amd_insert(k, len, head, next, prev);
+    }
+
+  for (k = 0; k < n; ++k)
+    {
+      amd_list Lp = { NULL, 0, 0 };
+      int piv, p, t, nleft;
+
+      /* variable of least (approximate) degree */
+      while (head[mindeg] < 0)
+        ++mindeg;
+
+      piv = head[mindeg];
+      amd_remove(piv, mindeg, head, next, prev);
+      perm[k] = (size_t) piv;
+
+      /* form the new element L_p */
+      ++stamp;
+      flag[piv] = stamp;
+
+      for (p = 0; p < vars[piv].len; ++p)
+        {
+          int v = vars[piv].a[p];
+
+          if (status[v] == 0 && flag[v] != stamp)
+            {
+              flag[v] = stamp;
+              if (amd_push(&Lp, v))
+                {
+                  status_code = GSL_ENOMEM;
+                  goto cleanup;
+                }
+            }
+        }
+
+      for (p = 0; p < elts[piv].len; ++p)
+        {
+          int e = elts[piv].a[p];
+
+          if (status[e] != 1)
+            continue;
+
+          for (t = 0; t < vars[e].len; ++t)
+            {
+              int v = vars[e].a[t];
+
+              if (status[v] == 0 && flag[v] != stamp)
+                {
+                  flag[v] = stamp;
+                  if (amd_push(&Lp, v))
+                    {
+                      amd_release(&Lp);
+                      status_code = GSL_ENOMEM;
+                      goto cleanup;
+                    }
+                }
+            }
+
+          /* absorb e into p */
+          status[e] = 2;
+          amd_release(&vars[e]);
+        }
+
+      status[piv] = 1;
+      amd_release(&elts[piv]);
+      amd_release(&vars[piv]);
+      vars[piv] = Lp;
+
+      /* |L_e \ L_p| for the elements adjacent to L_p */
+      for (p = 0; p < Lp.len; ++p)
+        {
+          int i = Lp.a[p];
+
+          amd_remove(i, deg[i], head, next, prev);
+
+          for (t = 0; t < elts[i].len; ++t)
+            {
+              int e = elts[i].a[t];
+
+              if (status[e] != 1)
+                continue;
+
+              if (wstamp[e] != k + 1)
+                {
+                  wstamp[e] = k + 1;
+                  w[e] = vars[e].len;
+                }
+
+              w[e]--;
+            }
+        }
+
+      /* update the adjacency and degree of each i in L_p */
+      nleft = n - k - 1;
+
+      for (p = 0; p < Lp.len; ++p)
+        {
+          int i = Lp.a[p];
+          int len = 0, d = 0;
+
+          for (t = 0; t < elts[i].len; ++t)
+            {
+              int e = elts[i].a[t];
+
+              if (status[e] != 1)
+                continue;
+
+              if (w[e] == 0)
+                {
+                  /* L_e is contained in L_p */
+                  status[e] = 2;
+                  amd_release(&vars[e]);
+                  continue;
+                }
+
+              d += w[e];
+              elts[i].a[len++] = e;
+            }
+
+          elts[i].len = len;
+          if (amd_push(&elts[i], piv))
+            {
+              status_code = GSL_ENOMEM;
+              goto cleanup;
+            }
+
+          len = 0;
+          for (t = 0; t < vars[i].len; ++t)
+            {
+              int v = vars[i].a[t];
+
+              if (status[v] == 0 && flag[v] != stamp)
+                vars[i].a[len++] = v;
+            }
+
+          vars[i].len = len;
+
+          d += len + Lp.len - 1;
+          d = GSL_MIN(d, deg[i] + Lp.len - 1);
+          d = GSL_MIN(d, nleft - 1);
+          d = GSL_MAX(d, 0);
+
+          deg[i] = d;
+          amd_insert(i, d, head, next, prev);
+          mindeg = GSL_MIN(mindeg, d);
+        }
+    }
+
+cleanup:
+  if (vars)
+    {
+      for (k = 0; k < n; ++k)
+        amd_release(&vars[k]);
+    }
+
+  if (elts)
+    {
+      for (k = 0; k < n; ++k)
+        amd_release(&elts[k]);
+    }
+
+  free(vars);
+  free(elts);
+  free(status);
+  free(deg);
+  free(head);
+  free(next);
+  free(prev);
+  free(flag);
+  free(w);
+  free(wstamp);
+
+  if (status_code)
+    {
+      GSL_ERROR("failed to allocate AMD workspace", status_code);
+    }
+
+  return GSL_SUCCESS;
+} /* splinalg_amd() */
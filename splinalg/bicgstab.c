@@ -0,0 +1,348 @@
+/* splinalg/bicgstab.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_splinalg.h>
+
+#include "itersolve.h"
+
+/*
+ * The biconjugate gradient stabilized method for general nonsymmetric
+ * A, with right preconditioning, following algorithm 7.7 of
+ *
+ * Y. Saad, Iterative methods for sparse linear systems,
+ * 2nd edition, SIAM, 2003.
+ *
+ * and H. A. van der Vorst, Bi-CGSTAB: A fast and smoothly converging
+ * variant of Bi-CG for the solution of nonsymmetric linear systems,
+ * SIAM J. Sci. Stat. Comput. 13(2), 1992.
+ */
+
+typedef struct
+{
+  size_t n;         /* size of linear system */
+  size_t m;         /* maximum number of iterations per call */
+  gsl_vector *r;    /* residual vector r = b - A*x */
+  gsl_vector *rhat; /* shadow residual r_0 */
+  gsl_vector *p;    /* search direction */
+  gsl_vector *v;    /* A*M^{-1}*p */
+  gsl_vector *s;    /* r - alpha*v */
+  gsl_vector *t;    /* A*M^{-1}*s */
+  gsl_vector *y;    /* M^{-1}*p */
+  gsl_vector *z;    /* M^{-1}*s */
+
+  const gsl_splinalg_precond *P; /* right preconditioner, or NULL */
+
+  double normr;     /* residual norm ||r|| */
+} bicgstab_state_t;
+
+static void bicgstab_free(void *vstate);
+
+/*
+bicgstab_alloc()
+  Allocate a BiCGSTAB workspace for solving an n-by-n system A x = b
+
+Inputs: n - size of system
+        m - maximum number of iterations per call to bicgstab_iterate();
+            if this parameter is 0, the value n is used
+
+Return: pointer to workspace
+*/
+
+static void *
+bicgstab_alloc(const size_t n, const size_t m)
+{
+  bicgstab_state_t *state;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  state = calloc(1, sizeof(bicgstab_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate bicgstab state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+  state->m = (m == 0) ? n : m;
+
+  state->r = gsl_vector_alloc(n);
+  state->rhat = gsl_vector_alloc(n);
+  state->p = gsl_vector_alloc(n);
+  state->v = gsl_vector_alloc(n);
+  state->s = gsl_vector_alloc(n);
+  state->t = gsl_vector_alloc(n);
+  state->y = gsl_vector_alloc(n);
+  state->z = gsl_vector_alloc(n);
+  if (!state->r || !state->rhat || !state->p || !state->v ||
+      !state->s || !state->t || !state->y || !state->z)
+    {
+      bicgstab_free(state);
+      GSL_ERROR_NULL("failed to allocate vectors", GSL_ENOMEM);
+    }
+
+  state->normr = 0.0;
+
+  return state;
+} /* bicgstab_alloc() */
+
+static void
+bicgstab_free(void *vstate)
+{
+  bicgstab_state_t *state = (bicgstab_state_t *) vstate;
+
+  if (state->r)
+    gsl_vector_free(state->r);
+
+  if (state->rhat)
+    gsl_vector_free(state->rhat);
+
+  if (state->p)
+    gsl_vector_free(state->p);
+
+  if (state->v)
+    gsl_vector_free(state->v);
+
+  if (state->s)
+    gsl_vector_free(state->s);
+
+  if (state->t)
+    gsl_vector_free(state->t);
+
+  if (state->y)
+    gsl_vector_free(state->y);
+
+  if (state->z)
+    gsl_vector_free(state->z);
+
+  free(state);
+} /* bicgstab_free() */
+
+/*
+bicgstab_solve()
+  Solve A*x = b using the BiCGSTAB method
+
+Inputs: A    - sparse square matrix
+        b    - right hand side vector
+        tol  - stopping tolerance
+        x    - (input/output) on input, initial estimate x_0;
+               on output, solution vector
+        work - workspace
+
+Return:
+GSL_SUCCESS if ||b - A*x|| <= tol * ||b||, GSL_CONTINUE if not yet
+converged after m iterations or after a breakdown of the method
+(rho = (rhat,r) = 0 or omega = 0); calling this function again
+restarts the iteration from the current x with a new shadow residual.
+
+Notes:
+1) work->normr contains the true residual ||b - A*x||
+*/
+
+static int
+bicgstab_solve(const splinalg_matrix *A, const gsl_vector *b,
+               const double tol, gsl_vector *x,
+               void *vstate)
+{
+  const size_t N = A->size1;
+  bicgstab_state_t *state = (bicgstab_state_t *) vstate;
+
+  if (N != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (N != b->size)
+    {
+      GSL_ERROR("matrix does not match right hand side", GSL_EBADLEN);
+    }
+  else if (N != x->size)
+    {
+      GSL_ERROR("matrix does not match solution vector", GSL_EBADLEN);
+    }
+  else if (N != state->n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const double normb = gsl_blas_dnrm2(b); /* ||b|| */
+      const double reltol = tol * normb;      /* tol*||b|| */
+      gsl_vector *r = state->r;
+      gsl_vector *rhat = state->rhat;
+      gsl_vector *p = state->p;
+      gsl_vector *v = state->v;
+      gsl_vector *s = state->s;
+      gsl_vector *t = state->t;
+      gsl_vector *y = state->P ? state->y : state->p;
+      gsl_vector *z = state->P ? state->z : state->s;
+      double normr, rho, alpha = 1.0, omega = 1.0;
+      size_t k;
+
+      /* r = b - A*x_0 */
+      gsl_vector_memcpy(r, b);
+      splinalg_dgemv(-1.0, A, x, 1.0, r);
+      normr = gsl_blas_dnrm2(r);
+
+      if (normr > reltol)
+        {
+          gsl_vector_memcpy(rhat, r);
+          gsl_vector_memcpy(p, r);
+          rho = normr * normr;
+
+          for (k = 0; k < state->m; ++k)
+            {
+              double rv, ts, tt, rho_new;
+
+              /* v = A M^{-1} p */
+              if (state->P)
+                gsl_splinalg_precond_apply(p, y, state->P);
+
+              splinalg_dgemv(1.0, A, y, 0.0, v);
+
+              gsl_blas_ddot(rhat, v, &rv);
+              if (rv == 0.0)
+                break;
+
+              alpha = rho / rv;
+
+              /* s = r - alpha v */
+              gsl_vector_memcpy(s, r);
+              gsl_blas_daxpy(-alpha, v, s);
+
+              normr = gsl_blas_dnrm2(s);
+              if (normr <= reltol)
+                {
+                  gsl_blas_daxpy(alpha, y, x);
+                  break;
+                }
+
+              /* t = A M^{-1} s */
+              if (state->P)
+                gsl_splinalg_precond_apply(s, z, state->P);
+
+              splinalg_dgemv(1.0, A, z, 0.0, t);
+
+              gsl_blas_ddot(t, s, &ts);
+              gsl_blas_ddot(t, t, &tt);
+              omega = (tt > 0.0) ? ts / tt : 0.0;
+
+              /* x = x + alpha M^{-1} p + omega M^{-1} s */
+              gsl_blas_daxpy(alpha, y, x);
+              gsl_blas_daxpy(omega, z, x);
+
+              /* r = s - omega t */
+              gsl_vector_memcpy(r, s);
+              gsl_blas_daxpy(-omega, t, r);
+
+              normr = gsl_blas_dnrm2(r);
+              if (normr <= reltol || omega == 0.0)
+                break;
+
+              gsl_blas_ddot(rhat, r, &rho_new);
+              if (rho_new == 0.0)
+                break;
+
+              /* p = r + beta (p - omega v) */
+              gsl_blas_daxpy(-omega, v, p);
+              gsl_vector_axpby(1.0, r, (rho_new / rho) * (alpha / omega), p);
+              rho = rho_new;
+            }
+
+          /* true residual */
+          gsl_vector_memcpy(r, b);
+          splinalg_dgemv(-1.0, A, x, 1.0, r);
+          normr = gsl_blas_dnrm2(r);
+        }
+
+      state->normr = normr;
+
+      if (normr <= reltol)
+        return GSL_SUCCESS;
+      else
+        return GSL_CONTINUE;
+    }
+} /* bicgstab_solve() */
+
+static int
+bicgstab_iterate(const gsl_spmatrix *A, const gsl_vector *b,
+                 const double tol, gsl_vector *x, void *vstate)
+{
+  splinalg_matrix M;
+
+  splinalg_matrix_init(&M, A, NULL);
+
+  return bicgstab_solve(&M, b, tol, x, vstate);
+} /* bicgstab_iterate() */
+
+static int
+bicgstab_iterate64(const gsl_spmatrix64 *A, const gsl_vector *b,
+                   const double tol, gsl_vector *x, void *vstate)
+{
+  splinalg_matrix M;
+
+  splinalg_matrix_init(&M, NULL, A);
+
+  return bicgstab_solve(&M, b, tol, x, vstate);
+} /* bicgstab_iterate64() */
+
+static double
+bicgstab_normr(const void *vstate)
+{
+  const bicgstab_state_t *state = (const bicgstab_state_t *) vstate;
+  return state->normr;
+} /* bicgstab_normr() */
+
+static int
+bicgstab_set_precond(const gsl_splinalg_precond *P, void *vstate)
+{
+  bicgstab_state_t *state = (bicgstab_state_t *) vstate;
+
+  if (P != NULL && P->n != state->n)
+    {
+      GSL_ERROR("preconditioner does not match workspace", GSL_EBADLEN);
+    }
+
+  state->P = P;
+
+  return GSL_SUCCESS;
+} /* bicgstab_set_precond() */
+
+static const gsl_splinalg_itersolve_type bicgstab_type =
+{
+  "bicgstab",
+  &bicgstab_alloc,
+  &bicgstab_iterate,
+  &bicgstab_normr,
+  &bicgstab_free,
+  &bicgstab_set_precond,
+  &bicgstab_iterate64
+};
+
+const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_bicgstab =
+  &bicgstab_type;
@@ -0,0 +1,296 @@
+/* splinalg/cg.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_splinalg.h>
+
+#include "itersolve.h"
+
+/*
+ * The preconditioned conjugate gradient method for symmetric positive
+ * definite A and M, algorithm 9.1 of
+ *
+ * Y. Saad, Iterative methods for sparse linear systems,
+ * 2nd edition, SIAM, 2003.
+ */
+
+typedef struct
+{
+  size_t n;        /* size of linear system */
+  size_t m;        /* maximum number of iterations per call */
+  gsl_vector *r;   /* residual vector r = b - A*x */
+  gsl_vector *z;   /* preconditioned residual z = M^{-1} r */
+  gsl_vector *p;   /* search direction */
+  gsl_vector *q;   /* A*p */
+
+  const gsl_splinalg_precond *P; /* preconditioner, or NULL */
+
+  double normr;    /* residual norm ||r|| */
+} cg_state_t;
+
+static void cg_free(void *vstate);
+
+/*
+cg_alloc()
+  Allocate a CG workspace for solving an n-by-n system A x = b
+
+Inputs: n - size of system
+        m - maximum number of iterations per call to cg_iterate();
+            if this parameter is 0, the value n is used
+
+Return: pointer to workspace
+*/
+
+static void *
+cg_alloc(const size_t n, const size_t m)
+{
+  cg_state_t *state;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  state = calloc(1, sizeof(cg_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate cg state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+  state->m = (m == 0) ? n : m;
+
+  state->r = gsl_vector_alloc(n);
+  state->z = gsl_vector_alloc(n);
+  state->p = gsl_vector_alloc(n);
+  state->q = gsl_vector_alloc(n);
+  if (!state->r || !state->z || !state->p || !state->q)
+    {
+      cg_free(state);
+      GSL_ERROR_NULL("failed to allocate vectors", GSL_ENOMEM);
+    }
+
+  state->normr = 0.0;
+
+  return state;
+} /* cg_alloc() */
+
+static void
+cg_free(void *vstate)
+{
+  cg_state_t *state = (cg_state_t *) vstate;
+
+  if (state->r)
+    gsl_vector_free(state->r);
+
+  if (state->z)
+    gsl_vector_free(state->z);
+
+  if (state->p)
+    gsl_vector_free(state->p);
+
+  if (state->q)
+    gsl_vector_free(state->q);
+
+  free(state);
+} /* cg_free() */
+
+/*
+cg_solve()
+  Solve A*x = b using the (preconditioned) conjugate gradient method
+
+Inputs: A    - sparse symmetric positive definite matrix
+        b    - right hand side vector
+        tol  - stopping tolerance
+        x    - (input/output) on input, initial estimate x_0;
+               on output, solution vector
+        work - workspace
+
+Return:
+GSL_SUCCESS if ||b - A*x|| <= tol * ||b||, GSL_CONTINUE if not yet
+converged after m iterations; calling this function again restarts
+the iteration from the current x.
+
+Notes:
+1) The recursively updated residual is used to stop the iteration; the
+returned status and work->normr are computed from the true residual
+b - A*x
+*/
+
+static int
+cg_solve(const splinalg_matrix *A, const gsl_vector *b,
+         const double tol, gsl_vector *x,
+         void *vstate)
+{
+  const size_t N = A->size1;
+  cg_state_t *state = (cg_state_t *) vstate;
+
+  if (N != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (N != b->size)
+    {
+      GSL_ERROR("matrix does not match right hand side", GSL_EBADLEN);
+    }
+  else if (N != x->size)
+    {
+      GSL_ERROR("matrix does not match solution vector", GSL_EBADLEN);
+    }
+  else if (N != state->n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const double normb = gsl_blas_dnrm2(b); /* ||b|| */
+      const double reltol = tol * normb;      /* tol*||b|| */
+      gsl_vector *r = state->r;
+      gsl_vector *z = state->P ? state->z : state->r;
+      gsl_vector *p = state->p;
+      gsl_vector *q = state->q;
+      double normr, rz;
+      size_t k;
+
+      /* r = b - A*x_0 */
+      gsl_vector_memcpy(r, b);
+      splinalg_dgemv(-1.0, A, x, 1.0, r);
+      normr = gsl_blas_dnrm2(r);
+
+      if (normr > reltol)
+        {
+          if (state->P)
+            gsl_splinalg_precond_apply(r, z, state->P);
+
+          gsl_vector_memcpy(p, z);
+          gsl_blas_ddot(r, z, &rz);
+
+          for (k = 0; k < state->m; ++k)
+            {
+              double pq, alpha, rz_new;
+
+              /* q = A p, alpha = (r,z) / (p,A p) */
+              splinalg_dgemv(1.0, A, p, 0.0, q);
+              gsl_blas_ddot(p, q, &pq);
+
+              if (pq <= 0.0 || rz <= 0.0)
+                {
+                  GSL_ERROR("matrix or preconditioner is not positive definite",
+                            GSL_EDOM);
+                }
+
+              alpha = rz / pq;
+
+              gsl_blas_daxpy(alpha, p, x);
+              gsl_blas_daxpy(-alpha, q, r);
+
+              normr = gsl_blas_dnrm2(r);
+              if (normr <= reltol)
+                break;
+
+              if (state->P)
+                gsl_splinalg_precond_apply(r, z, state->P);
+
+              gsl_blas_ddot(r, z, &rz_new);
+
+              /* p = z + beta p */
+              gsl_vector_axpby(1.0, z, rz_new / rz, p);
+              rz = rz_new;
+            }
+
+          /* true residual */
+          gsl_vector_memcpy(r, b);
+          splinalg_dgemv(-1.0, A, x, 1.0, r);
+          normr = gsl_blas_dnrm2(r);
+        }
+
+      state->normr = normr;
+
+      if (normr <= reltol)
+        return GSL_SUCCESS;
+      else
+        return GSL_CONTINUE;
+    }
+} /* cg_solve() */
+
+static int
+cg_iterate(const gsl_spmatrix *A, const gsl_vector *b,
+           const double tol, gsl_vector *x, void *vstate)
+{
+  splinalg_matrix M;
+
+  splinalg_matrix_init(&M, A, NULL);
+
+  return cg_solve(&M, b, tol, x, vstate);
+} /* cg_iterate() */
+
+static int
+cg_iterate64(const gsl_spmatrix64 *A, const gsl_vector *b,
+             const double tol, gsl_vector *x, void *vstate)
+{
+  splinalg_matrix M;
+
+  splinalg_matrix_init(&M, NULL, A);
+
+  return cg_solve(&M, b, tol, x, vstate);
+} /* cg_iterate64() */
+
+static double
+cg_normr(const void *vstate)
+{
+  const cg_state_t *state = (const cg_state_t *) vstate;
+  return state->normr;
+} /* cg_normr() */
+
+static int
+cg_set_precond(const gsl_splinalg_precond *P, void *vstate)
+{
+  cg_state_t *state = (cg_state_t *) vstate;
+
+  if (P != NULL && P->n != state->n)
+    {
+      GSL_ERROR("preconditioner does not match workspace", GSL_EBADLEN);
+    }
+
+  state->P = P;
+
+  return GSL_SUCCESS;
+} /* cg_set_precond() */
+
+static const gsl_splinalg_itersolve_type cg_type =
+{
+  "cg",
+  &cg_alloc,
+  &cg_iterate,
+  &cg_normr,
+  &cg_free,
+  &cg_set_precond,
+  &cg_iterate64
+};
+
+const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_cg =
+  &cg_type;
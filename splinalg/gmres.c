@@ -28,6 +28,8 @@
 #include <gsl/gsl_spblas.h>
 #include <gsl/gsl_splinalg.h>
 
+#include "itersolve.h"
+
 /*
  * The code in this module is based on the Householder GMRES
  * algorithm described in
@@ -52,12 +54,15 @@ typedef struct
   double *c;       /* Givens rotations */
   double *s;
 
+  const gsl_splinalg_precond *P; /* right preconditioner, or NULL */
+  gsl_vector *z;   /* M^{-1} v */
+
   double normr;    /* residual norm ||r|| */
 } gmres_state_t;
 
 static void gmres_free(void *vstate);
-static int gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
-                         const double tol, gsl_vector *x, void *vstate);
+static int gmres_solve(const splinalg_matrix *A, const gsl_vector *b,
+                       const double tol, gsl_vector *x, void *vstate);
 
 /*
 gmres_alloc()
@@ -160,11 +165,14 @@ gmres_free(void *vstate)
   if (state->s)
     free(state->s);
 
+  if (state->z)
+    gsl_vector_free(state->z);
+
   free(state);
 } /* gmres_free() */
 
 /*
-gmres_iterate()
+gmres_solve()
   Solve A*x = b using GMRES algorithm
 
 Inputs: A    - sparse square matrix
@@ -189,12 +197,16 @@ Notes:
 (Saad, 2003 [2])
 
 2) On output, work->normr contains ||b - A*x||
+
+3) With a preconditioner M, GMRES is applied to A M^{-1} u = b,
+x = M^{-1} u (right preconditioning, Saad algorithm 9.5), so that the
+residual minimized is still the true residual b - A*x
 */
 
 static int
-gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
-              const double tol, gsl_vector *x,
-              void *vstate)
+gmres_solve(const splinalg_matrix *A, const gsl_vector *b,
+            const double tol, gsl_vector *x,
+            void *vstate)
 {
   const size_t N = A->size1;
   gmres_state_t *state = (gmres_state_t *) vstate;
@@ -247,7 +259,7 @@ gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
 
       /* Step 1a: compute r = b - A*x_0 */
       gsl_vector_memcpy(r, b);
-      gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, r);
+      splinalg_dgemv(-1.0, A, x, 1.0, r);
 
       /* Step 1b */
       gsl_vector_memcpy(&h0.vector, r);
@@ -292,8 +304,14 @@ gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
               gsl_linalg_householder_hv(tau, &uk.vector, &vk.vector);
             }
 
-          /* Step 2a: v_m <- A*v_m */
-          gsl_spblas_dgemv(CblasNoTrans, 1.0, A, &vm.vector, 0.0, r);
+          /* Step 2a: v_m <- A*v_m, or A*M^{-1}*v_m */
+          if (state->P)
+            {
+              gsl_splinalg_precond_apply(&vm.vector, state->z, state->P);
+              splinalg_dgemv(1.0, A, state->z, 0.0, r);
+            }
+          else
+            splinalg_dgemv(1.0, A, &vm.vector, 0.0, r);
           gsl_vector_memcpy(&vm.vector, r);
 
           /* Step 2a: v_m <- P_m ... P_1 v_m */
@@ -395,12 +413,18 @@ gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
           gsl_linalg_householder_hv(tau, &uk.vector, &rk.vector);
         }
 
-      /* x <- x + V_m y_m */
-      gsl_vector_add(x, r);
+      /* x <- x + V_m y_m, or x + M^{-1} V_m y_m */
+      if (state->P)
+        {
+          gsl_splinalg_precond_apply(r, state->z, state->P);
+          gsl_vector_add(x, state->z);
+        }
+      else
+        gsl_vector_add(x, r);
 
       /* compute new residual r = b - A*x */
       gsl_vector_memcpy(r, b);
-      gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, r);
+      splinalg_dgemv(-1.0, A, x, 1.0, r);
       normr = gsl_blas_dnrm2(r);
 
       if (normr <= reltol)
@@ -413,8 +437,30 @@ gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
 
       return status;
     }
+} /* gmres_solve() */
+
+static int
+gmres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
+              const double tol, gsl_vector *x, void *vstate)
+{
+  splinalg_matrix M;
+
+  splinalg_matrix_init(&M, A, NULL);
+
+  return gmres_solve(&M, b, tol, x, vstate);
 } /* gmres_iterate() */
 
+static int
+gmres_iterate64(const gsl_spmatrix64 *A, const gsl_vector *b,
+                const double tol, gsl_vector *x, void *vstate)
+{
+  splinalg_matrix M;
+
+  splinalg_matrix_init(&M, NULL, A);
+
+  return gmres_solve(&M, b, tol, x, vstate);
+} /* gmres_iterate64() */
+
 static double
 gmres_normr(const void *vstate)
 {
@@ -422,13 +468,39 @@ gmres_normr(const void *vstate)
   return state->normr;
 } /* gmres_normr() */
 
+static int
+gmres_set_precond(const gsl_splinalg_precond *P, void *vstate)
+{
+  gmres_state_t *state = (gmres_state_t *) vstate;
+
+  if (P != NULL && P->n != state->n)
+    {
+      GSL_ERROR("preconditioner does not match workspace", GSL_EBADLEN);
+    }
+
+  if (P != NULL && state->z == NULL)
+    {
+      state->z = gsl_vector_alloc(state->n);
+      if (!state->z)
+        {
+          GSL_ERROR("failed to allocate z vector", GSL_ENOMEM);
+        }
+    }
+
+  state->P = P;
+
+  return GSL_SUCCESS;
+} /* gmres_set_precond() */
+
 static const gsl_splinalg_itersolve_type gmres_type =
 {
   "gmres",
   &gmres_alloc,
   &gmres_iterate,
   &gmres_normr,
-  &gmres_free
+  &gmres_free,
+  &gmres_set_precond,
+  &gmres_iterate64
 };
 
 const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_gmres =
@@ -24,7 +24,9 @@
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spmatrix64.h>
 #include <gsl/gsl_linalg.h>
+#include <gsl/gsl_permutation.h>
 #include <gsl/gsl_types.h>
 
 #undef __BEGIN_DECLS
@@ -39,6 +41,29 @@
 
 __BEGIN_DECLS
 
+/* preconditioner type */
+typedef struct
+{
+  const char *name;
+  void * (*alloc) (const size_t n);
+  int (*init) (const gsl_spmatrix *A, void *);
+  int (*apply) (const gsl_vector *r, gsl_vector *z, const void *);
+  void (*free) (void *);
+  int (*init64) (const gsl_spmatrix64 *A, void *); /* NULL if not supported */
+} gsl_splinalg_precond_type;
+
+typedef struct
+{
+  const gsl_splinalg_precond_type * type;
+  size_t n;     /* size of linear system */
+  void * state;
+} gsl_splinalg_precond;
+
+/* available preconditioners */
+GSL_VAR const gsl_splinalg_precond_type * gsl_splinalg_precond_jacobi;
+GSL_VAR const gsl_splinalg_precond_type * gsl_splinalg_precond_ilu0;
+GSL_VAR const gsl_splinalg_precond_type * gsl_splinalg_precond_ic0;
+
 /* iteration solver type */
 typedef struct
 {
@@ -48,6 +73,9 @@ typedef struct
                   const double tol, gsl_vector *x, void *);
   double (*normr)(const void *);
   void (*free) (void *);
+  int (*set_precond) (const gsl_splinalg_precond *P, void *);
+  int (*iterate64) (const gsl_spmatrix64 *A, const gsl_vector *b,
+                    const double tol, gsl_vector *x, void *);
 } gsl_splinalg_itersolve_type;
 
 typedef struct
@@ -59,6 +87,60 @@ typedef struct
 
 /* available types */
 GSL_VAR const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_gmres;
+GSL_VAR const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_cg;
+GSL_VAR const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_bicgstab;
+GSL_VAR const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_minres;
+
+/* orderings for the direct solvers */
+typedef enum
+{
+  GSL_SPLINALG_ORDER_NATURAL = 0,
+  GSL_SPLINALG_ORDER_AMD = 1,   /* approximate minimum degree */
+  GSL_SPLINALG_ORDER_RCM = 2,   /* reverse Cuthill-McKee */
+  GSL_SPLINALG_ORDER_ND = 3     /* nested dissection */
+} gsl_splinalg_order_t;
+
+/* supernodal Cholesky factorization P A P^T = L L^T */
+typedef struct
+{
+  size_t n;               /* size of matrix */
+  size_t nz;              /* number of stored elements of A */
+  gsl_permutation *perm;  /* fill-reducing ordering */
+  size_t nsuper;          /* number of supernodes */
+  size_t *super;          /* first column of each supernode, size nsuper+1 */
+  size_t *rowptr;         /* start of each supernode in rows, size nsuper+1 */
+  int *rows;              /* row indices of each supernode */
+  size_t *Lptr;           /* start of each supernode in Lx, size nsuper+1 */
+  double *Lx;             /* nrows-by-ncols row-major block of each supernode */
+  size_t nnzL;            /* number of nonzero elements in L */
+  int *col2super;         /* supernode of each column */
+  size_t *amap;           /* position in Lx of each element of A */
+  int *map;               /* workspace */
+  int *head;
+  int *link;
+  size_t *pos;
+  double *work;
+} gsl_splinalg_cholesky_workspace;
+
+/* LU factorization P A Q = L U with partial pivoting */
+typedef struct
+{
+  size_t n;               /* size of matrix */
+  gsl_permutation *p;     /* row permutation, from pivoting */
+  gsl_permutation *q;     /* column ordering */
+  int *Lp;                /* L, unit lower triangular in CSC format */
+  int *Li;
+  double *Lx;
+  size_t Lnzmax;
+  int *Up;                /* U, upper triangular in CSC format */
+  int *Ui;
+  double *Ux;
+  size_t Unzmax;
+  int *pinv;              /* workspace */
+  int *mark;
+  int *xi;
+  double *x;
+} gsl_splinalg_LU_workspace;
 
 /*
  * Prototypes
@@ -72,7 +154,52 @@ int gsl_splinalg_itersolve_iterate(const gsl_spmatrix *A,
                                    const gsl_vector *b,
                                    const double tol, gsl_vector *x,
                                    gsl_splinalg_itersolve *w);
+int gsl_splinalg_itersolve_iterate64(const gsl_spmatrix64 *A,
+                                     const gsl_vector *b,
+                                     const double tol, gsl_vector *x,
+                                     gsl_splinalg_itersolve *w);
 double gsl_splinalg_itersolve_normr(const gsl_splinalg_itersolve *w);
+int gsl_splinalg_itersolve_set_precond(gsl_splinalg_itersolve *w,
+                                       const gsl_splinalg_precond *P);
+
+gsl_splinalg_precond *
+gsl_splinalg_precond_alloc(const gsl_splinalg_precond_type *T,
+                           const size_t n);
+void gsl_splinalg_precond_free(gsl_splinalg_precond *P);
+const char *gsl_splinalg_precond_name(const gsl_splinalg_precond *P);
+int gsl_splinalg_precond_init(const gsl_spmatrix *A,
+                              gsl_splinalg_precond *P);
+int gsl_splinalg_precond_init64(const gsl_spmatrix64 *A,
+                                gsl_splinalg_precond *P);
+int gsl_splinalg_precond_apply(const gsl_vector *r, gsl_vector *z,
+                               const gsl_splinalg_precond *P);
+
+gsl_splinalg_cholesky_workspace *
+gsl_splinalg_cholesky_alloc(const gsl_spmatrix *A,
+                            const gsl_splinalg_order_t order);
+void gsl_splinalg_cholesky_free(gsl_splinalg_cholesky_workspace *w);
+int gsl_splinalg_cholesky_decomp(const gsl_spmatrix *A,
+                                 gsl_splinalg_cholesky_workspace *w);
+int gsl_splinalg_cholesky_solve(const gsl_splinalg_cholesky_workspace *w,
+                                const gsl_vector *b, gsl_vector *x);
+
+gsl_splinalg_LU_workspace *
+gsl_splinalg_LU_alloc(const gsl_spmatrix *A, const gsl_splinalg_order_t order);
+void gsl_splinalg_LU_free(gsl_splinalg_LU_workspace *w);
+int gsl_splinalg_LU_decomp(const gsl_spmatrix *A,
+                           gsl_splinalg_LU_workspace *w);
+int gsl_splinalg_LU_solve(const gsl_splinalg_LU_workspace *w,
+                          const gsl_vector *b, gsl_vector *x);
+
+int gsl_splinalg_order_rcm(const gsl_spmatrix *A, gsl_permutation *p);
+int gsl_splinalg_order_amd(const gsl_spmatrix *A, gsl_permutation *p);
+int gsl_splinalg_order_nd(const gsl_spmatrix *A, gsl_permutation *p);
+int gsl_splinalg_permute_sym(const gsl_spmatrix *A, const gsl_permutation *p,
+                             gsl_spmatrix *B);
+int gsl_splinalg_bandwidth(const gsl_spmatrix *A, size_t *lb, size_t *ub);
+int gsl_splinalg_sp2band(const gsl_spmatrix *A, const size_t lb,
+                         const size_t ub, gsl_matrix *AB);
+int gsl_splinalg_sp2symband(const gsl_spmatrix *A, gsl_matrix *AB);
 
 __END_DECLS
 
@@ -0,0 +1,257 @@
+/* splinalg/ic0.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_splinalg.h>
+
+#include "precond.h"
+
+/*
+ * Incomplete Cholesky factorization with no fill-in, IC(0): A ~ L L^T
+ * for symmetric positive definite A, where L has the nonzero pattern
+ * of the lower triangle of A. Only the lower triangle of A is used.
+ * Row i of L is computed from the rows k < i it references,
+ *
+ * L(i,k) = ( A(i,k) - sum_{j<k} L(i,j) L(k,j) ) / L(k,k)
+ * L(i,i) = sqrt( A(i,i) - sum_{j<i} L(i,j)^2 )
+ *
+ * where the sums run over the pattern of row i only.
+ */
+
+typedef struct
+{
+  size_t n;
+  gsl_spmatrix *L; /* CSR format, diagonal element last in each row */
+  int *iw;         /* position of each column in the current row, or -1 */
+  gsl_spblas_trsv_workspace *wL;  /* level schedules of L and L^T */
+  gsl_spblas_trsv_workspace *wLT;
+} ic0_state_t;
+
+static void ic0_free(void *vstate);
+
+static void *
+ic0_alloc(const size_t n)
+{
+  ic0_state_t *state;
+
+  state = calloc(1, sizeof(ic0_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate ic0 state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+
+  state->iw = malloc(n * sizeof(int));
+  if (!state->iw)
+    {
+      ic0_free(state);
+      GSL_ERROR_NULL("failed to allocate index array", GSL_ENOMEM);
+    }
+
+  return state;
+} /* ic0_alloc() */
+
+static void
+ic0_free(void *vstate)
+{
+  ic0_state_t *state = (ic0_state_t *) vstate;
+
+  if (state->L)
+    gsl_spmatrix_free(state->L);
+
+  if (state->iw)
+    free(state->iw);
+
+  gsl_spblas_dtrsv_free(state->wL);
+  gsl_spblas_dtrsv_free(state->wLT);
+
+  free(state);
+} /* ic0_free() */
+
+static int
+ic0_init(const gsl_spmatrix *A, void *vstate)
+{
+  ic0_state_t *state = (ic0_state_t *) vstate;
+  const size_t n = state->n;
+  int same;
+  int status = splinalg_precond_csr(A, 1, &state->L, &same);
+  const int *Lp, *Lj;
+  double *Ld;
+  size_t i;
+  int p, q;
+
+  if (status)
+    return status;
+
+  /* the level schedules depend only on the pattern of L */
+  if (!same)
+    {
+      gsl_spblas_dtrsv_free(state->wL);
+      gsl_spblas_dtrsv_free(state->wLT);
+      state->wL = NULL;
+      state->wLT = NULL;
+    }
+
+  Lp = state->L->p;
+  Lj = state->L->i;
+  Ld = state->L->data;
+
+  for (i = 0; i < n; ++i)
+    state->iw[i] = -1;
+
+  for (i = 0; i < n; ++i)
+    {
+      const int pdiag = Lp[i + 1] - 1;
+      double d;
+
+      if (pdiag < Lp[i] || Lj[pdiag] != (int) i)
+        {
+          GSL_ERROR("matrix has a zero diagonal element", GSL_EDOM);
+        }
+
+      for (p = Lp[i]; p < pdiag; ++p)
+        state->iw[Lj[p]] = p;
+
+      d = Ld[pdiag];
+
+      for (p = Lp[i]; p < pdiag; ++p)
+        {
+          const int k = Lj[p];
+          double s = Ld[p];
+
+          /* row k is complete; its last element is L(k,k) */
+          for (q = Lp[k]; q < Lp[k + 1] - 1; ++q)
+            {
+              int w = state->iw[Lj[q]];
+
+              if (w >= 0 && w < p)
+                s -= Ld[w] * Ld[q];
+            }
+
+          s /= Ld[Lp[k + 1] - 1];
+          Ld[p] = s;
+          d -= s * s;
+        }
+
+      for (p = Lp[i]; p < pdiag; ++p)
+        state->iw[Lj[p]] = -1;
+
+      if (d <= 0.0)
+        {
+          GSL_ERROR("matrix is not positive definite", GSL_EDOM);
+        }
+
+      Ld[pdiag] = sqrt(d);
+    }
+
+  /* the level schedules are only used with more than one thread */
+  if (gsl_get_num_threads() > 1 && state->wL == NULL)
+    {
+      state->wL = gsl_spblas_dtrsv_alloc(CblasLower, CblasNoTrans, state->L);
+      state->wLT = gsl_spblas_dtrsv_alloc(CblasLower, CblasTrans, state->L);
+      if (!state->wL || !state->wLT)
+        {
+          gsl_spblas_dtrsv_free(state->wL);
+          gsl_spblas_dtrsv_free(state->wLT);
+          state->wL = NULL;
+          state->wLT = NULL;
+          GSL_ERROR("failed to analyze IC(0) factor", GSL_ENOMEM);
+        }
+    }
+
+  return GSL_SUCCESS;
+} /* ic0_init() */
+
+/* solve L L^T z = r */
+static int
+ic0_apply(const gsl_vector *r, gsl_vector *z, const void *vstate)
+{
+  const ic0_state_t *state = (const ic0_state_t *) vstate;
+
+  if (state->wL != NULL && gsl_get_num_threads() > 1)
+    {
+      int status;
+
+      gsl_vector_memcpy(z, r);
+
+      status = gsl_spblas_dtrsv(CblasLower, CblasNoTrans, CblasNonUnit,
+                                state->L, z, state->wL);
+      if (status)
+        return status;
+
+      return gsl_spblas_dtrsv(CblasLower, CblasTrans, CblasNonUnit,
+                              state->L, z, state->wLT);
+    }
+  else
+    {
+      const size_t n = state->n;
+      const int *Lp = state->L->p;
+      const int *Lj = state->L->i;
+      const double *Ld = state->L->data;
+      size_t i;
+      int p;
+
+      /* L y = r */
+      for (i = 0; i < n; ++i)
+        {
+          double sum = gsl_vector_get(r, i);
+
+          for (p = Lp[i]; p < Lp[i + 1] - 1; ++p)
+            sum -= Ld[p] * gsl_vector_get(z, Lj[p]);
+
+          gsl_vector_set(z, i, sum / Ld[Lp[i + 1] - 1]);
+        }
+
+      /* L^T z = y, by columns of L^T */
+      for (i = n; i-- > 0; )
+        {
+          double zi = gsl_vector_get(z, i) / Ld[Lp[i + 1] - 1];
+
+          gsl_vector_set(z, i, zi);
+
+          for (p = Lp[i]; p < Lp[i + 1] - 1; ++p)
+            {
+              double *zk = gsl_vector_ptr(z, Lj[p]);
+              *zk -= Ld[p] * zi;
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+} /* ic0_apply() */
+
+static const gsl_splinalg_precond_type ic0_type =
+{
+  "ic0",
+  &ic0_alloc,
+  &ic0_init,
+  &ic0_apply,
+  &ic0_free,
+  NULL
+};
+
+const gsl_splinalg_precond_type * gsl_splinalg_precond_ic0 =
+  &ic0_type;
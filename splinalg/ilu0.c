@@ -0,0 +1,244 @@
+/* splinalg/ilu0.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_splinalg.h>
+
+#include "precond.h"
+
+/*
+ * Incomplete LU factorization with no fill-in, ILU(0): A ~ L U, where
+ * the unit lower triangular L and upper triangular U have together the
+ * nonzero pattern of A. See algorithm 10.4 of
+ *
+ * Y. Saad, Iterative methods for sparse linear systems,
+ * 2nd edition, SIAM, 2003.
+ */
+
+typedef struct
+{
+  size_t n;
+  gsl_spmatrix *LU; /* L (without its unit diagonal) and U in CSR format */
+  int *diag;        /* position of the diagonal element of each row in LU */
+  int *iw;          /* position of each column in the current row, or -1 */
+  gsl_spblas_trsv_workspace *wL; /* level schedules of L and U */
+  gsl_spblas_trsv_workspace *wU;
+} ilu0_state_t;
+
+static void ilu0_free(void *vstate);
+
+static void *
+ilu0_alloc(const size_t n)
+{
+  ilu0_state_t *state;
+
+  state = calloc(1, sizeof(ilu0_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate ilu0 state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+
+  state->diag = malloc(n * sizeof(int));
+  state->iw = malloc(n * sizeof(int));
+  if (!state->diag || !state->iw)
+    {
+      ilu0_free(state);
+      GSL_ERROR_NULL("failed to allocate index arrays", GSL_ENOMEM);
+    }
+
+  return state;
+} /* ilu0_alloc() */
+
+static void
+ilu0_free(void *vstate)
+{
+  ilu0_state_t *state = (ilu0_state_t *) vstate;
+
+  if (state->LU)
+    gsl_spmatrix_free(state->LU);
+
+  if (state->diag)
+    free(state->diag);
+
+  if (state->iw)
+    free(state->iw);
+
+  gsl_spblas_dtrsv_free(state->wL);
+  gsl_spblas_dtrsv_free(state->wU);
+
+  free(state);
+} /* ilu0_free() */
+
+static int
+ilu0_init(const gsl_spmatrix *A, void *vstate)
+{
+  ilu0_state_t *state = (ilu0_state_t *) vstate;
+  const size_t n = state->n;
+  int same;
+  int status = splinalg_precond_csr(A, 0, &state->LU, &same);
+  const int *Lp, *Lj;
+  double *Ld;
+  size_t i;
+  int p, q;
+
+  if (status)
+    return status;
+
+  /* the level schedules depend only on the pattern of LU */
+  if (!same)
+    {
+      gsl_spblas_dtrsv_free(state->wL);
+      gsl_spblas_dtrsv_free(state->wU);
+      state->wL = NULL;
+      state->wU = NULL;
+    }
+
+  Lp = state->LU->p;
+  Lj = state->LU->i;
+  Ld = state->LU->data;
+
+  for (i = 0; i < n; ++i)
+    state->iw[i] = -1;
+
+  for (i = 0; i < n; ++i)
+    {
+      for (p = Lp[i]; p < Lp[i + 1]; ++p)
+        state->iw[Lj[p]] = p;
+
+      /* eliminate the elements left of the diagonal, in column order */
+      for (p = Lp[i]; p < Lp[i + 1] && Lj[p] < (int) i; ++p)
+        {
+          const int k = Lj[p];
+          const double lik = Ld[p] / Ld[state->diag[k]];
+
+          Ld[p] = lik;
+
+          for (q = state->diag[k] + 1; q < Lp[k + 1]; ++q)
+            {
+              int w = state->iw[Lj[q]];
+
+              if (w >= 0)
+                Ld[w] -= lik * Ld[q];
+            }
+        }
+
+      state->diag[i] = p;
+
+      for (q = Lp[i]; q < Lp[i + 1]; ++q)
+        state->iw[Lj[q]] = -1;
+
+      if (p == Lp[i + 1] || Lj[p] != (int) i || Ld[p] == 0.0)
+        {
+          GSL_ERROR("zero pivot in ILU(0) factorization", GSL_EDOM);
+        }
+    }
+
+  /* the level schedules are only used with more than one thread */
+  if (gsl_get_num_threads() > 1 && state->wL == NULL)
+    {
+      state->wL = gsl_spblas_dtrsv_alloc(CblasLower, CblasNoTrans, state->LU);
+      state->wU = gsl_spblas_dtrsv_alloc(CblasUpper, CblasNoTrans, state->LU);
+      if (!state->wL || !state->wU)
+        {
+          gsl_spblas_dtrsv_free(state->wL);
+          gsl_spblas_dtrsv_free(state->wU);
+          state->wL = NULL;
+          state->wU = NULL;
+          GSL_ERROR("failed to analyze ILU(0) factors", GSL_ENOMEM);
+        }
+    }
+
+  return GSL_SUCCESS;
+} /* ilu0_init() */
+
+/* solve L U z = r */
+static int
+ilu0_apply(const gsl_vector *r, gsl_vector *z, const void *vstate)
+{
+  const ilu0_state_t *state = (const ilu0_state_t *) vstate;
+
+  if (state->wL != NULL && gsl_get_num_threads() > 1)
+    {
+      int status;
+
+      gsl_vector_memcpy(z, r);
+
+      status = gsl_spblas_dtrsv(CblasLower, CblasNoTrans, CblasUnit,
+                                state->LU, z, state->wL);
+      if (status)
+        return status;
+
+      return gsl_spblas_dtrsv(CblasUpper, CblasNoTrans, CblasNonUnit,
+                              state->LU, z, state->wU);
+    }
+  else
+    {
+      const size_t n = state->n;
+      const int *Lp = state->LU->p;
+      const int *Lj = state->LU->i;
+      const double *Ld = state->LU->data;
+      size_t i;
+      int p;
+
+      /* L y = r */
+      for (i = 0; i < n; ++i)
+        {
+          double sum = gsl_vector_get(r, i);
+
+          for (p = Lp[i]; p < state->diag[i]; ++p)
+            sum -= Ld[p] * gsl_vector_get(z, Lj[p]);
+
+          gsl_vector_set(z, i, sum);
+        }
+
+      /* U z = y */
+      for (i = n; i-- > 0; )
+        {
+          double sum = gsl_vector_get(z, i);
+
+          for (p = state->diag[i] + 1; p < Lp[i + 1]; ++p)
+            sum -= Ld[p] * gsl_vector_get(z, Lj[p]);
+
+          gsl_vector_set(z, i, sum / Ld[state->diag[i]]);
+        }
+
+      return GSL_SUCCESS;
+    }
+} /* ilu0_apply() */
+
+static const gsl_splinalg_precond_type ilu0_type =
+{
+  "ilu0",
+  &ilu0_alloc,
+  &ilu0_init,
+  &ilu0_apply,
+  &ilu0_free,
+  NULL
+};
+
+const gsl_splinalg_precond_type * gsl_splinalg_precond_ilu0 =
+  &ilu0_type;
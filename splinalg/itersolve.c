@@ -26,6 +26,8 @@
 #include <gsl/gsl_spblas.h>
 #include <gsl/gsl_splinalg.h>
 
+#include "itersolve.h"
+
 gsl_splinalg_itersolve *
 gsl_splinalg_itersolve_alloc(const gsl_splinalg_itersolve_type *T,
                              const size_t n, const size_t m)
@@ -83,8 +85,85 @@ gsl_splinalg_itersolve_iterate(const gsl_spmatrix *A, const gsl_vector *b,
   return status;
 }
 
+/*
+gsl_splinalg_itersolve_iterate64()
+  As gsl_splinalg_itersolve_iterate(), for a matrix with size_t
+indices in COO, CSC or CSR format
+*/
+
+int
+gsl_splinalg_itersolve_iterate64(const gsl_spmatrix64 *A,
+                                 const gsl_vector *b, const double tol,
+                                 gsl_vector *x, gsl_splinalg_itersolve *w)
+{
+  int status;
+
+  if (w->type->iterate64 == NULL)
+    {
+      GSL_ERROR("solver does not support size_t indices", GSL_EINVAL);
+    }
+
+  status = w->type->iterate64(A, b, tol, x, w->state);
+
+  /* store current residual */
+  w->normr = w->type->normr(w->state);
+
+  return status;
+}
+
 double
 gsl_splinalg_itersolve_normr(const gsl_splinalg_itersolve *w)
 {
   return w->normr;
 }
+
+/*
+gsl_splinalg_itersolve_set_precond()
+  Attach a preconditioner to the solver, which is used by all
+following calls to gsl_splinalg_itersolve_iterate(). The preconditioner
+must have been initialized by gsl_splinalg_precond_init() and must
+remain valid while it is attached. P = NULL detaches the current
+preconditioner.
+*/
+
+int
+gsl_splinalg_itersolve_set_precond(gsl_splinalg_itersolve *w,
+                                   const gsl_splinalg_precond *P)
+{
+  if (w->type->set_precond == NULL)
+    {
+      GSL_ERROR("solver does not support preconditioning", GSL_EINVAL);
+    }
+
+  return w->type->set_precond(P, w->state);
+}
+
+void
+splinalg_matrix_init(splinalg_matrix *M, const gsl_spmatrix *A,
+                     const gsl_spmatrix64 *A64)
+{
+  M->A = A;
+  M->A64 = A64;
+
+  if (A != NULL)
+    {
+      M->size1 = A->size1;
+      M->size2 = A->size2;
+    }
+  else
+    {
+      M->size1 = A64->size1;
+      M->size2 = A64->size2;
+    }
+} /* splinalg_matrix_init() */
+
+/* y = alpha*A*x + beta*y */
+int
+splinalg_dgemv(const double alpha, const splinalg_matrix *M,
+               const gsl_vector *x, const double beta, gsl_vector *y)
+{
+  if (M->A != NULL)
+    return gsl_spblas_dgemv(CblasNoTrans, alpha, M->A, x, beta, y);
+  else
+    return gsl_spblas_dgemv64(CblasNoTrans, alpha, M->A64, x, beta, y);
+} /* splinalg_dgemv() */
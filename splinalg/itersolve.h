@@ -0,0 +1,42 @@
+/* splinalg/itersolve.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_SPLINALG_ITERSOLVE_H__
+#define __GSL_SPLINALG_ITERSOLVE_H__
+
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spmatrix64.h>
+
+/* matrix of the linear system of an iterative solver, with int or
+   size_t indices */
+typedef struct
+{
+  size_t size1;
+  size_t size2;
+  const gsl_spmatrix *A;     /* int indices, or NULL */
+  const gsl_spmatrix64 *A64; /* size_t indices, or NULL */
+} splinalg_matrix;
+
+void splinalg_matrix_init(splinalg_matrix *M, const gsl_spmatrix *A,
+                          const gsl_spmatrix64 *A64);
+int splinalg_dgemv(const double alpha, const splinalg_matrix *M,
+                   const gsl_vector *x, const double beta, gsl_vector *y);
+
+#endif /* __GSL_SPLINALG_ITERSOLVE_H__ */
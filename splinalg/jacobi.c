@@ -0,0 +1,162 @@
+/* splinalg/jacobi.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+/*
+ * Jacobi (diagonal) preconditioner M = diag(A)
+ */
+
+typedef struct
+{
+  size_t n;
+  gsl_vector *dinv; /* 1 / diag(A) */
+} jacobi_state_t;
+
+static void jacobi_free(void *vstate);
+
+static void *
+jacobi_alloc(const size_t n)
+{
+  jacobi_state_t *state;
+
+  state = calloc(1, sizeof(jacobi_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate jacobi state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+
+  state->dinv = gsl_vector_alloc(n);
+  if (!state->dinv)
+    {
+      jacobi_free(state);
+      GSL_ERROR_NULL("failed to allocate dinv vector", GSL_ENOMEM);
+    }
+
+  return state;
+} /* jacobi_alloc() */
+
+static void
+jacobi_free(void *vstate)
+{
+  jacobi_state_t *state = (jacobi_state_t *) vstate;
+
+  if (state->dinv)
+    gsl_vector_free(state->dinv);
+
+  free(state);
+} /* jacobi_free() */
+
+static int
+jacobi_init(const gsl_spmatrix *A, void *vstate)
+{
+  jacobi_state_t *state = (jacobi_state_t *) vstate;
+  size_t i;
+
+  for (i = 0; i < state->n; ++i)
+    {
+      double aii = gsl_spmatrix_get(A, i, i);
+
+      if (aii == 0.0)
+        {
+          GSL_ERROR("matrix has a zero diagonal element", GSL_EDOM);
+        }
+
+      gsl_vector_set(state->dinv, i, 1.0 / aii);
+    }
+
+  return GSL_SUCCESS;
+} /* jacobi_init() */
+
+static int
+jacobi_init64(const gsl_spmatrix64 *A, void *vstate)
+{
+  jacobi_state_t *state = (jacobi_state_t *) vstate;
+  gsl_vector *d = state->dinv;
+  size_t i, k;
+
+  /* sum the diagonal elements, in one pass over A */
+  gsl_vector_set_zero(d);
+
+  if (GSL_SPMATRIX_ISCOO(A))
+    {
+      for (k = 0; k < A->nz; ++k)
+        {
+          if (A->i[k] == A->p[k])
+            d->data[A->i[k] * d->stride] += A->data[k];
+        }
+    }
+  else
+    {
+      for (i = 0; i < state->n; ++i)
+        {
+          for (k = A->p[i]; k < A->p[i + 1]; ++k)
+            {
+              if (A->i[k] == i)
+                d->data[i * d->stride] += A->data[k];
+            }
+        }
+    }
+
+  for (i = 0; i < state->n; ++i)
+    {
+      double aii = gsl_vector_get(d, i);
+
+      if (aii == 0.0)
+        {
+          GSL_ERROR("matrix has a zero diagonal element", GSL_EDOM);
+        }
+
+      gsl_vector_set(d, i, 1.0 / aii);
+    }
+
+  return GSL_SUCCESS;
+} /* jacobi_init64() */
+
+static int
+jacobi_apply(const gsl_vector *r, gsl_vector *z, const void *vstate)
+{
+  const jacobi_state_t *state = (const jacobi_state_t *) vstate;
+
+  gsl_vector_memcpy(z, r);
+  gsl_vector_mul(z, state->dinv);
+
+  return GSL_SUCCESS;
+} /* jacobi_apply() */
+
+static const gsl_splinalg_precond_type jacobi_type =
+{
+  "jacobi",
+  &jacobi_alloc,
+  &jacobi_init,
+  &jacobi_apply,
+  &jacobi_free,
+  &jacobi_init64
+};
+
+const gsl_splinalg_precond_type * gsl_splinalg_precond_jacobi =
+  &jacobi_type;
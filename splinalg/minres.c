@@ -0,0 +1,381 @@
+/* splinalg/minres.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spblas.h>
+#include <gsl/gsl_splinalg.h>
+
+#include "itersolve.h"
+
+/*
+ * The MINRES method for symmetric, possibly indefinite A, with a
+ * symmetric positive definite preconditioner M, as described in
+ *
+ * C. C. Paige and M. A. Saunders, Solution of sparse indefinite
+ * systems of linear equations, SIAM J. Numer. Anal. 12(4), 1975.
+ *
+ * The Lanczos vectors are generated with the M^{-1} inner product and
+ * the tridiagonal least squares problem is solved by Givens rotations,
+ * so that each iteration needs one product with A, one application of
+ * M^{-1} and seven vectors of storage.
+ */
+
+typedef struct
+{
+  size_t n;        /* size of linear system */
+  size_t m;        /* maximum number of iterations per call */
+  gsl_vector *r1;  /* previous two Lanczos residuals */
+  gsl_vector *r2;
+  gsl_vector *y;   /* M^{-1} r2 */
+  gsl_vector *v;   /* Lanczos vector */
+  gsl_vector *w;   /* last three search directions */
+  gsl_vector *w1;
+  gsl_vector *w2;
+
+  const gsl_splinalg_precond *P; /* preconditioner, or NULL */
+
+  double normr;    /* residual norm ||r|| */
+} minres_state_t;
+
+static void minres_free(void *vstate);
+
+/*
+minres_alloc()
+  Allocate a MINRES workspace for solving an n-by-n system A x = b
+
+Inputs: n - size of system
+        m - maximum number of iterations per call to minres_iterate();
+            if this parameter is 0, the value n is used
+
+Return: pointer to workspace
+*/
+
+static void *
+minres_alloc(const size_t n, const size_t m)
+{
+  minres_state_t *state;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  state = calloc(1, sizeof(minres_state_t));
+  if (!state)
+    {
+      GSL_ERROR_NULL("failed to allocate minres state", GSL_ENOMEM);
+    }
+
+  state->n = n;
+  state->m = (m == 0) ? n : m;
+
+  state->r1 = gsl_vector_alloc(n);
+  state->r2 = gsl_vector_alloc(n);
+  state->y = gsl_vector_alloc(n);
+  state->v = gsl_vector_alloc(n);
+  state->w = gsl_vector_alloc(n);
+  state->w1 = gsl_vector_alloc(n);
+  state->w2 = gsl_vector_alloc(n);
+  if (!state->r1 || !state->r2 || !state->y || !state->v ||
+      !state->w || !state->w1 || !state->w2)
+    {
+      minres_free(state);
+      GSL_ERROR_NULL("failed to allocate vectors", GSL_ENOMEM);
+    }
+
+  state->normr = 0.0;
+
+  return state;
+} /* minres_alloc() */
+
+static void
+minres_free(void *vstate)
+{
+  minres_state_t *state = (minres_state_t *) vstate;
+
+  if (state->r1)
+    gsl_vector_free(state->r1);
+
+  if (state->r2)
+    gsl_vector_free(state->r2);
+
+  if (state->y)
+    gsl_vector_free(state->y);
+
+  if (state->v)
+    gsl_vector_free(state->v);
+
+  if (state->w)
+    gsl_vector_free(state->w);
+
+  if (state->w1)
+    gsl_vector_free(state->w1);
+
+  if (state->w2)
+    gsl_vector_free(state->w2);
+
+  free(state);
+} /* minres_free() */
+
+/* y = M^{-1} r, and return (r,y) */
+static double
+minres_precond(const gsl_vector *r, gsl_vector *y,
+               const minres_state_t *state)
+{
+  double ry;
+
+  if (state->P)
+    gsl_splinalg_precond_apply(r, y, state->P);
+  else
+    gsl_vector_memcpy(y, r);
+
+  gsl_blas_ddot(r, y, &ry);
+
+  return ry;
+}
+
+/*
+minres_solve()
+  Solve A*x = b using the MINRES method
+
+Inputs: A    - sparse symmetric matrix
+        b    - right hand side vector
+        tol  - stopping tolerance
+        x    - (input/output) on input, initial estimate x_0;
+               on output, solution vector
+        work - workspace
+
+Return:
+GSL_SUCCESS if ||b - A*x|| <= tol * ||b||, GSL_CONTINUE if not yet
+converged after m iterations; calling this function again restarts
+the iteration from the current x.
+
+Notes:
+1) The iteration stops when the estimate of the residual norm in the
+M^{-1} norm has decreased by the factor tol*||b||/||r_0||; the returned
+status and work->normr are computed from the true residual b - A*x
+*/
+
+static int
+minres_solve(const splinalg_matrix *A, const gsl_vector *b,
+             const double tol, gsl_vector *x,
+             void *vstate)
+{
+  const size_t N = A->size1;
+  minres_state_t *state = (minres_state_t *) vstate;
+
+  if (N != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (N != b->size)
+    {
+      GSL_ERROR("matrix does not match right hand side", GSL_EBADLEN);
+    }
+  else if (N != x->size)
+    {
+      GSL_ERROR("matrix does not match solution vector", GSL_EBADLEN);
+    }
+  else if (N != state->n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const double normb = gsl_blas_dnrm2(b); /* ||b|| */
+      const double reltol = tol * normb;      /* tol*||b|| */
+      gsl_vector *r1 = state->r1;
+      gsl_vector *r2 = state->r2;
+      gsl_vector *y = state->y;
+      gsl_vector *v = state->v;
+      gsl_vector *w = state->w;
+      gsl_vector *w1 = state->w1;
+      gsl_vector *w2 = state->w2;
+      double normr;
+      size_t k;
+
+      /* r1 = b - A*x_0 */
+      gsl_vector_memcpy(r1, b);
+      splinalg_dgemv(-1.0, A, x, 1.0, r1);
+      normr = gsl_blas_dnrm2(r1);
+
+      if (normr > reltol)
+        {
+          double beta1 = minres_precond(r1, y, state);
+          double oldb = 0.0, beta, dbar = 0.0, epsln = 0.0;
+          double phibar, cs = -1.0, sn = 0.0, threshold;
+
+          if (beta1 <= 0.0)
+            {
+              GSL_ERROR("preconditioner is not positive definite", GSL_EDOM);
+            }
+
+          beta1 = sqrt(beta1);
+          beta = beta1;
+          phibar = beta1;
+          threshold = beta1 * (reltol / normr);
+
+          gsl_vector_memcpy(r2, r1);
+          gsl_vector_set_zero(w);
+          gsl_vector_set_zero(w2);
+
+          for (k = 0; k < state->m; ++k)
+            {
+              double alpha, oldeps, delta, gbar, gamma, phi;
+              gsl_vector *tmp;
+
+              /* Lanczos step: v = y / beta, y = A v - (beta/oldb) r1 - (alpha/beta) r2 */
+              gsl_vector_memcpy(v, y);
+              gsl_vector_scale(v, 1.0 / beta);
+
+              splinalg_dgemv(1.0, A, v, 0.0, y);
+              if (k > 0)
+                gsl_blas_daxpy(-beta / oldb, r1, y);
+
+              gsl_blas_ddot(v, y, &alpha);
+              gsl_blas_daxpy(-alpha / beta, r2, y);
+
+              /* r1 = r2, r2 = y, y = M^{-1} r2 */
+              tmp = r1;
+              r1 = r2;
+              r2 = y;
+              y = tmp;
+
+              oldb = beta;
+              beta = minres_precond(r2, y, state);
+              if (beta < 0.0)
+                {
+                  GSL_ERROR("preconditioner is not positive definite", GSL_EDOM);
+                }
+
+              beta = sqrt(beta);
+
+              /* apply the previous rotation and compute the next one */
+              oldeps = epsln;
+              delta = cs * dbar + sn * alpha;
+              gbar = sn * dbar - cs * alpha;
+              epsln = sn * beta;
+              dbar = -cs * beta;
+
+              gamma = gsl_hypot(gbar, beta);
+              if (gamma == 0.0)
+                gamma = GSL_DBL_EPSILON;
+
+              cs = gbar / gamma;
+              sn = beta / gamma;
+              phi = cs * phibar;
+              phibar = sn * phibar;
+
+              /* w = (v - oldeps w1 - delta w2) / gamma, with w1 = w2, w2 = w */
+              tmp = w1;
+              w1 = w2;
+              w2 = w;
+              w = tmp;
+
+              gsl_vector_memcpy(w, v);
+              gsl_blas_daxpy(-oldeps, w1, w);
+              gsl_blas_daxpy(-delta, w2, w);
+              gsl_vector_scale(w, 1.0 / gamma);
+
+              gsl_blas_daxpy(phi, w, x);
+
+              /* beta = 0 means an invariant subspace: x is exact */
+              if (phibar <= threshold || beta == 0.0)
+                break;
+            }
+
+          /* true residual */
+          gsl_vector_memcpy(r1, b);
+          splinalg_dgemv(-1.0, A, x, 1.0, r1);
+          normr = gsl_blas_dnrm2(r1);
+        }
+
+      state->normr = normr;
+
+      if (normr <= reltol)
+        return GSL_SUCCESS;
+      else
+        return GSL_CONTINUE;
+    }
+} /* minres_solve() */
+
+static int
+minres_iterate(const gsl_spmatrix *A, const gsl_vector *b,
+               const double tol, gsl_vector *x, void *vstate)
+{
+  splinalg_matrix M;
+
+  splinalg_matrix_init(&M, A, NULL);
+
+  return minres_solve(&M, b, tol, x, vstate);
+} /* minres_iterate() */
+
+static int
+minres_iterate64(const gsl_spmatrix64 *A, const gsl_vector *b,
+                 const double tol, gsl_vector *x, void *vstate)
+{
+  splinalg_matrix M;
+
+  splinalg_matrix_init(&M, NULL, A);
+
+  return minres_solve(&M, b, tol, x, vstate);
+} /* minres_iterate64() */
+
+static double
+minres_normr(const void *vstate)
+{
+  const minres_state_t *state = (const minres_state_t *) vstate;
+  return state->normr;
+} /* minres_normr() */
+
+static int
+minres_set_precond(const gsl_splinalg_precond *P, void *vstate)
+{
+  minres_state_t *state = (minres_state_t *) vstate;
+
+  if (P != NULL && P->n != state->n)
+    {
+      GSL_ERROR("preconditioner does not match workspace", GSL_EBADLEN);
+    }
+
+  state->P = P;
+
+  return GSL_SUCCESS;
+} /* minres_set_precond() */
+
+static const gsl_splinalg_itersolve_type minres_type =
+{
+  "minres",
+  &minres_alloc,
+  &minres_iterate,
+  &minres_normr,
+  &minres_free,
+  &minres_set_precond,
+  &minres_iterate64
+};
+
+const gsl_splinalg_itersolve_type * gsl_splinalg_itersolve_minres =
+  &minres_type;
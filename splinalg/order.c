@@ -0,0 +1,1056 @@
+/* splinalg/order.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Orderings of the rows and columns of a square sparse matrix, computed
+ * from the graph of the pattern of A + A^T:
+ *
+ * reverse Cuthill-McKee: each connected component is numbered by a
+ * breadth first search from a pseudo-peripheral node, visiting the
+ * unnumbered neighbors of each node in order of increasing degree, and
+ * the numbering is then reversed. This reduces the bandwidth and
+ * profile of P A P^T.
+ *
+ * nested dissection: the graph is split recursively by vertex
+ * separators, each numbered after the two parts it separates. The
+ * separator of a connected subgraph is the smallest level of a breadth
+ * first search from a pseudo-peripheral node leaving at least a fifth
+ * of the nodes on either side; its nodes adjacent to only one side are
+ * then moved into that side. Disconnected subgraphs are split into
+ * their components, and subgraphs of at most ORDER_ND_LEAF nodes are
+ * ordered by approximate minimum degree (see amd.c).
+ *
+ * Both are described in
+ *
+ * A. George and J. W. H. Liu, Computer Solution of Large Sparse
+ * Positive Definite Systems, Prentice-Hall, 1981.
+ *
+ * In all orderings perm[k] is the k-th node, ie: row and column k of
+ * P A P^T are row and column perm[k] of A.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_permutation.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+#include "order.h"
+
+/* largest subgraph ordered by minimum degree in nested dissection */
+#define ORDER_ND_LEAF 128
+
+/* visit the elements (i_,j_) of the COO, CSR or CSC matrix A, with the
+   value x_ */
+#define ORDER_FOREACH(A, body)                                       \
+  do {                                                               \
+    size_t i_, j_, q_;                                               \
+    double x_ = 0.0;                                                 \
+    (void) x_;                                                       \
+    if (GSL_SPMATRIX_ISCOO(A))                                       \
+      {                                                              \
+        for (q_ = 0; q_ < (A)->nz; ++q_)                             \
+          {                                                          \
+            i_ = (A)->i[q_]; j_ = (A)->p[q_]; x_ = (A)->data[q_];    \
+            body;                                                    \
+          }                                                          \
+      }                                                              \
+    else if (GSL_SPMATRIX_ISCSR(A))                                  \
+      {                                                              \
+        for (i_ = 0; i_ < (A)->size1; ++i_)                          \
+          for (q_ = (A)->p[i_]; q_ < (size_t) (A)->p[i_ + 1]; ++q_)  \
+            {                                                        \
+              j_ = (A)->i[q_]; x_ = (A)->data[q_];                   \
+              body;                                                  \
+            }                                                        \
+      }                                                              \
+    else                                                             \
+      {                                                              \
+        for (j_ = 0; j_ < (A)->size2; ++j_)                          \
+          for (q_ = (A)->p[j_]; q_ < (size_t) (A)->p[j_ + 1]; ++q_)  \
+            {                                                        \
+              i_ = (A)->i[q_]; x_ = (A)->data[q_];                   \
+              body;                                                  \
+            }                                                        \
+      }                                                              \
+  } while (0)
+
+/* undirected graph: the neighbors of node v are adj[xadj[v]], ...,
+   adj[xadj[v+1]-1] */
+typedef struct
+{
+  int n;
+  int *xadj;
+  int *adj;
+} order_graph;
+
+/* workspace of the breadth first searches */
+typedef struct
+{
+  int *mark;   /* mark[v] = stamp if v was visited by the current search */
+  int stamp;
+  int *ls;     /* nodes by levels */
+  int *xls;    /* level l is ls[xls[l]], ..., ls[xls[l+1]-1] */
+} order_bfs_workspace;
+
+static void
+order_graph_free(order_graph *G)
+{
+  free(G->xadj);
+  free(G->adj);
+}
+
+/*
+order_graph_init()
+  Build the graph of the pattern of A + A^T, without the diagonal and
+with each edge stored once in each direction
+*/
+
+static int
+order_graph_init(const gsl_spmatrix *A, order_graph *G)
+{
+  const int n = (int) A->size1;
+  int *pos;
+  int v, p, start, len;
+
+  G->n = n;
+  G->xadj = calloc(n + 1, sizeof(int));
+  G->adj = malloc(GSL_MAX(2 * A->nz, 1) * sizeof(int));
+  pos = malloc(n * sizeof(int));
+  if (!G->xadj || !G->adj || !pos)
+    {
+      order_graph_free(G);
+      free(pos);
+      return GSL_ENOMEM;
+    }
+
+  ORDER_FOREACH(A, if (i_ != j_) { G->xadj[i_ + 1]++; G->xadj[j_ + 1]++; });
+
+  for (v = 0; v < n; ++v)
+    {
+      G->xadj[v + 1] += G->xadj[v];
+      pos[v] = G->xadj[v];
+    }
+
+  ORDER_FOREACH(A, if (i_ != j_)
+                     {
+                       G->adj[pos[i_]++] = (int) j_;
+                       G->adj[pos[j_]++] = (int) i_;
+                     });
+
+  /* remove duplicate edges, compacting the lists in place */
+  for (v = 0; v < n; ++v)
+    pos[v] = -1;
+
+  for (v = 0, start = 0, len = 0; v < n; ++v)
+    {
+      const int end = G->xadj[v + 1];
+
+      for (p = start; p < end; ++p)
+        {
+          const int u = G->adj[p];
+
+          if (pos[u] != v)
+            {
+              pos[u] = v;
+              G->adj[len++] = u;
+            }
+        }
+
+      start = end;
+      G->xadj[v + 1] = len;
+    }
+
+  free(pos);
+
+  return GSL_SUCCESS;
+} /* order_graph_init() */
+
+static int
+order_bfs_alloc(const int n, order_bfs_workspace *W)
+{
+  W->mark = calloc(n, sizeof(int));
+  W->ls = malloc(n * sizeof(int));
+  W->xls = malloc((n + 1) * sizeof(int));
+  W->stamp = 0;
+
+  if (!W->mark || !W->ls || !W->xls)
+    return GSL_ENOMEM;
+
+  return GSL_SUCCESS;
+}
+
+static void
+order_bfs_free(order_bfs_workspace *W)
+{
+  free(W->mark);
+  free(W->ls);
+  free(W->xls);
+}
+
+/*
+order_bfs()
+  Breadth first search from root over the nodes v with part[v] = id,
+storing the level structure in W; returns the number of levels
+*/
+
+static int
+order_bfs(const order_graph *G, const int root, const int *part,
+          const int id, order_bfs_workspace *W)
+{
+  int *mark = W->mark;
+  int *ls = W->ls;
+  int head = 0, tail = 1, nlev = 0;
+  int stamp;
+
+  if (W->stamp == INT_MAX)
+    {
+      int v;
+
+      for (v = 0; v < G->n; ++v)
+        mark[v] = 0;
+
+      W->stamp = 0;
+    }
+
+  stamp = ++(W->stamp);
+
+  ls[0] = root;
+  mark[root] = stamp;
+
+  while (head < tail)
+    {
+      const int end = tail;
+
+      W->xls[nlev++] = head;
+
+      for (; head < end; ++head)
+        {
+          const int v = ls[head];
+          int p;
+
+          for (p = G->xadj[v]; p < G->xadj[v + 1]; ++p)
+            {
+              const int u = G->adj[p];
+
+              if (part[u] == id && mark[u] != stamp)
+                {
+                  mark[u] = stamp;
+                  ls[tail++] = u;
+                }
+            }
+        }
+    }
+
+  W->xls[nlev] = tail;
+
+  return nlev;
+} /* order_bfs() */
+
+/*
+order_peripheral()
+  Find a pseudo-peripheral node of the connected component of root in
+the subgraph part[v] = id: starting from root, the search is repeated
+from a node of least degree in the last level for as long as the number
+of levels increases. On output W holds the level structure from the
+returned node, and *nlev its number of levels.
+*/
+
+static int
+order_peripheral(const order_graph *G, int root, const int *part,
+                 const int id, order_bfs_workspace *W, int *nlev)
+{
+  int n0 = order_bfs(G, root, part, id, W);
+
+  while (1)
+    {
+      int best = W->ls[W->xls[n0 - 1]];
+      int mindeg = INT_MAX;
+      int k, n1;
+
+      for (k = W->xls[n0 - 1]; k < W->xls[n0]; ++k)
+        {
+          const int v = W->ls[k];
+          const int deg = G->xadj[v + 1] - G->xadj[v];
+
+          if (deg < mindeg)
+            {
+              mindeg = deg;
+              best = v;
+            }
+        }
+
+      n1 = order_bfs(G, best, part, id, W);
+      root = best;
+
+      if (n1 <= n0)
+        {
+          *nlev = n1;
+          return root;
+        }
+
+      n0 = n1;
+    }
+} /* order_peripheral() */
+
+typedef struct
+{
+  int deg;
+  int v;
+} order_node;
+
+static int
+order_compare(const void *a, const void *b)
+{
+  const order_node *na = (const order_node *) a;
+  const order_node *nb = (const order_node *) b;
+
+  if (na->deg != nb->deg)
+    return (na->deg < nb->deg) ? -1 : 1;
+  else
+    return (na->v < nb->v) ? -1 : (na->v > nb->v);
+}
+
+static int
+order_rcm(const order_graph *G, size_t *perm)
+{
+  const int n = G->n;
+  int *part = calloc(n, sizeof(int));  /* 0 if not yet numbered */
+  int *order = malloc(n * sizeof(int));
+  order_node *nbr = malloc(n * sizeof(order_node));
+  order_bfs_workspace W;
+  int s, k = 0, status;
+
+  status = order_bfs_alloc(n, &W);
+  if (status || !part || !order || !nbr)
+    {
+      free(part);
+      free(order);
+      free(nbr);
+      order_bfs_free(&W);
+      return GSL_ENOMEM;
+    }
+
+  for (s = 0; s < n; ++s)
+    {
+      int nlev, head;
+
+      if (part[s] != 0)
+        continue;
+
+      /* Cuthill-McKee numbering of the component of s */
+      order[k++] = order_peripheral(G, s, part, 0, &W, &nlev);
+      part[order[k - 1]] = 1;
+
+      for (head = k - 1; head < k; ++head)
+        {
+          const int v = order[head];
+          int p, m = 0;
+
+          for (p = G->xadj[v]; p < G->xadj[v + 1]; ++p)
+            {
+              const int u = G->adj[p];
+
+              if (part[u] == 0)
+                {
+                  part[u] = 1;
+                  nbr[m].deg = G->xadj[u + 1] - G->xadj[u];
+                  nbr[m].v = u;
+                  ++m;
+                }
+            }
+
+          qsort(nbr, m, sizeof(order_node), order_compare);
+
+          for (p = 0; p < m; ++p)
+            order[k++] = nbr[p].v;
+        }
+    }
+
+  /* reverse */
+  for (k = 0; k < n; ++k)
+    perm[k] = (size_t) order[n - 1 - k];
+
+  free(part);
+  free(order);
+  free(nbr);
+  order_bfs_free(&W);
+
+  return GSL_SUCCESS;
+} /* order_rcm() */
+
+/*
+order_nd_leaf()
+  Order the nodes[0..m-1], which are the nodes v with part[v] = id, by
+approximate minimum degree of their induced subgraph
+*/
+
+static int
+order_nd_leaf(const order_graph *G, int *nodes, const int m,
+              const int *part, const int id, int *loc, int *tmp,
+              size_t *lperm)
+{
+  gsl_spmatrix *L;
+  size_t nnz = 0;
+  int k, p, status;
+
+  if (m <= 2)
+    return GSL_SUCCESS;
+
+  for (k = 0; k < m; ++k)
+    {
+      const int v = nodes[k];
+
+      loc[v] = k;
+
+      for (p = G->xadj[v]; p < G->xadj[v + 1]; ++p)
+        nnz += (part[G->adj[p]] == id);
+    }
+
+  L = gsl_spmatrix_alloc_nzmax(m, m, nnz, GSL_SPMATRIX_CSR);
+  if (L == NULL)
+    return GSL_ENOMEM;
+
+  L->p[0] = 0;
+
+  for (k = 0; k < m; ++k)
+    {
+      const int v = nodes[k];
+
+      for (p = G->xadj[v]; p < G->xadj[v + 1]; ++p)
+        {
+          const int u = G->adj[p];
+
+          if (part[u] == id)
+            {
+              L->i[L->nz] = loc[u];
+              L->data[L->nz] = 1.0;
+              ++(L->nz);
+            }
+        }
+
+      L->p[k + 1] = (int) L->nz;
+    }
+
+  status = splinalg_amd(L, lperm);
+  gsl_spmatrix_free(L);
+
+  if (status)
+    return status;
+
+  for (k = 0; k < m; ++k)
+    tmp[k] = nodes[lperm[k]];
+
+  for (k = 0; k < m; ++k)
+    nodes[k] = tmp[k];
+
+  return GSL_SUCCESS;
+} /* order_nd_leaf() */
+
+static int
+order_nd(const order_graph *G, size_t *perm)
+{
+  const int n = G->n;
+  int *nodes = malloc(n * sizeof(int));
+  int *part = calloc(n, sizeof(int));
+  int *loc = malloc(n * sizeof(int));
+  int *tmp = malloc(n * sizeof(int));
+  int *stack = malloc(2 * (n + 1) * sizeof(int));
+  size_t *lperm = malloc(n * sizeof(size_t));
+  order_bfs_workspace W;
+  int k, top = 0, tag = 0, status;
+
+  status = order_bfs_alloc(n, &W);
+  if (status || !nodes || !part || !loc || !tmp || !stack || !lperm)
+    {
+      status = GSL_ENOMEM;
+      goto cleanup;
+    }
+
+  for (k = 0; k < n; ++k)
+    nodes[k] = k;
+
+  /* ranges of nodes[] still to be ordered; range [lo,hi) is ordered
+     in place, and its nodes end up in positions lo..hi-1 */
+  stack[top++] = 0;
+  stack[top++] = n;
+
+  while (top > 0)
+    {
+      const int hi = stack[--top];
+      const int lo = stack[--top];
+      const int m = hi - lo;
+      int *nd = nodes + lo;
+      int nlev, ncomp;
+      int tagA, tagS, tagB;
+
+      if (m == 0)
+        continue;
+
+      /* tag the nodes of this subgraph */
+      tag += 3;
+      tagA = tag;
+      tagS = tag + 1;
+      tagB = tag + 2;
+
+      for (k = 0; k < m; ++k)
+        part[nd[k]] = tagA;
+
+      if (m <= ORDER_ND_LEAF)
+        {
+          status = order_nd_leaf(G, nd, m, part, tagA, loc, tmp, lperm);
+          if (status)
+            goto cleanup;
+
+          continue;
+        }
+
+      order_peripheral(G, nd[0], part, tagA, &W, &nlev);
+      ncomp = W.xls[nlev];
+
+      if (ncomp < m)
+        {
+          /* disconnected: split off the component which was searched */
+          int na = 0, nb = ncomp;
+
+          for (k = 0; k < m; ++k)
+            {
+              const int v = nd[k];
+
+              if (W.mark[v] == W.stamp)
+                tmp[na++] = v;
+              else
+                tmp[nb++] = v;
+            }
+
+          for (k = 0; k < m; ++k)
+            nd[k] = tmp[k];
+
+          stack[top++] = lo;
+          stack[top++] = lo + ncomp;
+          stack[top++] = lo + ncomp;
+          stack[top++] = hi;
+          continue;
+        }
+
+      if (nlev < 3)
+        {
+          /* no level separates two nonempty parts */
+          status = order_nd_leaf(G, nd, m, part, tagA, loc, tmp, lperm);
+          if (status)
+            goto cleanup;
+
+          continue;
+        }
+
+      {
+        int best = -1, l, na = 0, nb = 0;
+
+        /* smallest balanced separating level */
+        for (l = 1; l < nlev - 1; ++l)
+          {
+            const int below = W.xls[l];
+            const int above = m - W.xls[l + 1];
+            const int size = W.xls[l + 1] - W.xls[l];
+
+            if (5 * below >= m && 5 * above >= m &&
+                (best < 0 || size < W.xls[best + 1] - W.xls[best]))
+              best = l;
+          }
+
+        if (best < 0)
+          {
+            /* the level containing the median node */
+            for (best = 1; best < nlev - 2 && 2 * W.xls[best + 1] <= m; ++best)
+              ;
+          }
+
+        for (l = 0; l < nlev; ++l)
+          {
+            const int t = (l < best) ? tagA : ((l == best) ? tagS : tagB);
+
+            for (k = W.xls[l]; k < W.xls[l + 1]; ++k)
+              part[W.ls[k]] = t;
+          }
+
+        /* move separator nodes without neighbors in B into A; each
+           node of level best+1 keeps a neighbor in the separator */
+        for (k = W.xls[best]; k < W.xls[best + 1]; ++k)
+          {
+            const int v = W.ls[k];
+            int p;
+
+            for (p = G->xadj[v]; p < G->xadj[v + 1]; ++p)
+              {
+                if (part[G->adj[p]] == tagB)
+                  break;
+              }
+
+            if (p == G->xadj[v + 1])
+              part[v] = tagA;
+          }
+
+        /* A, then B, then the separator */
+        for (k = 0; k < m; ++k)
+          {
+            const int v = nd[k];
+
+            na += (part[v] == tagA);
+            nb += (part[v] == tagB);
+          }
+
+        {
+          int ia = 0, ib = na, is = na + nb;
+
+          for (k = 0; k < m; ++k)
+            {
+              const int v = nd[k];
+
+              if (part[v] == tagA)
+                tmp[ia++] = v;
+              else if (part[v] == tagB)
+                tmp[ib++] = v;
+              else
+                tmp[is++] = v;
+            }
+        }
+
+        for (k = 0; k < m; ++k)
+          nd[k] = tmp[k];
+
+        stack[top++] = lo;
+        stack[top++] = lo + na;
+        stack[top++] = lo + na;
+        stack[top++] = lo + na + nb;
+      }
+    }
+
+  for (k = 0; k < n; ++k)
+    perm[k] = (size_t) nodes[k];
+
+cleanup:
+  free(nodes);
+  free(part);
+  free(loc);
+  free(tmp);
+  free(stack);
+  free(lperm);
+  order_bfs_free(&W);
+
+  return status;
+} /* order_nd() */
+
+/*
+splinalg_order()
+  Compute the ordering of the square COO, CSR or CSC matrix A given by
+order into perm[0..n-1]
+*/
+
+int
+splinalg_order(const gsl_spmatrix *A, const gsl_splinalg_order_t order,
+               size_t *perm)
+{
+  if (A->size1 > INT_MAX || A->nz > INT_MAX / 2)
+    {
+      GSL_ERROR("matrix too large", GSL_EOVRFLW);
+    }
+  else if (order == GSL_SPLINALG_ORDER_AMD)
+    {
+      return splinalg_amd(A, perm);
+    }
+  else if (order == GSL_SPLINALG_ORDER_RCM ||
+           order == GSL_SPLINALG_ORDER_ND)
+    {
+      order_graph G;
+      int status = order_graph_init(A, &G);
+
+      if (status)
+        {
+          GSL_ERROR("failed to allocate graph", status);
+        }
+
+      if (order == GSL_SPLINALG_ORDER_RCM)
+        status = order_rcm(&G, perm);
+      else
+        status = order_nd(&G, perm);
+
+      order_graph_free(&G);
+
+      if (status)
+        {
+          GSL_ERROR("failed to compute ordering", status);
+        }
+
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      size_t k;
+
+      for (k = 0; k < A->size1; ++k)
+        perm[k] = k;
+
+      return GSL_SUCCESS;
+    }
+} /* splinalg_order() */
+
+static int
+order_check(const gsl_spmatrix *A, const gsl_permutation *p)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (p->size != A->size1)
+    {
+      GSL_ERROR("permutation size must match matrix size", GSL_EBADLEN);
+    }
+  else if (!GSL_SPMATRIX_ISCOO(A) && !GSL_SPMATRIX_ISCSR(A) &&
+           !GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR("matrix must be in COO, CSR or CSC format", GSL_EINVAL);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+gsl_splinalg_order_rcm()
+  Reverse Cuthill-McKee ordering of the pattern of A + A^T
+
+Inputs: A - square sparse matrix in COO, CSR or CSC format
+        p - (output) permutation; row and column k of P A P^T
+            are row and column p[k] of A
+*/
+
+int
+gsl_splinalg_order_rcm(const gsl_spmatrix *A, gsl_permutation *p)
+{
+  int status = order_check(A, p);
+
+  if (status)
+    return status;
+
+  return splinalg_order(A, GSL_SPLINALG_ORDER_RCM, p->data);
+}
+
+int
+gsl_splinalg_order_amd(const gsl_spmatrix *A, gsl_permutation *p)
+{
+  int status = order_check(A, p);
+
+  if (status)
+    return status;
+
+  return splinalg_order(A, GSL_SPLINALG_ORDER_AMD, p->data);
+}
+
+int
+gsl_splinalg_order_nd(const gsl_spmatrix *A, gsl_permutation *p)
+{
+  int status = order_check(A, p);
+
+  if (status)
+    return status;
+
+  return splinalg_order(A, GSL_SPLINALG_ORDER_ND, p->data);
+}
+
+/*
+gsl_splinalg_permute_sym()
+  Compute B = P A P^T, ie: B(k,l) = A(p[k],p[l])
+
+Inputs: A - square sparse matrix in CSR or CSC format
+        p - permutation
+        B - (output) P A P^T, in the format of A, with the indices
+            of each row (CSR) or column (CSC) in increasing order;
+            B is enlarged if needed
+
+Notes:
+1) The rows of B are formed by transposing the permuted matrix twice,
+which sorts the indices in O(n + nnz) operations.
+*/
+
+int
+gsl_splinalg_permute_sym(const gsl_spmatrix *A, const gsl_permutation *p,
+                         gsl_spmatrix *B)
+{
+  const size_t n = A->size1;
+
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (p->size != n)
+    {
+      GSL_ERROR("permutation size must match matrix size", GSL_EBADLEN);
+    }
+  else if (B->size1 != n || B->size2 != n)
+    {
+      GSL_ERROR("B matrix has wrong dimensions", GSL_EBADLEN);
+    }
+  else if (!GSL_SPMATRIX_ISCSR(A) && !GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR("matrix must be in CSR or CSC format", GSL_EINVAL);
+    }
+  else if (B->sptype != A->sptype)
+    {
+      GSL_ERROR("B matrix must have the same format as A", GSL_EINVAL);
+    }
+  else
+    {
+      /* the compressed arrays of P A P^T are those of A in both the
+         CSR and CSC formats */
+      const size_t nz = A->p[n];
+      int *pinv = malloc(n * sizeof(int));
+      int *Tp = malloc((n + 1) * sizeof(int));
+      int *Ti = malloc(GSL_MAX(nz, 1) * sizeof(int));
+      double *Tx = malloc(GSL_MAX(nz, 1) * sizeof(double));
+      int status = GSL_SUCCESS;
+      size_t k, l;
+      int q;
+
+      if (!pinv || !Tp || !Ti || !Tx)
+        {
+          status = GSL_ENOMEM;
+          goto cleanup;
+        }
+
+      if (B->nzmax < nz)
+        {
+          status = gsl_spmatrix_realloc(nz, B);
+          if (status)
+            goto cleanup;
+        }
+
+      for (k = 0; k < n; ++k)
+        pinv[p->data[k]] = (int) k;
+
+      /* T = (P A P^T)^T, with outer index l = pinv[inner index of A] */
+      for (l = 0; l <= n; ++l)
+        Tp[l] = 0;
+
+      for (q = 0; q < (int) nz; ++q)
+        Tp[pinv[A->i[q]] + 1]++;
+
+      for (l = 0; l < n; ++l)
+        Tp[l + 1] += Tp[l];
+
+      for (k = 0; k < n; ++k)
+        {
+          const size_t r = p->data[k];
+
+          for (q = A->p[r]; q < A->p[r + 1]; ++q)
+            {
+              const int dest = Tp[pinv[A->i[q]]]++;
+
+              Ti[dest] = (int) k;
+              Tx[dest] = A->data[q];
+            }
+        }
+
+      /* Tp[l] is now the end of row l of T */
+
+      /* B = T^T */
+      for (k = 0; k <= n; ++k)
+        B->p[k] = 0;
+
+      for (q = 0; q < (int) nz; ++q)
+        B->p[Ti[q] + 1]++;
+
+      for (k = 0; k < n; ++k)
+        B->p[k + 1] += B->p[k];
+
+      for (l = 0, q = 0; l < n; ++l)
+        {
+          for (; q < Tp[l]; ++q)
+            {
+              const int dest = B->p[Ti[q]]++;
+
+              B->i[dest] = (int) l;
+              B->data[dest] = Tx[q];
+            }
+        }
+
+      for (k = n; k > 0; --k)
+        B->p[k] = B->p[k - 1];
+
+      B->p[0] = 0;
+      B->nz = nz;
+
+cleanup:
+      free(pinv);
+      free(Tp);
+      free(Ti);
+      free(Tx);
+
+      if (status)
+        {
+          GSL_ERROR("failed to permute matrix", status);
+        }
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_splinalg_permute_sym() */
+
+/*
+gsl_splinalg_bandwidth()
+  Compute the lower and upper bandwidths of A, the largest values of
+i - j and j - i over its stored elements (A in COO, CSR or CSC format)
+*/
+
+int
+gsl_splinalg_bandwidth(const gsl_spmatrix *A, size_t *lb, size_t *ub)
+{
+  if (!GSL_SPMATRIX_ISCOO(A) && !GSL_SPMATRIX_ISCSR(A) &&
+      !GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR("matrix must be in COO, CSR or CSC format", GSL_EINVAL);
+    }
+  else
+    {
+      size_t l = 0, u = 0;
+
+      ORDER_FOREACH(A, if (i_ > j_ && i_ - j_ > l) l = i_ - j_;
+                    if (j_ > i_ && j_ - i_ > u) u = j_ - i_);
+
+      *lb = l;
+      *ub = u;
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_splinalg_sp2band()
+  Convert the square sparse matrix A into the packed band format of
+gsl_linalg_LU_band_decomp()
+
+Inputs: A  - square sparse matrix in COO, CSR or CSC format, with lower
+             and upper bandwidths at most lb and ub
+        lb - lower bandwidth
+        ub - upper bandwidth
+        AB - (output) N-by-(2*lb + ub + 1) packed band matrix,
+             A(i,j) = AB(j, lb + ub + i - j); the first lb
+             columns are workspace for the factorization and are
+             set to zero. Duplicate elements of A are summed.
+*/
+
+int
+gsl_splinalg_sp2band(const gsl_spmatrix *A, const size_t lb,
+                     const size_t ub, gsl_matrix *AB)
+{
+  const size_t N = A->size1;
+
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (AB->size1 != N)
+    {
+      GSL_ERROR("banded matrix requires N rows", GSL_EBADLEN);
+    }
+  else if (AB->size2 != 2 * lb + ub + 1)
+    {
+      GSL_ERROR("banded matrix requires 2*lb + ub + 1 columns", GSL_EBADLEN);
+    }
+  else if (!GSL_SPMATRIX_ISCOO(A) && !GSL_SPMATRIX_ISCSR(A) &&
+           !GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR("matrix must be in COO, CSR or CSC format", GSL_EINVAL);
+    }
+  else
+    {
+      int inband = 1;
+
+      gsl_matrix_set_zero(AB);
+
+      ORDER_FOREACH(A,
+                    if ((i_ > j_ && i_ - j_ > lb) || (j_ > i_ && j_ - i_ > ub))
+                      inband = 0;
+                    else
+                      *gsl_matrix_ptr(AB, j_, lb + ub + i_ - j_) += x_);
+
+      if (!inband)
+        {
+          GSL_ERROR("matrix has elements outside the band", GSL_EDOM);
+        }
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_splinalg_sp2band() */
+
+/*
+gsl_splinalg_sp2symband()
+  Convert the lower triangle of the symmetric sparse matrix A into the
+symmetric band format of gsl_linalg_cholesky_band_decomp()
+
+Inputs: A  - square sparse matrix in COO, CSR or CSC format; only its
+             lower triangle is referenced
+        AB - (output) N-by-(p + 1) band matrix, where p is the lower
+             bandwidth of A, A(j+k,j) = AB(j,k). Duplicate elements
+             of A are summed.
+*/
+
+int
+gsl_splinalg_sp2symband(const gsl_spmatrix *A, gsl_matrix *AB)
+{
+  const size_t N = A->size1;
+
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (AB->size1 != N || AB->size2 == 0)
+    {
+      GSL_ERROR("banded matrix requires N rows", GSL_EBADLEN);
+    }
+  else if (!GSL_SPMATRIX_ISCOO(A) && !GSL_SPMATRIX_ISCSR(A) &&
+           !GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR("matrix must be in COO, CSR or CSC format", GSL_EINVAL);
+    }
+  else
+    {
+      const size_t p = AB->size2 - 1;
+      int inband = 1;
+
+      gsl_matrix_set_zero(AB);
+
+      ORDER_FOREACH(A,
+                    if (i_ >= j_)
+                      {
+                        if (i_ - j_ > p)
+                          inband = 0;
+                        else
+                          *gsl_matrix_ptr(AB, j_, i_ - j_) += x_;
+                      });
+
+      if (!inband)
+        {
+          GSL_ERROR("matrix has elements outside the band", GSL_EDOM);
+        }
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_splinalg_sp2symband() */
@@ -0,0 +1,30 @@
+/* splinalg/order.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_SPLINALG_ORDER_H__
+#define __GSL_SPLINALG_ORDER_H__
+
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+int splinalg_amd(const gsl_spmatrix *A, size_t *perm);
+int splinalg_order(const gsl_spmatrix *A, const gsl_splinalg_order_t order,
+                   size_t *perm);
+
+#endif /* __GSL_SPLINALG_ORDER_H__ */
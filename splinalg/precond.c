@@ -0,0 +1,296 @@
+/* splinalg/precond.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+#include "precond.h"
+
+gsl_splinalg_precond *
+gsl_splinalg_precond_alloc(const gsl_splinalg_precond_type *T,
+                           const size_t n)
+{
+  gsl_splinalg_precond *P;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+
+  P = calloc(1, sizeof(gsl_splinalg_precond));
+  if (P == NULL)
+    {
+      GSL_ERROR_NULL("failed to allocate space for precond struct",
+                     GSL_ENOMEM);
+    }
+
+  P->type = T;
+  P->n = n;
+
+  P->state = P->type->alloc(n);
+  if (P->state == NULL)
+    {
+      gsl_splinalg_precond_free(P);
+      GSL_ERROR_NULL("failed to allocate space for precond state",
+                     GSL_ENOMEM);
+    }
+
+  return P;
+} /* gsl_splinalg_precond_alloc() */
+
+void
+gsl_splinalg_precond_free(gsl_splinalg_precond *P)
+{
+  RETURN_IF_NULL(P);
+
+  if (P->state)
+    P->type->free(P->state);
+
+  free(P);
+}
+
+const char *
+gsl_splinalg_precond_name(const gsl_splinalg_precond *P)
+{
+  return P->type->name;
+}
+
+/*
+gsl_splinalg_precond_init()
+  Compute the preconditioner M ~ A of the n-by-n matrix A, which may
+be stored in COO, CSR or CSC format. This may be called again with a
+new matrix, for example when A changes during a nonlinear iteration.
+*/
+
+int
+gsl_splinalg_precond_init(const gsl_spmatrix *A, gsl_splinalg_precond *P)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != P->n)
+    {
+      GSL_ERROR("matrix does not match preconditioner", GSL_EBADLEN);
+    }
+  else if (!GSL_SPMATRIX_ISCOO(A) && !GSL_SPMATRIX_ISCSR(A) &&
+           !GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR("matrix must be in COO, CSR or CSC format", GSL_EINVAL);
+    }
+  else
+    {
+      return P->type->init(A, P->state);
+    }
+}
+
+/*
+gsl_splinalg_precond_init64()
+  As gsl_splinalg_precond_init(), for a matrix with size_t indices.
+Only the Jacobi preconditioner supports these matrices.
+*/
+
+int
+gsl_splinalg_precond_init64(const gsl_spmatrix64 *A, gsl_splinalg_precond *P)
+{
+  if (A->size1 != A->size2)
+    {
+      GSL_ERROR("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (A->size1 != P->n)
+    {
+      GSL_ERROR("matrix does not match preconditioner", GSL_EBADLEN);
+    }
+  else if (P->type->init64 == NULL)
+    {
+      GSL_ERROR("preconditioner does not support size_t indices", GSL_EINVAL);
+    }
+  else
+    {
+      return P->type->init64(A, P->state);
+    }
+}
+
+/*
+gsl_splinalg_precond_apply()
+  Compute z = M^{-1} r. The vectors r and z may not be the same.
+*/
+
+int
+gsl_splinalg_precond_apply(const gsl_vector *r, gsl_vector *z,
+                           const gsl_splinalg_precond *P)
+{
+  if (r->size != P->n)
+    {
+      GSL_ERROR("r vector does not match preconditioner", GSL_EBADLEN);
+    }
+  else if (z->size != P->n)
+    {
+      GSL_ERROR("z vector does not match preconditioner", GSL_EBADLEN);
+    }
+  else
+    {
+      return P->type->apply(r, z, P->state);
+    }
+}
+
+/*
+splinalg_precond_csr()
+  Copy the square COO, CSR or CSC matrix A into the CSR matrix *L with
+the column indices of each row in increasing order, keeping only the
+lower triangle if lower is set. *L is (re)allocated if it is NULL or
+too small, so that repeated calls with the same pattern reuse it. On
+output *same is set if the pattern of *L is the same as on input.
+*/
+
+int
+splinalg_precond_csr(const gsl_spmatrix *A, const int lower,
+                     gsl_spmatrix **L, int *same)
+{
+  const size_t n = A->size1;
+  const size_t nz = A->nz;
+  int *colptr, *rowind, *pos;
+  double *val;
+  size_t k, j, nnz = 0;
+
+  *same = 0;
+
+  if (nz > INT_MAX)
+    {
+      GSL_ERROR("too many nonzero elements", GSL_EOVRFLW);
+    }
+
+  colptr = calloc(n + 1, sizeof(int));
+  rowind = malloc(GSL_MAX(nz, 1) * sizeof(int));
+  val = malloc(GSL_MAX(nz, 1) * sizeof(double));
+  pos = malloc((n + 1) * sizeof(int));
+  if (!colptr || !rowind || !val || !pos)
+    {
+      free(colptr);
+      free(rowind);
+      free(val);
+      free(pos);
+      GSL_ERROR("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  /* bucket the elements of A by column */
+#define SPLINALG_FOREACH(body)                                       \
+  do {                                                               \
+    size_t i_, c_, q_;                                               \
+    if (GSL_SPMATRIX_ISCOO(A))                                       \
+      {                                                              \
+        for (q_ = 0; q_ < nz; ++q_)                                  \
+          { i_ = A->i[q_]; c_ = A->p[q_]; body; }                    \
+      }                                                              \
+    else if (GSL_SPMATRIX_ISCSR(A))                                  \
+      {                                                              \
+        for (i_ = 0; i_ < n; ++i_)                                   \
+          for (q_ = A->p[i_]; q_ < (size_t) A->p[i_ + 1]; ++q_)      \
+            { c_ = A->i[q_]; body; }                                 \
+      }                                                              \
+    else                                                             \
+      {                                                              \
+        for (c_ = 0; c_ < n; ++c_)                                   \
+          for (q_ = A->p[c_]; q_ < (size_t) A->p[c_ + 1]; ++q_)      \
+            { i_ = A->i[q_]; body; }                                 \
+      }                                                              \
+  } while (0)
+
+  SPLINALG_FOREACH(if (!lower || c_ <= i_) { colptr[c_ + 1]++; ++nnz; });
+
+  for (j = 0; j < n; ++j)
+    colptr[j + 1] += colptr[j];
+
+  for (j = 0; j < n; ++j)
+    pos[j] = colptr[j];
+
+  SPLINALG_FOREACH(if (!lower || c_ <= i_)
+                     {
+                       rowind[pos[c_]] = (int) i_;
+                       val[pos[c_]++] = A->data[q_];
+                     });
+
+#undef SPLINALG_FOREACH
+
+  if (*L != NULL)
+    *same = ((*L)->nz == nnz);
+
+  if (*L != NULL && (*L)->nzmax < nnz)
+    {
+      gsl_spmatrix_free(*L);
+      *L = NULL;
+    }
+
+  if (*L == NULL)
+    {
+      *L = gsl_spmatrix_alloc_nzmax(n, n, GSL_MAX(nnz, 1), GSL_SPMATRIX_CSR);
+      if (*L == NULL)
+        {
+          free(colptr);
+          free(rowind);
+          free(val);
+          free(pos);
+          GSL_ERROR("failed to allocate factor matrix", GSL_ENOMEM);
+        }
+    }
+
+  /* scatter the columns in order into the rows, so that the column
+   * indices of each row come out sorted */
+  for (j = 0; j <= n; ++j)
+    pos[j] = 0;
+
+  for (k = 0; k < nnz; ++k)
+    pos[rowind[k] + 1]++;
+
+  for (j = 0; j < n; ++j)
+    pos[j + 1] += pos[j];
+
+  for (j = 0; j <= n; ++j)
+    {
+      *same = *same && ((*L)->p[j] == pos[j]);
+      (*L)->p[j] = pos[j];
+    }
+
+  for (j = 0; j < n; ++j)
+    {
+      for (k = colptr[j]; k < (size_t) colptr[j + 1]; ++k)
+        {
+          int q = pos[rowind[k]]++;
+          *same = *same && ((*L)->i[q] == (int) j);
+          (*L)->i[q] = (int) j;
+          (*L)->data[q] = val[k];
+        }
+    }
+
+  (*L)->nz = nnz;
+
+  free(colptr);
+  free(rowind);
+  free(val);
+  free(pos);
+
+  return GSL_SUCCESS;
+} /* splinalg_precond_csr() */
@@ -0,0 +1,28 @@
+/* splinalg/precond.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_SPLINALG_PRECOND_H__
+#define __GSL_SPLINALG_PRECOND_H__
+
+#include <gsl/gsl_spmatrix.h>
+
+int splinalg_precond_csr(const gsl_spmatrix *A, const int lower,
+                         gsl_spmatrix **L, int *same);
+
+#endif /* __GSL_SPLINALG_PRECOND_H__ */
@@ -0,0 +1,693 @@
+/* splinalg/spchol.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Sparse supernodal Cholesky factorization P A P^T = L L^T of a
+ * symmetric positive definite matrix in CSC format.
+ *
+ * gsl_splinalg_cholesky_alloc() performs the symbolic analysis, which
+ * depends only on the sparsity pattern of A:
+ *
+ * 1. a fill-reducing ordering of A (see amd.c and order.c), followed
+ *    by a postorder of the elimination tree of the permuted matrix,
+ *    which does not change the fill but numbers the columns of each
+ *    supernode consecutively;
+ * 2. the column counts of L, from the row subtrees of the elimination
+ *    tree;
+ * 3. the partition of the columns into supernodes: consecutive columns
+ *    j, j+1 with parent(j) = j+1 and |L_j| = |L_{j+1}| + 1, which have
+ *    the same pattern below the diagonal block;
+ * 4. the row indices of each supernode and the position in the factor
+ *    of each element of A.
+ *
+ * gsl_splinalg_cholesky_decomp() then computes the numerical factor by
+ * the left-looking supernodal algorithm of
+ *
+ * E. G. Ng and B. W. Peyton, Block sparse Cholesky algorithms on
+ * advanced uniprocessor computers, SIAM J. Sci. Comput. 14(5), 1993.
+ *
+ * Each supernode is stored as a dense nrows-by-ncols row-major block,
+ * whose first ncols rows are the diagonal block. The update of a
+ * supernode J by a descendant K is a single dgemm, followed by a scatter
+ * into J; the diagonal block is factored by gsl_linalg_cholesky_decomp1
+ * and the rows below it by dtrsm, so that almost all of the work is
+ * done by the Level 3 BLAS. The descendants which update J are kept in
+ * linked lists, as each factored supernode K moves on to the supernode
+ * containing its next row.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_permutation.h>
+#include <gsl/gsl_permute_vector.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+#include "order.h"
+
+#define CHOL_NONE ((size_t) -1)
+
+/*
+chol_upper()
+  Compute the pattern of the strict upper triangle of C = P A P^T in
+CSC format (Cp, Ci), from the strict lower triangle of A.
+*/
+
+static void
+chol_upper(const gsl_spmatrix *A, const int *pinv, int *Cp, int *Ci)
+{
+  const int n = (int) A->size1;
+  int j, p;
+
+  for (j = 0; j <= n; ++j)
+    Cp[j] = 0;
+
+  for (j = 0; j < n; ++j)
+    {
+      for (p = A->p[j]; p < A->p[j + 1]; ++p)
+        {
+          if (A->i[p] > j)
+            Cp[GSL_MAX(pinv[A->i[p]], pinv[j]) + 1]++;
+        }
+    }
+
+  for (j = 0; j < n; ++j)
+    Cp[j + 1] += Cp[j];
+
+  for (j = 0; j < n; ++j)
+    {
+      for (p = A->p[j]; p < A->p[j + 1]; ++p)
+        {
+          if (A->i[p] > j)
+            {
+              int r = pinv[A->i[p]];
+              int c = pinv[j];
+              int col = GSL_MAX(r, c);
+
+              Ci[Cp[col]++] = GSL_MIN(r, c);
+            }
+        }
+    }
+
+  /* restore column pointers */
+  for (j = n; j > 0; --j)
+    Cp[j] = Cp[j - 1];
+
+  Cp[0] = 0;
+}
+
+/* elimination tree of the matrix whose upper triangle is (Cp, Ci) */
+static void
+chol_etree(const int n, const int *Cp, const int *Ci, int *parent, int *anc)
+{
+  int k, p;
+
+  for (k = 0; k < n; ++k)
+    {
+      parent[k] = -1;
+      anc[k] = -1;
+
+      for (p = Cp[k]; p < Cp[k + 1]; ++p)
+        {
+          int i = Ci[p];
+
+          /* follow the path from i to the root of its subtree,
+           * compressing it to point to k */
+          while (i != -1 && i < k)
+            {
+              int inext = anc[i];
+
+              anc[i] = k;
+              if (inext == -1)
+                parent[i] = k;
+
+              i = inext;
+            }
+        }
+    }
+}
+
+/* postorder of the forest given by parent, by depth first search */
+static void
+chol_postorder(const int n, const int *parent, int *post, int *head,
+               int *next, int *stack)
+{
+  int j, k = 0;
+
+  for (j = 0; j < n; ++j)
+    head[j] = -1;
+
+  /* children lists, in increasing order */
+  for (j = n - 1; j >= 0; --j)
+    {
+      if (parent[j] != -1)
+        {
+          next[j] = head[parent[j]];
+          head[parent[j]] = j;
+        }
+    }
+
+  for (j = 0; j < n; ++j)
+    {
+      int top = 0;
+
+      if (parent[j] != -1)
+        continue;
+
+      stack[0] = j;
+
+      while (top >= 0)
+        {
+          int p = stack[top];
+          int i = head[p];
+
+          if (i == -1)
+            {
+              --top;
+              post[k++] = p;
+            }
+          else
+            {
+              head[p] = next[i];
+              stack[++top] = i;
+            }
+        }
+    }
+}
+
+gsl_splinalg_cholesky_workspace *
+gsl_splinalg_cholesky_alloc(const gsl_spmatrix *A,
+                            const gsl_splinalg_order_t order)
+{
+  const size_t n = A->size1;
+  gsl_splinalg_cholesky_workspace *w;
+  int *pinv, *Cp, *Ci, *parent, *iwork, *count, *post;
+  size_t j, J, max_rows = 0, max_cols = 0;
+  int status = GSL_SUCCESS;
+
+  if (!GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR_NULL("matrix must be in CSC format", GSL_EINVAL);
+    }
+  else if (A->size1 != A->size2)
+    {
+      GSL_ERROR_NULL("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+  else if (n >= INT_MAX || A->nz >= INT_MAX)
+    {
+      GSL_ERROR_NULL("matrix too large", GSL_EOVRFLW);
+    }
+
+  w = calloc(1, sizeof(gsl_splinalg_cholesky_workspace));
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->n = n;
+  w->nz = A->nz;
+
+  w->perm = gsl_permutation_alloc(n);
+  w->col2super = malloc(n * sizeof(int));
+  w->map = malloc(n * sizeof(int));
+  w->amap = malloc(GSL_MAX(A->nz, 1) * sizeof(size_t));
+
+  pinv = malloc(n * sizeof(int));
+  Cp = malloc((n + 1) * sizeof(int));
+  Ci = malloc(GSL_MAX(A->nz, 1) * sizeof(int));
+  parent = malloc(n * sizeof(int));
+  iwork = malloc(3 * n * sizeof(int));
+  count = malloc(n * sizeof(int));
+  post = malloc(n * sizeof(int));
+
+  if (!w->perm || !w->col2super || !w->map || !w->amap || !pinv || !Cp ||
+      !Ci || !parent || !iwork || !count || !post)
+    {
+      status = GSL_ENOMEM;
+      goto cleanup;
+    }
+
+  /* fill-reducing ordering */
+  status = splinalg_order(A, order, w->perm->data);
+  if (status)
+    goto cleanup;
+
+  /* postorder the elimination tree and compose it with the ordering */
+  for (j = 0; j < n; ++j)
+    pinv[w->perm->data[j]] = (int) j;
+
+  chol_upper(A, pinv, Cp, Ci);
+  chol_etree((int) n, Cp, Ci, parent, iwork);
+  chol_postorder((int) n, parent, post, iwork, iwork + n, iwork + 2 * n);
+
+  for (j = 0; j < n; ++j)
+    pinv[w->perm->data[post[j]]] = (int) j;
+
+  for (j = 0; j < n; ++j)
+    w->perm->data[pinv[j]] = j;
+
+  chol_upper(A, pinv, Cp, Ci);
+  chol_etree((int) n, Cp, Ci, parent, iwork);
+
+  /* column counts of L (including the diagonal) from the row subtrees:
+   * row i of L has a nonzero in each column on the paths from the
+   * nonzeros of row i of C to i */
+  {
+    int *mark = iwork;
+    int i, p;
+
+    for (i = 0; i < (int) n; ++i)
+      {
+        count[i] = 1;
+        mark[i] = i;
+
+        for (p = Cp[i]; p < Cp[i + 1]; ++p)
+          {
+            int k = Ci[p];
+
+            while (mark[k] != i)
+              {
+                count[k]++;
+                mark[k] = i;
+                k = parent[k];
+              }
+          }
+      }
+  }
+
+  /* supernodes */
+  w->nsuper = 0;
+  for (j = 0; j < n; ++j)
+    {
+      if (j == 0 || parent[j - 1] != (int) j || count[j - 1] != count[j] + 1)
+        w->nsuper++;
+
+      w->col2super[j] = (int) w->nsuper - 1;
+    }
+
+  w->super = malloc((w->nsuper + 1) * sizeof(size_t));
+  w->rowptr = malloc((w->nsuper + 1) * sizeof(size_t));
+  w->Lptr = malloc((w->nsuper + 1) * sizeof(size_t));
+  w->head = malloc(w->nsuper * sizeof(int));
+  w->link = malloc(w->nsuper * sizeof(int));
+  w->pos = malloc(w->nsuper * sizeof(size_t));
+  if (!w->super || !w->rowptr || !w->Lptr || !w->head || !w->link || !w->pos)
+    {
+      status = GSL_ENOMEM;
+      goto cleanup;
+    }
+
+  w->rowptr[0] = 0;
+  w->Lptr[0] = 0;
+  w->nnzL = 0;
+
+  for (j = 0; j < n; ++j)
+    {
+      J = w->col2super[j];
+
+      if (j == 0 || w->col2super[j - 1] != (int) J)
+        {
+          w->super[J] = j;
+          w->rowptr[J + 1] = w->rowptr[J] + count[j];
+        }
+    }
+
+  w->super[w->nsuper] = n;
+
+  for (J = 0; J < w->nsuper; ++J)
+    {
+      size_t ncols = w->super[J + 1] - w->super[J];
+      size_t nrows = w->rowptr[J + 1] - w->rowptr[J];
+
+      w->Lptr[J + 1] = w->Lptr[J] + nrows * ncols;
+      w->nnzL += nrows * ncols - ncols * (ncols - 1) / 2;
+      max_rows = GSL_MAX(max_rows, nrows);
+      max_cols = GSL_MAX(max_cols, ncols);
+    }
+
+  w->rows = malloc(GSL_MAX(w->rowptr[w->nsuper], 1) * sizeof(int));
+  w->Lx = malloc(GSL_MAX(w->Lptr[w->nsuper], 1) * sizeof(double));
+  w->work = malloc(GSL_MAX(max_rows * max_cols, 1) * sizeof(double));
+  if (!w->rows || !w->Lx || !w->work)
+    {
+      status = GSL_ENOMEM;
+      goto cleanup;
+    }
+
+  /* row indices of the first column of each supernode, in increasing
+   * order: the diagonal when row i is reached, then row i for each
+   * column on the row subtree of i */
+  {
+    int *mark = iwork;
+    size_t *fill = w->pos; /* next free position of each supernode */
+    int i, p;
+
+    for (J = 0; J < w->nsuper; ++J)
+      fill[J] = w->rowptr[J];
+
+    for (i = 0; i < (int) n; ++i)
+      {
+        mark[i] = i;
+
+        if (w->super[w->col2super[i]] == (size_t) i)
+          w->rows[fill[w->col2super[i]]++] = i;
+
+        for (p = Cp[i]; p < Cp[i + 1]; ++p)
+          {
+            int k = Ci[p];
+
+            while (mark[k] != i)
+              {
+                if (w->super[w->col2super[k]] == (size_t) k)
+                  w->rows[fill[w->col2super[k]]++] = i;
+
+                mark[k] = i;
+                k = parent[k];
+              }
+          }
+      }
+  }
+
+  /* position of each element of the lower triangle of A in Lx */
+  for (j = 0; j < n; ++j)
+    {
+      int p;
+
+      for (p = A->p[j]; p < A->p[j + 1]; ++p)
+        {
+          int r, c;
+          const int *rJ, *lo, *hi;
+
+          if (A->i[p] < (int) j)
+            {
+              w->amap[p] = CHOL_NONE;
+              continue;
+            }
+
+          r = GSL_MAX(pinv[A->i[p]], pinv[j]);
+          c = GSL_MIN(pinv[A->i[p]], pinv[j]);
+          J = w->col2super[c];
+          rJ = w->rows + w->rowptr[J];
+
+          /* binary search for row r */
+          lo = rJ;
+          hi = w->rows + w->rowptr[J + 1];
+          while (hi - lo > 1)
+            {
+              const int *mid = lo + (hi - lo) / 2;
+
+              if (*mid <= r)
+                lo = mid;
+              else
+                hi = mid;
+            }
+
+          w->amap[p] = w->Lptr[J] +
+                       (lo - rJ) * (w->super[J + 1] - w->super[J]) +
+                       (c - w->super[J]);
+        }
+    }
+
+cleanup:
+  free(pinv);
+  free(Cp);
+  free(Ci);
+  free(parent);
+  free(iwork);
+  free(count);
+  free(post);
+
+  if (status)
+    {
+      gsl_splinalg_cholesky_free(w);
+      GSL_ERROR_NULL("failed to allocate space for symbolic factorization",
+                     status);
+    }
+
+  return w;
+} /* gsl_splinalg_cholesky_alloc() */
+
+void
+gsl_splinalg_cholesky_free(gsl_splinalg_cholesky_workspace *w)
+{
+  RETURN_IF_NULL(w);
+
+  if (w->perm)
+    gsl_permutation_free(w->perm);
+
+  free(w->super);
+  free(w->rowptr);
+  free(w->rows);
+  free(w->Lptr);
+  free(w->Lx);
+  free(w->col2super);
+  free(w->amap);
+  free(w->map);
+  free(w->head);
+  free(w->link);
+  free(w->pos);
+  free(w->work);
+  free(w);
+}
+
+/*
+gsl_splinalg_cholesky_decomp()
+  Compute the numerical factorization P A P^T = L L^T. A must have the
+same sparsity pattern, stored in the same order, as the matrix given to
+gsl_splinalg_cholesky_alloc(); only its lower triangle is referenced.
+*/
+
+int
+gsl_splinalg_cholesky_decomp(const gsl_spmatrix *A,
+                             gsl_splinalg_cholesky_workspace *w)
+{
+  if (!GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR("matrix must be in CSC format", GSL_EINVAL);
+    }
+  else if (A->size1 != w->n || A->size2 != w->n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else if (A->nz != w->nz)
+    {
+      GSL_ERROR("matrix pattern does not match workspace", GSL_EINVAL);
+    }
+  else
+    {
+      double *Lx = w->Lx;
+      size_t J, k;
+      int status;
+
+      /* scatter A into L */
+      memset(Lx, 0, w->Lptr[w->nsuper] * sizeof(double));
+
+      for (k = 0; k < w->nz; ++k)
+        {
+          if (w->amap[k] != CHOL_NONE)
+            Lx[w->amap[k]] += A->data[k];
+        }
+
+      for (J = 0; J < w->nsuper; ++J)
+        w->head[J] = -1;
+
+      for (J = 0; J < w->nsuper; ++J)
+        {
+          const size_t f = w->super[J];
+          const size_t ncols = w->super[J + 1] - f;
+          const size_t nrows = w->rowptr[J + 1] - w->rowptr[J];
+          const int *rJ = w->rows + w->rowptr[J];
+          double *LJ = Lx + w->Lptr[J];
+          gsl_matrix_view L11 = gsl_matrix_view_array(LJ, ncols, ncols);
+          int K = w->head[J];
+          size_t t;
+
+          for (t = 0; t < nrows; ++t)
+            w->map[rJ[t]] = (int) t;
+
+          /* updates from the descendants K of J */
+          while (K >= 0)
+            {
+              const int Knext = w->link[K];
+              const size_t nK = w->super[K + 1] - w->super[K];
+              const size_t nrK = w->rowptr[K + 1] - w->rowptr[K];
+              const int *rK = w->rows + w->rowptr[K];
+              const double *LK = Lx + w->Lptr[K];
+              const size_t p0 = w->pos[K];
+              const size_t m2 = nrK - p0;
+              size_t m1 = 0, a, b;
+
+              while (p0 + m1 < nrK && (size_t) rK[p0 + m1] < f + ncols)
+                ++m1;
+
+              {
+                gsl_matrix_const_view A2 =
+                  gsl_matrix_const_view_array(LK + p0 * nK, m2, nK);
+                gsl_matrix_const_view A1 =
+                  gsl_matrix_const_view_array(LK + p0 * nK, m1, nK);
+                gsl_matrix_view W = gsl_matrix_view_array(w->work, m2, m1);
+
+                gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, &A2.matrix,
+                               &A1.matrix, 0.0, &W.matrix);
+              }
+
+              for (a = 0; a < m2; ++a)
+                {
+                  double *row = LJ + w->map[rK[p0 + a]] * ncols;
+                  const double *wa = w->work + a * m1;
+
+                  for (b = 0; b < m1; ++b)
+                    row[rK[p0 + b] - f] -= wa[b];
+                }
+
+              /* move K on to the supernode of its next row */
+              w->pos[K] += m1;
+              if (w->pos[K] < nrK)
+                {
+                  int T = w->col2super[rK[w->pos[K]]];
+
+                  w->link[K] = w->head[T];
+                  w->head[T] = K;
+                }
+
+              K = Knext;
+            }
+
+          /* factor the diagonal block and solve for the rows below it */
+          status = gsl_linalg_cholesky_decomp1(&L11.matrix);
+          if (status)
+            return status;
+
+          if (nrows > ncols)
+            {
+              gsl_matrix_view L21 =
+                gsl_matrix_view_array(LJ + ncols * ncols, nrows - ncols, ncols);
+              int T = w->col2super[rJ[ncols]];
+
+              gsl_blas_dtrsm(CblasRight, CblasLower, CblasTrans, CblasNonUnit,
+                             1.0, &L11.matrix, &L21.matrix);
+
+              w->pos[J] = ncols;
+              w->link[J] = w->head[T];
+              w->head[T] = (int) J;
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_splinalg_cholesky_decomp() */
+
+/*
+gsl_splinalg_cholesky_solve()
+  Solve A x = b using the factorization computed by
+gsl_splinalg_cholesky_decomp(). b and x may be the same vector.
+*/
+
+int
+gsl_splinalg_cholesky_solve(const gsl_splinalg_cholesky_workspace *w,
+                            const gsl_vector *b, gsl_vector *x)
+{
+  if (b->size != w->n)
+    {
+      GSL_ERROR("matrix size must match b size", GSL_EBADLEN);
+    }
+  else if (x->size != w->n)
+    {
+      GSL_ERROR("matrix size must match solution size", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t stride = x->stride;
+      double *xd = x->data;
+      size_t J, t, c;
+
+      if (x != b)
+        gsl_vector_memcpy(x, b);
+
+      gsl_permute_vector(w->perm, x);
+
+      /* L y = P b */
+      for (J = 0; J < w->nsuper; ++J)
+        {
+          const size_t f = w->super[J];
+          const size_t ncols = w->super[J + 1] - f;
+          const size_t nrows = w->rowptr[J + 1] - w->rowptr[J];
+          const int *rJ = w->rows + w->rowptr[J];
+          const double *LJ = w->Lx + w->Lptr[J];
+          gsl_matrix_const_view L11 = gsl_matrix_const_view_array(LJ, ncols, ncols);
+          gsl_vector_view x1 = gsl_vector_subvector(x, f, ncols);
+
+          gsl_blas_dtrsv(CblasLower, CblasNoTrans, CblasNonUnit,
+                         &L11.matrix, &x1.vector);
+
+          for (t = ncols; t < nrows; ++t)
+            {
+              const double *Lt = LJ + t * ncols;
+              double sum = 0.0;
+
+              for (c = 0; c < ncols; ++c)
+                sum += Lt[c] * xd[(f + c) * stride];
+
+              xd[rJ[t] * stride] -= sum;
+            }
+        }
+
+      /* L^T z = y */
+      for (J = w->nsuper; J-- > 0; )
+        {
+          const size_t f = w->super[J];
+          const size_t ncols = w->super[J + 1] - f;
+          const size_t nrows = w->rowptr[J + 1] - w->rowptr[J];
+          const int *rJ = w->rows + w->rowptr[J];
+          const double *LJ = w->Lx + w->Lptr[J];
+          gsl_matrix_const_view L11 = gsl_matrix_const_view_array(LJ, ncols, ncols);
+          gsl_vector_view x1 = gsl_vector_subvector(x, f, ncols);
+
+          for (t = ncols; t < nrows; ++t)
+            {
+              const double *Lt = LJ + t * ncols;
+              const double xt = xd[rJ[t] * stride];
+
+              for (c = 0; c < ncols; ++c)
+                xd[(f + c) * stride] -= Lt[c] * xt;
+            }
+
+          gsl_blas_dtrsv(CblasLower, CblasTrans, CblasNonUnit,
+                         &L11.matrix, &x1.vector);
+        }
+
+      /* x = P^T z */
+      gsl_permute_vector_inverse(w->perm, x);
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_splinalg_cholesky_solve() */
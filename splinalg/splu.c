@@ -0,0 +1,436 @@
+/* splinalg/splu.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Sparse LU factorization P A Q = L U with partial pivoting, by the
+ * left-looking algorithm of
+ *
+ * J. R. Gilbert and T. Peierls, Sparse partial pivoting in time
+ * proportional to arithmetic operations, SIAM J. Sci. Stat. Comput.
+ * 9(5), 1988.
+ *
+ * as in T. A. Davis, Direct methods for sparse linear systems, SIAM,
+ * 2006. Column k of L and U is computed by the sparse triangular solve
+ * L x = A(:,q[k]), whose nonzero pattern is found by a depth first
+ * search in the graph of the columns of L already computed. The column
+ * ordering Q is computed once by gsl_splinalg_LU_alloc(); the row
+ * ordering P is chosen during each numerical factorization, preferring
+ * the diagonal element A(q[k],q[k]) if it is at least LU_PIVOT_TOL times
+ * the largest candidate, which keeps the sparsity of a symmetric
+ * ordering for matrices with a strong diagonal.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_permutation.h>
+#include <gsl/gsl_permute_vector.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+#include "order.h"
+
+#define LU_PIVOT_TOL 0.1
+
+static int lu_grow(int **Li, double **Lx, size_t *nzmax, const size_t nz);
+
+gsl_splinalg_LU_workspace *
+gsl_splinalg_LU_alloc(const gsl_spmatrix *A, const gsl_splinalg_order_t order)
+{
+  const size_t n = A->size1;
+  gsl_splinalg_LU_workspace *w;
+
+  if (!GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR_NULL("matrix must be in CSC format", GSL_EINVAL);
+    }
+  else if (A->size1 != A->size2)
+    {
+      GSL_ERROR_NULL("matrix must be square", GSL_ENOTSQR);
+    }
+  else if (n == 0)
+    {
+      GSL_ERROR_NULL("matrix dimension n must be a positive integer",
+                     GSL_EINVAL);
+    }
+  else if (n >= INT_MAX || A->nz >= INT_MAX)
+    {
+      GSL_ERROR_NULL("matrix too large", GSL_EOVRFLW);
+    }
+
+  w = calloc(1, sizeof(gsl_splinalg_LU_workspace));
+  if (w == NULL)
+    {
+      GSL_ERROR_NULL("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->n = n;
+
+  /* initial guess for the size of the factors */
+  w->Lnzmax = 4 * A->nz + n;
+  w->Unzmax = 4 * A->nz + n;
+
+  w->p = gsl_permutation_alloc(n);
+  w->q = gsl_permutation_alloc(n);
+  w->Lp = malloc((n + 1) * sizeof(int));
+  w->Li = malloc(w->Lnzmax * sizeof(int));
+  w->Lx = malloc(w->Lnzmax * sizeof(double));
+  w->Up = malloc((n + 1) * sizeof(int));
+  w->Ui = malloc(w->Unzmax * sizeof(int));
+  w->Ux = malloc(w->Unzmax * sizeof(double));
+  w->pinv = malloc(n * sizeof(int));
+  w->mark = calloc(n, sizeof(int));
+  w->xi = malloc(3 * n * sizeof(int));
+  w->x = calloc(n, sizeof(double));
+
+  if (!w->p || !w->q || !w->Lp || !w->Li || !w->Lx || !w->Up || !w->Ui ||
+      !w->Ux || !w->pinv || !w->mark || !w->xi || !w->x)
+    {
+      gsl_splinalg_LU_free(w);
+      GSL_ERROR_NULL("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  {
+    int status = splinalg_order(A, order, w->q->data);
+
+    if (status)
+      {
+        gsl_splinalg_LU_free(w);
+        GSL_ERROR_NULL("failed to compute ordering", status);
+      }
+  }
+
+  return w;
+} /* gsl_splinalg_LU_alloc() */
+
+void
+gsl_splinalg_LU_free(gsl_splinalg_LU_workspace *w)
+{
+  RETURN_IF_NULL(w);
+
+  if (w->p)
+    gsl_permutation_free(w->p);
+
+  if (w->q)
+    gsl_permutation_free(w->q);
+
+  free(w->Lp);
+  free(w->Li);
+  free(w->Lx);
+  free(w->Up);
+  free(w->Ui);
+  free(w->Ux);
+  free(w->pinv);
+  free(w->mark);
+  free(w->xi);
+  free(w->x);
+  free(w);
+}
+
+/*
+lu_dfs()
+  Depth first search from row j in the graph of L, where the neighbors
+of a pivotal row i are the rows of column pinv[i] of L. The rows
+reached are stored in xi[top-1], xi[top-2], ... in reverse order of
+finishing, which is a topological order for the triangular solve.
+
+Return: new top
+*/
+
+static int
+lu_dfs(int j, int top, const int stamp, gsl_splinalg_LU_workspace *w)
+{
+  int *stack = w->xi + w->n;
+  int *pstack = w->xi + 2 * w->n;
+  int head = 0;
+
+  stack[0] = j;
+
+  while (head >= 0)
+    {
+      int jnew, p, p2, done = 1;
+
+      j = stack[head];
+      jnew = w->pinv[j];
+
+      if (w->mark[j] != stamp)
+        {
+          w->mark[j] = stamp;
+          pstack[head] = (jnew < 0) ? 0 : w->Lp[jnew] + 1;
+        }
+
+      p2 = (jnew < 0) ? 0 : w->Lp[jnew + 1];
+
+      for (p = pstack[head]; p < p2; ++p)
+        {
+          int i = w->Li[p];
+
+          if (w->mark[i] == stamp)
+            continue;
+
+          pstack[head] = p + 1;
+          stack[++head] = i;
+          done = 0;
+          break;
+        }
+
+      if (done)
+        {
+          --head;
+          w->xi[--top] = j;
+        }
+    }
+
+  return top;
+}
+
+/*
+gsl_splinalg_LU_decomp()
+  Compute the numerical factorization P A Q = L U, where Q is the
+ordering computed by gsl_splinalg_LU_alloc(). A may have a different
+sparsity pattern than the matrix given to gsl_splinalg_LU_alloc(), but
+the ordering is only useful if the patterns are similar.
+*/
+
+int
+gsl_splinalg_LU_decomp(const gsl_spmatrix *A, gsl_splinalg_LU_workspace *w)
+{
+  if (!GSL_SPMATRIX_ISCSC(A))
+    {
+      GSL_ERROR("matrix must be in CSC format", GSL_EINVAL);
+    }
+  else if (A->size1 != w->n || A->size2 != w->n)
+    {
+      GSL_ERROR("matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const int n = (int) w->n;
+      double *x = w->x;
+      size_t lnz = 0, unz = 0;
+      int i, k, p;
+
+      for (i = 0; i < n; ++i)
+        {
+          w->pinv[i] = -1;
+          w->mark[i] = 0;
+        }
+
+      for (k = 0; k < n; ++k)
+        {
+          const int col = (int) w->q->data[k];
+          const int stamp = k + 1;
+          int top = n, ipiv = -1;
+          double a = -1.0, pivot;
+
+          if (lnz + n > INT_MAX || unz + n > INT_MAX)
+            {
+              GSL_ERROR("too many nonzero elements in factors", GSL_EOVRFLW);
+            }
+
+          /* room for a full column of L and U */
+          if (lnz + n > w->Lnzmax &&
+              lu_grow(&w->Li, &w->Lx, &w->Lnzmax, lnz + n))
+            {
+              GSL_ERROR("failed to allocate space for L", GSL_ENOMEM);
+            }
+
+          if (unz + n > w->Unzmax &&
+              lu_grow(&w->Ui, &w->Ux, &w->Unzmax, unz + n))
+            {
+              GSL_ERROR("failed to allocate space for U", GSL_ENOMEM);
+            }
+
+          w->Lp[k] = (int) lnz;
+          w->Up[k] = (int) unz;
+
+          /* pattern of x = L \ A(:,col) */
+          for (p = A->p[col]; p < A->p[col + 1]; ++p)
+            {
+              if (w->mark[A->i[p]] != stamp)
+                top = lu_dfs(A->i[p], top, stamp, w);
+            }
+
+          /* numerical values */
+          for (p = A->p[col]; p < A->p[col + 1]; ++p)
+            x[A->i[p]] = A->data[p];
+
+          for (p = top; p < n; ++p)
+            {
+              const int j = w->xi[p];
+              const int J = w->pinv[j];
+              int q;
+
+              if (J < 0)
+                continue;
+
+              for (q = w->Lp[J] + 1; q < w->Lp[J + 1]; ++q)
+                x[w->Li[q]] -= w->Lx[q] * x[j];
+            }
+
+          /* U(:,k) from the pivotal rows, pivot from the others */
+          for (p = top; p < n; ++p)
+            {
+              const int r = w->xi[p];
+
+              if (w->pinv[r] < 0)
+                {
+                  if (fabs(x[r]) > a)
+                    {
+                      a = fabs(x[r]);
+                      ipiv = r;
+                    }
+                }
+              else
+                {
+                  w->Ui[unz] = w->pinv[r];
+                  w->Ux[unz++] = x[r];
+                }
+            }
+
+          if (ipiv < 0 || a <= 0.0)
+            {
+              for (p = top; p < n; ++p)
+                x[w->xi[p]] = 0.0;
+
+              GSL_ERROR("matrix is singular", GSL_EDOM);
+            }
+
+          if (w->pinv[col] < 0 && w->mark[col] == stamp &&
+              fabs(x[col]) >= LU_PIVOT_TOL * a)
+            ipiv = col;
+
+          pivot = x[ipiv];
+          w->Ui[unz] = k;
+          w->Ux[unz++] = pivot;
+          w->pinv[ipiv] = k;
+          w->Li[lnz] = ipiv;
+          w->Lx[lnz++] = 1.0;
+
+          for (p = top; p < n; ++p)
+            {
+              const int r = w->xi[p];
+
+              if (w->pinv[r] < 0)
+                {
+                  w->Li[lnz] = r;
+                  w->Lx[lnz++] = x[r] / pivot;
+                }
+
+              x[r] = 0.0;
+            }
+        }
+
+      w->Lp[n] = (int) lnz;
+      w->Up[n] = (int) unz;
+
+      /* row indices of L in pivot order */
+      for (p = 0; p < (int) lnz; ++p)
+        w->Li[p] = w->pinv[w->Li[p]];
+
+      for (i = 0; i < n; ++i)
+        w->p->data[w->pinv[i]] = i;
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_splinalg_LU_decomp() */
+
+/*
+gsl_splinalg_LU_solve()
+  Solve A x = b using the factorization computed by
+gsl_splinalg_LU_decomp(). b and x may be the same vector.
+*/
+
+int
+gsl_splinalg_LU_solve(const gsl_splinalg_LU_workspace *w,
+                      const gsl_vector *b, gsl_vector *x)
+{
+  if (b->size != w->n)
+    {
+      GSL_ERROR("matrix size must match b size", GSL_EBADLEN);
+    }
+  else if (x->size != w->n)
+    {
+      GSL_ERROR("matrix size must match solution size", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t n = w->n;
+      const size_t stride = x->stride;
+      double *xd = x->data;
+      size_t j;
+      int p;
+
+      if (x != b)
+        gsl_vector_memcpy(x, b);
+
+      /* y = P b */
+      gsl_permute_vector(w->p, x);
+
+      /* L z = y */
+      for (j = 0; j < n; ++j)
+        {
+          const double xj = xd[j * stride];
+
+          for (p = w->Lp[j] + 1; p < w->Lp[j + 1]; ++p)
+            xd[w->Li[p] * stride] -= w->Lx[p] * xj;
+        }
+
+      /* U u = z */
+      for (j = n; j-- > 0; )
+        {
+          double xj = xd[j * stride] / w->Ux[w->Up[j + 1] - 1];
+
+          xd[j * stride] = xj;
+
+          for (p = w->Up[j]; p < w->Up[j + 1] - 1; ++p)
+            xd[w->Ui[p] * stride] -= w->Ux[p] * xj;
+        }
+
+      /* x = Q u */
+      gsl_permute_vector_inverse(w->q, x);
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_splinalg_LU_solve() */
+
+static int
+lu_grow(int **Li, double **Lx, size_t *nzmax, const size_t nz)
+{
+  size_t nzmax_new = GSL_MAX(2 * *nzmax, nz);
+  int *i = realloc(*Li, nzmax_new * sizeof(int));
+  double *x;
+
+  if (i == NULL)
+    return GSL_ENOMEM;
+
+  *Li = i;
+
+  x = realloc(*Lx, nzmax_new * sizeof(double));
+  if (x == NULL)
+    return GSL_ENOMEM;
+
+  *Lx = x;
+  *nzmax = nzmax_new;
+
+  return GSL_SUCCESS;
+}
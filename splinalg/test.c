@@ -29,6 +29,8 @@
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_blas.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_permutation.h>
 #include <gsl/gsl_spmatrix.h>
 #include <gsl/gsl_spblas.h>
 #include <gsl/gsl_splinalg.h>
@@ -337,6 +339,683 @@ test_random(const size_t N, const gsl_rng *r, const int compress)
     gsl_spmatrix_free(B);
 } /* test_random() */
 
+/* 2D convection-diffusion operator -Laplacian(u) + c*du/dx on an n-by-n
+ * grid with upwind differences, plus shift*I; symmetric for c = 0 and
+ * positive definite for c = 0, shift >= 0 */
+static gsl_spmatrix *
+create_convdiff(const size_t n, const double c, const double shift)
+{
+  const size_t N = n * n;
+  gsl_spmatrix *A = gsl_spmatrix_alloc_nzmax(N, N, 5 * N, GSL_SPMATRIX_COO);
+  size_t i, j;
+
+  for (i = 0; i < n; ++i)
+    {
+      for (j = 0; j < n; ++j)
+        {
+          size_t k = i * n + j;
+
+          gsl_spmatrix_set(A, k, k, 4.0 + c + shift);
+
+          if (j > 0)
+            gsl_spmatrix_set(A, k, k - 1, -1.0 - c);
+          if (j + 1 < n)
+            gsl_spmatrix_set(A, k, k + 1, -1.0);
+          if (i > 0)
+            gsl_spmatrix_set(A, k, k - n, -1.0);
+          if (i + 1 < n)
+            gsl_spmatrix_set(A, k, k + n, -1.0);
+        }
+    }
+
+  return A;
+}
+
+/* solve A x = b with solver T and preconditioner PT (or none) */
+static void
+test_precond_solve(const gsl_splinalg_itersolve_type *T,
+                   const gsl_splinalg_precond_type *PT,
+                   const gsl_spmatrix *A, const double tol,
+                   const char *desc, const gsl_rng *r)
+{
+  const size_t N = A->size1;
+  const size_t max_iter = 100;
+  /* restarted GMRES needs a larger Krylov subspace than the default */
+  const size_t m = (T == gsl_splinalg_itersolve_gmres) ? 50 : 0;
+  gsl_splinalg_itersolve *w = gsl_splinalg_itersolve_alloc(T, N, m);
+  gsl_splinalg_precond *P = NULL;
+  gsl_vector *b = gsl_vector_alloc(N);
+  gsl_vector *x = gsl_vector_calloc(N);
+  gsl_vector *res = gsl_vector_alloc(N);
+  const char *pname = "none";
+  size_t iter = 0;
+  double normr, normb;
+  int status;
+
+  create_random_vector(b, r);
+
+  if (PT != NULL)
+    {
+      P = gsl_splinalg_precond_alloc(PT, N);
+      pname = gsl_splinalg_precond_name(P);
+
+      status = gsl_splinalg_precond_init(A, P);
+      gsl_test(status, "%s/%s %s precond init N=%zu", T->name, pname, desc, N);
+
+      gsl_splinalg_itersolve_set_precond(w, P);
+    }
+
+  do
+    {
+      status = gsl_splinalg_itersolve_iterate(A, b, tol, x, w);
+    }
+  while (status == GSL_CONTINUE && ++iter < max_iter);
+
+  gsl_test(status, "%s/%s %s status s=%d N=%zu", T->name, pname, desc,
+           status, N);
+
+  gsl_vector_memcpy(res, b);
+  gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, res);
+
+  normr = gsl_blas_dnrm2(res);
+  normb = gsl_blas_dnrm2(b);
+
+  gsl_test(normr > tol * normb,
+           "%s/%s %s residual N=%zu normr=%.12e normb=%.12e",
+           T->name, pname, desc, N, normr, normb);
+
+  gsl_test_rel(gsl_splinalg_itersolve_normr(w), normr, 1.0e-8,
+               "%s/%s %s normr N=%zu", T->name, pname, desc, N);
+
+  gsl_splinalg_itersolve_free(w);
+  gsl_splinalg_precond_free(P);
+  gsl_vector_free(b);
+  gsl_vector_free(x);
+  gsl_vector_free(res);
+}
+
+static void
+test_solvers(const size_t n, const gsl_rng *r)
+{
+  const gsl_splinalg_itersolve_type *T_spd[] =
+    { gsl_splinalg_itersolve_cg, gsl_splinalg_itersolve_minres,
+      gsl_splinalg_itersolve_bicgstab, gsl_splinalg_itersolve_gmres };
+  const gsl_splinalg_itersolve_type *T_gen[] =
+    { gsl_splinalg_itersolve_bicgstab, gsl_splinalg_itersolve_gmres };
+  const gsl_splinalg_precond_type *P_spd[] =
+    { NULL, gsl_splinalg_precond_jacobi, gsl_splinalg_precond_ic0,
+      gsl_splinalg_precond_ilu0 };
+  const gsl_splinalg_precond_type *P_gen[] =
+    { NULL, gsl_splinalg_precond_jacobi, gsl_splinalg_precond_ilu0 };
+  gsl_spmatrix *S = create_convdiff(n, 0.0, 0.0);  /* SPD */
+  gsl_spmatrix *G = create_convdiff(n, 2.0, 0.0);  /* nonsymmetric */
+  gsl_spmatrix *I = create_convdiff(n, 0.0, -1.0); /* symmetric indefinite */
+  gsl_spmatrix *Scsr = gsl_spmatrix_compress(S, GSL_SPMATRIX_CSR);
+  gsl_spmatrix *Gcsc = gsl_spmatrix_compress(G, GSL_SPMATRIX_CSC);
+  size_t i, j;
+
+  for (i = 0; i < 4; ++i)
+    {
+      for (j = 0; j < 4; ++j)
+        {
+          /* CG and MINRES need a symmetric preconditioner */
+          if (i < 2 && j == 3)
+            continue;
+
+          test_precond_solve(T_spd[i], P_spd[j], S, 1.0e-10, "spd coo", r);
+          test_precond_solve(T_spd[i], P_spd[j], Scsr, 1.0e-10, "spd csr", r);
+        }
+    }
+
+  for (i = 0; i < 2; ++i)
+    {
+      for (j = 0; j < 3; ++j)
+        {
+          test_precond_solve(T_gen[i], P_gen[j], G, 1.0e-10, "nonsym coo", r);
+          test_precond_solve(T_gen[i], P_gen[j], Gcsc, 1.0e-10, "nonsym csc", r);
+        }
+    }
+
+  test_precond_solve(gsl_splinalg_itersolve_minres, NULL, I, 1.0e-10,
+                     "indefinite", r);
+
+  gsl_spmatrix_free(S);
+  gsl_spmatrix_free(G);
+  gsl_spmatrix_free(I);
+  gsl_spmatrix_free(Scsr);
+  gsl_spmatrix_free(Gcsc);
+}
+
+/* the solvers with size_t index matrices give the iterates of int index
+   matrices in the same format */
+static void
+test_solvers64(const size_t n, const gsl_rng *r)
+{
+  const gsl_splinalg_itersolve_type *T[] =
+    { gsl_splinalg_itersolve_cg, gsl_splinalg_itersolve_minres,
+      gsl_splinalg_itersolve_bicgstab, gsl_splinalg_itersolve_gmres };
+  gsl_spmatrix *S = create_convdiff(n, 0.0, 0.0);
+  gsl_spmatrix *G = create_convdiff(n, 2.0, 0.0);
+  gsl_spmatrix *A[3];
+  gsl_spmatrix64 *A64[3];
+  const char *desc[3] = { "spd coo", "spd csr", "nonsym csc" };
+  const size_t N = S->size1;
+  gsl_vector *b = gsl_vector_alloc(N);
+  gsl_vector *x = gsl_vector_alloc(N);
+  gsl_vector *x64 = gsl_vector_alloc(N);
+  size_t i, j;
+  int k;
+
+  A[0] = S;
+  A[1] = gsl_spmatrix_compress(S, GSL_SPMATRIX_CSR);
+  A[2] = gsl_spmatrix_compress(G, GSL_SPMATRIX_CSC);
+
+  for (k = 0; k < 3; ++k)
+    A64[k] = gsl_spmatrix64_from_spmatrix(A[k]);
+
+  create_random_vector(b, r);
+
+  for (i = 0; i < 4; ++i)
+    {
+      for (k = 0; k < 3; ++k)
+        {
+          /* CG and MINRES need a symmetric matrix */
+          if (i < 2 && k == 2)
+            continue;
+
+          for (j = 0; j < 2; ++j)
+            {
+              gsl_splinalg_itersolve *w = gsl_splinalg_itersolve_alloc(T[i], N, 5);
+              gsl_splinalg_itersolve *w64 = gsl_splinalg_itersolve_alloc(T[i], N, 5);
+              gsl_splinalg_precond *P = NULL, *P64 = NULL;
+              int status, status64;
+              double normr;
+
+              if (j == 1)
+                {
+                  P = gsl_splinalg_precond_alloc(gsl_splinalg_precond_jacobi, N);
+                  P64 = gsl_splinalg_precond_alloc(gsl_splinalg_precond_jacobi, N);
+                  gsl_splinalg_precond_init(A[k], P);
+                  status = gsl_splinalg_precond_init64(A64[k], P64);
+                  gsl_test(status, "%s/jacobi %s precond_init64 N=%zu",
+                           T[i]->name, desc[k], N);
+                  gsl_splinalg_itersolve_set_precond(w, P);
+                  gsl_splinalg_itersolve_set_precond(w64, P64);
+                }
+
+              gsl_vector_set_zero(x);
+              gsl_vector_set_zero(x64);
+
+              status = gsl_splinalg_itersolve_iterate(A[k], b, 1.0e-10, x, w);
+              status64 = gsl_splinalg_itersolve_iterate64(A64[k], b, 1.0e-10, x64, w64);
+
+              gsl_test(status != status64, "%s %s iterate64 status N=%zu",
+                       T[i]->name, desc[k], N);
+
+              gsl_vector_sub(x64, x);
+              normr = gsl_blas_dnrm2(x64);
+              gsl_test(normr > 1.0e-12 * gsl_blas_dnrm2(x),
+                       "%s %s precond=%zu iterate64 N=%zu |x64-x|=%e",
+                       T[i]->name, desc[k], j, N, normr);
+
+              gsl_test_rel(gsl_splinalg_itersolve_normr(w64),
+                           gsl_splinalg_itersolve_normr(w), 1.0e-10,
+                           "%s %s iterate64 normr N=%zu", T[i]->name, desc[k], N);
+
+              gsl_splinalg_itersolve_free(w);
+              gsl_splinalg_itersolve_free(w64);
+              gsl_splinalg_precond_free(P);
+              gsl_splinalg_precond_free(P64);
+            }
+        }
+    }
+
+  for (k = 0; k < 3; ++k)
+    {
+      gsl_spmatrix_free(A[k]);
+      gsl_spmatrix64_free(A64[k]);
+    }
+
+  gsl_spmatrix_free(G);
+  gsl_vector_free(b);
+  gsl_vector_free(x);
+  gsl_vector_free(x64);
+}
+
+/* ILU(0) and IC(0) of a tridiagonal matrix are its exact factorizations */
+static void
+test_precond_exact(const size_t N, const gsl_rng *r)
+{
+  gsl_spmatrix *A = gsl_spmatrix_alloc(N, N);
+  gsl_spmatrix *B;
+  gsl_splinalg_precond *P;
+  gsl_vector *rhs = gsl_vector_alloc(N);
+  gsl_vector *z = gsl_vector_alloc(N);
+  gsl_vector *res = gsl_vector_alloc(N);
+  size_t i;
+  int k, t;
+
+  for (i = 0; i < N; ++i)
+    {
+      double c = gsl_rng_uniform(r) - 0.5;
+
+      gsl_spmatrix_set(A, i, i, 3.0 + gsl_rng_uniform(r));
+
+      if (i + 1 < N)
+        {
+          gsl_spmatrix_set(A, i, i + 1, c);
+          gsl_spmatrix_set(A, i + 1, i, c);
+        }
+    }
+
+  B = gsl_spmatrix_compress(A, GSL_SPMATRIX_CSC);
+  create_random_vector(rhs, r);
+
+  for (k = 0; k < 2; ++k)
+    {
+      P = gsl_splinalg_precond_alloc(k ? gsl_splinalg_precond_ic0 :
+                                     gsl_splinalg_precond_ilu0, N);
+
+      /* direct substitution, then level scheduled solves, and a second
+         init with the same pattern for each */
+      for (t = 0; t < 4; ++t)
+        {
+          gsl_set_num_threads(t < 2 ? 1 : 2);
+
+          gsl_splinalg_precond_init(B, P);
+          gsl_splinalg_precond_apply(rhs, z, P);
+
+          gsl_vector_memcpy(res, rhs);
+          gsl_spblas_dgemv(CblasNoTrans, -1.0, A, z, 1.0, res);
+
+          gsl_test(gsl_blas_dnrm2(res) > 1.0e-12 * gsl_blas_dnrm2(rhs),
+                   "%s exact tridiagonal N=%zu threads=%d",
+                   gsl_splinalg_precond_name(P), N, t < 2 ? 1 : 2);
+        }
+
+      gsl_set_num_threads(1);
+      gsl_splinalg_precond_free(P);
+    }
+
+  gsl_spmatrix_free(A);
+  gsl_spmatrix_free(B);
+  gsl_vector_free(rhs);
+  gsl_vector_free(z);
+  gsl_vector_free(res);
+}
+
+/* random sparse symmetric positive definite matrix, lower triangle only
+ * if lower is set */
+static gsl_spmatrix *
+create_random_spd(const size_t N, const double density, const int lower,
+                  const gsl_rng *r)
+{
+  gsl_spmatrix *A = gsl_spmatrix_alloc(N, N);
+  gsl_vector *d = gsl_vector_calloc(N);
+  size_t i, k, nk = (size_t) (0.5 * density * N * N);
+
+  for (k = 0; k < nk; ++k)
+    {
+      size_t i = (size_t) (gsl_rng_uniform(r) * N);
+      size_t j = (size_t) (gsl_rng_uniform(r) * N);
+      double x = gsl_rng_uniform(r) - 0.5;
+
+      if (i == j || gsl_spmatrix_get(A, GSL_MAX(i, j), GSL_MIN(i, j)) != 0.0)
+        continue;
+
+      gsl_spmatrix_set(A, GSL_MAX(i, j), GSL_MIN(i, j), x);
+      if (!lower)
+        gsl_spmatrix_set(A, GSL_MIN(i, j), GSL_MAX(i, j), x);
+
+      *gsl_vector_ptr(d, i) += fabs(x);
+      *gsl_vector_ptr(d, j) += fabs(x);
+    }
+
+  for (i = 0; i < N; ++i)
+    gsl_spmatrix_set(A, i, i, gsl_vector_get(d, i) + 1.0);
+
+  gsl_vector_free(d);
+
+  return A;
+}
+
+/* ||b - A x|| <= tol ||b||, where only the lower triangle of A is
+ * stored if sym is set */
+static void
+test_direct_residual(const gsl_spmatrix *A, const int sym,
+                     const gsl_vector *b, const gsl_vector *x,
+                     const double tol, const char *desc)
+{
+  gsl_vector *res = gsl_vector_alloc(b->size);
+  double normr, normb = gsl_blas_dnrm2(b);
+
+  gsl_vector_memcpy(res, b);
+  gsl_spblas_dgemv(CblasNoTrans, -1.0, A, x, 1.0, res);
+
+  if (sym)
+    {
+      /* the strict upper triangle A^T x */
+      size_t j;
+      int p;
+
+      for (j = 0; j < A->size2; ++j)
+        {
+          for (p = A->p[j]; p < A->p[j + 1]; ++p)
+            {
+              if ((size_t) A->i[p] > j)
+                *gsl_vector_ptr(res, j) -= A->data[p] * gsl_vector_get(x, A->i[p]);
+            }
+        }
+    }
+
+  normr = gsl_blas_dnrm2(res);
+
+  gsl_test(normr > tol * normb, "%s residual normr=%.12e normb=%.12e",
+           desc, normr, normb);
+
+  gsl_vector_free(res);
+}
+
+static void
+test_cholesky(gsl_spmatrix *T, const int lower, const char *desc,
+              const gsl_rng *r)
+{
+  const size_t N = T->size1;
+  const double tol = 1.0e-10;
+  gsl_spmatrix *A = gsl_spmatrix_compress(T, GSL_SPMATRIX_CSC);
+  gsl_vector *b = gsl_vector_alloc(N);
+  gsl_vector *x = gsl_vector_alloc(N);
+  gsl_splinalg_order_t order;
+  char buf[256];
+
+  create_random_vector(b, r);
+
+  for (order = GSL_SPLINALG_ORDER_NATURAL; order <= GSL_SPLINALG_ORDER_ND; ++order)
+    {
+      gsl_splinalg_cholesky_workspace *w = gsl_splinalg_cholesky_alloc(A, order);
+      int status;
+
+      sprintf(buf, "cholesky %s N=%zu order=%d", desc, N, (int) order);
+
+      gsl_test(gsl_permutation_valid(w->perm),
+               "%s permutation", buf);
+
+      status = gsl_splinalg_cholesky_decomp(A, w);
+      gsl_test(status, "%s decomp", buf);
+
+      gsl_splinalg_cholesky_solve(w, b, x);
+      test_direct_residual(A, lower, b, x, tol, buf);
+
+      /* refactorization with new values and the same pattern */
+      gsl_spmatrix_scale(A, 2.0);
+      status = gsl_splinalg_cholesky_decomp(A, w);
+      gsl_test(status, "%s refactor", buf);
+
+      gsl_vector_memcpy(x, b);
+      gsl_splinalg_cholesky_solve(w, x, x);
+      test_direct_residual(A, lower, b, x, tol, buf);
+      gsl_spmatrix_scale(A, 0.5);
+
+      gsl_splinalg_cholesky_free(w);
+    }
+
+  gsl_spmatrix_free(A);
+  gsl_spmatrix_free(T);
+  gsl_vector_free(b);
+  gsl_vector_free(x);
+}
+
+static void
+test_LU(gsl_spmatrix *T, const char *desc, const gsl_rng *r)
+{
+  const size_t N = T->size1;
+  const double tol = 1.0e-10;
+  gsl_spmatrix *A = gsl_spmatrix_compress(T, GSL_SPMATRIX_CSC);
+  gsl_vector *b = gsl_vector_alloc(N);
+  gsl_vector *x = gsl_vector_alloc(N);
+  gsl_splinalg_order_t order;
+  char buf[256];
+
+  create_random_vector(b, r);
+
+  for (order = GSL_SPLINALG_ORDER_NATURAL; order <= GSL_SPLINALG_ORDER_ND; ++order)
+    {
+      gsl_splinalg_LU_workspace *w = gsl_splinalg_LU_alloc(A, order);
+      int status;
+
+      sprintf(buf, "LU %s N=%zu order=%d", desc, N, (int) order);
+
+      status = gsl_splinalg_LU_decomp(A, w);
+      gsl_test(status, "%s decomp", buf);
+
+      gsl_test(gsl_permutation_valid(w->p) || gsl_permutation_valid(w->q),
+               "%s permutations", buf);
+
+      gsl_splinalg_LU_solve(w, b, x);
+      test_direct_residual(A, 0, b, x, tol, buf);
+
+      /* refactorization */
+      gsl_spmatrix_scale(A, -3.0);
+      status = gsl_splinalg_LU_decomp(A, w);
+      gsl_test(status, "%s refactor", buf);
+
+      gsl_vector_memcpy(x, b);
+      gsl_splinalg_LU_solve(w, x, x);
+      test_direct_residual(A, 0, b, x, tol, buf);
+      gsl_spmatrix_scale(A, -1.0 / 3.0);
+
+      gsl_splinalg_LU_free(w);
+    }
+
+  gsl_spmatrix_free(A);
+  gsl_spmatrix_free(T);
+  gsl_vector_free(b);
+  gsl_vector_free(x);
+}
+
+/* rows of A shifted cyclically, so that the diagonal is zero */
+static gsl_spmatrix *
+shift_rows(gsl_spmatrix *T)
+{
+  const size_t N = T->size1;
+  gsl_spmatrix *S = gsl_spmatrix_alloc_nzmax(N, N, T->nz, GSL_SPMATRIX_COO);
+  size_t k;
+
+  for (k = 0; k < T->nz; ++k)
+    gsl_spmatrix_set(S, (T->i[k] + 1) % N, T->p[k], T->data[k]);
+
+  gsl_spmatrix_free(T);
+
+  return S;
+}
+
+static void
+test_direct(const gsl_rng *r)
+{
+  size_t n;
+
+  for (n = 1; n <= 30; n += 29 / (n + 2) + 1)
+    {
+      test_cholesky(create_convdiff(n, 0.0, 0.0), 0, "laplace full", r);
+      test_cholesky(create_random_spd(n * n, 5.0 / (n * n), 1, r), 1,
+                    "random lower", r);
+      test_cholesky(create_random_spd(n * n, 5.0 / (n * n), 0, r), 0,
+                    "random full", r);
+
+      test_LU(create_convdiff(n, 2.0, 0.0), "convdiff", r);
+      test_LU(create_convdiff(n, 0.0, -1.0), "indefinite", r);
+      test_LU(create_random_spd(n * n, 5.0 / (n * n), 0, r), "random", r);
+
+      if (n > 1)
+        test_LU(shift_rows(create_convdiff(n, 2.0, 0.0)), "zero diagonal", r);
+    }
+
+  /* the fill-reducing ordering must reduce the fill of a 2D grid */
+  {
+    gsl_spmatrix *T = create_convdiff(30, 0.0, 0.0);
+    gsl_spmatrix *A = gsl_spmatrix_compress(T, GSL_SPMATRIX_CSC);
+    gsl_splinalg_cholesky_workspace *w0 =
+      gsl_splinalg_cholesky_alloc(A, GSL_SPLINALG_ORDER_NATURAL);
+    gsl_splinalg_cholesky_workspace *w1 =
+      gsl_splinalg_cholesky_alloc(A, GSL_SPLINALG_ORDER_AMD);
+
+    gsl_splinalg_cholesky_workspace *w2 =
+      gsl_splinalg_cholesky_alloc(A, GSL_SPLINALG_ORDER_ND);
+
+    gsl_test(w1->nnzL >= w0->nnzL / 2,
+             "cholesky AMD fill nnzL=%zu natural nnzL=%zu",
+             w1->nnzL, w0->nnzL);
+    gsl_test(w2->nnzL >= w0->nnzL / 2,
+             "cholesky ND fill nnzL=%zu natural nnzL=%zu",
+             w2->nnzL, w0->nnzL);
+
+    /* the natural ordering of a band matrix has one supernode per
+     * column except for the last n */
+    gsl_test(w0->nsuper > 900 - 29, "cholesky natural nsuper=%zu",
+             w0->nsuper);
+
+    gsl_splinalg_cholesky_free(w0);
+    gsl_splinalg_cholesky_free(w1);
+    gsl_splinalg_cholesky_free(w2);
+    gsl_spmatrix_free(A);
+    gsl_spmatrix_free(T);
+  }
+}
+
+/* grid Laplacian with its nodes numbered randomly */
+static gsl_spmatrix *
+create_shuffled_laplace(const size_t n, const gsl_rng *r)
+{
+  gsl_spmatrix *T = create_convdiff(n, 0.0, 0.0);
+  gsl_spmatrix *S = gsl_spmatrix_alloc_nzmax(T->size1, T->size2, T->nz,
+                                             GSL_SPMATRIX_COO);
+  gsl_permutation *p = gsl_permutation_alloc(T->size1);
+  size_t k;
+
+  gsl_permutation_init(p);
+
+  for (k = T->size1; k > 1; --k)
+    gsl_permutation_swap(p, k - 1, gsl_rng_uniform_int(r, k));
+
+  for (k = 0; k < T->nz; ++k)
+    gsl_spmatrix_set(S, p->data[T->i[k]], p->data[T->p[k]], T->data[k]);
+
+  gsl_permutation_free(p);
+  gsl_spmatrix_free(T);
+
+  return S;
+}
+
+static void
+test_order(const size_t n, const gsl_rng *r)
+{
+  gsl_spmatrix *T = create_shuffled_laplace(n, r);
+  const size_t N = T->size1;
+  gsl_spmatrix *A = gsl_spmatrix_compress(T, GSL_SPMATRIX_CSR);
+  gsl_spmatrix *B = gsl_spmatrix_alloc_nzmax(N, N, 1, GSL_SPMATRIX_CSR);
+  gsl_permutation *p = gsl_permutation_alloc(N);
+  gsl_vector *b = gsl_vector_alloc(N);
+  gsl_vector *x = gsl_vector_alloc(N);
+  gsl_vector *y = gsl_vector_alloc(N);
+  size_t lb, ub, k;
+  int status;
+
+  create_random_vector(b, r);
+
+  /* orderings are permutations */
+  status = gsl_splinalg_order_amd(T, p);
+  gsl_test(status || gsl_permutation_valid(p), "order amd n=%zu", n);
+  status = gsl_splinalg_order_nd(A, p);
+  gsl_test(status || gsl_permutation_valid(p), "order nd n=%zu", n);
+  status = gsl_splinalg_order_rcm(A, p);
+  gsl_test(status || gsl_permutation_valid(p), "order rcm n=%zu", n);
+
+  /* B = P A P^T */
+  status = gsl_splinalg_permute_sym(A, p, B);
+  gsl_test(status, "permute_sym n=%zu status", n);
+  gsl_test(gsl_spmatrix_nnz(B) != gsl_spmatrix_nnz(A),
+           "permute_sym n=%zu nnz", n);
+
+  {
+    int s = 0, q;
+
+    for (k = 0; k < N; ++k)
+      {
+        for (q = B->p[k]; q < B->p[k + 1]; ++q)
+          {
+            const size_t l = B->i[q];
+
+            s |= (q > B->p[k] && B->i[q - 1] >= B->i[q]);
+            s |= (B->data[q] != gsl_spmatrix_get(A, p->data[k], p->data[l]));
+          }
+      }
+
+    gsl_test(s, "permute_sym n=%zu elements", n);
+  }
+
+  /* RCM of a grid has bandwidth at most about n */
+  gsl_splinalg_bandwidth(B, &lb, &ub);
+  gsl_test(lb != ub || lb > n + 1, "rcm n=%zu bandwidth lb=%zu ub=%zu",
+           n, lb, ub);
+
+  /* banded LU and Cholesky of P A P^T */
+  {
+    gsl_matrix *AB = gsl_matrix_alloc(N, 2 * lb + ub + 1);
+    gsl_matrix *LLT = gsl_matrix_alloc(N, lb + 1);
+    gsl_vector_uint *piv = gsl_vector_uint_alloc(N);
+    gsl_vector *pb = gsl_vector_alloc(N);
+
+    for (k = 0; k < N; ++k)
+      gsl_vector_set(pb, k, gsl_vector_get(b, p->data[k]));
+
+    status = gsl_splinalg_sp2band(B, lb, ub, AB);
+    gsl_test(status, "sp2band n=%zu", n);
+    gsl_linalg_LU_band_decomp(N, lb, ub, AB, piv);
+    gsl_linalg_LU_band_solve(lb, ub, AB, piv, pb, y);
+
+    for (k = 0; k < N; ++k)
+      gsl_vector_set(x, p->data[k], gsl_vector_get(y, k));
+
+    test_direct_residual(A, 0, b, x, 1.0e-10, "LU_band rcm");
+
+    status = gsl_splinalg_sp2symband(B, LLT);
+    gsl_test(status, "sp2symband n=%zu", n);
+    gsl_linalg_cholesky_band_decomp(LLT);
+    gsl_linalg_cholesky_band_solve(LLT, pb, y);
+
+    for (k = 0; k < N; ++k)
+      gsl_vector_set(x, p->data[k], gsl_vector_get(y, k));
+
+    test_direct_residual(A, 0, b, x, 1.0e-10, "cholesky_band rcm");
+
+    /* elements outside the band are rejected */
+    if (lb > 0)
+      {
+        gsl_matrix *AB0 = gsl_matrix_alloc(N, ub + 1);
+
+        gsl_set_error_handler_off();
+        status = gsl_splinalg_sp2band(B, 0, ub, AB0);
+        gsl_test(status != GSL_EDOM, "sp2band n=%zu outside band", n);
+        gsl_set_error_handler(NULL);
+
+        gsl_matrix_free(AB0);
+      }
+
+    gsl_matrix_free(AB);
+    gsl_matrix_free(LLT);
+    gsl_vector_uint_free(piv);
+    gsl_vector_free(pb);
+  }
+
+  gsl_spmatrix_free(T);
+  gsl_spmatrix_free(A);
+  gsl_spmatrix_free(B);
+  gsl_permutation_free(p);
+  gsl_vector_free(b);
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+}
+
 int
 main()
 {
@@ -366,6 +1045,22 @@ main()
       test_random(n, r, 1);
     }
 
+  for (n = 1; n <= 50; n += 7)
+    test_precond_exact(n, r);
+
+  test_solvers(1, r);
+  test_solvers(10, r);
+  test_solvers(40, r);
+
+  test_solvers64(10, r);
+  test_solvers64(40, r);
+
+  test_direct(r);
+
+  test_order(1, r);
+  test_order(8, r);
+  test_order(40, r);
+
   gsl_rng_free(r);
 
   exit (gsl_test_summary());
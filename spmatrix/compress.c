@@ -1,8 +1,40 @@
 #include <config.h>
 #include <stddef.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_spmatrix.h>
 #include <gsl/gsl_errno.h>
 
+/* row of a SELL matrix and its number of elements */
+typedef struct
+{
+  int len;
+  int row;
+} spmatrix_sell_row;
+
+static int
+compare_int (const void * a, const void * b)
+{
+  const int ia = *(const int *) a;
+  const int ib = *(const int *) b;
+
+  return (ia > ib) - (ia < ib);
+}
+
+/* longest rows first; rows of equal length in their original order */
+static int
+compare_sell_row (const void * a, const void * b)
+{
+  const spmatrix_sell_row * ra = (const spmatrix_sell_row *) a;
+  const spmatrix_sell_row * rb = (const spmatrix_sell_row *) b;
+
+  if (ra->len != rb->len)
+    return (ra->len < rb->len) - (ra->len > rb->len);
+  else
+    return (ra->row > rb->row) - (ra->row < rb->row);
+}
+
 #define BASE_GSL_COMPLEX_LONG
 #include "templates_on.h"
 #include "compress_source.c"
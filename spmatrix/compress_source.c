@@ -17,13 +17,75 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+/*
+compress_dupl()
+  Sum duplicate entries of a compressed matrix built from appended
+triplets. Within each outer index (column for CSC, row for CSR) the
+first occurrence of each inner index is kept, and later occurrences
+are added to it, in a single pass using m->work as a map from inner
+index to position.
+
+Inputs: nouter - number of outer indices (length of m->p minus 1)
+        ninner - number of inner indices
+        m      - CSC or CSR matrix
+*/
+
+static void
+FUNCTION (compress, dupl) (const size_t nouter, const size_t ninner, TYPE (gsl_spmatrix) * m)
+{
+  int *Ap = m->p;
+  int *Ai = m->i;
+  ATOMIC *Ad = m->data;
+  int *w = m->work.work_int;
+  int nz = 0;
+  size_t j, r;
+
+  for (j = 0; j < ninner; ++j)
+    w[j] = -1;
+
+  for (j = 0; j < nouter; ++j)
+    {
+      const int q = nz; /* start of outer index j after compaction */
+      int p;
+
+      for (p = Ap[j]; p < Ap[j + 1]; ++p)
+        {
+          const int i = Ai[p];
+
+          if (w[i] >= q)
+            {
+              /* duplicate entry in this column/row */
+              for (r = 0; r < MULTIPLICITY; ++r)
+                Ad[MULTIPLICITY * w[i] + r] += Ad[MULTIPLICITY * p + r];
+            }
+          else
+            {
+              w[i] = nz;
+              Ai[nz] = i;
+
+              for (r = 0; r < MULTIPLICITY; ++r)
+                Ad[MULTIPLICITY * nz + r] = Ad[MULTIPLICITY * p + r];
+
+              ++nz;
+            }
+        }
+
+      Ap[j] = q;
+    }
+
+  Ap[nouter] = nz;
+  m->nz = nz;
+}
+
 /*
 gsl_spmatrix_csc()
   Create a sparse matrix in compressed column format
 
-Inputs: T - sparse matrix in triplet format
+Inputs: dest - (output) sparse matrix in CSC format
+        src  - sparse matrix in triplet format; triplets added with
+               gsl_spmatrix_append() are summed
 
-Return: pointer to new matrix (should be freed when finished with it)
+Return: success/error
 */
 
 int
@@ -89,6 +151,9 @@ FUNCTION (gsl_spmatrix, csc) (TYPE (gsl_spmatrix) * dest, const TYPE (gsl_spmatr
 
       dest->nz = src->nz;
 
+      if (src->spflags & GSL_SPMATRIX_FLG_APPEND)
+        FUNCTION (compress, dupl) (dest->size2, dest->size1, dest);
+
       return GSL_SUCCESS;
     }
 }
@@ -109,12 +174,112 @@ FUNCTION (gsl_spmatrix, ccs) (const TYPE (gsl_spmatrix) * src)
   return dest;
 }
 
+/*
+compress_block()
+  Convert a BSR or SELL matrix to compressed row format. All the
+elements of the blocks inside the matrix are kept, including the
+zeros which fill the blocks; the padding of the slices is dropped.
+
+Inputs: dest - (output) sparse matrix in CSR format
+        src  - sparse matrix in BSR or SELL format
+
+Return: success/error
+*/
+
+static int
+FUNCTION (compress, block) (TYPE (gsl_spmatrix) * dest, const TYPE (gsl_spmatrix) * src)
+{
+  const size_t M = src->size1;
+  const size_t N = src->size2;
+  const size_t B1 = src->block_size1;
+  const size_t B2 = src->block_size2;
+  const size_t nb1 = (M + B1 - 1) / B1;
+  const int *perm = src->p + nb1 + 1; /* SELL row order */
+  const int *len = perm + M;          /* SELL row lengths */
+  int *Cp = dest->p;
+  size_t i, k, n, r;
+  int p;
+
+  /* Cp[i] = number of elements in row i */
+  for (n = 0; n < M + 1; ++n)
+    Cp[n] = 0;
+
+  if (GSL_SPMATRIX_ISBSR(src))
+    {
+      for (i = 0; i < M; ++i)
+        {
+          for (p = src->p[i / B1]; p < src->p[i / B1 + 1]; ++p)
+            Cp[i] += (int) GSL_MIN(B2, N - (size_t) src->i[p] * B2);
+        }
+    }
+  else
+    {
+      for (n = 0; n < M; ++n)
+        Cp[perm[n]] = len[n];
+    }
+
+  gsl_spmatrix_cumsum(M, Cp);
+
+  if (dest->nzmax < (size_t) Cp[M])
+    {
+      int status = FUNCTION (gsl_spmatrix, realloc) (Cp[M], dest);
+      if (status)
+        return status;
+    }
+
+  if (GSL_SPMATRIX_ISBSR(src))
+    {
+      for (i = 0; i < M; ++i)
+        {
+          int q = Cp[i];
+
+          /* the blocks of a block row are in order of block column */
+          for (p = src->p[i / B1]; p < src->p[i / B1 + 1]; ++p)
+            {
+              const size_t j0 = (size_t) src->i[p] * B2;
+              const size_t nc = GSL_MIN(B2, N - j0);
+              const size_t idx = (size_t) p * B1 * B2 + (i % B1) * B2;
+
+              for (k = 0; k < nc; ++k, ++q)
+                {
+                  dest->i[q] = (int) (j0 + k);
+
+                  for (r = 0; r < MULTIPLICITY; ++r)
+                    dest->data[MULTIPLICITY * q + r] = src->data[MULTIPLICITY * (idx + k) + r];
+                }
+            }
+        }
+    }
+  else
+    {
+      for (n = 0; n < M; ++n)
+        {
+          const size_t idx = src->p[n / B1] + n % B1;
+          int q = Cp[perm[n]];
+
+          for (k = 0; k < (size_t) len[n]; ++k, ++q)
+            {
+              dest->i[q] = src->i[idx + k * B1];
+
+              for (r = 0; r < MULTIPLICITY; ++r)
+                dest->data[MULTIPLICITY * q + r] = src->data[MULTIPLICITY * (idx + k * B1) + r];
+            }
+        }
+    }
+
+  dest->nz = Cp[M];
+
+  return GSL_SUCCESS;
+}
+
 /*
 gsl_spmatrix_csr()
   Create a sparse matrix in compressed row format
 
 Inputs: dest - (output) sparse matrix in CSR format
-        src  - sparse matrix in triplet format
+        src  - sparse matrix in triplet format; triplets added with
+               gsl_spmatrix_append() are summed. A matrix in BSR or
+               SELL format is also accepted, see compress_block()
 
 Return: success/error
 */
@@ -122,9 +287,9 @@ Return: success/error
 int
 FUNCTION (gsl_spmatrix, csr) (TYPE (gsl_spmatrix) * dest, const TYPE (gsl_spmatrix) * src)
 {
-  if (!GSL_SPMATRIX_ISCOO(src))
+  if (!GSL_SPMATRIX_ISCOO(src) && !GSL_SPMATRIX_ISBSR(src) && !GSL_SPMATRIX_ISSELL(src))
     {
-      GSL_ERROR("input matrix must be in COO format", GSL_EINVAL);
+      GSL_ERROR("input matrix must be in COO, BSR or SELL format", GSL_EINVAL);
     }
   else if (!GSL_SPMATRIX_ISCSR(dest))
     {
@@ -134,6 +299,10 @@ FUNCTION (gsl_spmatrix, csr) (TYPE (gsl_spmatrix) * dest, const TYPE (gsl_spmatr
     {
       GSL_ERROR("matrices must have same dimensions", GSL_EBADLEN);
     }
+  else if (!GSL_SPMATRIX_ISCOO(src))
+    {
+      return FUNCTION (compress, block) (dest, src);
+    }
   else
     {
       int status;
@@ -182,6 +351,9 @@ FUNCTION (gsl_spmatrix, csr) (TYPE (gsl_spmatrix) * dest, const TYPE (gsl_spmatr
 
       dest->nz = src->nz;
 
+      if (src->spflags & GSL_SPMATRIX_FLG_APPEND)
+        FUNCTION (compress, dupl) (dest->size1, dest->size2, dest);
+
       return GSL_SUCCESS;
     }
 }
@@ -195,6 +367,62 @@ FUNCTION (gsl_spmatrix, crs) (const TYPE (gsl_spmatrix) * src)
   return dest;
 }
 
+/*
+gsl_spmatrix_sum_duplicates()
+  Sum the duplicate triplets of a COO matrix assembled with
+gsl_spmatrix_append(), and rebuild its binary tree, so that
+gsl_spmatrix_get() and gsl_spmatrix_set() can be used again.
+The triplets are left in row-major order.
+
+Inputs: m - COO matrix
+
+Return: success/error
+*/
+
+int
+FUNCTION (gsl_spmatrix, sum_duplicates) (TYPE (gsl_spmatrix) * m)
+{
+  if (!GSL_SPMATRIX_ISCOO(m))
+    {
+      GSL_ERROR("matrix must be in COO format", GSL_EINVAL);
+    }
+  else if (!(m->spflags & GSL_SPMATRIX_FLG_APPEND))
+    {
+      /* the binary tree already excludes duplicates */
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      TYPE (gsl_spmatrix) * C = FUNCTION (gsl_spmatrix, compress) (m, GSL_SPMATRIX_CSR);
+      size_t i, r;
+      int p;
+
+      if (C == NULL)
+        {
+          GSL_ERROR("failed to allocate space for CSR matrix", GSL_ENOMEM);
+        }
+
+      for (i = 0; i < m->size1; ++i)
+        {
+          for (p = C->p[i]; p < C->p[i + 1]; ++p)
+            {
+              m->i[p] = (int) i;
+              m->p[p] = C->i[p];
+
+              for (r = 0; r < MULTIPLICITY; ++r)
+                m->data[MULTIPLICITY * p + r] = C->data[MULTIPLICITY * p + r];
+            }
+        }
+
+      m->nz = C->nz;
+      m->spflags &= ~GSL_SPMATRIX_FLG_APPEND;
+
+      FUNCTION (gsl_spmatrix, free) (C);
+
+      return FUNCTION (gsl_spmatrix, tree_rebuild) (m);
+    }
+}
+
 TYPE (gsl_spmatrix) *
 FUNCTION (gsl_spmatrix, compress) (const TYPE (gsl_spmatrix) * src, const int sptype)
 {
@@ -231,3 +459,352 @@ FUNCTION (gsl_spmatrix, compress) (const TYPE (gsl_spmatrix) * src, const int sp
 
   return dest;
 }
+
+/*
+gsl_spmatrix_compress_bsr()
+  Create a sparse matrix in block compressed row format
+
+Inputs: src - sparse matrix in COO or CSR format
+        r   - number of rows of the blocks
+        c   - number of columns of the blocks
+
+Return: pointer to new matrix (should be freed when finished with it)
+
+Notes:
+1) Every block with at least one element of src is stored in full,
+so the number of stored elements (gsl_spmatrix_nnz) is the number of
+blocks times r*c
+
+2) The blocks of each block row are stored in order of block column
+*/
+
+TYPE (gsl_spmatrix) *
+FUNCTION (gsl_spmatrix, compress_bsr) (const TYPE (gsl_spmatrix) * src, const size_t r, const size_t c)
+{
+  if (!GSL_SPMATRIX_ISCOO(src) && !GSL_SPMATRIX_ISCSR(src))
+    {
+      GSL_ERROR_NULL("input matrix must be in COO or CSR format", GSL_EINVAL);
+    }
+  else if (r == 0 || c == 0)
+    {
+      GSL_ERROR_NULL("block dimensions must be positive", GSL_EINVAL);
+    }
+  else if (r > (size_t) INT_MAX / c)
+    {
+      GSL_ERROR_NULL("block dimensions are too large", GSL_EOVRFLW);
+    }
+  else
+    {
+      const size_t M = src->size1;
+      const size_t N = src->size2;
+      const size_t nb1 = (M + r - 1) / r; /* number of block rows */
+      const size_t nb2 = (N + c - 1) / c; /* number of block columns */
+      const size_t bsize = r * c;
+      TYPE (gsl_spmatrix) * csr;
+      TYPE (gsl_spmatrix) * dest;
+      int *marker;
+      size_t nblocks = 0;
+      size_t I, k, n, q;
+      int p;
+
+      if (GSL_SPMATRIX_ISCOO(src))
+        {
+          csr = FUNCTION (gsl_spmatrix, compress) (src, GSL_SPMATRIX_CSR);
+          if (csr == NULL)
+            return NULL;
+        }
+      else
+        {
+          csr = (TYPE (gsl_spmatrix) *) src;
+        }
+
+      /* marker[J] = last block row (pass 1) or block (pass 2) using block column J */
+      marker = malloc(nb2 * sizeof(int));
+      if (marker == NULL)
+        {
+          if (csr != src)
+            FUNCTION (gsl_spmatrix, free) (csr);
+          GSL_ERROR_NULL("failed to allocate space for block markers", GSL_ENOMEM);
+        }
+
+      /* pass 1: count the blocks */
+      for (n = 0; n < nb2; ++n)
+        marker[n] = -1;
+
+      for (I = 0; I < nb1; ++I)
+        {
+          const size_t i1 = GSL_MIN(M, (I + 1) * r);
+          size_t i;
+
+          for (i = I * r; i < i1; ++i)
+            {
+              for (p = csr->p[i]; p < csr->p[i + 1]; ++p)
+                {
+                  const size_t J = csr->i[p] / c;
+
+                  if (marker[J] != (int) I)
+                    {
+                      marker[J] = (int) I;
+                      ++nblocks;
+                    }
+                }
+            }
+        }
+
+      /* the stored elements must be indexable by int */
+      if (nblocks > (size_t) INT_MAX / bsize)
+        {
+          free(marker);
+          if (csr != src)
+            FUNCTION (gsl_spmatrix, free) (csr);
+          GSL_ERROR_NULL("too many stored elements", GSL_EOVRFLW);
+        }
+
+      dest = FUNCTION (gsl_spmatrix, alloc_nzmax) (M, N, nblocks * bsize, GSL_SPMATRIX_BSR);
+      if (dest == NULL)
+        {
+          free(marker);
+          if (csr != src)
+            FUNCTION (gsl_spmatrix, free) (csr);
+          return NULL;
+        }
+
+      dest->block_size1 = r;
+      dest->block_size2 = c;
+
+      /* pass 2: block columns of each block row, then the elements */
+      for (n = 0; n < nb2; ++n)
+        marker[n] = -1;
+
+      dest->p[0] = 0;
+      k = 0;
+
+      for (I = 0; I < nb1; ++I)
+        {
+          const size_t i1 = GSL_MIN(M, (I + 1) * r);
+          const size_t k0 = k;
+          size_t i;
+
+          for (i = I * r; i < i1; ++i)
+            {
+              for (p = csr->p[i]; p < csr->p[i + 1]; ++p)
+                {
+                  const int J = csr->i[p] / (int) c;
+
+                  if (marker[J] < (int) k0)
+                    {
+                      marker[J] = (int) k;
+                      dest->i[k++] = J;
+                    }
+                }
+            }
+
+          qsort(dest->i + k0, k - k0, sizeof(int), compare_int);
+
+          for (n = k0; n < k; ++n)
+            marker[dest->i[n]] = (int) n;
+
+          for (n = MULTIPLICITY * k0 * bsize; n < MULTIPLICITY * k * bsize; ++n)
+            dest->data[n] = (ATOMIC) 0;
+
+          for (i = I * r; i < i1; ++i)
+            {
+              for (p = csr->p[i]; p < csr->p[i + 1]; ++p)
+                {
+                  const size_t j = csr->i[p];
+                  const size_t b = marker[j / c];
+                  const size_t idx = b * bsize + (i - I * r) * c + j % c;
+
+                  for (q = 0; q < MULTIPLICITY; ++q)
+                    dest->data[MULTIPLICITY * idx + q] += csr->data[MULTIPLICITY * p + q];
+                }
+            }
+
+          dest->p[I + 1] = (int) k;
+        }
+
+      dest->nz = nblocks * bsize;
+
+      free(marker);
+      if (csr != src)
+        FUNCTION (gsl_spmatrix, free) (csr);
+
+      return dest;
+    }
+}
+
+/*
+gsl_spmatrix_compress_sell()
+  Create a sparse matrix in sliced ELLPACK (SELL-C-sigma) format
+
+Inputs: src   - sparse matrix in COO or CSR format
+        C     - number of rows in each slice
+        sigma - number of consecutive rows sorted by length; 1 keeps
+                the original row order
+
+Return: pointer to new matrix (should be freed when finished with it)
+
+Notes:
+1) Each slice is padded to the length of its longest row, and the
+padding is counted in the number of stored elements (gsl_spmatrix_nnz)
+
+2) sigma is usually a multiple of C, so that the rows of a slice
+have similar lengths
+*/
+
+TYPE (gsl_spmatrix) *
+FUNCTION (gsl_spmatrix, compress_sell) (const TYPE (gsl_spmatrix) * src, const size_t C, const size_t sigma)
+{
+  if (!GSL_SPMATRIX_ISCOO(src) && !GSL_SPMATRIX_ISCSR(src))
+    {
+      GSL_ERROR_NULL("input matrix must be in COO or CSR format", GSL_EINVAL);
+    }
+  else if (C == 0)
+    {
+      GSL_ERROR_NULL("slice height must be positive", GSL_EINVAL);
+    }
+  else if (sigma == 0)
+    {
+      GSL_ERROR_NULL("sorting scope must be positive", GSL_EINVAL);
+    }
+  else
+    {
+      const size_t M = src->size1;
+      const size_t N = src->size2;
+      const size_t nslice = (M + C - 1) / C;
+      TYPE (gsl_spmatrix) * csr;
+      TYPE (gsl_spmatrix) * dest;
+      spmatrix_sell_row * rows;
+      size_t total = 0;
+      size_t i, s, t, k, q;
+      int *perm;
+
+      if (GSL_SPMATRIX_ISCOO(src))
+        {
+          csr = FUNCTION (gsl_spmatrix, compress) (src, GSL_SPMATRIX_CSR);
+          if (csr == NULL)
+            return NULL;
+        }
+      else
+        {
+          csr = (TYPE (gsl_spmatrix) *) src;
+        }
+
+      rows = malloc(M * sizeof(spmatrix_sell_row));
+      if (rows == NULL)
+        {
+          if (csr != src)
+            FUNCTION (gsl_spmatrix, free) (csr);
+          GSL_ERROR_NULL("failed to allocate space for row lengths", GSL_ENOMEM);
+        }
+
+      /* sort the rows by length within each window of sigma rows */
+      for (i = 0; i < M; ++i)
+        {
+          rows[i].len = csr->p[i + 1] - csr->p[i];
+          rows[i].row = (int) i;
+        }
+
+      for (i = 0; i < M; i += sigma)
+        qsort(rows + i, GSL_MIN(sigma, M - i), sizeof(spmatrix_sell_row), compare_sell_row);
+
+      /* storage: each slice is as wide as its longest row, and the
+         stored elements must be indexable by int */
+      for (s = 0; s < nslice; ++s)
+        {
+          const size_t i1 = GSL_MIN(M, (s + 1) * C);
+          int width = 0;
+
+          for (i = s * C; i < i1; ++i)
+            width = GSL_MAX(width, rows[i].len);
+
+          if (width > 0 && C > ((size_t) INT_MAX - total) / (size_t) width)
+            {
+              free(rows);
+              if (csr != src)
+                FUNCTION (gsl_spmatrix, free) (csr);
+              GSL_ERROR_NULL("too many stored elements", GSL_EOVRFLW);
+            }
+
+          total += C * (size_t) width;
+        }
+
+      dest = FUNCTION (gsl_spmatrix, alloc_nzmax) (M, N, total, GSL_SPMATRIX_SELL);
+      if (dest == NULL)
+        {
+          free(rows);
+          if (csr != src)
+            FUNCTION (gsl_spmatrix, free) (csr);
+          return NULL;
+        }
+
+      dest->block_size1 = C;
+      dest->block_size2 = sigma;
+
+      perm = dest->p + nslice + 1;
+      for (i = 0; i < M; ++i)
+        {
+          perm[i] = rows[i].row;
+          perm[M + i] = rows[i].len;
+        }
+
+      dest->p[0] = 0;
+
+      for (s = 0; s < nslice; ++s)
+        {
+          const size_t i1 = GSL_MIN(M, (s + 1) * C);
+          const int p0 = dest->p[s];
+          int width = 0;
+
+          for (i = s * C; i < i1; ++i)
+            width = GSL_MAX(width, rows[i].len);
+
+          for (t = 0; t < C; ++t)
+            {
+              int len = 0, col = 0;
+              const ATOMIC * Ad = NULL;
+              const int * Aj = NULL;
+
+              if (s * C + t < M)
+                {
+                  const int row = perm[s * C + t];
+
+                  len = csr->p[row + 1] - csr->p[row];
+                  Aj = csr->i + csr->p[row];
+                  Ad = csr->data + MULTIPLICITY * csr->p[row];
+
+                  if (len > 0)
+                    col = Aj[len - 1];
+                }
+
+              for (k = 0; k < (size_t) width; ++k)
+                {
+                  const size_t idx = p0 + k * C + t;
+
+                  if (k < (size_t) len)
+                    {
+                      dest->i[idx] = Aj[k];
+                      for (q = 0; q < MULTIPLICITY; ++q)
+                        dest->data[MULTIPLICITY * idx + q] = Ad[MULTIPLICITY * k + q];
+                    }
+                  else
+                    {
+                      dest->i[idx] = col;
+                      for (q = 0; q < MULTIPLICITY; ++q)
+                        dest->data[MULTIPLICITY * idx + q] = (ATOMIC) 0;
+                    }
+                }
+            }
+
+          dest->p[s + 1] = p0 + (int) C * width;
+        }
+
+      dest->nz = total;
+
+      free(rows);
+      if (csr != src)
+        FUNCTION (gsl_spmatrix, free) (csr);
+
+      return dest;
+    }
+}
@@ -37,6 +37,11 @@ FUNCTION (gsl_spmatrix, memcpy) (TYPE (gsl_spmatrix) * dest, const TYPE (gsl_spm
       int status = GSL_SUCCESS;
       size_t n, r;
 
+      /* start from an empty tree; appended triplets are copied without
+         building it, and dest keeps the append flag of src */
+      FUNCTION (gsl_spmatrix, set_zero) (dest);
+      dest->spflags |= (src->spflags & GSL_SPMATRIX_FLG_APPEND);
+
       if (dest->nzmax < src->nz)
         {
           status = FUNCTION (gsl_spmatrix, realloc) (src->nz, dest);
@@ -57,6 +62,9 @@ FUNCTION (gsl_spmatrix, memcpy) (TYPE (gsl_spmatrix) * dest, const TYPE (gsl_spm
               for (r = 0; r < MULTIPLICITY; ++r)
                 dest->data[MULTIPLICITY * n + r] = src->data[MULTIPLICITY * n + r];
 
+              if (src->spflags & GSL_SPMATRIX_FLG_APPEND)
+                continue;
+
               /* copy binary tree data */
               ptr = gsl_bst_insert(&dest->data[MULTIPLICITY * n], dest->tree);
               if (ptr != NULL)
@@ -95,6 +103,26 @@ FUNCTION (gsl_spmatrix, memcpy) (TYPE (gsl_spmatrix) * dest, const TYPE (gsl_spm
               dest->p[n] = src->p[n];
             }
         }
+      else if (GSL_SPMATRIX_ISBSR(src) || GSL_SPMATRIX_ISSELL(src))
+        {
+          /* BSR: block row pointers; SELL: slice pointers, row order
+             and row lengths */
+          const size_t nb = (M + src->block_size1 - 1) / src->block_size1;
+          const size_t np = GSL_SPMATRIX_ISBSR(src) ? nb + 1 : nb + 1 + 2 * M;
+          const size_t ni = GSL_SPMATRIX_ISBSR(src) ? (size_t) src->p[nb] : src->nz;
+
+          for (n = 0; n < ni; ++n)
+            dest->i[n] = src->i[n];
+
+          for (n = 0; n < MULTIPLICITY * src->nz; ++n)
+            dest->data[n] = src->data[n];
+
+          for (n = 0; n < np; ++n)
+            dest->p[n] = src->p[n];
+
+          dest->block_size1 = src->block_size1;
+          dest->block_size2 = src->block_size2;
+        }
       else
         {
           GSL_ERROR("invalid matrix type for src", GSL_EINVAL);
@@ -1,8 +1,12 @@
 #include <config.h>
 #include <stddef.h>
+#include <string.h>
+#include <limits.h>
 #include <gsl/gsl_spmatrix.h>
 #include <gsl/gsl_errno.h>
 
+#include "mmap.h"
+
 #define BASE_GSL_COMPLEX_LONG
 #include "templates_on.h"
 #include "file_source.c"
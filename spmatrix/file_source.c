@@ -296,6 +296,11 @@ FUNCTION (gsl_spmatrix, fwrite) (FILE * stream, const TYPE (gsl_spmatrix) * m)
 {
   size_t items;
 
+  if (GSL_SPMATRIX_ISBSR(m) || GSL_SPMATRIX_ISSELL(m))
+    {
+      GSL_ERROR("unsupported sparse matrix type", GSL_EINVAL);
+    }
+
   /* write header: size1, size2, nz */
 
   items = fwrite(&(m->size1), sizeof(size_t), 1, stream);
@@ -364,6 +369,11 @@ FUNCTION (gsl_spmatrix, fread) (FILE * stream, TYPE (gsl_spmatrix) * m)
   size_t size1, size2, nz;
   size_t items;
 
+  if (GSL_SPMATRIX_ISBSR(m) || GSL_SPMATRIX_ISSELL(m))
+    {
+      GSL_ERROR("unsupported sparse matrix type", GSL_EINVAL);
+    }
+
   /* read header: size1, size2, nz */
 
   items = fread(&size1, sizeof(size_t), 1, stream);
@@ -445,3 +455,160 @@ FUNCTION (gsl_spmatrix, fread) (FILE * stream, TYPE (gsl_spmatrix) * m)
 
   return GSL_SUCCESS;
 }
+
+/*
+gsl_spmatrix_fwrite_mmap()
+  Write a CSR or CSC matrix to a file in the binary format read by
+gsl_spmatrix_mmap() (see mmap.h)
+
+Inputs: filename - output file
+        m        - CSR or CSC matrix
+
+Return: success/error
+*/
+
+int
+FUNCTION (gsl_spmatrix, fwrite_mmap) (const char * filename, const TYPE (gsl_spmatrix) * m)
+{
+  if (!GSL_SPMATRIX_ISCSR(m) && !GSL_SPMATRIX_ISCSC(m))
+    {
+      GSL_ERROR("matrix must be in CSR or CSC format", GSL_EINVAL);
+    }
+  else
+    {
+      const size_t outer = GSL_SPMATRIX_ISCSR(m) ? m->size1 : m->size2;
+      const size_t elem_size = MULTIPLICITY * sizeof(ATOMIC);
+      static const unsigned char zero[SPMATRIX_MMAP_ALIGN] = { 0 };
+      unsigned char buf[SPMATRIX_MMAP_HEADER];
+      spmatrix_mmap_header h;
+      size_t pos;
+      int status = 0;
+      FILE *f;
+
+      h.version = SPMATRIX_MMAP_VERSION;
+      h.sptype = m->sptype;
+      h.index_size = sizeof(int);
+      h.elem_size = elem_size;
+      memset(h.type, 0, sizeof(h.type));
+      memcpy(h.type, NAME(gsl_spmatrix), sizeof(NAME(gsl_spmatrix)));
+      h.size1 = m->size1;
+      h.size2 = m->size2;
+      h.nz = m->nz;
+
+      /* each array starts on an aligned offset */
+      h.offset_p = SPMATRIX_MMAP_HEADER;
+      pos = h.offset_p + (outer + 1) * sizeof(int);
+      h.offset_i = (pos + SPMATRIX_MMAP_ALIGN - 1) / SPMATRIX_MMAP_ALIGN * SPMATRIX_MMAP_ALIGN;
+      pos = h.offset_i + m->nz * sizeof(int);
+      h.offset_data = (pos + SPMATRIX_MMAP_ALIGN - 1) / SPMATRIX_MMAP_ALIGN * SPMATRIX_MMAP_ALIGN;
+      h.file_size = h.offset_data + m->nz * elem_size;
+
+      spmatrix_mmap_encode(&h, buf);
+
+      f = fopen(filename, "wb");
+      if (f == NULL)
+        {
+          GSL_ERROR("unable to open file", GSL_EFAILED);
+        }
+
+      status |= fwrite(buf, 1, SPMATRIX_MMAP_HEADER, f) != SPMATRIX_MMAP_HEADER;
+      status |= fwrite(m->p, sizeof(int), outer + 1, f) != outer + 1;
+      pos = h.offset_p + (outer + 1) * sizeof(int);
+      status |= fwrite(zero, 1, h.offset_i - pos, f) != h.offset_i - pos;
+      status |= fwrite(m->i, sizeof(int), m->nz, f) != m->nz;
+      pos = h.offset_i + m->nz * sizeof(int);
+      status |= fwrite(zero, 1, h.offset_data - pos, f) != h.offset_data - pos;
+      status |= fwrite(m->data, elem_size, m->nz, f) != m->nz;
+      status |= fclose(f) != 0;
+
+      if (status)
+        {
+          GSL_ERROR("fwrite failed", GSL_EFAILED);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_spmatrix_mmap()
+  Map a file written by gsl_spmatrix_fwrite_mmap() into memory,
+without copying its arrays
+
+Inputs: filename - input file
+
+Return: CSR or CSC matrix whose i, p and data arrays point into a
+        private mapping of the file, or NULL on error; elements may
+        be modified without changing the file, but the arrays cannot
+        be reallocated. The mapping is released by gsl_spmatrix_free()
+*/
+
+TYPE (gsl_spmatrix) *
+FUNCTION (gsl_spmatrix, mmap) (const char * filename)
+{
+  size_t size;
+  unsigned char *base = spmatrix_mmap_map(filename, &size);
+  spmatrix_mmap_header h;
+  TYPE (gsl_spmatrix) * m;
+  size_t outer;
+
+  if (base == NULL)
+    return NULL;
+
+  if (spmatrix_mmap_decode(base, size, &h) != GSL_SUCCESS)
+    {
+      spmatrix_mmap_unmap(base, size);
+      return NULL;
+    }
+
+  outer = (h.sptype == GSL_SPMATRIX_CSR) ? h.size1 : h.size2;
+
+  if (strcmp(h.type, NAME(gsl_spmatrix)) != 0 ||
+      h.elem_size != MULTIPLICITY * sizeof(ATOMIC))
+    {
+      spmatrix_mmap_unmap(base, size);
+      GSL_ERROR_NULL("file contains a different element type", GSL_EINVAL);
+    }
+  else if (h.index_size != sizeof(int))
+    {
+      spmatrix_mmap_unmap(base, size);
+      GSL_ERROR_NULL("file contains a different index type", GSL_EINVAL);
+    }
+  else if (h.size1 == 0 || h.size2 == 0 || h.nz > INT_MAX ||
+           ((const int *) (base + h.offset_p))[outer] != (int) h.nz)
+    {
+      spmatrix_mmap_unmap(base, size);
+      GSL_ERROR_NULL("corrupt binary sparse matrix file", GSL_EINVAL);
+    }
+
+  m = calloc(1, sizeof(TYPE(gsl_spmatrix)));
+  if (!m)
+    {
+      spmatrix_mmap_unmap(base, size);
+      GSL_ERROR_NULL("failed to allocate space for spmatrix struct", GSL_ENOMEM);
+    }
+
+  m->size1 = h.size1;
+  m->size2 = h.size2;
+  m->nz = h.nz;
+  m->nzmax = h.nz;
+  m->sptype = h.sptype;
+  m->spflags = 0;
+  m->block_size1 = 1;
+  m->block_size2 = 1;
+  m->map = base;
+  m->map_size = size;
+  m->p = (int *) (base + h.offset_p);
+  m->i = (int *) (base + h.offset_i);
+  m->data = (ATOMIC *) (base + h.offset_data);
+
+  m->work.work_void = malloc(GSL_MAX(h.size1, h.size2) * MULTIPLICITY *
+                             GSL_MAX(sizeof(int), sizeof(ATOMIC)));
+  if (!m->work.work_void)
+    {
+      FUNCTION(gsl_spmatrix, free) (m);
+      GSL_ERROR_NULL("failed to allocate space for work", GSL_ENOMEM);
+    }
+
+  return m;
+}
@@ -1,5 +1,6 @@
 #include <config.h>
 #include <stddef.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_spmatrix.h>
 #include <gsl/gsl_bst.h>
 #include <gsl/gsl_errno.h>
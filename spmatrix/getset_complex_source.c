@@ -18,6 +18,7 @@
  */
 
 static void * FUNCTION (tree, find) (const TYPE (gsl_spmatrix) * m, const size_t i, const size_t j);
+static int FUNCTION (block, find) (const TYPE (gsl_spmatrix) * m, const size_t i, const size_t j);
 
 BASE
 FUNCTION (gsl_spmatrix, get) (const TYPE (gsl_spmatrix) * m, const size_t i, const size_t j)
@@ -32,6 +33,10 @@ FUNCTION (gsl_spmatrix, get) (const TYPE (gsl_spmatrix) * m, const size_t i, con
     {
       GSL_ERROR_VAL("second index out of range", GSL_EINVAL, zero);
     }
+  else if (m->spflags & GSL_SPMATRIX_FLG_APPEND)
+    {
+      GSL_ERROR_VAL("matrix has appended triplets, call sum_duplicates first", GSL_EINVAL, zero);
+    }
   else if (m->nz == 0)
     {
       /* no non-zero elements added to matrix */
@@ -72,6 +77,13 @@ FUNCTION (gsl_spmatrix, get) (const TYPE (gsl_spmatrix) * m, const size_t i, con
                 return *(BASE *) &m->data[2 * p];
             }
         }
+      else if (GSL_SPMATRIX_ISBSR(m) || GSL_SPMATRIX_ISSELL(m))
+        {
+          const int p = FUNCTION (block, find) (m, i, j);
+
+          if (p >= 0)
+            return *(BASE *) &m->data[2 * p];
+        }
       else
         {
           GSL_ERROR_VAL("unknown sparse matrix type", GSL_EINVAL, zero);
@@ -94,6 +106,10 @@ FUNCTION (gsl_spmatrix, set) (TYPE (gsl_spmatrix) * m, const size_t i,
     {
       GSL_ERROR ("indices out of range", GSL_EINVAL);
     }
+  else if (m->spflags & GSL_SPMATRIX_FLG_APPEND)
+    {
+      GSL_ERROR("matrix has appended triplets, call sum_duplicates first", GSL_EINVAL);
+    }
   else if (m->spflags & GSL_SPMATRIX_FLG_FIXED)
     {
       /*
@@ -156,6 +172,69 @@ FUNCTION (gsl_spmatrix, set) (TYPE (gsl_spmatrix) * m, const size_t i,
     }
 }
 
+/*
+gsl_spmatrix_append()
+  Append the triplet (i,j,x) to a COO matrix without searching
+or updating the binary tree, so that assembly costs O(1) per
+element. Triplets with the same (i,j) are not merged: they are
+summed when the matrix is converted with gsl_spmatrix_csc(),
+gsl_spmatrix_csr() or gsl_spmatrix_compress(), or by
+gsl_spmatrix_sum_duplicates(). Until then, gsl_spmatrix_get(),
+gsl_spmatrix_set() and gsl_spmatrix_ptr() cannot be used on m.
+
+Inputs: m - COO matrix
+        i - row index
+        j - column index
+        x - value added to element (i,j)
+
+Return: success/error
+*/
+
+int
+FUNCTION (gsl_spmatrix, append) (TYPE (gsl_spmatrix) * m, const size_t i,
+                                 const size_t j, const BASE x)
+{
+  if (!GSL_SPMATRIX_ISCOO(m))
+    {
+      GSL_ERROR("matrix not in COO representation", GSL_EINVAL);
+    }
+  else if (!(m->spflags & GSL_SPMATRIX_FLG_GROW) && (i >= m->size1 || j >= m->size2))
+    {
+      GSL_ERROR ("indices out of range", GSL_EINVAL);
+    }
+  else if (m->spflags & GSL_SPMATRIX_FLG_FIXED)
+    {
+      GSL_ERROR("cannot append to fixed sparsity pattern", GSL_EINVAL);
+    }
+  else
+    {
+      /* the binary tree is no longer maintained */
+      m->spflags |= GSL_SPMATRIX_FLG_APPEND;
+
+      if (m->nz >= m->nzmax)
+        {
+          int status = FUNCTION (gsl_spmatrix, realloc) (2 * m->nzmax, m);
+          if (status)
+            return status;
+        }
+
+      m->i[m->nz] = i;
+      m->p[m->nz] = j;
+      m->data[2 * m->nz] = GSL_REAL (x);
+      m->data[2 * m->nz + 1] = GSL_IMAG (x);
+
+      if (m->spflags & GSL_SPMATRIX_FLG_GROW)
+        {
+          m->size1 = GSL_MAX(m->size1, i + 1);
+          m->size2 = GSL_MAX(m->size2, j + 1);
+        }
+
+      ++(m->nz);
+
+      return GSL_SUCCESS;
+    }
+}
+
 BASE *
 FUNCTION (gsl_spmatrix, ptr) (const TYPE (gsl_spmatrix) * m, const size_t i, const size_t j)
 {
@@ -167,6 +246,10 @@ FUNCTION (gsl_spmatrix, ptr) (const TYPE (gsl_spmatrix) * m, const size_t i, con
     {
       GSL_ERROR_NULL("second index out of range", GSL_EINVAL);
     }
+  else if (m->spflags & GSL_SPMATRIX_FLG_APPEND)
+    {
+      GSL_ERROR_NULL("matrix has appended triplets, call sum_duplicates first", GSL_EINVAL);
+    }
   else
     {
       if (GSL_SPMATRIX_ISCOO(m))
@@ -201,6 +284,13 @@ FUNCTION (gsl_spmatrix, ptr) (const TYPE (gsl_spmatrix) * m, const size_t i, con
                 return (BASE *) &(m->data[2 * p]);
             }
         }
+      else if (GSL_SPMATRIX_ISBSR(m) || GSL_SPMATRIX_ISSELL(m))
+        {
+          const int p = FUNCTION (block, find) (m, i, j);
+
+          if (p >= 0)
+            return (BASE *) &(m->data[2 * p]);
+        }
       else
         {
           GSL_ERROR_NULL("unknown sparse matrix type", GSL_EINVAL);
@@ -246,3 +336,73 @@ FUNCTION (tree, find) (const TYPE (gsl_spmatrix) * m, const size_t i, const size
 
   return NULL;
 }
+
+/*
+block_find()
+  Find the stored element (i,j) of a BSR or SELL matrix. Every
+element of a stored block is stored, while the padding of the
+slices is not
+
+Inputs: m - spmatrix in BSR or SELL format
+        i - row index
+        j - column index
+
+Return: position of the element among the stored elements if found,
+        -1 if not found
+*/
+
+static int
+FUNCTION (block, find) (const TYPE (gsl_spmatrix) * m, const size_t i, const size_t j)
+{
+  const size_t B1 = m->block_size1;
+  const size_t B2 = m->block_size2;
+
+  if (GSL_SPMATRIX_ISBSR(m))
+    {
+      const int J = (int) (j / B2);
+      int lo = m->p[i / B1];
+      int hi = m->p[i / B1 + 1];
+
+      /* the blocks of a block row are in order of block column */
+      while (lo < hi)
+        {
+          const int mid = lo + (hi - lo) / 2;
+
+          if (m->i[mid] < J)
+            lo = mid + 1;
+          else
+            hi = mid;
+        }
+
+      if (lo < m->p[i / B1 + 1] && m->i[lo] == J)
+        return (int) ((size_t) lo * B1 * B2 + (i % B1) * B2 + j % B2);
+    }
+  else
+    {
+      const size_t M = m->size1;
+      const int *perm = m->p + (M + B1 - 1) / B1 + 1;
+      const int *len = perm + M;
+      const size_t t1 = GSL_MIN(M, (i / B2 + 1) * B2);
+      size_t t;
+      int k;
+
+      /* rows are only reordered within their window of sigma rows */
+      for (t = (i / B2) * B2; t < t1; ++t)
+        {
+          if (perm[t] == (int) i)
+            {
+              const size_t idx = m->p[t / B1] + t % B1;
+
+              for (k = 0; k < len[t]; ++k)
+                {
+                  if (m->i[idx + k * B1] == (int) j)
+                    return (int) (idx + k * B1);
+                }
+
+              break;
+            }
+        }
+    }
+
+  return -1;
+}
@@ -0,0 +1,89 @@
+/* spmatrix/gsl_spmatrix64.h
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_SPMATRIX64_H__
+#define __GSL_SPMATRIX64_H__
+
+#include <stdlib.h>
+#include <gsl/gsl_spmatrix.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/*
+ * Sparse matrix of doubles with size_t indices, for matrices with more
+ * than INT_MAX stored elements or dimensions. The COO, CSC and CSR
+ * formats are stored as for gsl_spmatrix (see gsl_spmatrix_double.h).
+ *
+ * There is no binary tree: a COO matrix is assembled with
+ * gsl_spmatrix64_append(), may contain duplicate entries, and is
+ * converted with gsl_spmatrix64_compress(), which sums the duplicates
+ * and sorts the indices of each compressed row or column.
+ */
+
+typedef struct
+{
+  size_t size1;              /* number of rows */
+  size_t size2;              /* number of columns */
+  size_t *i;                 /* COO/CSC: row indices, CSR: column indices, size nzmax */
+  double *data;              /* matrix elements of size nzmax */
+  size_t *p;                 /* COO: column indices, CSC/CSR: column/row pointers */
+  size_t nzmax;              /* maximum number of matrix elements */
+  size_t nz;                 /* number of stored elements */
+  int sptype;                /* GSL_SPMATRIX_COO, GSL_SPMATRIX_CSC or GSL_SPMATRIX_CSR */
+} gsl_spmatrix64;
+
+/* allocation / initialization */
+
+gsl_spmatrix64 * gsl_spmatrix64_alloc (const size_t n1, const size_t n2);
+gsl_spmatrix64 * gsl_spmatrix64_alloc_nzmax (const size_t n1, const size_t n2,
+                                             const size_t nzmax, const int sptype);
+void gsl_spmatrix64_free (gsl_spmatrix64 * m);
+int gsl_spmatrix64_realloc (const size_t nzmax, gsl_spmatrix64 * m);
+size_t gsl_spmatrix64_nnz (const gsl_spmatrix64 * m);
+const char * gsl_spmatrix64_type (const gsl_spmatrix64 * m);
+int gsl_spmatrix64_set_zero (gsl_spmatrix64 * m);
+
+/* get/set */
+
+double gsl_spmatrix64_get (const gsl_spmatrix64 * m, const size_t i, const size_t j);
+int gsl_spmatrix64_append (gsl_spmatrix64 * m, const size_t i, const size_t j, const double x);
+
+/* compress / copy */
+
+gsl_spmatrix64 * gsl_spmatrix64_compress (const gsl_spmatrix64 * src, const int sptype);
+int gsl_spmatrix64_memcpy (gsl_spmatrix64 * dest, const gsl_spmatrix64 * src);
+
+/* conversion to and from 32 bit indices */
+
+gsl_spmatrix64 * gsl_spmatrix64_from_spmatrix (const gsl_spmatrix * src);
+gsl_spmatrix * gsl_spmatrix64_to_spmatrix (const gsl_spmatrix64 * src);
+
+__END_DECLS
+
+#endif /* __GSL_SPMATRIX64_H__ */
@@ -60,6 +60,28 @@ __BEGIN_DECLS
  *   A->p[i] <= n < A->p[i+1]
  * so that row i is stored in
  * [ data[p[i]], data[p[i] + 1], ..., data[p[i+1] - 1] ]
+ *
+ * Block compressed row format (BSR), with blocks of size
+ * B1 = block_size1 by B2 = block_size2:
+ *
+ * Block row I (rows I*B1 to I*B1+B1-1) has the blocks p[I] <= k < p[I+1],
+ * and block k covers the columns i[k]*B2 to i[k]*B2+B2-1. The block is
+ * stored by rows in data[k*B1*B2], ..., data[k*B1*B2 + B1*B2 - 1].
+ * Elements of a block outside of the matrix are zero.
+ *
+ * Sliced ELLPACK format (SELL-C-sigma), with slices of C = block_size1
+ * rows and sorting scope sigma = block_size2:
+ *
+ * Within each group of sigma rows, the rows are stored in order of
+ * decreasing length; stored row r is row p[nslice + 1 + r] of the
+ * matrix and has p[nslice + 1 + size1 + r] elements, where
+ * nslice = ceil(size1 / C). Slice s (stored rows s*C to
+ * s*C+C-1) occupies data[p[s]], ..., data[p[s+1] - 1], column by
+ * column: if W = (p[s+1] - p[s]) / C is the length of its longest row,
+ * the k-th element of stored row s*C+t is data[p[s] + k*C + t], with
+ * column index i[p[s] + k*C + t]. Shorter rows are padded with zeros
+ * (with the column index of the last element of the row), and so are
+ * the stored rows of the last slice beyond size1.
  */
 
 typedef struct
@@ -70,7 +92,8 @@ typedef struct
   /* i (size nzmax) contains:
    *
    * COO/CSC: row indices
-   * CSR: column indices
+   * CSR/SELL: column indices
+   * BSR: block column indices
    */
   int *i;
 
@@ -80,6 +103,8 @@ typedef struct
    * COO: p[n] = column number of element data[n]
    * CSC: p[j] = index in data of first non-zero element in column j
    * CSR: p[i] = index in data of first non-zero element in row i
+   * BSR: p[I] = index in i of first block in block row I
+   * SELL: slice pointers, followed by the row order and lengths (see above)
    */
   int *p;
 
@@ -103,6 +128,10 @@ typedef struct
 
   int sptype;                /* sparse storage type */
   size_t spflags;            /* GSL_SPMATRIX_FLG_xxx */
+  size_t block_size1;        /* BSR: block rows; SELL: slice height C */
+  size_t block_size2;        /* BSR: block columns; SELL: sorting scope sigma */
+  void *map;                 /* file mapping of a gsl_spmatrix_mmap() view, or NULL */
+  size_t map_size;           /* size of the file mapping in bytes */
 } gsl_spmatrix_int;
 
 /*
@@ -126,9 +155,12 @@ int gsl_spmatrix_int_tree_rebuild (gsl_spmatrix_int * m);
 int gsl_spmatrix_int_csc (gsl_spmatrix_int * dest, const gsl_spmatrix_int * src);
 int gsl_spmatrix_int_csr (gsl_spmatrix_int * dest, const gsl_spmatrix_int * src);
 gsl_spmatrix_int * gsl_spmatrix_int_compress (const gsl_spmatrix_int * src, const int sptype);
+gsl_spmatrix_int * gsl_spmatrix_int_compress_bsr (const gsl_spmatrix_int * src, const size_t r, const size_t c);
+gsl_spmatrix_int * gsl_spmatrix_int_compress_sell (const gsl_spmatrix_int * src, const size_t C, const size_t sigma);
 gsl_spmatrix_int * gsl_spmatrix_int_compcol (const gsl_spmatrix_int * src);
 gsl_spmatrix_int * gsl_spmatrix_int_ccs (const gsl_spmatrix_int * src);
 gsl_spmatrix_int * gsl_spmatrix_int_crs (const gsl_spmatrix_int * src);
+int gsl_spmatrix_int_sum_duplicates (gsl_spmatrix_int * m);
 
 /* copy */
 
@@ -140,11 +172,14 @@ int gsl_spmatrix_int_fprintf (FILE * stream, const gsl_spmatrix_int * m, const c
 gsl_spmatrix_int * gsl_spmatrix_int_fscanf (FILE * stream);
 int gsl_spmatrix_int_fwrite (FILE * stream, const gsl_spmatrix_int * m);
 int gsl_spmatrix_int_fread (FILE * stream, gsl_spmatrix_int * m);
+int gsl_spmatrix_int_fwrite_mmap (const char * filename, const gsl_spmatrix_int * m);
+gsl_spmatrix_int * gsl_spmatrix_int_mmap (const char * filename);
 
 /* get/set */
 
 int gsl_spmatrix_int_get (const gsl_spmatrix_int * m, const size_t i, const size_t j);
 int gsl_spmatrix_int_set (gsl_spmatrix_int * m, const size_t i, const size_t j, const int x);
+int gsl_spmatrix_int_append (gsl_spmatrix_int * m, const size_t i, const size_t j, const int x);
 int * gsl_spmatrix_int_ptr (const gsl_spmatrix_int * m, const size_t i, const size_t j);
 
 /* minmax */
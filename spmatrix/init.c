@@ -4,6 +4,8 @@
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_bst.h>
 
+#include "mmap.h"
+
 #define BASE_GSL_COMPLEX_LONG
 #include "templates_on.h"
 #include "init_source.c"
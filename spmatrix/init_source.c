@@ -70,6 +70,8 @@ FUNCTION (gsl_spmatrix, alloc_nzmax) (const size_t n1, const size_t n2,
   m->nz = 0;
   m->nzmax = GSL_MAX(nzmax, 1);
   m->sptype = sptype;
+  m->block_size1 = 1;
+  m->block_size2 = 1;
 
   if (n1 == 1 && n2 == 1)
     m->spflags = GSL_SPMATRIX_FLG_GROW; /* allow matrix size to grow */
@@ -135,6 +137,29 @@ FUNCTION (gsl_spmatrix, alloc_nzmax) (const size_t n1, const size_t n2,
                          GSL_ENOMEM);
         }
     }
+  else if (sptype == GSL_SPMATRIX_BSR)
+    {
+      /* enough block row pointers for any block size */
+      m->p = malloc((n1 + 1) * sizeof(int));
+      if (!m->p)
+        {
+          FUNCTION(gsl_spmatrix, free) (m);
+          GSL_ERROR_NULL("failed to allocate space for block row pointers",
+                         GSL_ENOMEM);
+        }
+    }
+  else if (sptype == GSL_SPMATRIX_SELL)
+    {
+      /* slice pointers for any slice height, the row order and
+         the row lengths */
+      m->p = malloc((3 * n1 + 1) * sizeof(int));
+      if (!m->p)
+        {
+          FUNCTION(gsl_spmatrix, free) (m);
+          GSL_ERROR_NULL("failed to allocate space for slice pointers",
+                         GSL_ENOMEM);
+        }
+    }
 
   m->data = malloc(m->nzmax * MULTIPLICITY * sizeof (ATOMIC));
   if (!m->data)
@@ -150,14 +175,22 @@ FUNCTION (gsl_spmatrix, alloc_nzmax) (const size_t n1, const size_t n2,
 void
 FUNCTION (gsl_spmatrix, free) (TYPE (gsl_spmatrix) * m)
 {
-  if (m->i)
-    free(m->i);
+  if (m->map)
+    {
+      /* i, p and data point into the file mapping */
+      spmatrix_mmap_unmap(m->map, m->map_size);
+    }
+  else
+    {
+      if (m->i)
+        free(m->i);
 
-  if (m->p)
-    free(m->p);
+      if (m->p)
+        free(m->p);
 
-  if (m->data)
-    free(m->data);
+      if (m->data)
+        free(m->data);
+    }
 
   if (m->work.work_void)
     free(m->work.work_void);
@@ -182,6 +215,10 @@ FUNCTION (gsl_spmatrix, realloc) (const size_t nzmax, TYPE (gsl_spmatrix) * m)
     {
       GSL_ERROR("new nzmax is less than current nz", GSL_EINVAL);
     }
+  else if (m->map)
+    {
+      GSL_ERROR("cannot reallocate a mapped matrix", GSL_EINVAL);
+    }
 
   ptr = realloc(m->i, nzmax * sizeof(int));
   if (!ptr)
@@ -208,7 +245,11 @@ FUNCTION (gsl_spmatrix, realloc) (const size_t nzmax, TYPE (gsl_spmatrix) * m)
       GSL_ERROR("failed to allocate space for data", GSL_ENOMEM);
     }
 
-  if (GSL_SPMATRIX_ISCOO(m))
+  /*
+   * with appended triplets the tree is not in use; it is rebuilt, with a
+   * pool of nzmax nodes, by gsl_spmatrix_sum_duplicates()
+   */
+  if (GSL_SPMATRIX_ISCOO(m) && !(m->spflags & GSL_SPMATRIX_FLG_APPEND))
     {
       const size_t nnew = nzmax - m->nz; /* number of new nodes to allocate in memory pool */
       gsl_spmatrix_pool * node;
@@ -273,6 +314,10 @@ FUNCTION (gsl_spmatrix, type) (const TYPE (gsl_spmatrix) * m)
     return "CSR";
   else if (GSL_SPMATRIX_ISCSC(m))
     return "CSC";
+  else if (GSL_SPMATRIX_ISBSR(m))
+    return "BSR";
+  else if (GSL_SPMATRIX_ISSELL(m))
+    return "SELL";
   else
     return "unknown";
 }
@@ -281,6 +326,7 @@ int
 FUNCTION (gsl_spmatrix, set_zero) (TYPE (gsl_spmatrix) * m)
 {
   m->nz = 0;
+  m->spflags &= ~GSL_SPMATRIX_FLG_APPEND;
 
   if (m->tree != NULL)
     {
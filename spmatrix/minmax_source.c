@@ -17,6 +17,102 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+/*
+block_minmax()
+  Find the minimum and maximum elements of a BSR or SELL matrix,
+skipping the parts of the blocks outside of the matrix and the
+padding of the slices
+
+Inputs: m        - spmatrix in BSR or SELL format
+        min_out  - (output) minimum element
+        max_out  - (output) maximum element
+        imin_out - (output) row of minimum element
+        jmin_out - (output) column of minimum element
+
+Return: success/error
+*/
+
+static int
+FUNCTION (block, minmax) (const TYPE (gsl_spmatrix) * m, ATOMIC * min_out, ATOMIC * max_out,
+                          size_t * imin_out, size_t * jmin_out)
+{
+  const size_t M = m->size1;
+  const size_t N = m->size2;
+  const size_t B1 = m->block_size1;
+  const size_t B2 = m->block_size2;
+  ATOMIC min = 0, max = 0;
+  size_t imin = 0, jmin = 0;
+  size_t n = 0; /* number of elements visited */
+
+  if (GSL_SPMATRIX_ISBSR(m))
+    {
+      size_t i, jj;
+      int p;
+
+      for (i = 0; i < M; ++i)
+        {
+          for (p = m->p[i / B1]; p < m->p[i / B1 + 1]; ++p)
+            {
+              const size_t j0 = (size_t) m->i[p] * B2;
+              const size_t nc = GSL_MIN(B2, N - j0);
+              const ATOMIC * x = m->data + (size_t) p * B1 * B2 + (i % B1) * B2;
+
+              for (jj = 0; jj < nc; ++jj, ++n)
+                {
+                  if (n == 0 || x[jj] < min)
+                    {
+                      min = x[jj];
+                      imin = i;
+                      jmin = j0 + jj;
+                    }
+
+                  if (n == 0 || x[jj] > max)
+                    max = x[jj];
+                }
+            }
+        }
+    }
+  else
+    {
+      const int *perm = m->p + (M + B1 - 1) / B1 + 1;
+      const int *len = perm + M;
+      size_t t;
+      int k;
+
+      for (t = 0; t < M; ++t)
+        {
+          const size_t idx = m->p[t / B1] + t % B1;
+
+          for (k = 0; k < len[t]; ++k, ++n)
+            {
+              const ATOMIC x = m->data[idx + k * B1];
+
+              if (n == 0 || x < min)
+                {
+                  min = x;
+                  imin = perm[t];
+                  jmin = m->i[idx + k * B1];
+                }
+
+              if (n == 0 || x > max)
+                max = x;
+            }
+        }
+    }
+
+  if (n == 0)
+    {
+      GSL_ERROR("matrix is empty", GSL_EINVAL);
+    }
+
+  *min_out = min;
+  *max_out = max;
+  *imin_out = imin;
+  *jmin_out = jmin;
+
+  return GSL_SUCCESS;
+}
+
 int
 FUNCTION (gsl_spmatrix, minmax) (const TYPE (gsl_spmatrix) * m,
                                  ATOMIC * min_out, ATOMIC * max_out)
@@ -28,6 +124,16 @@ FUNCTION (gsl_spmatrix, minmax) (const TYPE (gsl_spmatrix) * m,
     {
       GSL_ERROR("matrix is empty", GSL_EINVAL);
     }
+  else if (m->spflags & GSL_SPMATRIX_FLG_APPEND)
+    {
+      GSL_ERROR("matrix has appended triplets, call sum_duplicates first", GSL_EINVAL);
+    }
+
+  if (GSL_SPMATRIX_ISBSR(m) || GSL_SPMATRIX_ISSELL(m))
+    {
+      size_t imin, jmin;
+      return FUNCTION (block, minmax) (m, min_out, max_out, &imin, &jmin);
+    }
 
   min = m->data[0];
   max = m->data[0];
@@ -57,6 +163,10 @@ FUNCTION (gsl_spmatrix, min_index) (const TYPE (gsl_spmatrix) * m,
     {
       GSL_ERROR("matrix is empty", GSL_EINVAL);
     }
+  else if (m->spflags & GSL_SPMATRIX_FLG_APPEND)
+    {
+      GSL_ERROR("matrix has appended triplets, call sum_duplicates first", GSL_EINVAL);
+    }
   else
     {
       ATOMIC * Ad = m->data;
@@ -120,6 +230,11 @@ FUNCTION (gsl_spmatrix, min_index) (const TYPE (gsl_spmatrix) * m,
                 }
             }
         }
+      else if (GSL_SPMATRIX_ISBSR(m) || GSL_SPMATRIX_ISSELL(m))
+        {
+          ATOMIC max;
+          return FUNCTION (block, minmax) (m, &min, &max, imin_out, jmin_out);
+        }
       else
         {
           GSL_ERROR("unknown sparse matrix type", GSL_EINVAL);
@@ -0,0 +1,269 @@
+/* spmatrix/mmap.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Mapping of the binary CSR/CSC files written by
+ * gsl_spmatrix_fwrite_mmap(); see mmap.h for the layout. Where mmap()
+ * is not available the file is read into memory instead. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+
+#include "mmap.h"
+
+static const char spmatrix_mmap_magic[8] = { 'G', 'S', 'L', 'S', 'P', 'M', 'A', 'T' };
+
+static void
+put32 (unsigned char * buf, const size_t offset, const size_t x)
+{
+  const uint32_t v = (uint32_t) x;
+  memcpy (buf + offset, &v, sizeof (v));
+}
+
+static void
+put64 (unsigned char * buf, const size_t offset, const size_t x)
+{
+  const uint64_t v = (uint64_t) x;
+  memcpy (buf + offset, &v, sizeof (v));
+}
+
+static uint32_t
+get32 (const unsigned char * buf, const size_t offset)
+{
+  uint32_t v;
+  memcpy (&v, buf + offset, sizeof (v));
+  return v;
+}
+
+static uint64_t
+get64 (const unsigned char * buf, const size_t offset)
+{
+  uint64_t v;
+  memcpy (&v, buf + offset, sizeof (v));
+  return v;
+}
+
+void
+spmatrix_mmap_encode (const spmatrix_mmap_header * h, unsigned char * buf)
+{
+  memset (buf, 0, SPMATRIX_MMAP_HEADER);
+  memcpy (buf, spmatrix_mmap_magic, sizeof (spmatrix_mmap_magic));
+  put32 (buf, 8, h->version);
+  put32 (buf, 12, 0x01020304);
+  put32 (buf, 16, (size_t) h->sptype);
+  put32 (buf, 20, h->index_size);
+  put32 (buf, 24, h->elem_size);
+  memcpy (buf + 32, h->type, SPMATRIX_MMAP_TYPE);
+  put64 (buf, 96, h->size1);
+  put64 (buf, 104, h->size2);
+  put64 (buf, 112, h->nz);
+  put64 (buf, 120, h->offset_p);
+  put64 (buf, 128, h->offset_i);
+  put64 (buf, 136, h->offset_data);
+  put64 (buf, 144, h->file_size);
+}
+
+/*
+spmatrix_mmap_decode()
+  Read the header of a file of the given size and check that it
+is consistent; the element type is checked by the caller
+*/
+
+int
+spmatrix_mmap_decode (const unsigned char * buf, const size_t size,
+                      spmatrix_mmap_header * h)
+{
+  uint64_t v[7];
+  size_t k;
+
+  if (size < SPMATRIX_MMAP_HEADER ||
+      memcmp (buf, spmatrix_mmap_magic, sizeof (spmatrix_mmap_magic)) != 0)
+    {
+      GSL_ERROR ("not a binary sparse matrix file", GSL_EINVAL);
+    }
+  else if (get32 (buf, 12) != 0x01020304)
+    {
+      GSL_ERROR ("file was written with a different byte order", GSL_EINVAL);
+    }
+  else if (get32 (buf, 8) != SPMATRIX_MMAP_VERSION)
+    {
+      GSL_ERROR ("unsupported file format version", GSL_EINVAL);
+    }
+
+  for (k = 0; k < 7; ++k)
+    {
+      v[k] = get64 (buf, 96 + 8 * k);
+      if (v[k] > (uint64_t) ((size_t) -1))
+        {
+          GSL_ERROR ("matrix too large for this platform", GSL_EINVAL);
+        }
+    }
+
+  h->version = get32 (buf, 8);
+  h->sptype = (int) get32 (buf, 16);
+  h->index_size = get32 (buf, 20);
+  h->elem_size = get32 (buf, 24);
+  memcpy (h->type, buf + 32, SPMATRIX_MMAP_TYPE);
+  h->type[SPMATRIX_MMAP_TYPE - 1] = '\0';
+  h->size1 = (size_t) v[0];
+  h->size2 = (size_t) v[1];
+  h->nz = (size_t) v[2];
+  h->offset_p = (size_t) v[3];
+  h->offset_i = (size_t) v[4];
+  h->offset_data = (size_t) v[5];
+  h->file_size = (size_t) v[6];
+
+  if (h->sptype != GSL_SPMATRIX_CSR && h->sptype != GSL_SPMATRIX_CSC)
+    {
+      GSL_ERROR ("file must contain a CSR or CSC matrix", GSL_EINVAL);
+    }
+  else
+    {
+      const size_t outer = (h->sptype == GSL_SPMATRIX_CSR) ? h->size1 : h->size2;
+      const size_t max = (size_t) -1;
+
+      /* the array sizes must not wrap around in the checks below */
+      if (h->index_size == 0 || h->elem_size == 0 ||
+          outer >= max / h->index_size ||
+          h->nz > max / h->index_size ||
+          h->nz > max / h->elem_size)
+        {
+          GSL_ERROR ("corrupt binary sparse matrix file", GSL_EINVAL);
+        }
+
+      if (h->file_size != size ||
+          h->offset_p % SPMATRIX_MMAP_ALIGN != 0 ||
+          h->offset_i % SPMATRIX_MMAP_ALIGN != 0 ||
+          h->offset_data % SPMATRIX_MMAP_ALIGN != 0 ||
+          h->offset_p < SPMATRIX_MMAP_HEADER ||
+          h->offset_i < h->offset_p ||
+          h->offset_i - h->offset_p < (outer + 1) * h->index_size ||
+          h->offset_data < h->offset_i ||
+          h->offset_data - h->offset_i < h->nz * h->index_size ||
+          h->file_size < h->offset_data ||
+          h->file_size - h->offset_data < h->nz * h->elem_size)
+        {
+          GSL_ERROR ("corrupt binary sparse matrix file", GSL_EINVAL);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+spmatrix_mmap_map()
+  Map a file into memory, privately: the pages can be written, but the
+writes are never carried through to the file
+
+Inputs: filename - file to map
+        size     - (output) size of file in bytes
+
+Return: pointer to the first byte of the file, or NULL on error
+*/
+
+void *
+spmatrix_mmap_map (const char * filename, size_t * size)
+{
+#ifdef HAVE_SYS_MMAN_H
+  struct stat st;
+  void *base;
+  int fd = open (filename, O_RDONLY);
+
+  if (fd < 0)
+    {
+      GSL_ERROR_NULL ("unable to open file", GSL_EFAILED);
+    }
+
+  if (fstat (fd, &st) != 0 || st.st_size < SPMATRIX_MMAP_HEADER)
+    {
+      close (fd);
+      GSL_ERROR_NULL ("not a binary sparse matrix file", GSL_EINVAL);
+    }
+
+  *size = (size_t) st.st_size;
+  base = mmap (NULL, *size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close (fd);
+
+  if (base == MAP_FAILED)
+    {
+      GSL_ERROR_NULL ("mmap failed", GSL_EFAILED);
+    }
+
+  return base;
+#else
+  FILE *f = fopen (filename, "rb");
+  unsigned char *base;
+  long len;
+
+  if (f == NULL)
+    {
+      GSL_ERROR_NULL ("unable to open file", GSL_EFAILED);
+    }
+
+  if (fseek (f, 0, SEEK_END) != 0 || (len = ftell (f)) < SPMATRIX_MMAP_HEADER ||
+      fseek (f, 0, SEEK_SET) != 0)
+    {
+      fclose (f);
+      GSL_ERROR_NULL ("not a binary sparse matrix file", GSL_EINVAL);
+    }
+
+  *size = (size_t) len;
+  base = malloc (*size);
+  if (base == NULL)
+    {
+      fclose (f);
+      GSL_ERROR_NULL ("failed to allocate space for file", GSL_ENOMEM);
+    }
+
+  if (fread (base, 1, *size, f) != *size)
+    {
+      free (base);
+      fclose (f);
+      GSL_ERROR_NULL ("fread failed", GSL_EFAILED);
+    }
+
+  fclose (f);
+
+  return base;
+#endif
+}
+
+/* release a mapping of the given size returned by spmatrix_mmap_map() */
+void
+spmatrix_mmap_unmap (void * base, const size_t size)
+{
+#ifdef HAVE_SYS_MMAN_H
+  munmap (base, size);
+#else
+  (void) size;
+  free (base);
+#endif
+}
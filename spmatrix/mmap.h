@@ -0,0 +1,81 @@
+/* spmatrix/mmap.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_SPMATRIX_MMAP_H__
+#define __GSL_SPMATRIX_MMAP_H__
+
+#include <stddef.h>
+
+/*
+ * Binary CSR/CSC file format read by gsl_spmatrix_mmap(). All values
+ * are in the byte order of the machine which wrote the file; the file
+ * starts with a header of SPMATRIX_MMAP_HEADER bytes:
+ *
+ * offset  size  contents
+ *      0     8  magic "GSLSPMAT"
+ *      8     4  format version (SPMATRIX_MMAP_VERSION)
+ *     12     4  0x01020304, to detect a different byte order
+ *     16     4  storage format (GSL_SPMATRIX_CSR or GSL_SPMATRIX_CSC)
+ *     20     4  size of an index in bytes
+ *     24     4  size of a matrix element in bytes
+ *     28     4  reserved (0)
+ *     32    64  element type, e.g. "gsl_spmatrix" or "gsl_spmatrix_float",
+ *               padded with zeros
+ *     96     8  size1
+ *    104     8  size2
+ *    112     8  nz
+ *    120     8  file offset of the pointer array p
+ *    128     8  file offset of the index array i
+ *    136     8  file offset of the data array
+ *    144     8  file size
+ *    152    40  reserved (0)
+ *
+ * The arrays p (size1 + 1 row pointers for CSR, size2 + 1 column
+ * pointers for CSC), i (nz indices) and data (nz elements) follow, each
+ * starting at a multiple of SPMATRIX_MMAP_ALIGN bytes.
+ */
+
+#define SPMATRIX_MMAP_HEADER   192
+#define SPMATRIX_MMAP_VERSION  2
+#define SPMATRIX_MMAP_ALIGN    64
+#define SPMATRIX_MMAP_TYPE     64   /* size of the element type field */
+
+typedef struct
+{
+  unsigned int version;
+  int sptype;
+  size_t index_size;
+  size_t elem_size;
+  char type[SPMATRIX_MMAP_TYPE];
+  size_t size1;
+  size_t size2;
+  size_t nz;
+  size_t offset_p;
+  size_t offset_i;
+  size_t offset_data;
+  size_t file_size;
+} spmatrix_mmap_header;
+
+void spmatrix_mmap_encode (const spmatrix_mmap_header * h, unsigned char * buf);
+int spmatrix_mmap_decode (const unsigned char * buf, const size_t size,
+                          spmatrix_mmap_header * h);
+void * spmatrix_mmap_map (const char * filename, size_t * size);
+void spmatrix_mmap_unmap (void * base, const size_t size);
+
+#endif /* __GSL_SPMATRIX_MMAP_H__ */
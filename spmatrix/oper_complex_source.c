@@ -20,6 +20,9 @@
 static size_t
 FUNCTION (spmatrix, scatter) (const TYPE (gsl_spmatrix) * A, const size_t j, int * w,
                               ATOMIC * x, const int mark, TYPE (gsl_spmatrix) * C, size_t nz);
+static int
+FUNCTION (spmatrix, add_block) (TYPE (gsl_spmatrix) * c, const TYPE (gsl_spmatrix) * a,
+                                const TYPE (gsl_spmatrix) * b);
 
 int
 FUNCTION (gsl_spmatrix, scale) (TYPE (gsl_spmatrix) * m, const BASE x)
@@ -224,6 +227,10 @@ FUNCTION (gsl_spmatrix, add) (TYPE (gsl_spmatrix) * c, const TYPE (gsl_spmatrix)
     {
       GSL_ERROR("COO format not yet supported", GSL_EINVAL);
     }
+  else if (GSL_SPMATRIX_ISBSR(a) || GSL_SPMATRIX_ISSELL(a))
+    {
+      return FUNCTION (spmatrix, add_block) (c, a, b);
+    }
   else
     {
       int status = GSL_SUCCESS;
@@ -367,6 +374,74 @@ FUNCTION (gsl_spmatrix, dense_add) (TYPE (gsl_matrix) * a, const TYPE (gsl_spmat
                 }
             }
         }
+      else if (GSL_SPMATRIX_ISBSR(b))
+        {
+          const size_t r = b->block_size1;
+          const size_t c = b->block_size2;
+          const size_t nb1 = (M + r - 1) / r;
+          const int * bj = b->i;
+          const int * bp = b->p;
+          size_t I;
+          int k;
+
+          for (I = 0; I < nb1; ++I)
+            {
+              const size_t i0 = I * r;
+              const size_t mr = GSL_MIN(r, M - i0);
+
+              for (k = bp[I]; k < bp[I + 1]; ++k)
+                {
+                  const size_t j0 = bj[k] * c;
+                  const size_t nc = GSL_MIN(c, N - j0);
+                  size_t ii, jj;
+
+                  for (ii = 0; ii < mr; ++ii)
+                    {
+                      for (jj = 0; jj < nc; ++jj)
+                        {
+                          const size_t idx = 2 * ((i0 + ii) * tda_a + j0 + jj);
+                          const size_t n = (size_t) k * r * c + ii * c + jj;
+                          a->data[idx] += bd[2 * n];
+                          a->data[idx + 1] += bd[2 * n + 1];
+                        }
+                    }
+                }
+            }
+        }
+      else if (GSL_SPMATRIX_ISSELL(b))
+        {
+          /* padding elements are zero, and add nothing */
+          const size_t C = b->block_size1;
+          const size_t nslice = (M + C - 1) / C;
+          const int * bj = b->i;
+          const int * bp = b->p;
+          const int * perm = b->p + nslice + 1;
+          size_t s, t, k;
+
+          for (s = 0; s < nslice; ++s)
+            {
+              const size_t p0 = bp[s];
+              const size_t width = (bp[s + 1] - bp[s]) / C;
+              const size_t nt = GSL_MIN(C, M - s * C);
+
+              for (t = 0; t < nt; ++t)
+                {
+                  const size_t row = perm[s * C + t];
+
+                  for (k = 0; k < width; ++k)
+                    {
+                      const size_t n = p0 + k * C + t;
+                      const size_t idx = 2 * (row * tda_a + bj[n]);
+                      a->data[idx] += bd[2 * n];
+                      a->data[idx + 1] += bd[2 * n + 1];
+                    }
+                }
+            }
+        }
+      else
+        {
+          GSL_ERROR("unknown sparse matrix type", GSL_EINVAL);
+        }
 
       return GSL_SUCCESS;
     }
@@ -458,6 +533,10 @@ FUNCTION (gsl_spmatrix, dense_sub) (TYPE (gsl_matrix) * a, const TYPE (gsl_spmat
                 }
             }
         }
+      else
+        {
+          GSL_ERROR("unknown sparse matrix type", GSL_EINVAL);
+        }
 
       return GSL_SUCCESS;
     }
@@ -527,9 +606,11 @@ FUNCTION (gsl_spmatrix, sp2d) (TYPE (gsl_matrix) * A, const TYPE (gsl_spmatrix)
             {
               int i = S->i[n];
               int j = S->p[n];
-              BASE x = *(BASE *) &S->data[2 * n];
+              ATOMIC * a = (ATOMIC *) FUNCTION (gsl_matrix, ptr) (A, i, j);
 
-              FUNCTION (gsl_matrix, set) (A, i, j, x);
+              /* add, so that appended duplicates are summed */
+              a[0] += S->data[2 * n];
+              a[1] += S->data[2 * n + 1];
             }
         }
       else if (GSL_SPMATRIX_ISCSR(S))
@@ -568,6 +649,10 @@ FUNCTION (gsl_spmatrix, sp2d) (TYPE (gsl_matrix) * A, const TYPE (gsl_spmatrix)
                 }
             }
         }
+      else if (GSL_SPMATRIX_ISBSR(S) || GSL_SPMATRIX_ISSELL(S))
+        {
+          return FUNCTION (gsl_spmatrix, dense_add) (A, S);
+        }
       else
         {
           GSL_ERROR("unknown sparse matrix type", GSL_EINVAL);
@@ -634,3 +719,54 @@ FUNCTION (spmatrix, scatter) (const TYPE (gsl_spmatrix) * A, const size_t j, int
 
   return (nz) ;
 }
+
+/*
+spmatrix_add_block()
+  Add two sparse matrices in BSR or SELL format, by way of CSR. The
+sum is stored with the block or slice dimensions of a
+
+Inputs: c - (output) a + b
+        a - (input) sparse matrix
+        b - (input) sparse matrix
+
+Return: success or error
+*/
+
+static int
+FUNCTION (spmatrix, add_block) (TYPE (gsl_spmatrix) * c, const TYPE (gsl_spmatrix) * a,
+                                const TYPE (gsl_spmatrix) * b)
+{
+  TYPE (gsl_spmatrix) * A = FUNCTION (gsl_spmatrix, compress) (a, GSL_SPMATRIX_CSR);
+  TYPE (gsl_spmatrix) * B = FUNCTION (gsl_spmatrix, compress) (b, GSL_SPMATRIX_CSR);
+  TYPE (gsl_spmatrix) * C = NULL;
+  TYPE (gsl_spmatrix) * S = NULL;
+  int status;
+
+  if (A != NULL && B != NULL)
+    C = FUNCTION (gsl_spmatrix, alloc_nzmax) (a->size1, a->size2, A->nz + B->nz, GSL_SPMATRIX_CSR);
+
+  if (C != NULL && FUNCTION (gsl_spmatrix, add) (C, A, B) == GSL_SUCCESS)
+    {
+      if (GSL_SPMATRIX_ISBSR(a))
+        S = FUNCTION (gsl_spmatrix, compress_bsr) (C, a->block_size1, a->block_size2);
+      else
+        S = FUNCTION (gsl_spmatrix, compress_sell) (C, a->block_size1, a->block_size2);
+    }
+
+  if (A != NULL)
+    FUNCTION (gsl_spmatrix, free) (A);
+  if (B != NULL)
+    FUNCTION (gsl_spmatrix, free) (B);
+  if (C != NULL)
+    FUNCTION (gsl_spmatrix, free) (C);
+
+  if (S == NULL)
+    {
+      GSL_ERROR("failed to compute sum", GSL_ENOMEM);
+    }
+
+  status = FUNCTION (gsl_spmatrix, memcpy) (c, S);
+  FUNCTION (gsl_spmatrix, free) (S);
+
+  return status;
+}
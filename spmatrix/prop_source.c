@@ -31,6 +31,10 @@ FUNCTION (gsl_spmatrix, equal) (const TYPE (gsl_spmatrix) * a, const TYPE (gsl_s
     {
       GSL_ERROR_VAL("trying to compare different sparse matrix types", GSL_EINVAL, 0);
     }
+  else if ((a->spflags | b->spflags) & GSL_SPMATRIX_FLG_APPEND)
+    {
+      GSL_ERROR_VAL("matrix has appended triplets, call sum_duplicates first", GSL_EINVAL, 0);
+    }
   else
     {
       const size_t nz = a->nz;
@@ -114,6 +118,39 @@ FUNCTION (gsl_spmatrix, equal) (const TYPE (gsl_spmatrix) * a, const TYPE (gsl_s
                 return 0;
             }
         }
+      else if (GSL_SPMATRIX_ISBSR(a) || GSL_SPMATRIX_ISSELL(a))
+        {
+          /*
+           * for BSR and SELL, both matrices should have the same
+           * block or slice dimensions, and everything in the same order
+           */
+          const size_t nb = (M + a->block_size1 - 1) / a->block_size1;
+          const size_t np = GSL_SPMATRIX_ISBSR(a) ? nb + 1 : nb + 1 + 2 * M;
+          const size_t ni = GSL_SPMATRIX_ISBSR(a) ? (size_t) a->p[nb] : nz;
+
+          if (a->block_size1 != b->block_size1 || a->block_size2 != b->block_size2)
+            return 0;
+
+          /* check block row pointers, or slice pointers, row order and lengths */
+          for (n = 0; n < np; ++n)
+            {
+              if (a->p[n] != b->p[n])
+                return 0;
+            }
+
+          /* check block column or column indices */
+          for (n = 0; n < ni; ++n)
+            {
+              if (a->i[n] != b->i[n])
+                return 0;
+            }
+
+          for (n = 0; n < MULTIPLICITY * nz; ++n)
+            {
+              if (a->data[n] != b->data[n])
+                return 0;
+            }
+        }
       else
         {
           GSL_ERROR_VAL("unknown sparse matrix type", GSL_EINVAL, 0);
@@ -131,7 +168,15 @@ FUNCTION (gsl_spmatrix, norm1) (const TYPE (gsl_spmatrix) * A)
   const size_t N = A->size2;
   ATOMIC value = (ATOMIC) 0;
 
-  if (A->nz == 0)
+  if (GSL_SPMATRIX_ISBSR(A) || GSL_SPMATRIX_ISSELL(A))
+    {
+      GSL_ERROR_VAL("unsupported sparse matrix type", GSL_EINVAL, (ATOMIC) 0);
+    }
+  else if (A->spflags & GSL_SPMATRIX_FLG_APPEND)
+    {
+      GSL_ERROR_VAL("matrix has appended triplets, call sum_duplicates first", GSL_EINVAL, (ATOMIC) 0);
+    }
+  else if (A->nz == 0)
     {
       return (ATOMIC) 0;
     }
@@ -0,0 +1,532 @@
+/* spmatrix/spmatrix64.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spmatrix64.h>
+
+/* number of compressed rows or columns */
+#define SPMATRIX64_OUTER(m) (GSL_SPMATRIX_ISCSR(m) ? (m)->size1 : (m)->size2)
+
+gsl_spmatrix64 *
+gsl_spmatrix64_alloc (const size_t n1, const size_t n2)
+{
+  const double density = 0.1; /* estimate */
+  size_t nzmax = (size_t) floor(n1 * (double) n2 * density);
+
+  if (nzmax == 0)
+    nzmax = 10;
+
+  return gsl_spmatrix64_alloc_nzmax (n1, n2, nzmax, GSL_SPMATRIX_COO);
+}
+
+gsl_spmatrix64 *
+gsl_spmatrix64_alloc_nzmax (const size_t n1, const size_t n2,
+                            const size_t nzmax, const int sptype)
+{
+  gsl_spmatrix64 * m;
+
+  if (n1 == 0)
+    {
+      GSL_ERROR_NULL ("matrix dimension n1 must be positive integer",
+                      GSL_EINVAL);
+    }
+  else if (n2 == 0)
+    {
+      GSL_ERROR_NULL ("matrix dimension n2 must be positive integer",
+                      GSL_EINVAL);
+    }
+  else if (sptype != GSL_SPMATRIX_COO && sptype != GSL_SPMATRIX_CSC &&
+           sptype != GSL_SPMATRIX_CSR)
+    {
+      GSL_ERROR_NULL ("matrix must be in COO, CSC or CSR format", GSL_EINVAL);
+    }
+
+  m = calloc(1, sizeof(gsl_spmatrix64));
+  if (!m)
+    {
+      GSL_ERROR_NULL("failed to allocate space for spmatrix struct",
+                     GSL_ENOMEM);
+    }
+
+  m->size1 = n1;
+  m->size2 = n2;
+  m->nz = 0;
+  m->nzmax = GSL_MAX(nzmax, 1);
+  m->sptype = sptype;
+
+  m->i = malloc(m->nzmax * sizeof(size_t));
+  m->data = malloc(m->nzmax * sizeof(double));
+
+  if (sptype == GSL_SPMATRIX_COO)
+    m->p = malloc(m->nzmax * sizeof(size_t));
+  else
+    m->p = calloc(SPMATRIX64_OUTER(m) + 1, sizeof(size_t));
+
+  if (!m->i || !m->data || !m->p)
+    {
+      gsl_spmatrix64_free (m);
+      GSL_ERROR_NULL("failed to allocate space for matrix arrays",
+                     GSL_ENOMEM);
+    }
+
+  return m;
+}
+
+void
+gsl_spmatrix64_free (gsl_spmatrix64 * m)
+{
+  RETURN_IF_NULL(m);
+
+  free(m->i);
+  free(m->data);
+  free(m->p);
+  free(m);
+}
+
+int
+gsl_spmatrix64_realloc (const size_t nzmax, gsl_spmatrix64 * m)
+{
+  void *ptr;
+
+  if (nzmax < m->nz)
+    {
+      GSL_ERROR("new nzmax is less than current nz", GSL_EINVAL);
+    }
+
+  ptr = realloc(m->i, GSL_MAX(nzmax, 1) * sizeof(size_t));
+  if (!ptr)
+    {
+      GSL_ERROR("failed to allocate space for row indices", GSL_ENOMEM);
+    }
+
+  m->i = (size_t *) ptr;
+
+  if (GSL_SPMATRIX_ISCOO(m))
+    {
+      ptr = realloc(m->p, GSL_MAX(nzmax, 1) * sizeof(size_t));
+      if (!ptr)
+        {
+          GSL_ERROR("failed to allocate space for column indices", GSL_ENOMEM);
+        }
+
+      m->p = (size_t *) ptr;
+    }
+
+  ptr = realloc(m->data, GSL_MAX(nzmax, 1) * sizeof(double));
+  if (!ptr)
+    {
+      GSL_ERROR("failed to allocate space for data", GSL_ENOMEM);
+    }
+
+  m->data = (double *) ptr;
+  m->nzmax = GSL_MAX(nzmax, 1);
+
+  return GSL_SUCCESS;
+}
+
+size_t
+gsl_spmatrix64_nnz (const gsl_spmatrix64 * m)
+{
+  return m->nz;
+}
+
+const char *
+gsl_spmatrix64_type (const gsl_spmatrix64 * m)
+{
+  if (GSL_SPMATRIX_ISCOO(m))
+    return "COO";
+  else if (GSL_SPMATRIX_ISCSR(m))
+    return "CSR";
+  else if (GSL_SPMATRIX_ISCSC(m))
+    return "CSC";
+  else
+    return "unknown";
+}
+
+int
+gsl_spmatrix64_set_zero (gsl_spmatrix64 * m)
+{
+  m->nz = 0;
+
+  if (!GSL_SPMATRIX_ISCOO(m))
+    memset(m->p, 0, (SPMATRIX64_OUTER(m) + 1) * sizeof(size_t));
+
+  return GSL_SUCCESS;
+}
+
+/*
+gsl_spmatrix64_get()
+  Return element (i,j). A COO matrix is searched linearly and its
+duplicate entries are summed, so this is meant for testing rather than
+for use in loops over the matrix.
+*/
+
+double
+gsl_spmatrix64_get (const gsl_spmatrix64 * m, const size_t i, const size_t j)
+{
+  if (i >= m->size1)
+    {
+      GSL_ERROR_VAL("first index out of range", GSL_EINVAL, 0);
+    }
+  else if (j >= m->size2)
+    {
+      GSL_ERROR_VAL("second index out of range", GSL_EINVAL, 0);
+    }
+  else
+    {
+      double x = 0.0;
+      size_t p;
+
+      if (GSL_SPMATRIX_ISCOO(m))
+        {
+          for (p = 0; p < m->nz; ++p)
+            {
+              if (m->i[p] == i && m->p[p] == j)
+                x += m->data[p];
+            }
+        }
+      else if (GSL_SPMATRIX_ISCSC(m))
+        {
+          /* loop over column j and search for row index i */
+          for (p = m->p[j]; p < m->p[j + 1]; ++p)
+            {
+              if (m->i[p] == i)
+                return m->data[p];
+            }
+        }
+      else
+        {
+          /* loop over row i and search for column index j */
+          for (p = m->p[i]; p < m->p[i + 1]; ++p)
+            {
+              if (m->i[p] == j)
+                return m->data[p];
+            }
+        }
+
+      return x;
+    }
+}
+
+int
+gsl_spmatrix64_append (gsl_spmatrix64 * m, const size_t i, const size_t j,
+                       const double x)
+{
+  if (!GSL_SPMATRIX_ISCOO(m))
+    {
+      GSL_ERROR("matrix not in COO representation", GSL_EINVAL);
+    }
+  else if (i >= m->size1 || j >= m->size2)
+    {
+      GSL_ERROR ("indices out of range", GSL_EINVAL);
+    }
+  else
+    {
+      if (m->nz >= m->nzmax)
+        {
+          int status = gsl_spmatrix64_realloc (2 * m->nzmax, m);
+          if (status)
+            return status;
+        }
+
+      m->i[m->nz] = i;
+      m->p[m->nz] = j;
+      m->data[m->nz] = x;
+      ++(m->nz);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_spmatrix64_compress()
+  Convert a COO matrix to CSC or CSR format, or copy a compressed
+matrix. Duplicate COO entries are summed and the indices of each
+compressed column or row are sorted.
+
+The COO triplets are bucket sorted by their inner index (the row for
+CSC) into a temporary array, and then stably by their outer index into
+the result, which leaves each compressed column or row sorted; the
+duplicates are then adjacent and are summed in a final pass. This is
+O(nz + size1 + size2) with no comparisons.
+*/
+
+gsl_spmatrix64 *
+gsl_spmatrix64_compress (const gsl_spmatrix64 * src, const int sptype)
+{
+  gsl_spmatrix64 * dest;
+
+  if (sptype != GSL_SPMATRIX_CSC && sptype != GSL_SPMATRIX_CSR)
+    {
+      GSL_ERROR_NULL ("sptype must be GSL_SPMATRIX_CSC or GSL_SPMATRIX_CSR",
+                      GSL_EINVAL);
+    }
+
+  dest = gsl_spmatrix64_alloc_nzmax (src->size1, src->size2, src->nz, sptype);
+  if (!dest)
+    return NULL;
+
+  if (GSL_SPMATRIX_ISCOO(src))
+    {
+      const int csr = (sptype == GSL_SPMATRIX_CSR);
+      const size_t nouter = csr ? src->size1 : src->size2;
+      const size_t ninner = csr ? src->size2 : src->size1;
+      const size_t *so = csr ? src->i : src->p; /* outer index of each triplet */
+      const size_t *si = csr ? src->p : src->i; /* inner index of each triplet */
+      const size_t nz = src->nz;
+      size_t *tp = calloc(ninner + 1, sizeof(size_t));
+      size_t *to = malloc(GSL_MAX(nz, 1) * sizeof(size_t));
+      double *td = malloc(GSL_MAX(nz, 1) * sizeof(double));
+      size_t *Cp = dest->p;
+      size_t k, n, q;
+
+      if (!tp || !to || !td)
+        {
+          free(tp);
+          free(to);
+          free(td);
+          gsl_spmatrix64_free (dest);
+          GSL_ERROR_NULL ("failed to allocate workspace", GSL_ENOMEM);
+        }
+
+      /* bucket by inner index */
+      for (n = 0; n < nz; ++n)
+        tp[si[n] + 1]++;
+
+      for (k = 0; k < ninner; ++k)
+        tp[k + 1] += tp[k];
+
+      for (n = 0; n < nz; ++n)
+        {
+          q = tp[si[n]]++;
+          to[q] = so[n];
+          td[q] = src->data[n];
+        }
+
+      /* tp[k] is now the end of bucket k, and the start of bucket k+1 */
+
+      /* bucket by outer index, visiting the inner indices in order */
+      for (n = 0; n < nz; ++n)
+        Cp[so[n] + 1]++;
+
+      for (k = 0; k < nouter; ++k)
+        Cp[k + 1] += Cp[k];
+
+      for (k = 0, n = 0; k < ninner; ++k)
+        {
+          for (; n < tp[k]; ++n)
+            {
+              q = Cp[to[n]]++;
+              dest->i[q] = k;
+              dest->data[q] = td[n];
+            }
+        }
+
+      /* Cp[k] is now the end of outer k; sum adjacent duplicates */
+      for (k = 0, n = 0, q = 0; k < nouter; ++k)
+        {
+          const size_t end = Cp[k];
+          const size_t start = q;
+
+          for (; n < end; ++n)
+            {
+              if (q > start && dest->i[q - 1] == dest->i[n])
+                {
+                  dest->data[q - 1] += dest->data[n];
+                }
+              else
+                {
+                  dest->i[q] = dest->i[n];
+                  dest->data[q] = dest->data[n];
+                  ++q;
+                }
+            }
+
+          Cp[k] = start;
+        }
+
+      Cp[nouter] = q;
+      dest->nz = q;
+
+      free(tp);
+      free(to);
+      free(td);
+    }
+  else if (src->sptype == sptype)
+    {
+      gsl_spmatrix64_memcpy (dest, src);
+    }
+  else
+    {
+      gsl_spmatrix64_free (dest);
+      GSL_ERROR_NULL ("source matrix must be COO or of the requested format",
+                      GSL_EINVAL);
+    }
+
+  return dest;
+}
+
+int
+gsl_spmatrix64_memcpy (gsl_spmatrix64 * dest, const gsl_spmatrix64 * src)
+{
+  if (dest->size1 != src->size1 || dest->size2 != src->size2)
+    {
+      GSL_ERROR("matrix sizes are different", GSL_EBADLEN);
+    }
+  else if (dest->sptype != src->sptype)
+    {
+      GSL_ERROR("cannot copy matrices of different storage formats", GSL_EINVAL);
+    }
+  else
+    {
+      const size_t nz = src->nz;
+
+      if (dest->nzmax < nz)
+        {
+          int status = gsl_spmatrix64_realloc (nz, dest);
+          if (status)
+            return status;
+        }
+
+      memcpy(dest->i, src->i, nz * sizeof(size_t));
+      memcpy(dest->data, src->data, nz * sizeof(double));
+
+      if (GSL_SPMATRIX_ISCOO(src))
+        memcpy(dest->p, src->p, nz * sizeof(size_t));
+      else
+        memcpy(dest->p, src->p, (SPMATRIX64_OUTER(src) + 1) * sizeof(size_t));
+
+      dest->nz = nz;
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_spmatrix64_from_spmatrix()
+  Return a copy of the COO, CSC or CSR matrix src with size_t indices.
+Appended (not yet summed) COO triplets are copied as they are.
+*/
+
+gsl_spmatrix64 *
+gsl_spmatrix64_from_spmatrix (const gsl_spmatrix * src)
+{
+  gsl_spmatrix64 * dest;
+  size_t n;
+
+  if (!GSL_SPMATRIX_ISCOO(src) && !GSL_SPMATRIX_ISCSC(src) &&
+      !GSL_SPMATRIX_ISCSR(src))
+    {
+      GSL_ERROR_NULL ("matrix must be in COO, CSC or CSR format", GSL_EINVAL);
+    }
+
+  dest = gsl_spmatrix64_alloc_nzmax (src->size1, src->size2, src->nz, src->sptype);
+  if (!dest)
+    return NULL;
+
+  for (n = 0; n < src->nz; ++n)
+    {
+      dest->i[n] = (size_t) src->i[n];
+      dest->data[n] = src->data[n];
+    }
+
+  if (GSL_SPMATRIX_ISCOO(src))
+    {
+      for (n = 0; n < src->nz; ++n)
+        dest->p[n] = (size_t) src->p[n];
+    }
+  else
+    {
+      const size_t nouter = SPMATRIX64_OUTER(dest);
+
+      for (n = 0; n <= nouter; ++n)
+        dest->p[n] = (size_t) src->p[n];
+    }
+
+  dest->nz = src->nz;
+
+  return dest;
+}
+
+/*
+gsl_spmatrix64_to_spmatrix()
+  Return a copy of src with int indices, or NULL with GSL_EOVRFLW if
+its dimensions or number of elements do not fit into an int. The
+duplicate entries of a COO matrix are summed.
+*/
+
+gsl_spmatrix *
+gsl_spmatrix64_to_spmatrix (const gsl_spmatrix64 * src)
+{
+  gsl_spmatrix * dest;
+  size_t n;
+
+  if (src->size1 > INT_MAX || src->size2 > INT_MAX || src->nz > INT_MAX)
+    {
+      GSL_ERROR_NULL ("matrix too large for int indices", GSL_EOVRFLW);
+    }
+
+  dest = gsl_spmatrix_alloc_nzmax (src->size1, src->size2, src->nz, src->sptype);
+  if (!dest)
+    return NULL;
+
+  if (GSL_SPMATRIX_ISCOO(src))
+    {
+      int status = GSL_SUCCESS;
+
+      /* a 1-by-1 matrix is allowed to grow; this one must not */
+      dest->spflags &= ~GSL_SPMATRIX_FLG_GROW;
+
+      for (n = 0; n < src->nz && !status; ++n)
+        status = gsl_spmatrix_append (dest, src->i[n], src->p[n], src->data[n]);
+
+      if (!status)
+        status = gsl_spmatrix_sum_duplicates (dest);
+
+      if (status)
+        {
+          gsl_spmatrix_free (dest);
+          return NULL;
+        }
+    }
+  else
+    {
+      const size_t nouter = SPMATRIX64_OUTER(src);
+
+      for (n = 0; n < src->nz; ++n)
+        {
+          dest->i[n] = (int) src->i[n];
+          dest->data[n] = src->data[n];
+        }
+
+      for (n = 0; n <= nouter; ++n)
+        dest->p[n] = (int) src->p[n];
+
+      dest->nz = src->nz;
+    }
+
+  return dest;
+}
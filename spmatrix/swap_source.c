@@ -17,9 +17,67 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+/*
+transpose_block()
+  Compute the transpose of a BSR or SELL matrix in the same format:
+r-by-c blocks become c-by-r blocks, and the slice height and sorting
+scope are kept
+
+Inputs: src - spmatrix in BSR or SELL format
+
+Return: pointer to new matrix (should be freed when finished with it)
+*/
+
+static TYPE (gsl_spmatrix) *
+FUNCTION (transpose, block) (const TYPE (gsl_spmatrix) * src)
+{
+  TYPE (gsl_spmatrix) * A = FUNCTION (gsl_spmatrix, compress) (src, GSL_SPMATRIX_CSR);
+  TYPE (gsl_spmatrix) * AT;
+  TYPE (gsl_spmatrix) * dest = NULL;
+
+  if (A == NULL)
+    return NULL;
+
+  AT = FUNCTION (gsl_spmatrix, alloc_nzmax) (src->size2, src->size1, A->nz, GSL_SPMATRIX_CSR);
+  if (AT != NULL && FUNCTION (gsl_spmatrix, transpose_memcpy) (AT, A) == GSL_SUCCESS)
+    {
+      if (GSL_SPMATRIX_ISBSR(src))
+        dest = FUNCTION (gsl_spmatrix, compress_bsr) (AT, src->block_size2, src->block_size1);
+      else
+        dest = FUNCTION (gsl_spmatrix, compress_sell) (AT, src->block_size1, src->block_size2);
+    }
+
+  FUNCTION (gsl_spmatrix, free) (A);
+  if (AT != NULL)
+    FUNCTION (gsl_spmatrix, free) (AT);
+
+  return dest;
+}
+
 int
 FUNCTION (gsl_spmatrix, transpose) (TYPE (gsl_spmatrix) * m)
 {
+  if (GSL_SPMATRIX_ISBSR(m) || GSL_SPMATRIX_ISSELL(m))
+    {
+      TYPE (gsl_spmatrix) * mt = FUNCTION (transpose, block) (m);
+      TYPE (gsl_spmatrix) tmp;
+
+      if (mt == NULL)
+        {
+          GSL_ERROR("failed to compute transpose", GSL_ENOMEM);
+        }
+
+      /* exchange the storage of m and its transpose */
+      tmp = *m;
+      *m = *mt;
+      *mt = tmp;
+      m->spflags = tmp.spflags;
+
+      FUNCTION (gsl_spmatrix, free) (mt);
+
+      return GSL_SUCCESS;
+    }
+
   /* swap dimensions - this must be done before the tree_rebuild step */
   if (m->size1 != m->size2)
     {
@@ -42,7 +100,8 @@ FUNCTION (gsl_spmatrix, transpose) (TYPE (gsl_spmatrix) * m)
 
       /* need to rebuild binary tree, or element searches won't
        * work correctly with transposed indices */
-      FUNCTION (gsl_spmatrix, tree_rebuild) (m);
+      if (!(m->spflags & GSL_SPMATRIX_FLG_APPEND))
+        FUNCTION (gsl_spmatrix, tree_rebuild) (m);
     }
   else if (GSL_SPMATRIX_ISCSC(m))
     {
@@ -83,11 +142,31 @@ FUNCTION (gsl_spmatrix, transpose_memcpy) (TYPE (gsl_spmatrix) * dest, const TYP
       GSL_ERROR("cannot copy matrices of different storage formats",
                 GSL_EINVAL);
     }
+  else if (GSL_SPMATRIX_ISBSR(src) || GSL_SPMATRIX_ISSELL(src))
+    {
+      TYPE (gsl_spmatrix) * srct = FUNCTION (transpose, block) (src);
+      int status;
+
+      if (srct == NULL)
+        {
+          GSL_ERROR("failed to compute transpose", GSL_ENOMEM);
+        }
+
+      status = FUNCTION (gsl_spmatrix, memcpy) (dest, srct);
+      FUNCTION (gsl_spmatrix, free) (srct);
+
+      return status;
+    }
   else
     {
       int status = GSL_SUCCESS;
       const size_t nz = src->nz;
 
+      /* start from an empty tree; appended triplets are copied without
+         building it, and dest keeps the append flag of src */
+      FUNCTION (gsl_spmatrix, set_zero) (dest);
+      dest->spflags |= (src->spflags & GSL_SPMATRIX_FLG_APPEND);
+
       if (dest->nzmax < src->nz)
         {
           status = FUNCTION (gsl_spmatrix, realloc) (src->nz, dest);
@@ -108,6 +187,9 @@ FUNCTION (gsl_spmatrix, transpose_memcpy) (TYPE (gsl_spmatrix) * dest, const TYP
               for (r = 0; r < MULTIPLICITY; ++r)
                 dest->data[MULTIPLICITY * n + r] = src->data[MULTIPLICITY * n + r];
 
+              if (src->spflags & GSL_SPMATRIX_FLG_APPEND)
+                continue;
+
               /* copy binary tree data */
               ptr = gsl_bst_insert(&dest->data[MULTIPLICITY * n], dest->tree);
               if (ptr != NULL)
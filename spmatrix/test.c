@@ -20,15 +20,32 @@
 #include <config.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <math.h>
+#include <stdint.h>
 #include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_spmatrix64.h>
 
 int status = 0;
 
+/* number of errors caught by test_error_handler() */
+static int test_nerror = 0;
+
+static void
+test_error_handler (const char *reason, const char *file, int line, int err)
+{
+  (void) reason;
+  (void) file;
+  (void) line;
+  (void) err;
+  test_nerror++;
+}
+
 #define BASE_GSL_COMPLEX_LONG
 #include "templates_on.h"
 #include "test_complex_source.c"
@@ -113,6 +130,162 @@ int status = 0;
 #include "templates_off.h"
 #undef  BASE_CHAR
 
+/* 1 if the indices of each compressed row or column of A are increasing */
+static int
+test_sorted64 (const gsl_spmatrix64 * A)
+{
+  const size_t nouter = GSL_SPMATRIX_ISCSR(A) ? A->size1 : A->size2;
+  size_t k, p;
+
+  for (k = 0; k < nouter; ++k)
+    {
+      for (p = A->p[k] + 1; p < A->p[k + 1]; ++p)
+        {
+          if (A->i[p - 1] >= A->i[p])
+            return 0;
+        }
+    }
+
+  return 1;
+}
+
+/* 1 if A and B have the same elements */
+static int
+test_equal64 (const gsl_spmatrix * A, const gsl_spmatrix64 * B)
+{
+  size_t i, j;
+
+  for (i = 0; i < A->size1; ++i)
+    {
+      for (j = 0; j < A->size2; ++j)
+        {
+          if (fabs (gsl_spmatrix_get (A, i, j) - gsl_spmatrix64_get (B, i, j)) > 1.0e-12)
+            return 0;
+        }
+    }
+
+  return 1;
+}
+
+static void
+test_spmatrix64 (const size_t M, const size_t N, const double density,
+                 const gsl_rng * r)
+{
+  gsl_spmatrix * A = test_random (M, N, density, -1.0, 1.0, r);
+  gsl_spmatrix * A_csr = gsl_spmatrix_compress (A, GSL_SPMATRIX_CSR);
+  gsl_spmatrix64 * T = gsl_spmatrix64_alloc_nzmax (M, N, 1, GSL_SPMATRIX_COO);
+  gsl_spmatrix64 * B, * C, * D;
+  gsl_spmatrix * E;
+  size_t n;
+
+  /* each element of A as two halves, appended in opposite orders */
+  for (n = 0; n < A->nz; ++n)
+    gsl_spmatrix64_append (T, A->i[n], A->p[n], 0.25 * A->data[n]);
+
+  for (n = A->nz; n-- > 0; )
+    gsl_spmatrix64_append (T, A->i[n], A->p[n], 0.75 * A->data[n]);
+
+  gsl_test (T->nz != 2 * A->nz, "spmatrix64 append M=%zu N=%zu nz", M, N);
+  gsl_test (!test_equal64 (A, T), "spmatrix64 append M=%zu N=%zu", M, N);
+
+  B = gsl_spmatrix64_compress (T, GSL_SPMATRIX_CSR);
+  C = gsl_spmatrix64_compress (T, GSL_SPMATRIX_CSC);
+
+  gsl_test (B->nz != A->nz || !test_sorted64 (B) || !test_equal64 (A, B),
+            "spmatrix64 compress CSR M=%zu N=%zu", M, N);
+  gsl_test (C->nz != A->nz || !test_sorted64 (C) || !test_equal64 (A, C),
+            "spmatrix64 compress CSC M=%zu N=%zu", M, N);
+
+  /* 32 to 64 bit */
+  D = gsl_spmatrix64_from_spmatrix (A_csr);
+  gsl_test (strcmp (gsl_spmatrix64_type (D), "CSR") != 0 || D->nz != A->nz ||
+            !test_equal64 (A, D), "spmatrix64 from_spmatrix CSR M=%zu N=%zu", M, N);
+  gsl_spmatrix64_free (D);
+
+  D = gsl_spmatrix64_from_spmatrix (A);
+  gsl_test (D->nz != A->nz || !test_equal64 (A, D),
+            "spmatrix64 from_spmatrix COO M=%zu N=%zu", M, N);
+  gsl_spmatrix64_free (D);
+
+  /* 64 to 32 bit */
+  E = gsl_spmatrix64_to_spmatrix (C);
+  gsl_test (!GSL_SPMATRIX_ISCSC (E) || E->nz != A->nz || !test_equal64 (E, C),
+            "spmatrix64 to_spmatrix CSC M=%zu N=%zu", M, N);
+  gsl_spmatrix_free (E);
+
+  E = gsl_spmatrix64_to_spmatrix (T);
+  gsl_test (!GSL_SPMATRIX_ISCOO (E) || E->nz != A->nz || !test_equal64 (E, B),
+            "spmatrix64 to_spmatrix COO M=%zu N=%zu", M, N);
+  gsl_spmatrix_free (E);
+
+  /* memcpy and set_zero */
+  D = gsl_spmatrix64_alloc_nzmax (M, N, 1, GSL_SPMATRIX_CSR);
+  gsl_spmatrix64_memcpy (D, B);
+  gsl_test (!test_equal64 (A, D), "spmatrix64 memcpy M=%zu N=%zu", M, N);
+  gsl_spmatrix64_set_zero (D);
+  gsl_test (D->nz != 0 || D->p[M] != 0 || gsl_spmatrix64_get (D, 0, 0) != 0.0,
+            "spmatrix64 set_zero M=%zu N=%zu", M, N);
+  gsl_spmatrix64_free (D);
+
+  gsl_spmatrix_free (A);
+  gsl_spmatrix_free (A_csr);
+  gsl_spmatrix64_free (T);
+  gsl_spmatrix64_free (B);
+  gsl_spmatrix64_free (C);
+}
+
+/* overwrite the 64 bit header field at offset in filename */
+static void
+test_mmap_poke (const char * filename, const long offset, const unsigned long long x)
+{
+  FILE * f = fopen (filename, "r+b");
+  const uint64_t v = (uint64_t) x;
+
+  fseek (f, offset, SEEK_SET);
+  fwrite (&v, sizeof (v), 1, f);
+  fclose (f);
+}
+
+/* gsl_spmatrix_mmap must reject foreign and corrupt files, unmapping
+   them with the size of the file and not the one in the header */
+static void
+test_mmap_corrupt (const gsl_rng * r)
+{
+  const char filename[] = "test_mmap_corrupt.dat";
+  gsl_spmatrix * A = test_random (20, 30, 0.2, 1.0, 20.0, r);
+  gsl_spmatrix * B = gsl_spmatrix_compress (A, GSL_SPMATRIX_CSR);
+  gsl_error_handler_t * handler = gsl_set_error_handler_off ();
+  unsigned char buf[4096];
+  FILE * f;
+
+  /* foreign file claiming a file size of 2^28 bytes */
+  memset (buf, 0, sizeof (buf));
+  f = fopen (filename, "wb");
+  fwrite (buf, 1, sizeof (buf), f);
+  fclose (f);
+  test_mmap_poke (filename, 144, 1ULL << 28);
+  gsl_test (gsl_spmatrix_mmap (filename) != NULL, "spmatrix mmap foreign file");
+
+  /* different element type */
+  gsl_spmatrix_fwrite_mmap (filename, B);
+  gsl_test (gsl_spmatrix_float_mmap (filename) != NULL, "spmatrix mmap element type");
+
+  /* nz * index_size wraps around */
+  test_mmap_poke (filename, 112, 1ULL << 62);
+  gsl_test (gsl_spmatrix_mmap (filename) != NULL, "spmatrix mmap nz overflow");
+
+  /* offset of i before offset of p */
+  gsl_spmatrix_fwrite_mmap (filename, B);
+  test_mmap_poke (filename, 128, 0);
+  gsl_test (gsl_spmatrix_mmap (filename) != NULL, "spmatrix mmap offsets");
+
+  gsl_set_error_handler (handler);
+  unlink (filename);
+
+  gsl_spmatrix_free (A);
+  gsl_spmatrix_free (B);
+}
+
 int
 main (void)
 {
@@ -140,8 +313,12 @@ main (void)
       test_complex_all (M[i], N[i], density[i], r);
       test_complex_float_all (M[i], N[i], density[i], r);
       test_complex_long_double_all (M[i], N[i], density[i], r);
+
+      test_spmatrix64 (M[i], N[i], density[i], r);
     }
 
+  test_mmap_corrupt (r);
+
   gsl_rng_free(r);
 
   exit (gsl_test_summary ());
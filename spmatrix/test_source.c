@@ -796,6 +796,269 @@ FUNCTION (test, io_binary) (const size_t M, const size_t N, const int sptype,
   FUNCTION (gsl_spmatrix, free) (C);
 }
 
+/* write a CSR or CSC matrix (sptype) to a file, map it back and modify
+   the mapped matrix, which must not change the file */
+static void
+FUNCTION (test, io_mmap) (const size_t M, const size_t N, const int sptype,
+                          const double density, gsl_rng * r)
+{
+  TYPE (gsl_spmatrix) * A = FUNCTION (test, random) (M, N, density, 1.0, 20.0, r);
+  TYPE (gsl_spmatrix) * B = FUNCTION (gsl_spmatrix, compress) (A, sptype);
+  TYPE (gsl_spmatrix) * C, * D;
+  char filename[] = "test_mmap.dat";
+  BASE s = (BASE) 2;
+
+  FUNCTION (gsl_spmatrix, fwrite_mmap) (filename, B);
+  C = FUNCTION (gsl_spmatrix, mmap) (filename);
+
+  status = (C == NULL) || FUNCTION (gsl_spmatrix, equal) (B, C) != 1 || C->map == NULL;
+  gsl_test (status, NAME (gsl_spmatrix) "_mmap[%zu,%zu](%s)",
+            M, N, FUNCTION (gsl_spmatrix, type) (B));
+
+  if (C != NULL)
+    {
+      FUNCTION (gsl_spmatrix, scale) (C, s);
+
+      D = FUNCTION (gsl_spmatrix, mmap) (filename);
+      status = (D == NULL) || FUNCTION (gsl_spmatrix, equal) (B, D) != 1;
+
+      FUNCTION (gsl_spmatrix, scale) (B, s);
+      status |= FUNCTION (gsl_spmatrix, equal) (B, C) != 1;
+
+      gsl_test (status, NAME (gsl_spmatrix) "_mmap[%zu,%zu](%s) private writes",
+                M, N, FUNCTION (gsl_spmatrix, type) (B));
+
+      FUNCTION (gsl_spmatrix, free) (C);
+      if (D != NULL)
+        FUNCTION (gsl_spmatrix, free) (D);
+    }
+
+  unlink (filename);
+
+  FUNCTION (gsl_spmatrix, free) (A);
+  FUNCTION (gsl_spmatrix, free) (B);
+}
+
+static void
+FUNCTION (test, block) (const size_t M, const size_t N, const int sptype,
+                        const size_t b1, const size_t b2,
+                        const double density, gsl_rng * r)
+{
+  TYPE (gsl_spmatrix) * A = FUNCTION (test, random) (M, N, density, 1.0, 20.0, r);
+  TYPE (gsl_spmatrix) * B = FUNCTION (gsl_spmatrix, compress) (A, GSL_SPMATRIX_CSR);
+  TYPE (gsl_spmatrix) * C = FUNCTION (gsl_spmatrix, alloc_nzmax) (M, N, 1, sptype);
+  TYPE (gsl_spmatrix) * T = FUNCTION (gsl_spmatrix, alloc_nzmax) (N, M, 1, sptype);
+  TYPE (gsl_matrix) * D = FUNCTION (gsl_matrix, alloc) (M, N);
+  TYPE (gsl_matrix) * E = FUNCTION (gsl_matrix, alloc) (M, N);
+  TYPE (gsl_matrix) * DT = FUNCTION (gsl_matrix, alloc) (N, M);
+  TYPE (gsl_matrix) * ET = FUNCTION (gsl_matrix, alloc) (N, M);
+  int k;
+
+  FUNCTION (gsl_spmatrix, sp2d) (D, A);
+  FUNCTION (gsl_matrix, transpose_memcpy) (DT, D);
+
+  for (k = 0; k < 2; ++k)
+    {
+      const TYPE (gsl_spmatrix) * src = (k == 0) ? A : B;
+      TYPE (gsl_spmatrix) * S;
+      TYPE (gsl_spmatrix) * X;
+      size_t i, j;
+
+      if (sptype == GSL_SPMATRIX_BSR)
+        S = FUNCTION (gsl_spmatrix, compress_bsr) (src, b1, b2);
+      else
+        S = FUNCTION (gsl_spmatrix, compress_sell) (src, b1, b2);
+
+      FUNCTION (gsl_spmatrix, sp2d) (E, S);
+
+      status = FUNCTION (gsl_matrix, equal) (D, E) != 1;
+      gsl_test (status, NAME (gsl_spmatrix) "_compress[%zu,%zu](%s->%s,%zu,%zu)",
+                M, N, FUNCTION (gsl_spmatrix, type) (src),
+                FUNCTION (gsl_spmatrix, type) (S), b1, b2);
+
+      FUNCTION (gsl_spmatrix, memcpy) (C, S);
+      FUNCTION (gsl_spmatrix, sp2d) (E, C);
+
+      status = FUNCTION (gsl_matrix, equal) (D, E) != 1;
+      gsl_test (status, NAME (gsl_spmatrix) "_memcpy[%zu,%zu](%s,%zu,%zu)",
+                M, N, FUNCTION (gsl_spmatrix, type) (S), b1, b2);
+
+      status = FUNCTION (gsl_spmatrix, equal) (C, S) != 1;
+      gsl_test (status, NAME (gsl_spmatrix) "_equal[%zu,%zu](%s,%zu,%zu)",
+                M, N, FUNCTION (gsl_spmatrix, type) (S), b1, b2);
+
+      for (i = 0; i < M; ++i)
+        {
+          for (j = 0; j < N; ++j)
+            FUNCTION (gsl_matrix, set) (E, i, j, FUNCTION (gsl_spmatrix, get) (S, i, j));
+        }
+
+      status = FUNCTION (gsl_matrix, equal) (D, E) != 1;
+      gsl_test (status, NAME (gsl_spmatrix) "_get[%zu,%zu](%s,%zu,%zu)",
+                M, N, FUNCTION (gsl_spmatrix, type) (S), b1, b2);
+
+      X = FUNCTION (gsl_spmatrix, compress) (S, GSL_SPMATRIX_CSR);
+      FUNCTION (gsl_spmatrix, sp2d) (E, X);
+
+      status = FUNCTION (gsl_matrix, equal) (D, E) != 1;
+      gsl_test (status, NAME (gsl_spmatrix) "_csr[%zu,%zu](%s,%zu,%zu)",
+                M, N, FUNCTION (gsl_spmatrix, type) (S), b1, b2);
+
+      /* padding and the parts of blocks outside of the matrix are skipped */
+      {
+        ATOMIC min, max, min_csr, max_csr;
+        size_t imin, jmin;
+
+        FUNCTION (gsl_spmatrix, minmax) (S, &min, &max);
+        FUNCTION (gsl_spmatrix, minmax) (X, &min_csr, &max_csr);
+        FUNCTION (gsl_spmatrix, min_index) (S, &imin, &jmin);
+
+        status = min != min_csr || max != max_csr ||
+                 FUNCTION (gsl_spmatrix, get) (S, imin, jmin) != min;
+        gsl_test (status, NAME (gsl_spmatrix) "_minmax[%zu,%zu](%s,%zu,%zu)",
+                  M, N, FUNCTION (gsl_spmatrix, type) (S), b1, b2);
+      }
+      /* transpose_memcpy, and in place transpose of a copy */
+      FUNCTION (gsl_spmatrix, transpose_memcpy) (T, S);
+      FUNCTION (gsl_spmatrix, sp2d) (ET, T);
+
+      status = FUNCTION (gsl_matrix, equal) (DT, ET) != 1;
+      gsl_test (status, NAME (gsl_spmatrix) "_transpose_memcpy[%zu,%zu](%s,%zu,%zu)",
+                M, N, FUNCTION (gsl_spmatrix, type) (S), b1, b2);
+
+      FUNCTION (gsl_spmatrix, memcpy) (C, S);
+      FUNCTION (gsl_spmatrix, transpose) (C);
+
+      status = C->size1 != N || C->size2 != M ||
+               FUNCTION (gsl_spmatrix, equal) (C, T) != 1;
+      gsl_test (status, NAME (gsl_spmatrix) "_transpose[%zu,%zu](%s,%zu,%zu)",
+                M, N, FUNCTION (gsl_spmatrix, type) (S), b1, b2);
+
+      FUNCTION (gsl_spmatrix, transpose) (C);
+
+      /* C = S + S */
+      FUNCTION (gsl_spmatrix, add) (C, S, S);
+      FUNCTION (gsl_spmatrix, sp2d) (E, C);
+      FUNCTION (gsl_matrix, sub) (E, D);
+
+      status = FUNCTION (gsl_matrix, equal) (D, E) != 1;
+      gsl_test (status, NAME (gsl_spmatrix) "_add[%zu,%zu](%s,%zu,%zu)",
+                M, N, FUNCTION (gsl_spmatrix, type) (S), b1, b2);
+
+      FUNCTION (gsl_spmatrix, free) (S);
+      FUNCTION (gsl_spmatrix, free) (X);
+    }
+
+  FUNCTION (gsl_spmatrix, free) (A);
+  FUNCTION (gsl_spmatrix, free) (B);
+  FUNCTION (gsl_spmatrix, free) (C);
+  FUNCTION (gsl_spmatrix, free) (T);
+  FUNCTION (gsl_matrix, free) (D);
+  FUNCTION (gsl_matrix, free) (E);
+  FUNCTION (gsl_matrix, free) (DT);
+  FUNCTION (gsl_matrix, free) (ET);
+}
+
+/* assemble A from appended triplets, each entry split into two parts */
+static void
+FUNCTION (test, append) (const size_t M, const size_t N, const int sptype,
+                         const double density, gsl_rng * r)
+{
+  TYPE (gsl_spmatrix) * A = FUNCTION (test, random_int) (M, N, density, 1.0, 20.0, r);
+  TYPE (gsl_spmatrix) * B = FUNCTION (gsl_spmatrix, alloc_nzmax) (M, N, 1, GSL_SPMATRIX_COO);
+  TYPE (gsl_spmatrix) * C;
+  TYPE (gsl_matrix) * D = FUNCTION (gsl_matrix, alloc) (M, N);
+  TYPE (gsl_matrix) * E = FUNCTION (gsl_matrix, alloc) (M, N);
+  size_t n;
+  int pass;
+
+  FUNCTION (gsl_spmatrix, sp2d) (D, A);
+
+  /* second parts in reverse order */
+  for (pass = 0; pass < 2; ++pass)
+    {
+      for (n = 0; n < A->nz; ++n)
+        {
+          const size_t k = (pass == 0) ? n : A->nz - 1 - n;
+          const BASE x = A->data[k];
+          const BASE x1 = (BASE) (x / 2);
+
+          FUNCTION (gsl_spmatrix, append) (B, A->i[k], A->p[k], (pass == 0) ? (BASE) (x - x1) : x1);
+        }
+    }
+
+  FUNCTION (gsl_spmatrix, sp2d) (E, B);
+  status = FUNCTION (gsl_matrix, equal) (D, E) != 1;
+  gsl_test (status, NAME (gsl_spmatrix) "_append[%zu,%zu](COO)", M, N);
+
+  if (sptype == GSL_SPMATRIX_COO)
+    {
+      /* the duplicates of B are separate elements, so B is rejected
+         until they are summed */
+      {
+        gsl_error_handler_t * handler = gsl_set_error_handler (&test_error_handler);
+        ATOMIC min, max;
+        size_t imin, jmin;
+
+        test_nerror = 0;
+        FUNCTION (gsl_spmatrix, equal) (A, B);
+        FUNCTION (gsl_spmatrix, equal) (B, A);
+        FUNCTION (gsl_spmatrix, minmax) (B, &min, &max);
+        FUNCTION (gsl_spmatrix, min_index) (B, &imin, &jmin);
+#if !defined(UNSIGNED) && !defined(BASE_CHAR)
+        FUNCTION (gsl_spmatrix, norm1) (B);
+        status = test_nerror != 5;
+#else
+        status = test_nerror != 4;
+#endif
+        gsl_set_error_handler (handler);
+
+        gsl_test (status, NAME (gsl_spmatrix) "_append[%zu,%zu](COO) rejected", M, N);
+      }
+
+      C = FUNCTION (gsl_spmatrix, alloc_nzmax) (M, N, 1, GSL_SPMATRIX_COO);
+      FUNCTION (gsl_spmatrix, memcpy) (C, B);
+      FUNCTION (gsl_spmatrix, sum_duplicates) (C);
+
+      /* get() uses the rebuilt tree */
+      status = FUNCTION (gsl_spmatrix, equal) (A, C) != 1;
+
+      /* copying a matrix with a tree over appended triplets, or over
+         other entries, gives a matrix whose tree can be searched */
+      {
+        TYPE (gsl_spmatrix) * T = FUNCTION (gsl_spmatrix, alloc_nzmax) (N, M, 1, GSL_SPMATRIX_COO);
+
+        FUNCTION (gsl_spmatrix, memcpy) (C, B);
+        FUNCTION (gsl_spmatrix, memcpy) (C, A);
+        status |= FUNCTION (gsl_spmatrix, equal) (A, C) != 1;
+
+        FUNCTION (gsl_spmatrix, transpose_memcpy) (T, B);
+        FUNCTION (gsl_spmatrix, transpose_memcpy) (T, A);
+
+        for (n = 0; n < A->nz; ++n)
+          status |= FUNCTION (gsl_spmatrix, get) (T, A->p[n], A->i[n]) != A->data[n];
+
+        FUNCTION (gsl_spmatrix, free) (T);
+      }
+    }
+  else
+    {
+      C = FUNCTION (gsl_spmatrix, compress) (B, sptype);
+      FUNCTION (gsl_spmatrix, sp2d) (E, C);
+      status = FUNCTION (gsl_matrix, equal) (D, E) != 1;
+    }
+
+  status |= FUNCTION (gsl_spmatrix, nnz) (C) != FUNCTION (gsl_spmatrix, nnz) (A);
+  gsl_test (status, NAME (gsl_spmatrix) "_append[%zu,%zu](%s) duplicates",
+            M, N, FUNCTION (gsl_spmatrix, type) (C));
+
+  FUNCTION (gsl_spmatrix, free) (A);
+  FUNCTION (gsl_spmatrix, free) (B);
+  FUNCTION (gsl_spmatrix, free) (C);
+  FUNCTION (gsl_matrix, free) (D);
+  FUNCTION (gsl_matrix, free) (E);
+}
+
 static void
 FUNCTION (test, all) (const size_t M, const size_t N, const double density, gsl_rng * r)
 {
@@ -853,4 +1116,20 @@ FUNCTION (test, all) (const size_t M, const size_t N, const double density, gsl_
   FUNCTION (test, io_binary) (M, N, GSL_SPMATRIX_COO, density, r);
   FUNCTION (test, io_binary) (M, N, GSL_SPMATRIX_CSC, density, r);
   FUNCTION (test, io_binary) (M, N, GSL_SPMATRIX_CSR, density, r);
+
+  FUNCTION (test, block) (M, N, GSL_SPMATRIX_BSR, 1, 1, density, r);
+  FUNCTION (test, block) (M, N, GSL_SPMATRIX_BSR, 2, 3, density, r);
+  FUNCTION (test, block) (M, N, GSL_SPMATRIX_BSR, 4, 4, density, r);
+
+  FUNCTION (test, block) (M, N, GSL_SPMATRIX_SELL, 1, 1, density, r);
+  FUNCTION (test, block) (M, N, GSL_SPMATRIX_SELL, 4, 1, density, r);
+  FUNCTION (test, block) (M, N, GSL_SPMATRIX_SELL, 4, 16, density, r);
+  FUNCTION (test, block) (M, N, GSL_SPMATRIX_SELL, 8, 8, density, r);
+
+  FUNCTION (test, append) (M, N, GSL_SPMATRIX_COO, density, r);
+  FUNCTION (test, append) (M, N, GSL_SPMATRIX_CSC, density, r);
+  FUNCTION (test, append) (M, N, GSL_SPMATRIX_CSR, density, r);
+
+  FUNCTION (test, io_mmap) (M, N, GSL_SPMATRIX_CSC, density, r);
+  FUNCTION (test, io_mmap) (M, N, GSL_SPMATRIX_CSR, density, r);
 }
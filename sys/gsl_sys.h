@@ -20,6 +20,8 @@
 #ifndef __GSL_SYS_H__
 #define __GSL_SYS_H__
 
+#include <stddef.h>
+
 #undef __BEGIN_DECLS
 #undef __END_DECLS
 #ifdef __cplusplus
@@ -58,6 +60,9 @@ double gsl_frexp(const double x, int * e);
 
 int gsl_fcmp (const double x1, const double x2, const double epsilon);
 
+void gsl_set_num_threads (const size_t n);
+size_t gsl_get_num_threads (void);
+
 __END_DECLS
 
 #endif /* __GSL_SYS_H__ */
@@ -678,5 +678,15 @@ main (void)
     gsl_test_rel (x, 0.5772156649015328606065120900824, 4 * GSL_DBL_EPSILON, "M_EULER");
   }    
 
+  /* Test thread control */
+
+  {
+    gsl_set_num_threads (3);
+    gsl_test_int ((int) gsl_get_num_threads (), 3, "gsl_set_num_threads(3)");
+
+    gsl_set_num_threads (0);
+    gsl_test_int ((int) gsl_get_num_threads (), 1, "gsl_set_num_threads(0)");
+  }
+
   exit (gsl_test_summary ());
 }
@@ -0,0 +1,50 @@
+/* sys/thread.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Number of threads used by the multithreaded routines of the
+ * library.  Threading is opt-in: everything runs on a single thread
+ * unless gsl_set_num_threads() has been called or GSL_NUM_THREADS is
+ * set in the environment, and it is only available when the library
+ * was built with OpenMP. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_sys.h>
+
+/* 0 means not yet initialized from the environment */
+static size_t gsl_nthreads = 0;
+
+void
+gsl_set_num_threads (const size_t n)
+{
+  gsl_nthreads = (n > 0) ? n : 1;
+}
+
+size_t
+gsl_get_num_threads (void)
+{
+  if (gsl_nthreads == 0)
+    {
+      const char *s = getenv ("GSL_NUM_THREADS");
+      const long n = (s != NULL) ? atol (s) : 1;
+      gsl_nthreads = (n > 0) ? (size_t) n : 1;
+    }
+
+  return gsl_nthreads;
+}